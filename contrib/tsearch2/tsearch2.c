@@ -26,19 +26,31 @@ PG_MODULE_MAGIC;
 static Oid	current_dictionary_oid = InvalidOid;
 static Oid	current_parser_oid = InvalidOid;
 
-/* insert given value at argument position 0 */
-#define INSERT_ARGUMENT0(argument, isnull)				\
-	do {												\
-		int i;											\
-		for (i = fcinfo->nargs; i > 0; i--)				\
-		{												\
-			fcinfo->arg[i] = fcinfo->arg[i-1];			\
-			fcinfo->argnull[i] = fcinfo->argnull[i-1];	\
-		}												\
-		fcinfo->arg[0] = (argument);					\
-		fcinfo->argnull[0] = (isnull);					\
-		fcinfo->nargs++;								\
-	} while (0)
+/*
+ * Call func with the given value inserted at argument position 0, ahead of
+ * our own arguments.  The caller's fcinfo has no room for an extra
+ * argument, so the call goes through a copy of it.
+ */
+static Datum
+call_with_argument0(PGFunction func, FunctionCallInfo fcinfo, Datum argument)
+{
+	LOCAL_FCINFO(locfcinfo, FUNC_MAX_ARGS);
+	Datum		result;
+	int			i;
+
+	InitFunctionCallInfoData(*locfcinfo, fcinfo->flinfo, fcinfo->nargs + 1,
+							 fcinfo->fncollation, fcinfo->context,
+							 fcinfo->resultinfo);
+	locfcinfo->args[0].value = argument;
+	locfcinfo->args[0].isnull = false;
+	for (i = 0; i < fcinfo->nargs; i++)
+		locfcinfo->args[i + 1] = fcinfo->args[i];
+
+	result = (*func) (locfcinfo);
+	fcinfo->isnull = locfcinfo->isnull;
+
+	return result;
+}
 
 #define TextGetObjectId(infunction, text) \
 	DatumGetObjectId(DirectFunctionCall1(infunction, \
@@ -181,8 +193,8 @@ tsa_set_curdict_byname(PG_FUNCTION_ARGS)
 Datum
 tsa_token_type_current(PG_FUNCTION_ARGS)
 {
-	INSERT_ARGUMENT0(ObjectIdGetDatum(GetCurrentParser()), false);
-	return ts_token_type_byid(fcinfo);
+	return call_with_argument0(ts_token_type_byid, fcinfo,
+							   ObjectIdGetDatum(GetCurrentParser()));
 }
 
 /* set_curprs(int) */
@@ -220,8 +232,8 @@ tsa_set_curprs_byname(PG_FUNCTION_ARGS)
 Datum
 tsa_parse_current(PG_FUNCTION_ARGS)
 {
-	INSERT_ARGUMENT0(ObjectIdGetDatum(GetCurrentParser()), false);
-	return ts_parse_byid(fcinfo);
+	return call_with_argument0(ts_parse_byid, fcinfo,
+							   ObjectIdGetDatum(GetCurrentParser()));
 }
 
 /* set_curcfg(int) */
@@ -92,6 +92,7 @@ brinhandler(PG_FUNCTION_ARGS)
 	amroutine->amstorage = true;
 	amroutine->amclusterable = false;
 	amroutine->ampredlocks = false;
+	amroutine->amcanparallel = false;
 	amroutine->amkeytype = InvalidOid;
 
 	amroutine->ambuild = brinbuild;
@@ -111,6 +112,9 @@ brinhandler(PG_FUNCTION_ARGS)
 	amroutine->amendscan = brinendscan;
 	amroutine->ammarkpos = NULL;
 	amroutine->amrestrpos = NULL;
+	amroutine->amestimateparallelscan = NULL;
+	amroutine->aminitparallelscan = NULL;
+	amroutine->amparallelrescan = NULL;
 
 	PG_RETURN_POINTER(amroutine);
 }
@@ -459,17 +463,11 @@ bringetbitmap(IndexScanDesc scan, TIDBitmap *tbm)
 		/* add the pages in the range to the output bitmap, if needed */
 		if (addrange)
 		{
-			BlockNumber pageno;
-
-			for (pageno = heapBlk;
-				 pageno <= heapBlk + opaque->bo_pagesPerRange - 1;
-				 pageno++)
-			{
-				MemoryContextSwitchTo(oldcxt);
-				tbm_add_page(tbm, pageno);
-				totalpages++;
-				MemoryContextSwitchTo(perRangeCxt);
-			}
+			MemoryContextSwitchTo(oldcxt);
+			tbm_add_page_range(tbm, heapBlk,
+							   heapBlk + opaque->bo_pagesPerRange - 1);
+			totalpages += opaque->bo_pagesPerRange;
+			MemoryContextSwitchTo(perRangeCxt);
 		}
 	}
 
@@ -1000,6 +1000,51 @@ slot_deform_tuple(TupleTableSlot *slot, int natts)
 
 	tp = (char *) tup + tup->t_hoff;
 
+	/*
+	 * On the first call, run the slot's deform program over the leading
+	 * fixed-width attributes, up to the first null one.  Their offsets don't
+	 * depend on the tuple, so the generic loop below can take over with
+	 * attcacheoff still usable.
+	 */
+	if (attnum == 0 && slot->tts_deform != NULL)
+	{
+		TupleDeformProgram *prog = slot->tts_deform;
+		int			nsteps = Min(natts, prog->nsteps);
+
+		for (; attnum < nsteps; attnum++)
+		{
+			TupleDeformStep *step = &prog->steps[attnum];
+			char	   *ptr = tp + step->off;
+
+			if (hasnulls && att_isnull(attnum, bp))
+				break;
+
+			isnull[attnum] = false;
+
+			switch (step->kind)
+			{
+				case TDK_CHAR:
+					values[attnum] = CharGetDatum(*ptr);
+					break;
+				case TDK_INT16:
+					values[attnum] = Int16GetDatum(*((int16 *) ptr));
+					break;
+				case TDK_INT32:
+					values[attnum] = Int32GetDatum(*((int32 *) ptr));
+					break;
+				case TDK_DATUM:
+					values[attnum] = *((Datum *) ptr);
+					break;
+				case TDK_BYREF:
+					values[attnum] = PointerGetDatum(ptr);
+					break;
+			}
+		}
+
+		if (attnum > 0)
+			off = prog->steps[attnum - 1].end;
+	}
+
 	for (; attnum < natts; attnum++)
 	{
 		Form_pg_attribute thisatt = att[attnum];
@@ -1059,6 +1104,65 @@ slot_deform_tuple(TupleTableSlot *slot, int natts)
 	slot->tts_slow = slow;
 }
 
+/*
+ * slot_build_deform_program
+ *		Build the deform program for tuples of the given descriptor, for use
+ *		by slot_deform_tuple.  The result is palloc'd in the current memory
+ *		context.  Returns NULL if the descriptor doesn't start with a
+ *		fixed-width attribute, in which case there is nothing to precompute.
+ */
+TupleDeformProgram *
+slot_build_deform_program(TupleDesc tupleDesc)
+{
+	Form_pg_attribute *att = tupleDesc->attrs;
+	int			natts = tupleDesc->natts;
+	TupleDeformProgram *prog;
+	long		off = 0;
+	int			attnum;
+
+	prog = (TupleDeformProgram *)
+		palloc(offsetof(TupleDeformProgram, steps) +
+			   natts * sizeof(TupleDeformStep));
+
+	for (attnum = 0; attnum < natts; attnum++)
+	{
+		Form_pg_attribute thisatt = att[attnum];
+		TupleDeformStep *step = &prog->steps[attnum];
+
+		if (thisatt->attlen <= 0)
+			break;
+
+		/* This must match fetch_att() */
+		if (!thisatt->attbyval)
+			step->kind = TDK_BYREF;
+		else if (thisatt->attlen == (int) sizeof(Datum))
+			step->kind = TDK_DATUM;
+		else if (thisatt->attlen == (int) sizeof(int32))
+			step->kind = TDK_INT32;
+		else if (thisatt->attlen == (int) sizeof(int16))
+			step->kind = TDK_INT16;
+		else if (thisatt->attlen == 1)
+			step->kind = TDK_CHAR;
+		else
+			break;
+
+		off = att_align_nominal(off, thisatt->attalign);
+		step->off = off;
+		off += thisatt->attlen;
+		step->end = off;
+	}
+
+	if (attnum == 0)
+	{
+		pfree(prog);
+		return NULL;
+	}
+
+	prog->nsteps = attnum;
+
+	return prog;
+}
+
 /*
  * slot_getattr
  *		This function fetches an attribute of the slot's current tuple.
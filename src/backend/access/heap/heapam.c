@@ -1380,7 +1380,9 @@ heap_openrv_extended(const RangeVar *relation, LOCKMODE lockmode,
  * heap_beginscan_bm is an alternative entry point for setting up a
  * HeapScanDesc for a bitmap heap scan.  Although that scan technology is
  * really quite unlike a standard seqscan, there is just enough commonality
- * to make it worth using the same data structure.
+ * to make it worth using the same data structure.  A bulk-read strategy is
+ * set up for large tables as for a seqscan, but it is up to the caller to
+ * use it only where the bitmap scan is in fact reading sequentially.
  *
  * heap_beginscan_sampling is an alternative entry point for setting up a
  * HeapScanDesc for a TABLESAMPLE scan.  As with bitmap scans, it's worth
@@ -1422,7 +1424,7 @@ heap_beginscan_bm(Relation relation, Snapshot snapshot,
 				  int nkeys, ScanKey key)
 {
 	return heap_beginscan_internal(relation, snapshot, nkeys, key, NULL,
-								   false, false, true, true, false, false);
+								   true, false, true, true, false, false);
 }
 
 HeapScanDesc
@@ -1,6 +1,7 @@
 
 #include "postgres.h"
 
+#include "access/heapam.h"
 #include "access/reloptions.h"
 #include "access/relscan.h"
 #include "access/xact.h"
@@ -33,8 +34,12 @@
 #include "utils/index_selfuncs.h"
 
 #include "miscadmin.h"
+#include "optimizer/plancat.h"
 #include "pgstat.h"
 #include "fmgr.h"
+#include "funcapi.h"
+#include "utils/acl.h"
+#include "utils/builtins.h"
 #include "ewok.h"
 
 #define SORT_TYPE int16
@@ -62,6 +67,7 @@ hippohandler(PG_FUNCTION_ARGS)
 	amroutine->amstorage = true;
 	amroutine->amclusterable = false;
 	amroutine->ampredlocks = false;
+	amroutine->amcanparallel = true;
 	amroutine->amkeytype = InvalidOid;
 
 	amroutine->ambuild = hippobuild;
@@ -81,6 +87,9 @@ hippohandler(PG_FUNCTION_ARGS)
 	amroutine->amendscan = hippoendscan;
 	amroutine->ammarkpos = NULL;
 	amroutine->amrestrpos = NULL;
+	amroutine->amestimateparallelscan = hippoestimateparallelscan;
+	amroutine->aminitparallelscan = hippoinitparallelscan;
+	amroutine->amparallelrescan = hippoparallelrescan;
 
 	PG_RETURN_POINTER(amroutine);
 }
@@ -104,11 +113,12 @@ hippobuildCallback(Relation index,
 	thisblock = ItemPointerGetBlockNumber(&htup->t_self);
 	ereport(DEBUG2,(errmsg("[hippobuildCallback] Retrieved necessary from buildstate")));
 	ereport(DEBUG2,(errmsg("[hippobuildCallback] first histogram bound is %d",DatumGetInt32(histogramBounds[0]))));
-	if(buildstate->hp_PageNum==0)
+	if(buildstate->hp_scanpage==0)
 	{
 		ereport(DEBUG2,(errmsg("[hippobuildCallback] Initialize the buildstate for first page")));
 		/*
-		 * We are working on the first index tuple.
+		 * We are working on the first index tuple. Don't go by hp_PageNum, which is still 0 when the first tuple of block 1
+		 * arrives, so that block 0 would be dropped from the first index entry.
 		 */
 		buildstate->hp_PageStart=thisblock;
 		buildstate->hp_currentPage=thisblock;
@@ -400,11 +410,13 @@ IndexBuildResult *hippobuild(Relation heap, Relation index, IndexInfo *indexInfo
 	 */
 	SortedListInialize(index,buildstate,histogramBoundsNum/HISTOGRAM_PER_PAGE+1);
 
-	terminate_hippo_buildstate(buildstate);
 	/*
 	 * Return statistics
 	 */
 	result = (IndexBuildResult *) palloc(sizeof(IndexBuildResult));
+	result->heap_tuples=reltuples;
+	result->index_tuples=buildstate->hp_indexnumtuples;
+	terminate_hippo_buildstate(buildstate);
 	ereport(DEBUG1,(errmsg("[hippobuild] stop")));
 	return result;
 }
@@ -1070,7 +1082,7 @@ int64 hippogetbitmap(IndexScanDesc scan, TIDBitmap *tbm)
 	bool matchFlag=false;
 	bool scankeymatchflag=false;
 	int totalPages=0;
-	int i,j,counter,k;
+	int i,counter,k;
 	int histogramBoundsNum;
 	Datum *histogramBounds;
 	ScanKey keys=scan->keyData;
@@ -1111,7 +1123,24 @@ int64 hippogetbitmap(IndexScanDesc scan, TIDBitmap *tbm)
 	scanstate.histogramBoundsNum=histogramBoundsNum;
 	histogramPages=histogramBoundsNum/HISTOGRAM_PER_PAGE;
 	get_sorted_list_pages(idxRel,&sorted_list_pages,histogramPages+1);
-	scanstate.currentLookupBuffer=ReadBuffer(scan->indexRelation,sorted_list_pages+histogramPages+1);
+	scanstate.firstEntryPage=sorted_list_pages+histogramPages+1;
+	scanstate.nBlocks=RelationGetNumberOfBlocks(idxRel);
+	scanstate.length=0;
+	/*
+	 * In a parallel scan, only look at the entry pages this backend manages to claim.
+	 */
+	if(scan->parallel_scan!=NULL)
+	{
+		scanstate.currentLookupPageNum=hippo_parallel_next_page(scan,scanstate.firstEntryPage);
+	}
+	else
+	{
+		scanstate.currentLookupPageNum=scanstate.firstEntryPage;
+	}
+	scanstate.scanHasNext=scanstate.currentLookupPageNum<scanstate.nBlocks;
+	if(scanstate.scanHasNext==true)
+	{
+	scanstate.currentLookupBuffer=ReadBuffer(scan->indexRelation,scanstate.currentLookupPageNum);
 	if(scanstate.currentLookupBuffer==NULL)
 	{
 		elog(ERROR,"[hippogetbitmap] Read NULL buffer");
@@ -1124,16 +1153,15 @@ int64 hippogetbitmap(IndexScanDesc scan, TIDBitmap *tbm)
 	}
 	diskTuple=(IndexTuple)PageGetItem(page,PageGetItemId(page,1));
 	scanstate.maxOffset=PageGetMaxOffsetNumber(page);
-	scanstate.currentLookupPageNum=sorted_list_pages+histogramPages+1;
 	scanstate.currentOffset=1;
 	scanstate.currentDiskTuple=diskTuple;
-	scanstate.length=0;
-	scanstate.scanHasNext=true;
-	bool test[nkeys][histogramBoundsNum];
-	bool gridtest[nkeys][histogramBoundsNum];
+	}
+	bool gridtest[nkeys][histogramBoundsNum+2];
 
 	/*
 	 * Check whether one histogram bound satisfies scankeys. It is true only under this circumstance that this bound satisfies all the keys.
+	 * Besides the grids between the bounds, grid histogramBoundsNum holds the values below the first bound and grid histogramBoundsNum+1
+	 * the values above the last one, as binary_search_histogram_ondisk maps them.
 	 */
 	/*
 	 * Iterate scan key to find matched grids
@@ -1146,38 +1174,55 @@ int64 hippogetbitmap(IndexScanDesc scan, TIDBitmap *tbm)
 		 */
 			searchResult histogramMatchData;
 			binary_search_histogram_ondisk(&histogramMatchData,idxRel,DatumGetInt32(keys[k].sk_argument),0,histogramBoundsNum);
-			if(histogramMatchData.index==HISTOGRAM_OUT_OF_BOUNDARY)
+			for(i=0;i<=histogramBoundsNum+1;i++)
 			{
-				for(i=0;i<=histogramBoundsNum-1;i++)
-				{
-					gridtest[k][i]=false;
-				}
+				gridtest[k][i]=false;
 			}
-			else
+			if(histogramMatchData.index==HISTOGRAM_OUT_OF_BOUNDARY)
 			{
-			if(keys[k].sk_strategy==1 || keys[k].sk_strategy==2)
+				/* nothing matches */
+			}
+			else if(keys[k].sk_strategy==1 || keys[k].sk_strategy==2)
 			{
-				for(i=0;i<=histogramMatchData.index;i++)
+				/*
+				 * Everything below the argument: the grids up to its own, and the values below the first bound
+				 */
+				if(histogramMatchData.index==histogramBoundsNum+1)
 				{
-					gridtest[k][i]=true;
+					for(i=0;i<=histogramBoundsNum+1;i++)
+					{
+						gridtest[k][i]=true;
+					}
 				}
-				for(i=histogramMatchData.index+1;i<=histogramBoundsNum-1;i++)
+				else if(histogramMatchData.index<histogramBoundsNum)
 				{
-					gridtest[k][i]=false;
+					for(i=0;i<=histogramMatchData.index;i++)
+					{
+						gridtest[k][i]=true;
+					}
 				}
-
+				gridtest[k][histogramBoundsNum]=true;
 			}
 			else if(keys[k].sk_strategy==5 || keys[k].sk_strategy==4)
 			{
-				for(i=0;i<histogramMatchData.index;i++)
+				/*
+				 * Everything above the argument: the grids from its own on, and the values above the last bound
+				 */
+				if(histogramMatchData.index==histogramBoundsNum)
 				{
-					gridtest[k][i]=false;
+					for(i=0;i<=histogramBoundsNum+1;i++)
+					{
+						gridtest[k][i]=true;
+					}
 				}
-				for(i=histogramMatchData.index;i<=histogramBoundsNum-1;i++)
+				else if(histogramMatchData.index<histogramBoundsNum)
 				{
-					gridtest[k][i]=true;
+					for(i=histogramMatchData.index;i<=histogramBoundsNum-1;i++)
+					{
+						gridtest[k][i]=true;
+					}
 				}
-			}
+				gridtest[k][histogramBoundsNum+1]=true;
 			}
 			ereport(DEBUG1,(errmsg("[hippogetbitmap][handle inequality operator] stop")));
 	}
@@ -1187,11 +1232,9 @@ int64 hippogetbitmap(IndexScanDesc scan, TIDBitmap *tbm)
 		/*
 		 * Handle the case that strategy number is 3 which means "equal" like id = 100
 		 */
-		int data=DatumGetInt32(keys[k].sk_argument);
 		searchResult histogramMatchData;
 		binary_search_histogram_ondisk(&histogramMatchData,idxRel,DatumGetInt32(keys[k].sk_argument),0,histogramBoundsNum);
-		gridtest[k][histogramMatchData.index]=true;
-		for(i=0;i<=histogramBoundsNum-1;i++)
+		for(i=0;i<=histogramBoundsNum+1;i++)
 		{
 			gridtest[k][i]=false;
 		}
@@ -1203,7 +1246,7 @@ int64 hippogetbitmap(IndexScanDesc scan, TIDBitmap *tbm)
 	}
 	}
 	gridBitset=bitmap_new();
-	for(i=0;i<=histogramBoundsNum-1;i++)
+	for(i=0;i<=histogramBoundsNum+1;i++)
 	{
 		scankeymatchflag=gridtest[0][i];
 		for(k=0;k<nkeys;k++)
@@ -1227,8 +1270,12 @@ int64 hippogetbitmap(IndexScanDesc scan, TIDBitmap *tbm)
 	nblocks = RelationGetNumberOfBlocks(idxRel);
 	scanstate.nBlocks=nblocks;
 	index_close(heapRel, AccessShareLock);
-	hippoGetNextIndexTuple(scan);
-	do{
+	if(scanstate.scanHasNext==true)
+	{
+		hippoGetNextIndexTuple(scan);
+	}
+	while(scanstate.scanHasNext==true)
+	{
 		ereport(DEBUG1,(errmsg("[hippogetbitmap]Got the partial histogram of query predicate")));
 		hippoTupleLong.hp_PageStart=0;
 		hippoTupleLong.hp_PageNum=0;
@@ -1242,11 +1289,8 @@ int64 hippogetbitmap(IndexScanDesc scan, TIDBitmap *tbm)
 		{
 			if(bitmap_get(hippoTupleLong.originalBitset,predicateGrids[i])==true)
 			{
-				for(j=hippoTupleLong.hp_PageStart;j<=hippoTupleLong.hp_PageNum;j++)
-				{
-					tbm_add_page(tbm,j);
-					totalPages++;
-				}
+				tbm_add_page_range(tbm,hippoTupleLong.hp_PageStart,hippoTupleLong.hp_PageNum);
+				totalPages+=hippoTupleLong.hp_PageNum-hippoTupleLong.hp_PageStart+1;
 				break;
 			}
 		}
@@ -1254,8 +1298,7 @@ int64 hippogetbitmap(IndexScanDesc scan, TIDBitmap *tbm)
 		bitmap_free(hippoTupleLong.originalBitset);
 		hippoGetNextIndexTuple(scan);
 		counter++;
-		}
-	while(scanstate.scanHasNext==true);
+	}
 	ereport(DEBUG1,(errmsg("[hippogetbitmap] stop")));
 	return (totalPages * 10);
 }
@@ -1267,6 +1310,31 @@ hippoendscan(IndexScanDesc scan)
 	ereport(DEBUG1,(errmsg("[hippoendscan] do nothing")));
 }
 
+/*
+ * Parallel scan support. See HippoParallelScanDescData.
+ */
+Size
+hippoestimateparallelscan(void)
+{
+	return sizeof(HippoParallelScanDescData);
+}
+
+void
+hippoinitparallelscan(void *target)
+{
+	HippoParallelScanDesc hippoTarget=(HippoParallelScanDesc) target;
+	pg_atomic_init_u32(&hippoTarget->nextEntryPage,0);
+}
+
+void
+hippoparallelrescan(IndexScanDesc scan)
+{
+	HippoParallelScanDesc hippoScan;
+	Assert(scan->parallel_scan!=NULL);
+	hippoScan=(HippoParallelScanDesc) ((char *) scan->parallel_scan+scan->parallel_scan->ps_offset);
+	pg_atomic_write_u32(&hippoScan->nextEntryPage,0);
+}
+
 void
 hippo_redo(XLogReaderState *record)
 {
@@ -1324,3 +1392,193 @@ hippooptions(Datum reloptions, bool validate)
 	return (bytea *) rdopts;
 }
 
+
+/*
+ * SQL-callable function hippo_estimate_count(index, low, high)
+ *
+ * Estimate the number of rows whose key lies in [low, high] using only the index: every
+ * entry knows which histogram buckets occur somewhere in its page range. An entry none
+ * of whose buckets overlap the range can't contain a match, so only entries with some
+ * overlapping bucket count towards upper_bound, at MaxHeapTuplesPerPage rows per heap
+ * page. That makes upper_bound a hard limit. The other two columns are estimates, using
+ * the tuples per heap page the planner would assume: lower_estimate counts the rows of
+ * entries all of whose buckets lie inside the range, and expected assumes an entry's
+ * tuples are spread evenly over its buckets and a bucket's values evenly over its range,
+ * which is what the equi-depth histogram promises. There is no hard lower limit, since
+ * deleting rows leaves the buckets of an entry set.
+ */
+Datum
+hippo_estimate_count(PG_FUNCTION_ARGS)
+{
+	Oid			indexoid = PG_GETARG_OID(0);
+	int64		low = PG_GETARG_INT64(1);
+	int64		high = PG_GETARG_INT64(2);
+	Oid			heapoid;
+	Relation	heapRel;
+	Relation	idxRel;
+	TupleDesc	tupdesc;
+	Datum		values[3];
+	bool		nulls[3];
+	BlockNumber heapPages;
+	double		heapTuples;
+	double		allvisfrac;
+	double		tupleDensity;
+	double		lowerEstimate=0;
+	double		upperBound=0;
+	double		expected=0;
+	double		*bucketFraction;
+	int			histogramBoundsNum;
+	BlockNumber histogramPages;
+	BlockNumber sorted_list_pages;
+	BlockNumber nblocks;
+	BlockNumber blk;
+	int			i;
+
+	if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+		elog(ERROR, "return type must be a row type");
+
+	/*
+	 * Lock the table before the index, as brin_summarize_new_values does.
+	 */
+	heapoid = IndexGetRelation(indexoid, true);
+	if (OidIsValid(heapoid))
+		heapRel = heap_open(heapoid, AccessShareLock);
+	else
+		heapRel = NULL;
+
+	idxRel = index_open(indexoid, AccessShareLock);
+
+	if (idxRel->rd_rel->relkind != RELKIND_INDEX ||
+		idxRel->rd_rel->relam != HIPPO_AM_OID)
+		ereport(ERROR,
+				(errcode(ERRCODE_WRONG_OBJECT_TYPE),
+				 errmsg("\"%s\" is not a HIPPO index",
+						RelationGetRelationName(idxRel))));
+
+	if (heapRel == NULL || heapoid != IndexGetRelation(indexoid, false))
+		ereport(ERROR,
+				(errcode(ERRCODE_UNDEFINED_TABLE),
+				 errmsg("could not open parent table of index %s",
+						RelationGetRelationName(idxRel))));
+
+	/* The answer reveals the table's contents, so require SELECT on it */
+	if (pg_class_aclcheck(heapoid, GetUserId(), ACL_SELECT) != ACLCHECK_OK)
+		aclcheck_error(ACLCHECK_NO_PRIV, ACL_KIND_CLASS,
+					   RelationGetRelationName(heapRel));
+
+	/*
+	 * Work out tuples per heap page as the planner does, so that a table that has
+	 * grown since its last VACUUM or ANALYZE, or never had one, still gets a figure.
+	 */
+	estimate_rel_size(heapRel,NULL,&heapPages,&heapTuples,&allvisfrac);
+	if (heapPages > 0)
+		tupleDensity=heapTuples/heapPages;
+	else
+		tupleDensity=0;
+
+	histogramBoundsNum=get_histogram_totalNumber(idxRel,0);
+	histogramPages=histogramBoundsNum/HISTOGRAM_PER_PAGE;
+	get_sorted_list_pages(idxRel,&sorted_list_pages,histogramPages+1);
+	nblocks=RelationGetNumberOfBlocks(idxRel);
+
+	/*
+	 * Fraction of each bucket's values that fall into [low, high]. Grid i < n-1 holds
+	 * [bound i, bound i+1), grid n-1 only the last bound itself, and the two overflow
+	 * grids n and n+1 whatever lies below the first or above the last bound. Since the
+	 * overflow grids are unbounded, count them as half covered unless the range misses
+	 * them entirely.
+	 */
+	bucketFraction=(double *) palloc0((histogramBoundsNum+2)*sizeof(double));
+	if (low <= high && histogramBoundsNum > 0)
+	{
+		int64		firstBound=get_histogram(idxRel,0,0);
+		int64		lastBound=get_histogram(idxRel,0,histogramBoundsNum-1);
+		int64		bucketLow=firstBound;
+
+		for(i=0;i<histogramBoundsNum;i++)
+		{
+			int64		bucketHigh;
+			int64		overlapLow;
+			int64		overlapHigh;
+
+			if (i<histogramBoundsNum-1)
+				bucketHigh=(int64) get_histogram(idxRel,0,i+1)-1;
+			else
+				bucketHigh=bucketLow;
+			overlapLow=Max(bucketLow,low);
+			overlapHigh=Min(bucketHigh,high);
+			if (bucketHigh>=bucketLow && overlapHigh>=overlapLow)
+				bucketFraction[i]=(double) (overlapHigh-overlapLow+1)/(double) (bucketHigh-bucketLow+1);
+			bucketLow=bucketHigh+1;
+		}
+		if (low<firstBound)
+			bucketFraction[histogramBoundsNum]=0.5;
+		if (high>lastBound)
+			bucketFraction[histogramBoundsNum+1]=0.5;
+	}
+
+	/*
+	 * Walk all the entries, in the same order as hippogetbitmap does.
+	 */
+	for(blk=sorted_list_pages+histogramPages+1;blk<nblocks;blk++)
+	{
+		Buffer		buffer;
+		Page		page;
+		OffsetNumber maxOffset;
+		OffsetNumber off;
+
+		CHECK_FOR_INTERRUPTS();
+
+		buffer=ReadBuffer(idxRel,blk);
+		LockBuffer(buffer,BUFFER_LOCK_SHARE);
+		page=BufferGetPage(buffer);
+		maxOffset=PageGetMaxOffsetNumber(page);
+		for(off=FirstOffsetNumber;off<=maxOffset;off++)
+		{
+			HippoTupleLong hippoTupleLong;
+			Size		itemsz;
+			double		entryPages;
+			double		fractionSum=0;
+			int			bucketNum=0;
+			bool		allInside=true;
+
+			hippo_form_memtuple(&hippoTupleLong,(IndexTuple) PageGetItem(page,PageGetItemId(page,off)),&itemsz);
+			entryPages=hippoTupleLong.hp_PageNum-hippoTupleLong.hp_PageStart+1;
+			for(i=0;i<histogramBoundsNum+2;i++)
+			{
+				if(bitmap_get(hippoTupleLong.originalBitset,i)==true)
+				{
+					bucketNum++;
+					fractionSum+=bucketFraction[i];
+					if(bucketFraction[i]<1.0)
+					{
+						allInside=false;
+					}
+				}
+			}
+			if(fractionSum>0)
+			{
+				upperBound+=entryPages*MaxHeapTuplesPerPage;
+				expected+=entryPages*tupleDensity*fractionSum/bucketNum;
+				if(allInside==true)
+				{
+					lowerEstimate+=entryPages*tupleDensity;
+				}
+			}
+			ewah_free(hippoTupleLong.compressedBitset);
+			bitmap_free(hippoTupleLong.originalBitset);
+		}
+		UnlockReleaseBuffer(buffer);
+	}
+	pfree(bucketFraction);
+
+	index_close(idxRel, AccessShareLock);
+	heap_close(heapRel, AccessShareLock);
+
+	values[0]=Int64GetDatum((int64) rint(lowerEstimate));
+	values[1]=Int64GetDatum((int64) rint(upperBound));
+	values[2]=Float8GetDatum(expected);
+	memset(nulls,0,sizeof(nulls));
+
+	PG_RETURN_DATUM(HeapTupleGetDatum(heap_form_tuple(tupdesc,values,nulls)));
+}
@@ -520,7 +520,7 @@ void binary_search_histogram(searchResult *histogramMatchData,int histogramBound
 		/*
 		 * Got an overflow data. It is smaller than the lower bound. Total number is the id.
 		 */
-		histogramMatchData->index=max;
+		histogramMatchData->index=histogramBoundsNum;
 		ereport(DEBUG1,(errmsg("[binary_search_histogram] histogramBounds[min] is %d value is %d", (int)histogramBounds[min]),DatumGetInt32(value)));
 		ereport(DEBUG1,(errmsg("[binary_search_histogram] stop")));
 		return;
@@ -847,6 +847,16 @@ void hippo_form_memtuple(HippoTupleLong *hippoTupleLong,IndexTuple diskTuple,Siz
 	originalBitset=ewah_to_bitmap(compressedBitset);
 	hippoTupleLong->originalBitset=originalBitset;
 }
+/*
+ * Claim the next entry page of a parallel scan. Returns a page number past the end of
+ * the index once all of them have been claimed.
+ */
+BlockNumber hippo_parallel_next_page(IndexScanDesc scan,BlockNumber firstEntryPage)
+{
+	HippoParallelScanDesc hippoScan=(HippoParallelScanDesc) ((char *) scan->parallel_scan+scan->parallel_scan->ps_offset);
+	return firstEntryPage+pg_atomic_fetch_add_u32(&hippoScan->nextEntryPage,1);
+}
+
 /*
  * This function is to retrieve one Hippo index entry from disk
  */
@@ -874,7 +884,14 @@ void hippoGetNextIndexTuple(IndexScanDesc scan)
 	}
 	else{
 	UnlockReleaseBuffer(scanstate->currentLookupBuffer);//, BUFFER_LOCK_UNLOCK);
-	scanstate->currentLookupPageNum++;
+	if(scan->parallel_scan!=NULL)
+	{
+		scanstate->currentLookupPageNum=hippo_parallel_next_page(scan,scanstate->firstEntryPage);
+	}
+	else
+	{
+		scanstate->currentLookupPageNum++;
+	}
 	if(scanstate->currentLookupPageNum<scanstate->nBlocks)
 	{
 		buffer=ReadBuffer(scan->indexRelation,scanstate->currentLookupPageNum);
@@ -125,6 +125,13 @@ RelationGetIndexScan(Relation indexRelation, int nkeys, int norderbys)
 	scan->xs_cbuf = InvalidBuffer;
 	scan->xs_continue_hot = false;
 
+	scan->xs_prefetch_distance = 0;		/* may be set later */
+	scan->xs_prefetch_block = InvalidBlockNumber;
+	scan->xs_prefetch_vmbuffer = InvalidBuffer;
+	scan->xs_prefetch_count = 0;
+
+	scan->parallel_scan = NULL;
+
 	return scan;
 }
 
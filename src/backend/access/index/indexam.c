@@ -20,9 +20,14 @@
  *		index_insert	- insert an index tuple into a relation
  *		index_markpos	- mark a scan position
  *		index_restrpos	- restore a scan position
+ *		index_parallelscan_estimate - estimate shared memory for parallel scan
+ *		index_parallelscan_initialize - initialize parallel scan
+ *		index_parallelrescan  - (re)start a parallel scan of an index
+ *		index_parallelscan_attach - join a parallel scan of an index
  *		index_getnext_tid	- get the next TID from a scan
  *		index_fetch_heap		- get the scan's next heap tuple
  *		index_getnext	- get the next heap tuple from a scan
+ *		index_prefetch_heap - prefetch the heap block of an upcoming TID
  *		index_getbitmap - get all tuples from a scan
  *		index_bulk_delete	- bulk deletion of index tuples
  *		index_vacuum_cleanup	- post-deletion cleanup of an index
@@ -68,6 +73,7 @@
 #include "access/amapi.h"
 #include "access/relscan.h"
 #include "access/transam.h"
+#include "access/visibilitymap.h"
 #include "access/xlog.h"
 #include "catalog/catalog.h"
 #include "catalog/index.h"
@@ -335,6 +341,13 @@ index_endscan(IndexScanDesc scan)
 		scan->xs_cbuf = InvalidBuffer;
 	}
 
+	/* ... or on a visibility map page */
+	if (BufferIsValid(scan->xs_prefetch_vmbuffer))
+	{
+		ReleaseBuffer(scan->xs_prefetch_vmbuffer);
+		scan->xs_prefetch_vmbuffer = InvalidBuffer;
+	}
+
 	/* End the AM's scan */
 	scan->indexRelation->rd_amroutine->amendscan(scan);
 
@@ -389,6 +402,110 @@ index_restrpos(IndexScanDesc scan)
 	scan->indexRelation->rd_amroutine->amrestrpos(scan);
 }
 
+/*
+ * index_parallelscan_estimate - estimate shared memory for parallel scan
+ *
+ * Currently, we don't pass any information to the AM-specific estimator,
+ * so it can probably only return a constant.  In the future, we might need
+ * to pass more information.
+ */
+Size
+index_parallelscan_estimate(Relation indexRelation, Snapshot snapshot)
+{
+	Size		nbytes;
+
+	RELATION_CHECKS;
+
+	nbytes = offsetof(ParallelIndexScanDescData, ps_snapshot_data);
+	nbytes = add_size(nbytes, EstimateSnapshotSpace(snapshot));
+	nbytes = MAXALIGN(nbytes);
+
+	/*
+	 * If amestimateparallelscan is not provided, assume there is no
+	 * AM-specific data needed.  (It's hard to believe that could work, but
+	 * it's easy enough to cater to it here.)
+	 */
+	if (indexRelation->rd_amroutine->amestimateparallelscan != NULL)
+		nbytes = add_size(nbytes,
+					  indexRelation->rd_amroutine->amestimateparallelscan());
+
+	return nbytes;
+}
+
+/*
+ * index_parallelscan_initialize - initialize parallel scan
+ *
+ * We initialize both the ParallelIndexScanDesc proper and the AM-specific
+ * information which follows it.
+ *
+ * This function calls access method specific initialization routine to
+ * initialize am specific information.  Call this just once in the leader
+ * process; then, individual workers attach via index_parallelscan_attach.
+ */
+void
+index_parallelscan_initialize(Relation heapRelation, Relation indexRelation,
+							  Snapshot snapshot, ParallelIndexScanDesc target)
+{
+	Size		offset;
+
+	RELATION_CHECKS;
+
+	offset = add_size(offsetof(ParallelIndexScanDescData, ps_snapshot_data),
+					  EstimateSnapshotSpace(snapshot));
+	offset = MAXALIGN(offset);
+
+	target->ps_relid = RelationGetRelid(heapRelation);
+	target->ps_indexid = RelationGetRelid(indexRelation);
+	target->ps_offset = offset;
+	SerializeSnapshot(snapshot, target->ps_snapshot_data);
+
+	/* aminitparallelscan is optional; assume no-op if not provided by AM */
+	if (indexRelation->rd_amroutine->aminitparallelscan != NULL)
+	{
+		void	   *amtarget;
+
+		amtarget = (char *) target + offset;
+		indexRelation->rd_amroutine->aminitparallelscan(amtarget);
+	}
+}
+
+/* ----------------
+ *		index_parallelrescan  - (re)start a parallel scan of an index
+ *
+ * Only the leader may call this, and only while no worker is attached to
+ * the shared state.
+ * ----------------
+ */
+void
+index_parallelrescan(IndexScanDesc scan)
+{
+	SCAN_CHECKS;
+
+	/* amparallelrescan is optional; assume no-op if not provided by AM */
+	if (scan->indexRelation->rd_amroutine->amparallelrescan != NULL)
+		scan->indexRelation->rd_amroutine->amparallelrescan(scan);
+}
+
+/* ----------------
+ *		index_parallelscan_attach - join a parallel scan of an index
+ *
+ * The scan must have been started with index_beginscan or
+ * index_beginscan_bitmap using the snapshot that was serialized into the
+ * shared descriptor; from now on the AM divides the work among all the
+ * scans attached to the same descriptor.
+ * ----------------
+ */
+void
+index_parallelscan_attach(IndexScanDesc scan, ParallelIndexScanDesc pscan)
+{
+	SCAN_CHECKS;
+
+	Assert(RelationGetRelid(scan->indexRelation) == pscan->ps_indexid);
+	Assert(scan->indexRelation->rd_amroutine->amcanparallel);
+
+	scan->parallel_scan = pscan;
+}
+
 /* ----------------
  * index_getnext_tid - get the next TID from a scan
  *
@@ -570,6 +687,37 @@ index_getnext(IndexScanDesc scan, ScanDirection direction)
 	return NULL;				/* failure exit */
 }
 
+/* ----------------
+ *		index_prefetch_heap - prefetch the heap block of an upcoming TID
+ *
+ * An index AM that knows which TIDs it is going to return next can call this
+ * from amgettuple, if the caller set xs_prefetch_distance, so that the heap
+ * pages are read in while the caller is busy with the current ones.  In an
+ * index-only scan, blocks that are all-visible won't be visited at all, so
+ * we don't prefetch those.
+ * ----------------
+ */
+void
+index_prefetch_heap(IndexScanDesc scan, ItemPointer tid)
+{
+#ifdef USE_PREFETCH
+	BlockNumber blkno = ItemPointerGetBlockNumber(tid);
+
+	/* consecutive TIDs often share a block; don't ask for it again */
+	if (blkno == scan->xs_prefetch_block)
+		return;
+	scan->xs_prefetch_block = blkno;
+
+	if (scan->xs_want_itup &&
+		VM_ALL_VISIBLE(scan->heapRelation, blkno,
+					   &scan->xs_prefetch_vmbuffer))
+		return;
+
+	PrefetchBuffer(scan->heapRelation, MAIN_FORKNUM, blkno);
+	scan->xs_prefetch_count++;
+#endif   /* USE_PREFETCH */
+}
+
 /* ----------------
  *		index_getbitmap - get all tuples at once from an index scan
  *
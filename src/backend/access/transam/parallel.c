@@ -24,7 +24,10 @@
 #include "libpq/pqmq.h"
 #include "miscadmin.h"
 #include "optimizer/planmain.h"
+#include "pgstat.h"
 #include "storage/ipc.h"
+#include "storage/proc.h"
+#include "storage/shmem.h"
 #include "storage/sinval.h"
 #include "storage/spin.h"
 #include "tcop/tcopprot.h"
@@ -32,6 +35,7 @@
 #include "utils/guc.h"
 #include "utils/inval.h"
 #include "utils/memutils.h"
+#include "utils/ps_status.h"
 #include "utils/resowner.h"
 #include "utils/snapmgr.h"
 
@@ -86,6 +90,61 @@ typedef struct FixedParallelState
 	XLogRecPtr	last_xlog_end;
 } FixedParallelState;
 
+/*
+ * Parallel worker pool.
+ *
+ * Starting a parallel worker means forking a new background worker, which
+ * must then connect to the database and build its caches from scratch before
+ * it can do any useful work.  For short parallel queries that can cost more
+ * than the parallelism saves.  To avoid it, a worker registered while
+ * parallel_worker_pool_size is nonzero may be given a slot in the pool.  Such
+ * a worker doesn't exit when its parallel operation is complete; instead, it
+ * stays connected to its database and waits for a later leader, running in
+ * the same database as the same authenticated user, to hand it the handle of
+ * a new dynamic shared memory segment.  Reusing it then costs no more than
+ * attaching to the segment and restoring the leader's state.
+ *
+ * The leader that assigns a job to a pooled worker can't wait for the worker
+ * to exit before finishing its transaction, so it waits for the worker to
+ * give the job back instead.  The worker does that only once it has left the
+ * leader's lock group and detached from the segment.  Errors still cause the
+ * worker to exit, as for an unpooled worker.
+ */
+typedef enum
+{
+	POOL_SLOT_FREE,				/* no worker */
+	POOL_SLOT_IDLE,				/* worker waiting for a job */
+	POOL_SLOT_BUSY				/* job assigned to worker */
+} ParallelWorkerPoolSlotState;
+
+typedef struct ParallelWorkerPoolSlot
+{
+	ParallelWorkerPoolSlotState state;
+	bool		exit_requested; /* idle worker should exit */
+	bool		handle_valid;	/* bgw_slot and bgw_generation are set */
+	int			bgw_slot;		/* exported background worker handle */
+	uint64		bgw_generation;
+	PGPROC	   *proc;			/* worker, once it has started */
+	Oid			database_id;	/* database the worker is connected to */
+	Oid			authenticated_user_id;	/* and the user it runs as */
+	uint64		job;			/* incremented for each job assigned */
+	PGPROC	   *leader;			/* backend that assigned the current job */
+	dsm_handle	segment;		/* segment for the current job */
+	int			worker_number;	/* worker number for the current job */
+} ParallelWorkerPoolSlot;
+
+typedef struct ParallelWorkerPoolData
+{
+	slock_t		mutex;			/* protects all slots */
+	int			nslots;
+	ParallelWorkerPoolSlot slot[FLEXIBLE_ARRAY_MEMBER];
+} ParallelWorkerPoolData;
+
+/* GUC variable */
+int			parallel_worker_pool_size = 0;
+
+static ParallelWorkerPoolData *ParallelWorkerPool;
+
 /*
  * Our parallel worker number.  We initialize this to -1, meaning that we are
  * not a parallel worker.  In parallel workers, it will be set to a value >= 0
@@ -103,6 +162,16 @@ bool		InitializingParallelWorker = false;
 /* Pointer to our fixed parallel state. */
 static FixedParallelState *MyFixedParallelState;
 
+/* Our pool slot, if we are a pooled parallel worker. */
+static ParallelWorkerPoolSlot *MyPoolSlot = NULL;
+
+/* Segment of our current job, and whether we've attached its error queue. */
+static dsm_segment *MyJobSegment = NULL;
+static bool MyJobErrorQueueAttached = false;
+
+/* Flag set by signal handler for pooled parallel workers. */
+static volatile sig_atomic_t got_SIGHUP = false;
+
 /* List of active parallel contexts. */
 static dlist_head pcxt_list = DLIST_STATIC_INIT(pcxt_list);
 
@@ -110,7 +179,22 @@ static dlist_head pcxt_list = DLIST_STATIC_INIT(pcxt_list);
 static void HandleParallelMessage(ParallelContext *pcxt, int i, StringInfo msg);
 static void ParallelExtensionTrampoline(dsm_segment *seg, shm_toc *toc);
 static void ParallelWorkerMain(Datum main_arg);
+static void ParallelWorkerRunJob(dsm_handle segment, int worker_number,
+					 bool *connected);
+static void ParallelWorkerEndJob(dsm_segment *seg, ResourceOwner owner,
+					 MemoryContext context, bool joined_group);
 static void WaitForParallelWorkersToExit(ParallelContext *pcxt);
+static bool ParallelWorkerPoolAssign(ParallelContext *pcxt, int i);
+static int	ParallelWorkerPoolReserve(ParallelContext *pcxt, int i);
+static void ParallelWorkerPoolSetHandle(int slotno,
+							BackgroundWorkerHandle *handle);
+static void ParallelWorkerPoolRelease(int slotno);
+static void ParallelWorkerPoolEvict(void);
+static BgwHandleStatus ParallelWorkerPoolWaitForRelease(ParallelWorkerInfo *winfo);
+static bool ParallelWorkerPoolWaitForJob(dsm_handle *segment,
+							 int *worker_number);
+static void ParallelWorkerPoolShutdown(int code, Datum arg);
+static void ParallelWorkerSigHup(SIGNAL_ARGS);
 
 
 /*
@@ -450,8 +534,6 @@ LaunchParallelWorkers(ParallelContext *pcxt)
 	oldcontext = MemoryContextSwitchTo(TopTransactionContext);
 
 	/* Configure a worker. */
-	snprintf(worker.bgw_name, BGW_MAXLEN, "parallel worker for PID %d",
-			 MyProcPid);
 	worker.bgw_flags =
 		BGWORKER_SHMEM_ACCESS | BGWORKER_BACKEND_DATABASE_CONNECTION;
 	worker.bgw_start_time = BgWorkerStart_ConsistentState;
@@ -471,17 +553,55 @@ LaunchParallelWorkers(ParallelContext *pcxt)
 	 */
 	for (i = 0; i < pcxt->nworkers; ++i)
 	{
+		int			pool_slot = -1;
+
+		pcxt->worker[i].pool_slot = -1;
+
+		/* An idle pooled worker is much cheaper than a new one. */
+		if (!any_registrations_failed && ParallelWorkerPoolAssign(pcxt, i))
+		{
+			shm_mq_set_handle(pcxt->worker[i].error_mqh,
+							  pcxt->worker[i].bgwhandle);
+			pcxt->nworkers_launched++;
+			continue;
+		}
+
+		/* Otherwise, give the new worker a pool slot if one is free. */
+		if (!any_registrations_failed)
+			pool_slot = ParallelWorkerPoolReserve(pcxt, i);
+		if (pool_slot >= 0)
+			snprintf(worker.bgw_name, BGW_MAXLEN, "pooled parallel worker");
+		else
+			snprintf(worker.bgw_name, BGW_MAXLEN,
+					 "parallel worker for PID %d", MyProcPid);
+
 		memcpy(worker.bgw_extra, &i, sizeof(int));
+		memcpy(worker.bgw_extra + sizeof(int), &pool_slot, sizeof(int));
 		if (!any_registrations_failed &&
 			RegisterDynamicBackgroundWorker(&worker,
 											&pcxt->worker[i].bgwhandle))
 		{
+			if (pool_slot >= 0)
+			{
+				ParallelWorkerPoolSetHandle(pool_slot,
+											pcxt->worker[i].bgwhandle);
+				pcxt->worker[i].pool_slot = pool_slot;
+			}
 			shm_mq_set_handle(pcxt->worker[i].error_mqh,
 							  pcxt->worker[i].bgwhandle);
 			pcxt->nworkers_launched++;
 		}
 		else
 		{
+			/*
+			 * Idle pooled workers tie up background worker slots, so if we
+			 * are out of slots, ask one of them to make room for next time.
+			 */
+			if (pool_slot >= 0)
+				ParallelWorkerPoolRelease(pool_slot);
+			if (!any_registrations_failed && parallel_worker_pool_size > 0)
+				ParallelWorkerPoolEvict();
+
 			/*
 			 * If we weren't able to register the worker, then we've bumped up
 			 * against the max_worker_processes limit, and future
@@ -561,6 +681,8 @@ WaitForParallelWorkersToFinish(ParallelContext *pcxt)
  * difference between WaitForParallelWorkersToFinish and this function is
  * that former just ensures that last message sent by worker backend is
  * received by master backend whereas this ensures the complete shutdown.
+ * Pooled workers don't shut down; for them, we wait until they have finished
+ * with the parallel context and gone back to the pool.
  */
 static void
 WaitForParallelWorkersToExit(ParallelContext *pcxt)
@@ -575,7 +697,11 @@ WaitForParallelWorkersToExit(ParallelContext *pcxt)
 		if (pcxt->worker == NULL || pcxt->worker[i].bgwhandle == NULL)
 			continue;
 
-		status = WaitForBackgroundWorkerShutdown(pcxt->worker[i].bgwhandle);
+		/* A pooled worker survives; wait for it to give the job back. */
+		if (pcxt->worker[i].pool_slot >= 0)
+			status = ParallelWorkerPoolWaitForRelease(&pcxt->worker[i]);
+		else
+			status = WaitForBackgroundWorkerShutdown(pcxt->worker[i].bgwhandle);
 
 		/*
 		 * If the postmaster kicked the bucket, we have no chance of cleaning
@@ -927,9 +1053,55 @@ AtEOXact_Parallel(bool isCommit)
 
 /*
  * Main entrypoint for parallel workers.
+ *
+ * An unpooled worker performs a single parallel operation and exits.  A
+ * pooled worker instead goes on to wait for more work.
  */
 static void
 ParallelWorkerMain(Datum main_arg)
+{
+	dsm_handle	segment = DatumGetUInt32(main_arg);
+	int			worker_number;
+	int			pool_slot;
+	bool		connected = false;
+
+	/* Determine our parallel worker number and pool slot, if any. */
+	memcpy(&worker_number, MyBgworkerEntry->bgw_extra, sizeof(int));
+	memcpy(&pool_slot, MyBgworkerEntry->bgw_extra + sizeof(int), sizeof(int));
+
+	/* Establish signal handlers. */
+	pqsignal(SIGTERM, die);
+	if (pool_slot >= 0)
+		pqsignal(SIGHUP, ParallelWorkerSigHup);
+	BackgroundWorkerUnblockSignals();
+
+	/* Advertise ourselves in our pool slot. */
+	if (pool_slot >= 0)
+	{
+		MyPoolSlot = &ParallelWorkerPool->slot[pool_slot];
+		SpinLockAcquire(&ParallelWorkerPool->mutex);
+		MyPoolSlot->proc = MyProc;
+		SpinLockRelease(&ParallelWorkerPool->mutex);
+		before_shmem_exit(ParallelWorkerPoolShutdown, (Datum) 0);
+	}
+
+	do
+	{
+		ParallelWorkerRunJob(segment, worker_number, &connected);
+	} while (MyPoolSlot != NULL &&
+			 ParallelWorkerPoolWaitForJob(&segment, &worker_number));
+}
+
+/*
+ * Perform one parallel operation.
+ *
+ * We attach to the given dynamic shared memory segment, set up our
+ * backend-local state to match the backend that initiated parallelism, and
+ * invoke the caller-supplied entrypoint.  *connected says whether we have
+ * already established our database connection, and is updated if we do so.
+ */
+static void
+ParallelWorkerRunJob(dsm_handle segment, int worker_number, bool *connected)
 {
 	dsm_segment *seg;
 	shm_toc    *toc;
@@ -944,17 +1116,15 @@ ParallelWorkerMain(Datum main_arg)
 	char	   *asnapspace;
 	char	   *tstatespace;
 	StringInfoData msgbuf;
+	ResourceOwner toplevel_owner;
+	MemoryContext worker_context;
 
 	/* Set flag to indicate that we're initializing a parallel worker. */
 	InitializingParallelWorker = true;
 
-	/* Establish signal handlers. */
-	pqsignal(SIGTERM, die);
-	BackgroundWorkerUnblockSignals();
-
-	/* Determine and set our parallel worker number. */
+	/* Set our parallel worker number. */
 	Assert(ParallelWorkerNumber == -1);
-	memcpy(&ParallelWorkerNumber, MyBgworkerEntry->bgw_extra, sizeof(int));
+	ParallelWorkerNumber = worker_number;
 
 	/* Set up a memory context and resource owner. */
 	Assert(CurrentResourceOwner == NULL);
@@ -962,16 +1132,19 @@ ParallelWorkerMain(Datum main_arg)
 	CurrentMemoryContext = AllocSetContextCreate(TopMemoryContext,
 												 "Parallel worker",
 												 ALLOCSET_DEFAULT_SIZES);
+	toplevel_owner = CurrentResourceOwner;
+	worker_context = CurrentMemoryContext;
 
 	/*
 	 * Now that we have a resource owner, we can attach to the dynamic shared
 	 * memory segment and read the table of contents.
 	 */
-	seg = dsm_attach(DatumGetUInt32(main_arg));
+	seg = dsm_attach(segment);
 	if (seg == NULL)
 		ereport(ERROR,
 				(errcode(ERRCODE_OBJECT_NOT_IN_PREREQUISITE_STATE),
 				 errmsg("could not map dynamic shared memory segment")));
+	MyJobSegment = seg;
 	toc = shm_toc_attach(PARALLEL_MAGIC, dsm_segment_address(seg));
 	if (toc == NULL)
 		ereport(ERROR,
@@ -994,6 +1167,7 @@ ParallelWorkerMain(Datum main_arg)
 					 ParallelWorkerNumber * PARALLEL_ERROR_QUEUE_SIZE);
 	shm_mq_set_sender(mq, MyProc);
 	mqh = shm_mq_attach(mq, seg, NULL);
+	MyJobErrorQueueAttached = true;
 	pq_redirect_to_shm_mq(seg, mqh);
 	pq_set_parallel_master(fps->parallel_master_pid,
 						   fps->parallel_master_backend_id);
@@ -1022,30 +1196,51 @@ ParallelWorkerMain(Datum main_arg)
 	 * leader or against some process which in turn waits for a lock that
 	 * conflicts with the parallel group leader, causing an undetected
 	 * deadlock.  (If we can't join the lock group, the leader has gone away,
-	 * so just exit quietly.)
+	 * so just exit quietly, or go back to the pool.)
 	 */
 	if (!BecomeLockGroupMember(fps->parallel_master_pgproc,
 							   fps->parallel_master_pid))
+	{
+		if (MyPoolSlot != NULL)
+			ParallelWorkerEndJob(seg, toplevel_owner, worker_context, false);
 		return;
+	}
 
 	/*
 	 * Load libraries that were loaded by original backend.  We want to do
 	 * this before restoring GUCs, because the libraries might define custom
-	 * variables.
+	 * variables.  Libraries can't be unloaded, so a pooled worker keeps the
+	 * ones loaded for earlier jobs, along with whatever hooks they installed.
 	 */
 	libraryspace = shm_toc_lookup(toc, PARALLEL_KEY_LIBRARY);
 	Assert(libraryspace != NULL);
 	RestoreLibraryState(libraryspace);
 
-	/* Restore database connection. */
-	BackgroundWorkerInitializeConnectionByOid(fps->database_id,
-											  fps->authenticated_user_id);
-
 	/*
-	 * Set the client encoding to the database encoding, since that is what
-	 * the leader will expect.
+	 * Restore database connection, unless a previous job already did.  A
+	 * pooled worker is only ever handed jobs for the database and user it is
+	 * connected as.  The connection outlives this job, so set it up outside
+	 * of the per-job memory context.
 	 */
-	SetClientEncoding(GetDatabaseEncoding());
+	if (!*connected)
+	{
+		MemoryContext oldcontext = MemoryContextSwitchTo(TopMemoryContext);
+
+		BackgroundWorkerInitializeConnectionByOid(fps->database_id,
+												  fps->authenticated_user_id);
+
+		/*
+		 * Set the client encoding to the database encoding, since that is
+		 * what the leader will expect.
+		 */
+		SetClientEncoding(GetDatabaseEncoding());
+
+		MemoryContextSwitchTo(oldcontext);
+		*connected = true;
+	}
+	else if (fps->database_id != MyDatabaseId ||
+			 fps->authenticated_user_id != GetAuthenticatedUserId())
+		elog(ERROR, "pooled parallel worker assigned to wrong database or user");
 
 	/* Restore GUC values from launching backend. */
 	gucspace = shm_toc_lookup(toc, PARALLEL_KEY_GUC);
@@ -1116,6 +1311,47 @@ ParallelWorkerMain(Datum main_arg)
 
 	/* Report success. */
 	pq_putmessage('X', NULL, 0);
+
+	/* Get ready for the next job, if there is going to be one. */
+	if (MyPoolSlot != NULL)
+		ParallelWorkerEndJob(seg, toplevel_owner, worker_context, true);
+}
+
+/*
+ * Undo the per-job state established by ParallelWorkerRunJob, so that a
+ * pooled worker can serve a different parallel context.  joined_group says
+ * whether we got as far as joining the leader's lock group.
+ */
+static void
+ParallelWorkerEndJob(dsm_segment *seg, ResourceOwner owner,
+					 MemoryContext context, bool joined_group)
+{
+	if (joined_group)
+	{
+		SetUserIdAndSecContext(GetAuthenticatedUserId(), 0);
+		ClearTempNamespaceState();
+		ParallelMasterBackendId = InvalidBackendId;
+		LeaveLockGroup();
+	}
+
+	/* This also stops redirecting protocol messages to the error queue. */
+	MyFixedParallelState = NULL;
+	dsm_detach(seg);
+	MyJobSegment = NULL;
+	MyJobErrorQueueAttached = false;
+
+	/* The transaction, if any, has already reset CurrentResourceOwner. */
+	CurrentResourceOwner = NULL;
+	ResourceOwnerDelete(owner);
+	MemoryContextSwitchTo(TopMemoryContext);
+	MemoryContextDelete(context);
+
+	ParallelWorkerNumber = -1;
+	InitializingParallelWorker = false;
+
+	/* We may sit idle for a long time, so don't sit on our statistics. */
+	if (joined_group)
+		pgstat_report_stat(true);
 }
 
 /*
@@ -1160,3 +1396,451 @@ ParallelWorkerReportLastRecEnd(XLogRecPtr last_xlog_end)
 		fps->last_xlog_end = last_xlog_end;
 	SpinLockRelease(&fps->mutex);
 }
+
+/*
+ * Report shared-memory space needed by the parallel worker pool.
+ *
+ * There can't be more pooled workers than background workers, so we size
+ * the pool to match max_worker_processes.
+ */
+Size
+ParallelWorkerPoolShmemSize(void)
+{
+	Size		size;
+
+	size = offsetof(ParallelWorkerPoolData, slot);
+	size = add_size(size, mul_size(max_worker_processes,
+								   sizeof(ParallelWorkerPoolSlot)));
+
+	return size;
+}
+
+/*
+ * Initialize the parallel worker pool.
+ */
+void
+ParallelWorkerPoolShmemInit(void)
+{
+	bool		found;
+
+	ParallelWorkerPool = ShmemInitStruct("Parallel Worker Pool",
+										 ParallelWorkerPoolShmemSize(),
+										 &found);
+	if (!IsUnderPostmaster)
+	{
+		int			slotno;
+
+		Assert(!found);
+
+		SpinLockInit(&ParallelWorkerPool->mutex);
+		ParallelWorkerPool->nslots = max_worker_processes;
+		for (slotno = 0; slotno < max_worker_processes; ++slotno)
+		{
+			ParallelWorkerPoolSlot *slot = &ParallelWorkerPool->slot[slotno];
+
+			memset(slot, 0, sizeof(ParallelWorkerPoolSlot));
+			slot->state = POOL_SLOT_FREE;
+		}
+	}
+	else
+		Assert(found);
+}
+
+/*
+ * Number of pool slots currently usable.
+ */
+static int
+ParallelWorkerPoolLimit(void)
+{
+	return Min(parallel_worker_pool_size, ParallelWorkerPool->nslots);
+}
+
+/*
+ * Try to hand worker number i of a parallel context to an idle pooled worker
+ * connected to our database as our authenticated user.  On success, fill in
+ * pcxt->worker[i] and return true.
+ */
+static bool
+ParallelWorkerPoolAssign(ParallelContext *pcxt, int i)
+{
+	Oid			userid = GetAuthenticatedUserId();
+	int			limit = ParallelWorkerPoolLimit();
+	int			slotno;
+	int			bgw_slot = 0;
+	uint64		bgw_generation = 0;
+	PGPROC	   *proc = NULL;
+
+	SpinLockAcquire(&ParallelWorkerPool->mutex);
+	for (slotno = 0; slotno < limit; ++slotno)
+	{
+		ParallelWorkerPoolSlot *slot = &ParallelWorkerPool->slot[slotno];
+
+		if (slot->state == POOL_SLOT_IDLE && slot->handle_valid &&
+			!slot->exit_requested && slot->database_id == MyDatabaseId &&
+			slot->authenticated_user_id == userid)
+		{
+			slot->state = POOL_SLOT_BUSY;
+			slot->job++;
+			slot->leader = MyProc;
+			slot->segment = dsm_segment_handle(pcxt->seg);
+			slot->worker_number = i;
+
+			pcxt->worker[i].pool_slot = slotno;
+			pcxt->worker[i].pool_job = slot->job;
+			bgw_slot = slot->bgw_slot;
+			bgw_generation = slot->bgw_generation;
+			proc = slot->proc;
+			break;
+		}
+	}
+	SpinLockRelease(&ParallelWorkerPool->mutex);
+
+	if (proc == NULL)
+		return false;
+
+	pcxt->worker[i].bgwhandle =
+		ImportBackgroundWorkerHandle(bgw_slot, bgw_generation);
+	SetLatch(&proc->procLatch);
+
+	return true;
+}
+
+/*
+ * Reserve a pool slot for a worker we are about to register, and assign it
+ * worker number i of a parallel context.  Returns the slot number, or -1 if
+ * pooling is disabled or the pool is full.  The job number is stored in
+ * pcxt->worker[i].
+ */
+static int
+ParallelWorkerPoolReserve(ParallelContext *pcxt, int i)
+{
+	int			limit = ParallelWorkerPoolLimit();
+	int			slotno;
+
+	SpinLockAcquire(&ParallelWorkerPool->mutex);
+	for (slotno = 0; slotno < limit; ++slotno)
+	{
+		ParallelWorkerPoolSlot *slot = &ParallelWorkerPool->slot[slotno];
+
+		if (slot->state == POOL_SLOT_FREE)
+		{
+			slot->state = POOL_SLOT_BUSY;
+			slot->exit_requested = false;
+			slot->handle_valid = false;
+			slot->proc = NULL;
+			slot->database_id = MyDatabaseId;
+			slot->authenticated_user_id = GetAuthenticatedUserId();
+			slot->job++;
+			slot->leader = MyProc;
+			slot->segment = dsm_segment_handle(pcxt->seg);
+			slot->worker_number = i;
+
+			pcxt->worker[i].pool_job = slot->job;
+			break;
+		}
+	}
+	SpinLockRelease(&ParallelWorkerPool->mutex);
+
+	return slotno < limit ? slotno : -1;
+}
+
+/*
+ * Publish the handle of a newly registered pooled worker, so that other
+ * backends can use it once the worker becomes idle.
+ */
+static void
+ParallelWorkerPoolSetHandle(int slotno, BackgroundWorkerHandle *handle)
+{
+	ParallelWorkerPoolSlot *slot = &ParallelWorkerPool->slot[slotno];
+	int			bgw_slot;
+	uint64		bgw_generation;
+
+	ExportBackgroundWorkerHandle(handle, &bgw_slot, &bgw_generation);
+
+	SpinLockAcquire(&ParallelWorkerPool->mutex);
+	slot->bgw_slot = bgw_slot;
+	slot->bgw_generation = bgw_generation;
+	slot->handle_valid = true;
+	SpinLockRelease(&ParallelWorkerPool->mutex);
+}
+
+/*
+ * Give back a slot reserved by ParallelWorkerPoolReserve when the worker
+ * could not be registered after all.
+ */
+static void
+ParallelWorkerPoolRelease(int slotno)
+{
+	ParallelWorkerPoolSlot *slot = &ParallelWorkerPool->slot[slotno];
+
+	SpinLockAcquire(&ParallelWorkerPool->mutex);
+	Assert(slot->state == POOL_SLOT_BUSY && slot->leader == MyProc);
+	slot->state = POOL_SLOT_FREE;
+	slot->leader = NULL;
+	SpinLockRelease(&ParallelWorkerPool->mutex);
+}
+
+/*
+ * Ask one idle pooled worker to exit, freeing up its background worker slot.
+ * Any idle worker we could have used was assigned a job before we got here,
+ * so the one we pick must belong to some other database or user.
+ */
+static void
+ParallelWorkerPoolEvict(void)
+{
+	int			slotno;
+	PGPROC	   *proc = NULL;
+
+	SpinLockAcquire(&ParallelWorkerPool->mutex);
+	for (slotno = 0; slotno < ParallelWorkerPool->nslots; ++slotno)
+	{
+		ParallelWorkerPoolSlot *slot = &ParallelWorkerPool->slot[slotno];
+
+		if (slot->state == POOL_SLOT_IDLE && !slot->exit_requested)
+		{
+			slot->exit_requested = true;
+			proc = slot->proc;
+			break;
+		}
+	}
+	SpinLockRelease(&ParallelWorkerPool->mutex);
+
+	if (proc != NULL)
+		SetLatch(&proc->procLatch);
+}
+
+/*
+ * Ask all idle pooled workers connected to the given database to exit.
+ *
+ * This is used when the database is about to be dropped or otherwise needs
+ * to be free of other backends.  Pooled workers that are busy belong to an
+ * active parallel query, and so conflict with such operations anyway; if
+ * they go idle while the caller is still waiting, a later call catches them.
+ */
+void
+TerminatePooledParallelWorkers(Oid databaseId)
+{
+	int			slotno;
+
+	for (slotno = 0; slotno < ParallelWorkerPool->nslots; ++slotno)
+	{
+		ParallelWorkerPoolSlot *slot = &ParallelWorkerPool->slot[slotno];
+		PGPROC	   *proc = NULL;
+
+		SpinLockAcquire(&ParallelWorkerPool->mutex);
+		if (slot->state == POOL_SLOT_IDLE && slot->database_id == databaseId)
+		{
+			slot->exit_requested = true;
+			proc = slot->proc;
+		}
+		SpinLockRelease(&ParallelWorkerPool->mutex);
+
+		if (proc != NULL)
+			SetLatch(&proc->procLatch);
+	}
+}
+
+/*
+ * Wait for a pooled worker to finish with the job we assigned it.
+ *
+ * The worker sets our latch when it gives the job back, but we don't get
+ * notified if it dies instead, since we aren't necessarily the backend that
+ * registered it.  So poll for that case.  If the worker died, the slot is
+ * still marked busy with our job, and it's up to us to free it.
+ */
+static BgwHandleStatus
+ParallelWorkerPoolWaitForRelease(ParallelWorkerInfo *winfo)
+{
+	ParallelWorkerPoolSlot *slot = &ParallelWorkerPool->slot[winfo->pool_slot];
+
+	for (;;)
+	{
+		bool		released;
+		pid_t		pid;
+		int			rc;
+
+		SpinLockAcquire(&ParallelWorkerPool->mutex);
+		released = (slot->job != winfo->pool_job ||
+					slot->state != POOL_SLOT_BUSY);
+		SpinLockRelease(&ParallelWorkerPool->mutex);
+		if (released)
+			break;
+
+		if (GetBackgroundWorkerPid(winfo->bgwhandle, &pid) == BGWH_STOPPED)
+		{
+			SpinLockAcquire(&ParallelWorkerPool->mutex);
+			if (slot->job == winfo->pool_job &&
+				slot->state == POOL_SLOT_BUSY)
+			{
+				slot->state = POOL_SLOT_FREE;
+				slot->handle_valid = false;
+				slot->proc = NULL;
+				slot->leader = NULL;
+			}
+			SpinLockRelease(&ParallelWorkerPool->mutex);
+			break;
+		}
+
+		rc = WaitLatch(MyLatch,
+					   WL_LATCH_SET | WL_TIMEOUT | WL_POSTMASTER_DEATH, 10L);
+		if (rc & WL_POSTMASTER_DEATH)
+			return BGWH_POSTMASTER_DIED;
+		ResetLatch(MyLatch);
+	}
+
+	return BGWH_STOPPED;
+}
+
+/*
+ * Give our job back to the leader that assigned it, then wait, as an idle
+ * pooled worker, for a new one.  Returns true if we got a new job, in which
+ * case *segment and *worker_number describe it, or false if we should exit.
+ */
+static bool
+ParallelWorkerPoolWaitForJob(dsm_handle *segment, int *worker_number)
+{
+	ParallelWorkerPoolSlot *slot = MyPoolSlot;
+	int			slotno = slot - ParallelWorkerPool->slot;
+	PGPROC	   *leader;
+
+	SpinLockAcquire(&ParallelWorkerPool->mutex);
+	Assert(slot->state == POOL_SLOT_BUSY);
+	leader = slot->leader;
+	slot->leader = NULL;
+	slot->state = POOL_SLOT_IDLE;
+	SpinLockRelease(&ParallelWorkerPool->mutex);
+
+	if (leader != NULL)
+		SetLatch(&leader->procLatch);
+
+	set_ps_display("idle", false);
+
+	for (;;)
+	{
+		bool		assigned = false;
+		bool		quit = false;
+		int			rc;
+
+		CHECK_FOR_INTERRUPTS();
+
+		if (got_SIGHUP)
+		{
+			got_SIGHUP = false;
+			ProcessConfigFile(PGC_SIGHUP);
+		}
+
+		/* Don't let our caches fall too far behind while idle. */
+		if (catchupInterruptPending)
+			ProcessCatchupInterrupt();
+
+		SpinLockAcquire(&ParallelWorkerPool->mutex);
+		if (slot->state == POOL_SLOT_BUSY)
+		{
+			assigned = true;
+			*segment = slot->segment;
+			*worker_number = slot->worker_number;
+		}
+		else if (slot->exit_requested || slotno >= parallel_worker_pool_size)
+		{
+			quit = true;
+			slot->state = POOL_SLOT_FREE;
+			slot->handle_valid = false;
+			slot->proc = NULL;
+		}
+		SpinLockRelease(&ParallelWorkerPool->mutex);
+
+		if (assigned)
+		{
+			set_ps_display("", false);
+			return true;
+		}
+		if (quit)
+		{
+			/* The slot isn't ours anymore. */
+			MyPoolSlot = NULL;
+			return false;
+		}
+
+		rc = WaitLatch(MyLatch, WL_LATCH_SET | WL_POSTMASTER_DEATH, -1L);
+		if (rc & WL_POSTMASTER_DEATH)
+			proc_exit(1);
+		ResetLatch(MyLatch);
+	}
+}
+
+/*
+ * Clean up our pool slot when a pooled worker exits.
+ *
+ * If we're idle, the slot can simply be freed.  If we have a job, the leader
+ * that assigned it frees the slot once it notices that we're gone.  But the
+ * leader may be waiting for us to attach to our error queue, and since it
+ * doesn't get told when we exit, we must attach now so that detaching will
+ * wake it up.
+ */
+static void
+ParallelWorkerPoolShutdown(int code, Datum arg)
+{
+	ParallelWorkerPoolSlot *slot = MyPoolSlot;
+	bool		attach_queue = false;
+	dsm_handle	segment = 0;
+	int			worker_number = 0;
+	dsm_segment *seg;
+	shm_toc    *toc;
+	char	   *error_queue_space;
+	shm_mq	   *mq;
+
+	if (slot == NULL)
+		return;
+
+	SpinLockAcquire(&ParallelWorkerPool->mutex);
+	if (slot->state == POOL_SLOT_IDLE)
+	{
+		slot->state = POOL_SLOT_FREE;
+		slot->handle_valid = false;
+		slot->proc = NULL;
+	}
+	else if (slot->state == POOL_SLOT_BUSY && !MyJobErrorQueueAttached)
+	{
+		attach_queue = true;
+		segment = slot->segment;
+		worker_number = slot->worker_number;
+	}
+	SpinLockRelease(&ParallelWorkerPool->mutex);
+	MyPoolSlot = NULL;
+
+	if (!attach_queue)
+		return;
+
+	/* dsm_attach needs a resource owner; we're idle, so we may have none. */
+	if (CurrentResourceOwner == NULL)
+		CurrentResourceOwner = ResourceOwnerCreate(NULL, "pooled worker exit");
+	seg = MyJobSegment != NULL ? MyJobSegment : dsm_attach(segment);
+	if (seg == NULL)
+		return;					/* leader is gone already */
+	toc = shm_toc_attach(PARALLEL_MAGIC, dsm_segment_address(seg));
+	if (toc != NULL)
+	{
+		error_queue_space = shm_toc_lookup(toc, PARALLEL_KEY_ERROR_QUEUE);
+		mq = (shm_mq *) (error_queue_space +
+						 worker_number * PARALLEL_ERROR_QUEUE_SIZE);
+		shm_mq_set_sender(mq, MyProc);
+		(void) shm_mq_attach(mq, seg, NULL);
+	}
+	if (seg != MyJobSegment)
+		dsm_detach(seg);
+}
+
+/*
+ * SIGHUP handler for pooled parallel workers.  Configuration changes are
+ * processed only while idle.
+ */
+static void
+ParallelWorkerSigHup(SIGNAL_ARGS)
+{
+	int			save_errno = errno;
+
+	got_SIGHUP = true;
+	SetLatch(MyLatch);
+
+	errno = save_errno;
+}
@@ -45,6 +45,7 @@
 #include "replication/origin.h"
 #include "replication/syncrep.h"
 #include "replication/walsender.h"
+#include "storage/condition_variable.h"
 #include "storage/fd.h"
 #include "storage/lmgr.h"
 #include "storage/predicate.h"
@@ -2469,6 +2470,9 @@ AbortTransaction(void)
 	AbortBufferIO();
 	UnlockBuffers();
 
+	/* Cancel condition variable sleep */
+	ConditionVariableCancelSleep();
+
 	/* Reset WAL record construction state */
 	XLogResetInsertion();
 
@@ -4561,6 +4565,9 @@ AbortSubTransaction(void)
 	AbortBufferIO();
 	UnlockBuffers();
 
+	/* Cancel condition variable sleep */
+	ConditionVariableCancelSleep();
+
 	/* Reset WAL record construction state */
 	XLogResetInsertion();
 
@@ -3117,6 +3117,24 @@ SetTempNamespaceState(Oid tempNamespaceId, Oid tempToastNamespaceId)
 	baseSearchPathValid = false;	/* may need to rebuild list */
 }
 
+/*
+ * ClearTempNamespaceState - forget temp namespace OIDs set by
+ * SetTempNamespaceState
+ *
+ * This is used by a pooled parallel worker once it has finished the parallel
+ * operation, so that it can adopt a different leader's state next time.
+ */
+void
+ClearTempNamespaceState(void)
+{
+	Assert(myTempNamespaceSubID == InvalidSubTransactionId);
+
+	myTempNamespace = InvalidOid;
+	myTempToastNamespace = InvalidOid;
+
+	baseSearchPathValid = false;	/* may need to rebuild list */
+}
+
 
 /*
  * GetOverrideSearchPath - fetch current search path definition in form
@@ -13,6 +13,7 @@
  */
 #include "postgres.h"
 
+#include "access/relscan.h"
 #include "access/xact.h"
 #include "catalog/pg_collation.h"
 #include "catalog/pg_type.h"
@@ -78,6 +79,8 @@ static void show_upper_qual(List *qual, const char *qlabel,
 				ExplainState *es);
 static void show_sort_keys(SortState *sortstate, List *ancestors,
 			   ExplainState *es);
+static void show_incremental_sort_keys(IncrementalSortState *incrsortstate,
+						   List *ancestors, ExplainState *es);
 static void show_merge_append_keys(MergeAppendState *mstate, List *ancestors,
 					   ExplainState *es);
 static void show_agg_keys(AggState *astate, List *ancestors,
@@ -99,9 +102,15 @@ static void show_sortorder_options(StringInfo buf, Node *sortexpr,
 static void show_tablesample(TableSampleClause *tsc, PlanState *planstate,
 				 List *ancestors, ExplainState *es);
 static void show_sort_info(SortState *sortstate, ExplainState *es);
+static void show_incremental_sort_info(IncrementalSortState *incrsortstate,
+						   ExplainState *es);
 static void show_hash_info(HashState *hashstate, ExplainState *es);
+static void show_resultcache_info(ResultCacheState *rcstate, List *ancestors,
+					  ExplainState *es);
+static void show_hashagg_info(AggState *aggstate, ExplainState *es);
 static void show_tidbitmap_info(BitmapHeapScanState *planstate,
 					ExplainState *es);
+static void show_index_prefetch_info(IndexScanDesc scandesc, ExplainState *es);
 static void show_instrumentation_count(const char *qlabel, int which,
 						   PlanState *planstate, ExplainState *es);
 static void show_foreignscan_info(ForeignScanState *fsstate, ExplainState *es);
@@ -879,6 +888,9 @@ ExplainNode(PlanState *planstate, List *ancestors,
 		case T_Gather:
 			pname = sname = "Gather";
 			break;
+		case T_GatherMerge:
+			pname = sname = "Gather Merge";
+			break;
 		case T_IndexScan:
 			pname = sname = "Index Scan";
 			break;
@@ -945,9 +957,15 @@ ExplainNode(PlanState *planstate, List *ancestors,
 		case T_Material:
 			pname = sname = "Materialize";
 			break;
+		case T_ResultCache:
+			pname = sname = "Result Cache";
+			break;
 		case T_Sort:
 			pname = sname = "Sort";
 			break;
+		case T_IncrementalSort:
+			pname = sname = "Incremental Sort";
+			break;
 		case T_Group:
 			pname = sname = "Group";
 			break;
@@ -970,6 +988,10 @@ ExplainNode(PlanState *planstate, List *ancestors,
 						pname = "HashAggregate";
 						strategy = "Hashed";
 						break;
+					case AGG_MIXED:
+						pname = "MixedAggregate";
+						strategy = "Mixed";
+						break;
 					default:
 						pname = "Aggregate ???";
 						strategy = "???";
@@ -1298,6 +1320,8 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			if (plan->qual)
 				show_instrumentation_count("Rows Removed by Filter", 1,
 										   planstate, es);
+			show_index_prefetch_info(((IndexScanState *) planstate)->iss_ScanDesc,
+									 es);
 			break;
 		case T_IndexOnlyScan:
 			show_scan_qual(((IndexOnlyScan *) plan)->indexqual,
@@ -1314,6 +1338,8 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			if (es->analyze)
 				ExplainPropertyLong("Heap Fetches",
 				   ((IndexOnlyScanState *) planstate)->ioss_HeapFetches, es);
+			show_index_prefetch_info(((IndexOnlyScanState *) planstate)->ioss_ScanDesc,
+									 es);
 			break;
 		case T_BitmapIndexScan:
 			show_scan_qual(((BitmapIndexScan *) plan)->indexqualorig,
@@ -1329,6 +1355,9 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			if (plan->qual)
 				show_instrumentation_count("Rows Removed by Filter", 1,
 										   planstate, es);
+			if (((ScanState *) planstate)->ss_RuntimeFilter)
+				show_instrumentation_count("Rows Removed by Runtime Filter", 3,
+										   planstate, es);
 			if (es->analyze)
 				show_tidbitmap_info((BitmapHeapScanState *) planstate, es);
 			break;
@@ -1345,6 +1374,9 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			if (plan->qual)
 				show_instrumentation_count("Rows Removed by Filter", 1,
 										   planstate, es);
+			if (((ScanState *) planstate)->ss_RuntimeFilter)
+				show_instrumentation_count("Rows Removed by Runtime Filter", 3,
+										   planstate, es);
 			break;
 		case T_Gather:
 			{
@@ -1368,6 +1400,26 @@ ExplainNode(PlanState *planstate, List *ancestors,
 					ExplainPropertyBool("Single Copy", gather->single_copy, es);
 			}
 			break;
+		case T_GatherMerge:
+			{
+				GatherMerge *gm = (GatherMerge *) plan;
+
+				show_scan_qual(plan->qual, "Filter", planstate, ancestors, es);
+				if (plan->qual)
+					show_instrumentation_count("Rows Removed by Filter", 1,
+											   planstate, es);
+				ExplainPropertyInteger("Workers Planned",
+									   gm->num_workers, es);
+				if (es->analyze)
+				{
+					int			nworkers;
+
+					nworkers = ((GatherMergeState *) planstate)->nworkers_launched;
+					ExplainPropertyInteger("Workers Launched",
+										   nworkers, es);
+				}
+			}
+			break;
 		case T_FunctionScan:
 			if (es->verbose)
 			{
@@ -1469,6 +1521,8 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			if (plan->qual)
 				show_instrumentation_count("Rows Removed by Filter", 1,
 										   planstate, es);
+			if (es->analyze)
+				show_hashagg_info((AggState *) planstate, es);
 			break;
 		case T_Group:
 			show_group_keys((GroupState *) planstate, ancestors, es);
@@ -1481,6 +1535,12 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			show_sort_keys((SortState *) planstate, ancestors, es);
 			show_sort_info((SortState *) planstate, es);
 			break;
+		case T_IncrementalSort:
+			show_incremental_sort_keys((IncrementalSortState *) planstate,
+									   ancestors, es);
+			show_incremental_sort_info((IncrementalSortState *) planstate,
+									   es);
+			break;
 		case T_MergeAppend:
 			show_merge_append_keys((MergeAppendState *) planstate,
 								   ancestors, es);
@@ -1500,6 +1560,10 @@ ExplainNode(PlanState *planstate, List *ancestors,
 		case T_Hash:
 			show_hash_info((HashState *) planstate, es);
 			break;
+		case T_ResultCache:
+			show_resultcache_info((ResultCacheState *) planstate, ancestors,
+								  es);
+			break;
 		default:
 			break;
 	}
@@ -1814,6 +1878,28 @@ show_sort_keys(SortState *sortstate, List *ancestors, ExplainState *es)
 						 ancestors, es);
 }
 
+/*
+ * Likewise, for an IncrementalSort node, also showing which leading keys
+ * the input is already sorted on.
+ */
+static void
+show_incremental_sort_keys(IncrementalSortState *incrsortstate,
+						   List *ancestors, ExplainState *es)
+{
+	IncrementalSort *plan = (IncrementalSort *) incrsortstate->ss.ps.plan;
+
+	show_sort_group_keys((PlanState *) incrsortstate, "Sort Key",
+						 plan->sort.numCols, plan->sort.sortColIdx,
+						 plan->sort.sortOperators, plan->sort.collations,
+						 plan->sort.nullsFirst,
+						 ancestors, es);
+	show_sort_group_keys((PlanState *) incrsortstate, "Presorted Key",
+						 plan->presortedCols, plan->sort.sortColIdx,
+						 plan->sort.sortOperators, plan->sort.collations,
+						 plan->sort.nullsFirst,
+						 ancestors, es);
+}
+
 /*
  * Likewise, for a MergeAppend node.
  */
@@ -1898,6 +1984,20 @@ show_grouping_set_keys(PlanState *planstate,
 	ListCell   *lc;
 	List	   *gsets = aggnode->groupingSets;
 	AttrNumber *keycols = aggnode->grpColIdx;
+	const char *keyname;
+	const char *keysetname;
+
+	if (aggnode->aggstrategy == AGG_HASHED ||
+		aggnode->aggstrategy == AGG_MIXED)
+	{
+		keyname = "Hash Key";
+		keysetname = "Hash Keys";
+	}
+	else
+	{
+		keyname = "Group Key";
+		keysetname = "Group Keys";
+	}
 
 	ExplainOpenGroup("Grouping Set", NULL, true, es);
 
@@ -1912,7 +2012,7 @@ show_grouping_set_keys(PlanState *planstate,
 			es->indent++;
 	}
 
-	ExplainOpenGroup("Group Keys", "Group Keys", false, es);
+	ExplainOpenGroup(keysetname, keysetname, false, es);
 
 	foreach(lc, gsets)
 	{
@@ -1936,12 +2036,12 @@ show_grouping_set_keys(PlanState *planstate,
 		}
 
 		if (!result && es->format == EXPLAIN_FORMAT_TEXT)
-			ExplainPropertyText("Group Key", "()", es);
+			ExplainPropertyText(keyname, "()", es);
 		else
-			ExplainPropertyListNested("Group Key", result, es);
+			ExplainPropertyListNested(keyname, result, es);
 	}
 
-	ExplainCloseGroup("Group Keys", "Group Keys", false, es);
+	ExplainCloseGroup(keysetname, keysetname, false, es);
 
 	if (sortnode && es->format == EXPLAIN_FORMAT_TEXT)
 		es->indent--;
@@ -2180,6 +2280,38 @@ show_sort_info(SortState *sortstate, ExplainState *es)
 	}
 }
 
+/*
+ * If it's EXPLAIN ANALYZE, show how many batches an IncrementalSort node
+ * sorted, and the method and space used for the largest of them.
+ */
+static void
+show_incremental_sort_info(IncrementalSortState *incrsortstate,
+						   ExplainState *es)
+{
+	if (es->analyze && incrsortstate->nbatches > 0)
+	{
+		if (es->format == EXPLAIN_FORMAT_TEXT)
+		{
+			appendStringInfoSpaces(es->str, es->indent * 2);
+			appendStringInfo(es->str,
+							 "Sort Batches: " INT64_FORMAT "  Sort Method: %s  Peak %s: %ldkB\n",
+							 incrsortstate->nbatches,
+							 incrsortstate->sortMethod,
+							 incrsortstate->spaceType,
+							 incrsortstate->maxSpace);
+		}
+		else
+		{
+			ExplainPropertyLong("Sort Batches", incrsortstate->nbatches, es);
+			ExplainPropertyText("Sort Method", incrsortstate->sortMethod, es);
+			ExplainPropertyLong("Peak Sort Space Used",
+								incrsortstate->maxSpace, es);
+			ExplainPropertyText("Sort Space Type", incrsortstate->spaceType,
+								es);
+		}
+	}
+}
+
 /*
  * Show information on hash buckets/batches.
  */
@@ -2194,18 +2326,23 @@ show_hash_info(HashState *hashstate, ExplainState *es)
 	if (hashtable)
 	{
 		long		spacePeakKb = (hashtable->spacePeak + 1023) / 1024;
+		int			nbatch = hashtable->nbatch;
+
+		/* a parallel-aware hash join keeps count of its batches separately */
+		if (hashtable->shared_nbatch > 0)
+			nbatch = hashtable->shared_nbatch;
 
 		if (es->format != EXPLAIN_FORMAT_TEXT)
 		{
 			ExplainPropertyLong("Hash Buckets", hashtable->nbuckets, es);
 			ExplainPropertyLong("Original Hash Buckets",
 								hashtable->nbuckets_original, es);
-			ExplainPropertyLong("Hash Batches", hashtable->nbatch, es);
+			ExplainPropertyLong("Hash Batches", nbatch, es);
 			ExplainPropertyLong("Original Hash Batches",
 								hashtable->nbatch_original, es);
 			ExplainPropertyLong("Peak Memory Usage", spacePeakKb, es);
 		}
-		else if (hashtable->nbatch_original != hashtable->nbatch ||
+		else if (hashtable->nbatch_original != nbatch ||
 				 hashtable->nbuckets_original != hashtable->nbuckets)
 		{
 			appendStringInfoSpaces(es->str, es->indent * 2);
@@ -2213,7 +2350,7 @@ show_hash_info(HashState *hashstate, ExplainState *es)
 							 "Buckets: %d (originally %d)  Batches: %d (originally %d)  Memory Usage: %ldkB\n",
 							 hashtable->nbuckets,
 							 hashtable->nbuckets_original,
-							 hashtable->nbatch,
+							 nbatch,
 							 hashtable->nbatch_original,
 							 spacePeakKb);
 		}
@@ -2222,14 +2359,107 @@ show_hash_info(HashState *hashstate, ExplainState *es)
 			appendStringInfoSpaces(es->str, es->indent * 2);
 			appendStringInfo(es->str,
 						   "Buckets: %d  Batches: %d  Memory Usage: %ldkB\n",
-							 hashtable->nbuckets, hashtable->nbatch,
+							 hashtable->nbuckets, nbatch,
 							 spacePeakKb);
 		}
 	}
 }
 
 /*
- * If it's EXPLAIN ANALYZE, show exact/lossy pages for a BitmapHeapScan node
+ * Show the cache key of a ResultCache node, and for EXPLAIN ANALYZE, how
+ * well the cache worked.
+ */
+static void
+show_resultcache_info(ResultCacheState *rcstate, List *ancestors,
+					  ExplainState *es)
+{
+	ResultCache *plan = (ResultCache *) rcstate->ss.ps.plan;
+	ResultCacheInstrumentation *stats = &rcstate->stats;
+	List	   *context;
+	StringInfoData keystr;
+	bool		useprefix;
+	ListCell   *lc;
+	char	   *separator = "";
+
+	/* Set up deparsing context */
+	context = set_deparse_context_planstate(es->deparse_cxt,
+											(Node *) rcstate,
+											ancestors);
+	useprefix = (list_length(es->rtable) > 1 || es->verbose);
+
+	initStringInfo(&keystr);
+	foreach(lc, plan->param_exprs)
+	{
+		appendStringInfoString(&keystr, separator);
+		appendStringInfoString(&keystr,
+							   deparse_expression((Node *) lfirst(lc),
+												  context, useprefix, false));
+		separator = ", ";
+	}
+	ExplainPropertyText("Cache Key", keystr.data, es);
+	pfree(keystr.data);
+
+	if (!es->analyze || stats->cache_hits + stats->cache_misses == 0)
+		return;
+
+	if (es->format != EXPLAIN_FORMAT_TEXT)
+	{
+		ExplainPropertyLong("Cache Hits", (long) stats->cache_hits, es);
+		ExplainPropertyLong("Cache Misses", (long) stats->cache_misses, es);
+		ExplainPropertyLong("Cache Evictions", (long) stats->cache_evictions,
+							es);
+		ExplainPropertyLong("Cache Overflows", (long) stats->cache_overflows,
+							es);
+		ExplainPropertyLong("Peak Memory Usage",
+							(long) ((stats->mem_peak + 1023) / 1024), es);
+	}
+	else
+	{
+		appendStringInfoSpaces(es->str, es->indent * 2);
+		appendStringInfo(es->str,
+						 "Hits: " UINT64_FORMAT "  Misses: " UINT64_FORMAT "  Evictions: " UINT64_FORMAT "  Overflows: " UINT64_FORMAT "  Memory Usage: %ldkB\n",
+						 stats->cache_hits,
+						 stats->cache_misses,
+						 stats->cache_evictions,
+						 stats->cache_overflows,
+						 (long) ((stats->mem_peak + 1023) / 1024));
+	}
+}
+
+/*
+ * Show information on hash aggregation's memory and disk usage
+ */
+static void
+show_hashagg_info(AggState *aggstate, ExplainState *es)
+{
+	Agg		   *agg = (Agg *) aggstate->ss.ps.plan;
+	long		memPeakKb = (aggstate->hash_mem_peak + 1023) / 1024;
+	long		diskKb = (aggstate->hash_disk_used + 1023) / 1024;
+
+	if ((agg->aggstrategy != AGG_HASHED &&
+		 agg->aggstrategy != AGG_MIXED) || !aggstate->table_filled)
+		return;
+
+	if (es->format != EXPLAIN_FORMAT_TEXT)
+	{
+		ExplainPropertyLong("HashAgg Batches", aggstate->hash_batches_used, es);
+		ExplainPropertyLong("Peak Memory Usage", memPeakKb, es);
+		ExplainPropertyLong("Disk Usage", diskKb, es);
+	}
+	else
+	{
+		appendStringInfoSpaces(es->str, es->indent * 2);
+		appendStringInfo(es->str, "Batches: %d  Memory Usage: %ldkB",
+						 aggstate->hash_batches_used, memPeakKb);
+		if (aggstate->hash_disk_used > 0)
+			appendStringInfo(es->str, "  Disk Usage: %ldkB", diskKb);
+		appendStringInfoChar(es->str, '\n');
+	}
+}
+
+/*
+ * If it's EXPLAIN ANALYZE, show exact/lossy pages for a BitmapHeapScan node,
+ * and how many of the exact ones didn't need to be read
  */
 static void
 show_tidbitmap_info(BitmapHeapScanState *planstate, ExplainState *es)
@@ -2238,6 +2468,8 @@ show_tidbitmap_info(BitmapHeapScanState *planstate, ExplainState *es)
 	{
 		ExplainPropertyLong("Exact Heap Blocks", planstate->exact_pages, es);
 		ExplainPropertyLong("Lossy Heap Blocks", planstate->lossy_pages, es);
+		ExplainPropertyLong("Skipped Heap Blocks", planstate->skipped_pages,
+							es);
 	}
 	else
 	{
@@ -2249,11 +2481,29 @@ show_tidbitmap_info(BitmapHeapScanState *planstate, ExplainState *es)
 				appendStringInfo(es->str, " exact=%ld", planstate->exact_pages);
 			if (planstate->lossy_pages > 0)
 				appendStringInfo(es->str, " lossy=%ld", planstate->lossy_pages);
+			if (planstate->skipped_pages > 0)
+				appendStringInfo(es->str, " skipped=%ld",
+								 planstate->skipped_pages);
 			appendStringInfoChar(es->str, '\n');
 		}
 	}
 }
 
+/*
+ * If it's EXPLAIN ANALYZE, show how many heap blocks an index scan prefetched
+ */
+static void
+show_index_prefetch_info(IndexScanDesc scandesc, ExplainState *es)
+{
+	if (!es->analyze || scandesc == NULL)
+		return;
+
+	/* In text mode, suppress zero counts, as for the other counters */
+	if (scandesc->xs_prefetch_count > 0 || es->format != EXPLAIN_FORMAT_TEXT)
+		ExplainPropertyLong("Heap Prefetches", scandesc->xs_prefetch_count,
+							es);
+}
+
 /*
  * If it's EXPLAIN ANALYZE, show instrumentation information for a plan node
  *
@@ -2269,7 +2519,9 @@ show_instrumentation_count(const char *qlabel, int which,
 	if (!es->analyze || !planstate->instrument)
 		return;
 
-	if (which == 2)
+	if (which == 3)
+		nfiltered = planstate->instrument->nfiltered3;
+	else if (which == 2)
 		nfiltered = planstate->instrument->nfiltered2;
 	else
 		nfiltered = planstate->instrument->nfiltered1;
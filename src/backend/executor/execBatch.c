@@ -0,0 +1,442 @@
+/*-------------------------------------------------------------------------
+ *
+ * execBatch.c
+ *	  Support for passing rows between plan nodes a batch at a time
+ *
+ * Normally every plan node hands its parent one tuple per ExecProcNode call,
+ * and the parent then evaluates its expressions on that one tuple.  Where a
+ * node and its parent both support it, they can instead exchange a whole
+ * TupleBatch of deformed column values at a time.  The scan applies its
+ * quals to the batch with type-specialized comparison loops that just
+ * shrink the selection vector, and the consumer works through the selected
+ * rows in tight loops of its own.  This saves the per-row node dispatch,
+ * qual and projection overhead, which dominates scans over narrow rows.
+ *
+ * Batch mode is strictly an execution-time optimization: a node that can't
+ * handle its part in it just declines, and the plan runs a row at a time as
+ * usual.
+ *
+ *
+ * Portions Copyright (c) 1996-2016, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  src/backend/executor/execBatch.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "catalog/pg_type.h"
+#include "executor/execBatch.h"
+#include "nodes/primnodes.h"
+#include "utils/builtins.h"
+#include "utils/fmgroids.h"
+
+
+/* GUC parameter */
+bool		enable_batch_execution = true;
+
+/* Operator functions we have comparison kernels for */
+typedef struct BatchCmpFunc
+{
+	Oid			funcid;
+	Oid			typid;
+	BatchCmpType type;
+	BatchCmpOp	op;
+} BatchCmpFunc;
+
+static const BatchCmpFunc batch_cmp_funcs[] = {
+	{F_INT4EQ, INT4OID, BATCH_CMP_INT4, BATCH_CMP_EQ},
+	{F_INT4NE, INT4OID, BATCH_CMP_INT4, BATCH_CMP_NE},
+	{F_INT4LT, INT4OID, BATCH_CMP_INT4, BATCH_CMP_LT},
+	{F_INT4LE, INT4OID, BATCH_CMP_INT4, BATCH_CMP_LE},
+	{F_INT4GT, INT4OID, BATCH_CMP_INT4, BATCH_CMP_GT},
+	{F_INT4GE, INT4OID, BATCH_CMP_INT4, BATCH_CMP_GE},
+	{F_DATE_EQ, DATEOID, BATCH_CMP_INT4, BATCH_CMP_EQ},
+	{F_DATE_NE, DATEOID, BATCH_CMP_INT4, BATCH_CMP_NE},
+	{F_DATE_LT, DATEOID, BATCH_CMP_INT4, BATCH_CMP_LT},
+	{F_DATE_LE, DATEOID, BATCH_CMP_INT4, BATCH_CMP_LE},
+	{F_DATE_GT, DATEOID, BATCH_CMP_INT4, BATCH_CMP_GT},
+	{F_DATE_GE, DATEOID, BATCH_CMP_INT4, BATCH_CMP_GE},
+#ifdef USE_FLOAT8_BYVAL
+	{F_INT8EQ, INT8OID, BATCH_CMP_INT8, BATCH_CMP_EQ},
+	{F_INT8NE, INT8OID, BATCH_CMP_INT8, BATCH_CMP_NE},
+	{F_INT8LT, INT8OID, BATCH_CMP_INT8, BATCH_CMP_LT},
+	{F_INT8LE, INT8OID, BATCH_CMP_INT8, BATCH_CMP_LE},
+	{F_INT8GT, INT8OID, BATCH_CMP_INT8, BATCH_CMP_GT},
+	{F_INT8GE, INT8OID, BATCH_CMP_INT8, BATCH_CMP_GE},
+	{F_FLOAT8EQ, FLOAT8OID, BATCH_CMP_FLOAT8, BATCH_CMP_EQ},
+	{F_FLOAT8NE, FLOAT8OID, BATCH_CMP_FLOAT8, BATCH_CMP_NE},
+	{F_FLOAT8LT, FLOAT8OID, BATCH_CMP_FLOAT8, BATCH_CMP_LT},
+	{F_FLOAT8LE, FLOAT8OID, BATCH_CMP_FLOAT8, BATCH_CMP_LE},
+	{F_FLOAT8GT, FLOAT8OID, BATCH_CMP_FLOAT8, BATCH_CMP_GT},
+	{F_FLOAT8GE, FLOAT8OID, BATCH_CMP_FLOAT8, BATCH_CMP_GE},
+#endif
+};
+
+static const BatchCmpFunc *ExecBatchMatchQual(Expr *clause, Var **var,
+				   Const **con, bool *commuted);
+
+
+/*
+ * ExecBatchCreate
+ *		Make an empty batch with ncols unused columns, and room for up to
+ *		maxcols columns in all.
+ */
+TupleBatch *
+ExecBatchCreate(int ncols, int maxcols)
+{
+	TupleBatch *batch;
+
+	Assert(ncols <= maxcols);
+
+	batch = (TupleBatch *) palloc0(sizeof(TupleBatch));
+	batch->ncols = ncols;
+	batch->maxcols = maxcols;
+	batch->attnos = (AttrNumber *) palloc0(maxcols * sizeof(AttrNumber));
+	batch->values = (Datum **) palloc0(maxcols * sizeof(Datum *));
+	batch->isnull = (bool **) palloc0(maxcols * sizeof(bool *));
+	batch->sel = (int *) palloc(BATCH_SIZE * sizeof(int));
+
+	return batch;
+}
+
+/*
+ * ExecBatchSetColumn
+ *		Have column col filled from input attribute attno.
+ */
+void
+ExecBatchSetColumn(TupleBatch *batch, int col, AttrNumber attno)
+{
+	Assert(col >= 0 && col < batch->ncols);
+	Assert(attno > 0);
+
+	if (batch->values[col] == NULL)
+	{
+		batch->values[col] = (Datum *) palloc(BATCH_SIZE * sizeof(Datum));
+		batch->isnull[col] = (bool *) palloc(BATCH_SIZE * sizeof(bool));
+	}
+	batch->attnos[col] = attno;
+	batch->lastattno = Max(batch->lastattno, attno);
+}
+
+/*
+ * ExecBatchFindColumn
+ *		Return a column filled from input attribute attno, adding one if
+ *		there's none yet.
+ */
+int
+ExecBatchFindColumn(TupleBatch *batch, AttrNumber attno)
+{
+	int			col;
+
+	for (col = 0; col < batch->ncols; col++)
+	{
+		if (batch->attnos[col] == attno)
+			return col;
+	}
+
+	if (batch->ncols >= batch->maxcols)
+		elog(ERROR, "too many columns in tuple batch");
+	col = batch->ncols++;
+	ExecBatchSetColumn(batch, col, attno);
+	return col;
+}
+
+/*
+ * ExecBatchQualsSupported
+ *		Check whether every clause of an implicitly-ANDed qual list can be
+ *		converted to a BatchQual.
+ *
+ * If not, the caller must not use batch mode.  This allocates nothing, so
+ * that callers can decline batch mode before setting anything up.
+ */
+bool
+ExecBatchQualsSupported(List *qual)
+{
+	ListCell   *lc;
+
+	foreach(lc, qual)
+	{
+		Var		   *var;
+		Const	   *con;
+		bool		commuted;
+
+		if (ExecBatchMatchQual((Expr *) lfirst(lc),
+							   &var, &con, &commuted) == NULL)
+			return false;
+	}
+
+	return true;
+}
+
+/*
+ * ExecBatchCompileQuals
+ *		Convert an implicitly-ANDed qual list to BatchQuals.
+ *
+ * The caller must have checked the list with ExecBatchQualsSupported.
+ * Columns for the attributes the quals reference are added to the batch as
+ * needed.
+ */
+void
+ExecBatchCompileQuals(TupleBatch *batch, List *qual,
+					  BatchQual **quals, int *nquals)
+{
+	ListCell   *lc;
+	int			n = 0;
+
+	*quals = (BatchQual *) palloc(Max(list_length(qual), 1) * sizeof(BatchQual));
+
+	foreach(lc, qual)
+	{
+		BatchQual  *bq = &(*quals)[n++];
+		const BatchCmpFunc *f;
+		Var		   *var;
+		Const	   *con;
+		bool		commuted;
+
+		f = ExecBatchMatchQual((Expr *) lfirst(lc), &var, &con, &commuted);
+		if (f == NULL)
+			elog(ERROR, "unsupported qual in tuple batch");
+
+		bq->col = ExecBatchFindColumn(batch, var->varattno);
+		bq->type = f->type;
+		bq->op = f->op;
+		bq->constval = con->constvalue;
+
+		/* "Const op Var" is "Var op' Const" with op' the commutator */
+		if (commuted)
+		{
+			switch (f->op)
+			{
+				case BATCH_CMP_LT:
+					bq->op = BATCH_CMP_GT;
+					break;
+				case BATCH_CMP_LE:
+					bq->op = BATCH_CMP_GE;
+					break;
+				case BATCH_CMP_GT:
+					bq->op = BATCH_CMP_LT;
+					break;
+				case BATCH_CMP_GE:
+					bq->op = BATCH_CMP_LE;
+					break;
+				default:
+					break;
+			}
+		}
+	}
+
+	*nquals = n;
+}
+
+/*
+ * Find the comparison kernel for a "Var op Const" or "Const op Var" clause,
+ * if there is one.  On success, also return the Var and the Const, and
+ * whether they were the other way around.
+ */
+static const BatchCmpFunc *
+ExecBatchMatchQual(Expr *clause, Var **var, Const **con, bool *commuted)
+{
+	OpExpr	   *opexpr;
+	Node	   *leftop;
+	Node	   *rightop;
+	int			i;
+
+	if (!IsA(clause, OpExpr))
+		return NULL;
+	opexpr = (OpExpr *) clause;
+	if (list_length(opexpr->args) != 2)
+		return NULL;
+
+	leftop = (Node *) linitial(opexpr->args);
+	rightop = (Node *) lsecond(opexpr->args);
+	if (IsA(leftop, Var) && IsA(rightop, Const))
+	{
+		*var = (Var *) leftop;
+		*con = (Const *) rightop;
+		*commuted = false;
+	}
+	else if (IsA(leftop, Const) && IsA(rightop, Var))
+	{
+		*var = (Var *) rightop;
+		*con = (Const *) leftop;
+		*commuted = true;
+	}
+	else
+		return NULL;
+
+	/* NULL constant makes the qual fail everywhere; not worth a kernel */
+	if ((*var)->varattno <= 0 || (*var)->varno == INNER_VAR ||
+		(*var)->varno == OUTER_VAR || (*con)->constisnull)
+		return NULL;
+
+	for (i = 0; i < lengthof(batch_cmp_funcs); i++)
+	{
+		const BatchCmpFunc *f = &batch_cmp_funcs[i];
+
+		if (f->funcid != opexpr->opfuncid)
+			continue;
+		if ((*var)->vartype != f->typid || (*con)->consttype != f->typid)
+			return NULL;
+		return f;
+	}
+
+	return NULL;
+}
+
+/*
+ * ExecBatchLoadRow
+ *		Append the row in slot to the batch.
+ */
+void
+ExecBatchLoadRow(TupleBatch *batch, TupleTableSlot *slot)
+{
+	int			row = batch->nrows++;
+	int			col;
+
+	Assert(row < BATCH_SIZE);
+
+	slot_getsomeattrs(slot, batch->lastattno);
+
+	for (col = 0; col < batch->ncols; col++)
+	{
+		int			attno = batch->attnos[col];
+
+		if (attno == 0)
+			continue;
+		batch->values[col][row] = slot->tts_values[attno - 1];
+		batch->isnull[col][row] = slot->tts_isnull[attno - 1];
+	}
+}
+
+/*
+ * Keep the selected rows for which "cmp" holds, in terms of v, the column
+ * value, and c, the constant.  NULLs never pass.  This is written without
+ * branches on the data, so that the compiler can make a tight loop of it.
+ */
+#define BATCH_FILTER(ctype, fromdatum, cmp) \
+	do { \
+		ctype		c = fromdatum(qual->constval); \
+		for (i = 0; i < nsel; i++) \
+		{ \
+			int			row = sel[i]; \
+			ctype		v = fromdatum(values[row]); \
+			sel[n] = row; \
+			n += (!isnull[row] && (cmp)); \
+		} \
+	} while (0)
+
+/*
+ * ExecBatchFilter
+ *		Set the batch's selection vector to the loaded rows passing all the
+ *		quals.
+ */
+void
+ExecBatchFilter(TupleBatch *batch, BatchQual *quals, int nquals)
+{
+	int		   *sel = batch->sel;
+	int			nsel;
+	int			q;
+	int			i;
+
+	for (i = 0; i < batch->nrows; i++)
+		sel[i] = i;
+	nsel = batch->nrows;
+
+	for (q = 0; q < nquals && nsel > 0; q++)
+	{
+		BatchQual  *qual = &quals[q];
+		Datum	   *values = batch->values[qual->col];
+		bool	   *isnull = batch->isnull[qual->col];
+		int			n = 0;
+
+		switch (qual->type)
+		{
+			case BATCH_CMP_INT4:
+				switch (qual->op)
+				{
+					case BATCH_CMP_EQ:
+						BATCH_FILTER(int32, DatumGetInt32, v == c);
+						break;
+					case BATCH_CMP_NE:
+						BATCH_FILTER(int32, DatumGetInt32, v != c);
+						break;
+					case BATCH_CMP_LT:
+						BATCH_FILTER(int32, DatumGetInt32, v < c);
+						break;
+					case BATCH_CMP_LE:
+						BATCH_FILTER(int32, DatumGetInt32, v <= c);
+						break;
+					case BATCH_CMP_GT:
+						BATCH_FILTER(int32, DatumGetInt32, v > c);
+						break;
+					case BATCH_CMP_GE:
+						BATCH_FILTER(int32, DatumGetInt32, v >= c);
+						break;
+				}
+				break;
+
+			case BATCH_CMP_INT8:
+				switch (qual->op)
+				{
+					case BATCH_CMP_EQ:
+						BATCH_FILTER(int64, DatumGetInt64, v == c);
+						break;
+					case BATCH_CMP_NE:
+						BATCH_FILTER(int64, DatumGetInt64, v != c);
+						break;
+					case BATCH_CMP_LT:
+						BATCH_FILTER(int64, DatumGetInt64, v < c);
+						break;
+					case BATCH_CMP_LE:
+						BATCH_FILTER(int64, DatumGetInt64, v <= c);
+						break;
+					case BATCH_CMP_GT:
+						BATCH_FILTER(int64, DatumGetInt64, v > c);
+						break;
+					case BATCH_CMP_GE:
+						BATCH_FILTER(int64, DatumGetInt64, v >= c);
+						break;
+				}
+				break;
+
+				/* float8 comparisons must treat NaNs the way float.c does */
+			case BATCH_CMP_FLOAT8:
+				switch (qual->op)
+				{
+					case BATCH_CMP_EQ:
+						BATCH_FILTER(float8, DatumGetFloat8,
+									 float8_cmp_internal(v, c) == 0);
+						break;
+					case BATCH_CMP_NE:
+						BATCH_FILTER(float8, DatumGetFloat8,
+									 float8_cmp_internal(v, c) != 0);
+						break;
+					case BATCH_CMP_LT:
+						BATCH_FILTER(float8, DatumGetFloat8,
+									 float8_cmp_internal(v, c) < 0);
+						break;
+					case BATCH_CMP_LE:
+						BATCH_FILTER(float8, DatumGetFloat8,
+									 float8_cmp_internal(v, c) <= 0);
+						break;
+					case BATCH_CMP_GT:
+						BATCH_FILTER(float8, DatumGetFloat8,
+									 float8_cmp_internal(v, c) > 0);
+						break;
+					case BATCH_CMP_GE:
+						BATCH_FILTER(float8, DatumGetFloat8,
+									 float8_cmp_internal(v, c) >= 0);
+						break;
+				}
+				break;
+		}
+
+		nsel = n;
+	}
+
+	batch->nsel = nsel;
+}
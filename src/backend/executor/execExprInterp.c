@@ -0,0 +1,905 @@
+/*-------------------------------------------------------------------------
+ *
+ * execExprInterp.c
+ *	  Compile expressions into flat step programs, and run them.
+ *
+ * ExecInitExpr still builds the usual ExprState tree for every expression,
+ * since some callers take those trees apart.  But for the node types accepted
+ * by ExecFlatExprSupported it installs ExecEvalFlatExprInit as the evalfunc.
+ * On first use, that walks the ExprState tree below the node, emits a linear
+ * array of ExprFlatSteps for it, and replaces itself with ExecEvalFlatExpr,
+ * which runs the steps in a loop.  Subexpressions that have no flat form
+ * become EEOP_EVAL_TREE steps that call back into the tree walker, so any
+ * expression that doesn't return a set can be compiled.
+ *
+ * Compared to walking the tree, a flat program
+ *	- deforms each input tuple once, up to the last attribute it needs, and
+ *	  then reads Vars straight out of the slot's arrays;
+ *	- evaluates function arguments directly into the FunctionCallInfo of the
+ *	  function consuming them, with no per-argument indirect call;
+ *	- handles the very common strict "scan Var op Const" call as one step;
+ *	- dispatches with computed goto where the compiler supports it.
+ *
+ * Compiling on first use rather than in ExecInitExpr keeps permission checks
+ * and function lookups where init_fcache does them, and lets us check Vars
+ * against the actual input slots the way ExecEvalScalarVar does.
+ *
+ *
+ * Portions Copyright (c) 1996-2016, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  src/backend/executor/execExprInterp.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/htup_details.h"
+#include "catalog/objectaccess.h"
+#include "executor/execExpr.h"
+#include "executor/executor.h"
+#include "miscadmin.h"
+#include "nodes/nodeFuncs.h"
+#include "pgstat.h"
+#include "utils/acl.h"
+#include "utils/builtins.h"
+#include "utils/lsyscache.h"
+
+
+/*
+ * Use computed goto for dispatch where the compiler has it, which saves a
+ * bounds check and gives the branch predictor one indirect jump per opcode
+ * to learn instead of a single shared one.  gcc and clang both support it.
+ */
+#if defined(__GNUC__)
+#define EEO_USE_COMPUTED_GOTO
+#endif
+
+#ifdef EEO_USE_COMPUTED_GOTO
+#define EEO_SWITCH()
+#define EEO_CASE(name)		CASE_##name:
+#define EEO_DISPATCH()		goto *((void *) dispatch_table[op->opcode])
+#else
+#define EEO_SWITCH()		starteval: switch ((ExprFlatOpcode) op->opcode)
+#define EEO_CASE(name)		case name:
+#define EEO_DISPATCH()		goto starteval
+#endif
+
+#define EEO_NEXT() \
+	do { \
+		op++; \
+		EEO_DISPATCH(); \
+	} while (0)
+
+#define EEO_JUMP(stepno) \
+	do { \
+		op = &steps[stepno]; \
+		EEO_DISPATCH(); \
+	} while (0)
+
+/* Working state while compiling an expression */
+typedef struct ExprFlatBuild
+{
+	ExprContext *econtext;		/* supplies the input slots for Var checks */
+	ExprFlatStep *steps;		/* steps emitted so far */
+	int			nsteps;
+	int			maxsteps;
+	int			last_inner;		/* highest attnum needed from each slot */
+	int			last_outer;
+	int			last_scan;
+} ExprFlatBuild;
+
+static Datum ExecEvalFlatExpr(ExprState *state, ExprContext *econtext,
+				 bool *isNull, ExprDoneCond *isDone);
+static void ExecFlatCompile(ExprFlatBuild *b, ExprState *state,
+				Datum *resv, bool *resnull);
+static bool ExecFlatCompileVar(ExprFlatBuild *b, Var *variable,
+				   Datum *resv, bool *resnull);
+static void ExecFlatCompileFunc(ExprFlatBuild *b, FuncExprState *fstate,
+					Datum *resv, bool *resnull);
+static void ExecFlatCompileBool(ExprFlatBuild *b, BoolExprState *bstate,
+					Datum *resv, bool *resnull);
+static bool ExecFlatCheckVar(ExprFlatBuild *b, Var *variable);
+static ExprFlatStep *ExecFlatNewStep(ExprFlatBuild *b, int opcode,
+				Datum *resv, bool *resnull);
+
+
+/*
+ * ExecFlatExprSupported - should ExecInitExpr have this node compiled?
+ *
+ * We only bother for nodes that do real work themselves; a lone Var or
+ * Const is evaluated about as fast by the tree walker.  Anything that could
+ * return a set is left alone entirely.
+ */
+bool
+ExecFlatExprSupported(Expr *node)
+{
+	switch (nodeTag(node))
+	{
+		case T_FuncExpr:
+		case T_OpExpr:
+		case T_BoolExpr:
+			break;
+		case T_NullTest:
+			if (((NullTest *) node)->argisrow)
+				return false;
+			break;
+		default:
+			return false;
+	}
+
+	return !expression_returns_set((Node *) node);
+}
+
+/*
+ * ExecEvalFlatExprInit - compile an expression on its first evaluation
+ *
+ * The program lives in the per-query memory context, like the function
+ * lookup data that init_fcache sets up.
+ */
+Datum
+ExecEvalFlatExprInit(ExprState *state, ExprContext *econtext,
+					 bool *isNull, ExprDoneCond *isDone)
+{
+	ExprFlatBuild b;
+	ExprFlatProgram *prog;
+	MemoryContext oldcontext;
+	int			nfetch;
+	int			i;
+
+	oldcontext = MemoryContextSwitchTo(econtext->ecxt_per_query_memory);
+
+	prog = (ExprFlatProgram *) palloc0(sizeof(ExprFlatProgram));
+
+	memset(&b, 0, sizeof(b));
+	b.econtext = econtext;
+	b.maxsteps = 16;
+	b.steps = (ExprFlatStep *) palloc(b.maxsteps * sizeof(ExprFlatStep));
+
+	ExecFlatCompile(&b, state, &prog->resvalue, &prog->resnull);
+	ExecFlatNewStep(&b, EEOP_DONE, NULL, NULL);
+
+	/*
+	 * Now that we know which attributes are needed, put the tuple deforming
+	 * up front, and shift the jump targets to match.
+	 */
+	nfetch = (b.last_inner > 0) + (b.last_outer > 0) + (b.last_scan > 0);
+	prog->nsteps = nfetch + b.nsteps;
+	prog->steps = (ExprFlatStep *) palloc(prog->nsteps * sizeof(ExprFlatStep));
+
+	i = 0;
+	if (b.last_inner > 0)
+	{
+		prog->steps[i].opcode = EEOP_INNER_FETCHSOME;
+		prog->steps[i].d.fetch.last = b.last_inner;
+		i++;
+	}
+	if (b.last_outer > 0)
+	{
+		prog->steps[i].opcode = EEOP_OUTER_FETCHSOME;
+		prog->steps[i].d.fetch.last = b.last_outer;
+		i++;
+	}
+	if (b.last_scan > 0)
+	{
+		prog->steps[i].opcode = EEOP_SCAN_FETCHSOME;
+		prog->steps[i].d.fetch.last = b.last_scan;
+		i++;
+	}
+	memcpy(&prog->steps[nfetch], b.steps, b.nsteps * sizeof(ExprFlatStep));
+	for (i = nfetch; i < prog->nsteps; i++)
+	{
+		switch (prog->steps[i].opcode)
+		{
+			case EEOP_BOOL_AND_STEP_FIRST:
+			case EEOP_BOOL_AND_STEP:
+			case EEOP_BOOL_AND_STEP_LAST:
+			case EEOP_BOOL_OR_STEP_FIRST:
+			case EEOP_BOOL_OR_STEP:
+			case EEOP_BOOL_OR_STEP_LAST:
+				prog->steps[i].d.boolexpr.jumpdone += nfetch;
+				break;
+			default:
+				break;
+		}
+	}
+	pfree(b.steps);
+
+	MemoryContextSwitchTo(oldcontext);
+
+	/* Skip the compilation on future executions of node */
+	state->flat = prog;
+	state->evalfunc = ExecEvalFlatExpr;
+
+	return ExecEvalFlatExpr(state, econtext, isNull, isDone);
+}
+
+/*
+ * ExecEvalFlatExpr - run a compiled expression
+ */
+static Datum
+ExecEvalFlatExpr(ExprState *state, ExprContext *econtext,
+				 bool *isNull, ExprDoneCond *isDone)
+{
+	ExprFlatProgram *prog = state->flat;
+	ExprFlatStep *steps = prog->steps;
+	ExprFlatStep *op = steps;
+	TupleTableSlot *innerslot = econtext->ecxt_innertuple;
+	TupleTableSlot *outerslot = econtext->ecxt_outertuple;
+	TupleTableSlot *scanslot = econtext->ecxt_scantuple;
+
+#ifdef EEO_USE_COMPUTED_GOTO
+
+	/*
+	 * This array has to be in the same order as enum ExprFlatOpcode.
+	 */
+	static const void *const dispatch_table[] = {
+		&&CASE_EEOP_DONE,
+		&&CASE_EEOP_INNER_FETCHSOME,
+		&&CASE_EEOP_OUTER_FETCHSOME,
+		&&CASE_EEOP_SCAN_FETCHSOME,
+		&&CASE_EEOP_INNER_VAR,
+		&&CASE_EEOP_OUTER_VAR,
+		&&CASE_EEOP_SCAN_VAR,
+		&&CASE_EEOP_CONST,
+		&&CASE_EEOP_FUNCEXPR,
+		&&CASE_EEOP_FUNCEXPR_STRICT,
+		&&CASE_EEOP_FUNCEXPR_FUSAGE,
+		&&CASE_EEOP_FUNCEXPR_SCANVAR_CONST,
+		&&CASE_EEOP_BOOL_AND_STEP_FIRST,
+		&&CASE_EEOP_BOOL_AND_STEP,
+		&&CASE_EEOP_BOOL_AND_STEP_LAST,
+		&&CASE_EEOP_BOOL_OR_STEP_FIRST,
+		&&CASE_EEOP_BOOL_OR_STEP,
+		&&CASE_EEOP_BOOL_OR_STEP_LAST,
+		&&CASE_EEOP_BOOL_NOT_STEP,
+		&&CASE_EEOP_NULLTEST_ISNULL,
+		&&CASE_EEOP_NULLTEST_ISNOTNULL,
+		&&CASE_EEOP_EVAL_TREE,
+		&&CASE_EEOP_LAST
+	};
+
+	StaticAssertStmt(EEOP_LAST + 1 == lengthof(dispatch_table),
+					 "dispatch_table out of whack with ExprFlatOpcode");
+#endif   /* EEO_USE_COMPUTED_GOTO */
+
+	if (isDone)
+		*isDone = ExprSingleResult;
+
+	EEO_DISPATCH();
+
+	EEO_SWITCH()
+	{
+		EEO_CASE(EEOP_DONE)
+		{
+			*isNull = prog->resnull;
+			return prog->resvalue;
+		}
+
+		EEO_CASE(EEOP_INNER_FETCHSOME)
+		{
+			slot_getsomeattrs(innerslot, op->d.fetch.last);
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_OUTER_FETCHSOME)
+		{
+			slot_getsomeattrs(outerslot, op->d.fetch.last);
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_SCAN_FETCHSOME)
+		{
+			slot_getsomeattrs(scanslot, op->d.fetch.last);
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_INNER_VAR)
+		{
+			int			attnum = op->d.var.attnum;
+
+			*op->resvalue = innerslot->tts_values[attnum];
+			*op->resnull = innerslot->tts_isnull[attnum];
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_OUTER_VAR)
+		{
+			int			attnum = op->d.var.attnum;
+
+			*op->resvalue = outerslot->tts_values[attnum];
+			*op->resnull = outerslot->tts_isnull[attnum];
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_SCAN_VAR)
+		{
+			int			attnum = op->d.var.attnum;
+
+			*op->resvalue = scanslot->tts_values[attnum];
+			*op->resnull = scanslot->tts_isnull[attnum];
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_CONST)
+		{
+			*op->resvalue = op->d.constval.value;
+			*op->resnull = op->d.constval.isnull;
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_FUNCEXPR)
+		{
+			FunctionCallInfo fcinfo = op->d.func.fcinfo;
+
+			fcinfo->isnull = false;
+			*op->resvalue = (op->d.func.fn_addr) (fcinfo);
+			*op->resnull = fcinfo->isnull;
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_FUNCEXPR_STRICT)
+		{
+			FunctionCallInfo fcinfo = op->d.func.fcinfo;
+			NullableDatum *args = fcinfo->args;
+			int			argno;
+
+			/* strict function, so check for NULL args */
+			for (argno = 0; argno < op->d.func.nargs; argno++)
+			{
+				if (args[argno].isnull)
+				{
+					*op->resvalue = (Datum) 0;
+					*op->resnull = true;
+					goto strictfail;
+				}
+			}
+			fcinfo->isnull = false;
+			*op->resvalue = (op->d.func.fn_addr) (fcinfo);
+			*op->resnull = fcinfo->isnull;
+
+	strictfail:
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_FUNCEXPR_FUSAGE)
+		{
+			FunctionCallInfo fcinfo = op->d.func.fcinfo;
+			PgStat_FunctionCallUsage fcusage;
+			int			argno;
+
+			if (op->d.func.finfo->fn_strict)
+			{
+				for (argno = 0; argno < op->d.func.nargs; argno++)
+				{
+					if (fcinfo->args[argno].isnull)
+					{
+						*op->resvalue = (Datum) 0;
+						*op->resnull = true;
+						goto fusagestrictfail;
+					}
+				}
+			}
+
+			pgstat_init_function_usage(fcinfo, &fcusage);
+
+			fcinfo->isnull = false;
+			*op->resvalue = (op->d.func.fn_addr) (fcinfo);
+			*op->resnull = fcinfo->isnull;
+
+			pgstat_end_function_usage(&fcusage, true);
+
+	fusagestrictfail:
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_FUNCEXPR_SCANVAR_CONST)
+		{
+			FunctionCallInfo fcinfo = op->d.func.fcinfo;
+			int			attnum = op->d.func.attnum;
+
+			/* the Const is non-null and already in place as arg 1 */
+			if (scanslot->tts_isnull[attnum])
+			{
+				*op->resvalue = (Datum) 0;
+				*op->resnull = true;
+			}
+			else
+			{
+				fcinfo->args[0].value = scanslot->tts_values[attnum];
+				fcinfo->isnull = false;
+				*op->resvalue = (op->d.func.fn_addr) (fcinfo);
+				*op->resnull = fcinfo->isnull;
+			}
+			EEO_NEXT();
+		}
+
+		/*
+		 * All the arguments of an AND or OR are evaluated into its own result
+		 * location, and checked by one of these after each.  Any argument
+		 * that settles the result jumps past the remaining ones.
+		 */
+		EEO_CASE(EEOP_BOOL_AND_STEP_FIRST)
+		{
+			*op->d.boolexpr.anynull = false;
+
+			/* FALL THROUGH to EEOP_BOOL_AND_STEP */
+		}
+
+		EEO_CASE(EEOP_BOOL_AND_STEP)
+		{
+			if (*op->resnull)
+				*op->d.boolexpr.anynull = true;
+			else if (!DatumGetBool(*op->resvalue))
+			{
+				/* result is already set to FALSE */
+				EEO_JUMP(op->d.boolexpr.jumpdone);
+			}
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_BOOL_AND_STEP_LAST)
+		{
+			/* a NULL or FALSE last input is the result; TRUE may be NULL */
+			if (!*op->resnull && DatumGetBool(*op->resvalue) &&
+				*op->d.boolexpr.anynull)
+			{
+				*op->resvalue = (Datum) 0;
+				*op->resnull = true;
+			}
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_BOOL_OR_STEP_FIRST)
+		{
+			*op->d.boolexpr.anynull = false;
+
+			/* FALL THROUGH to EEOP_BOOL_OR_STEP */
+		}
+
+		EEO_CASE(EEOP_BOOL_OR_STEP)
+		{
+			if (*op->resnull)
+				*op->d.boolexpr.anynull = true;
+			else if (DatumGetBool(*op->resvalue))
+			{
+				/* result is already set to TRUE */
+				EEO_JUMP(op->d.boolexpr.jumpdone);
+			}
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_BOOL_OR_STEP_LAST)
+		{
+			/* a NULL or TRUE last input is the result; FALSE may be NULL */
+			if (!*op->resnull && !DatumGetBool(*op->resvalue) &&
+				*op->d.boolexpr.anynull)
+			{
+				*op->resvalue = (Datum) 0;
+				*op->resnull = true;
+			}
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_BOOL_NOT_STEP)
+		{
+			/* NOT NULL is still NULL */
+			if (!*op->resnull)
+				*op->resvalue = BoolGetDatum(!DatumGetBool(*op->resvalue));
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_NULLTEST_ISNULL)
+		{
+			*op->resvalue = BoolGetDatum(*op->resnull);
+			*op->resnull = false;
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_NULLTEST_ISNOTNULL)
+		{
+			*op->resvalue = BoolGetDatum(!*op->resnull);
+			*op->resnull = false;
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_EVAL_TREE)
+		{
+			*op->resvalue = ExecEvalExpr(op->d.tree.state, econtext,
+										 op->resnull, NULL);
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_LAST)
+		{
+			/* unreachable */
+			Assert(false);
+			goto out;
+		}
+	}
+
+out:
+	elog(ERROR, "unrecognized expression step opcode: %d", op->opcode);
+	return (Datum) 0;			/* keep compiler quiet */
+}
+
+/*
+ * ExecFlatCompile - emit the steps to evaluate one ExprState subtree
+ *
+ * The steps leave their result in *resv and *resnull.
+ */
+static void
+ExecFlatCompile(ExprFlatBuild *b, ExprState *state,
+				Datum *resv, bool *resnull)
+{
+	Expr	   *node = state->expr;
+	ExprFlatStep *step;
+
+	/* Guard against stack overflow due to overly complex expressions */
+	check_stack_depth();
+
+	switch (nodeTag(node))
+	{
+		case T_Var:
+			if (IsA(state, ExprState) &&
+				ExecFlatCompileVar(b, (Var *) node, resv, resnull))
+				return;
+			break;
+
+		case T_Const:
+			{
+				Const	   *con = (Const *) node;
+
+				step = ExecFlatNewStep(b, EEOP_CONST, resv, resnull);
+				step->d.constval.value = con->constvalue;
+				step->d.constval.isnull = con->constisnull;
+			}
+			return;
+
+		case T_RelabelType:
+			/* binary-compatible, so just evaluate the argument in place */
+			if (IsA(state, GenericExprState))
+			{
+				ExecFlatCompile(b, ((GenericExprState *) state)->arg,
+								resv, resnull);
+				return;
+			}
+			break;
+
+		case T_FuncExpr:
+		case T_OpExpr:
+			if (IsA(state, FuncExprState))
+			{
+				ExecFlatCompileFunc(b, (FuncExprState *) state, resv, resnull);
+				return;
+			}
+			break;
+
+		case T_BoolExpr:
+			if (IsA(state, BoolExprState))
+			{
+				ExecFlatCompileBool(b, (BoolExprState *) state, resv, resnull);
+				return;
+			}
+			break;
+
+		case T_NullTest:
+			if (IsA(state, NullTestState) &&
+				!((NullTest *) node)->argisrow)
+			{
+				NullTest   *ntest = (NullTest *) node;
+
+				ExecFlatCompile(b, ((NullTestState *) state)->arg,
+								resv, resnull);
+				switch (ntest->nulltesttype)
+				{
+					case IS_NULL:
+						ExecFlatNewStep(b, EEOP_NULLTEST_ISNULL, resv, resnull);
+						break;
+					case IS_NOT_NULL:
+						ExecFlatNewStep(b, EEOP_NULLTEST_ISNOTNULL,
+										resv, resnull);
+						break;
+					default:
+						elog(ERROR, "unrecognized nulltesttype: %d",
+							 (int) ntest->nulltesttype);
+				}
+				return;
+			}
+			break;
+
+		default:
+			break;
+	}
+
+	/* Anything else is left to the tree walker */
+	step = ExecFlatNewStep(b, EEOP_EVAL_TREE, resv, resnull);
+	step->d.tree.state = state;
+}
+
+/*
+ * Emit a step fetching a user attribute, if we can
+ */
+static bool
+ExecFlatCompileVar(ExprFlatBuild *b, Var *variable,
+				   Datum *resv, bool *resnull)
+{
+	ExprFlatStep *step;
+	int			opcode;
+
+	if (variable->varattno <= 0 || !ExecFlatCheckVar(b, variable))
+		return false;
+
+	switch (variable->varno)
+	{
+		case INNER_VAR:
+			opcode = EEOP_INNER_VAR;
+			break;
+		case OUTER_VAR:
+			opcode = EEOP_OUTER_VAR;
+			break;
+		default:
+			/* INDEX_VAR is handled by default case */
+			opcode = EEOP_SCAN_VAR;
+			break;
+	}
+
+	step = ExecFlatNewStep(b, opcode, resv, resnull);
+	step->d.var.attnum = variable->varattno - 1;
+	return true;
+}
+
+/*
+ * Emit the steps for a function or operator call
+ */
+static void
+ExecFlatCompileFunc(ExprFlatBuild *b, FuncExprState *fstate,
+					Datum *resv, bool *resnull)
+{
+	Expr	   *node = fstate->xprstate.expr;
+	Oid			funcid;
+	Oid			inputcollid;
+	int			nargs = list_length(fstate->args);
+	FmgrInfo   *finfo;
+	FunctionCallInfo fcinfo;
+	AclResult	aclresult;
+	ExprFlatStep *step;
+	ListCell   *lc;
+	int			argno;
+
+	if (IsA(node, FuncExpr))
+	{
+		funcid = ((FuncExpr *) node)->funcid;
+		inputcollid = ((FuncExpr *) node)->inputcollid;
+	}
+	else
+	{
+		funcid = ((OpExpr *) node)->opfuncid;
+		inputcollid = ((OpExpr *) node)->inputcollid;
+	}
+
+	/* Check permission to call function, as init_fcache does */
+	aclresult = pg_proc_aclcheck(funcid, GetUserId(), ACL_EXECUTE);
+	if (aclresult != ACLCHECK_OK)
+		aclcheck_error(aclresult, ACL_KIND_PROC, get_func_name(funcid));
+	InvokeFunctionExecuteHook(funcid);
+
+	if (nargs > FUNC_MAX_ARGS)
+		ereport(ERROR,
+				(errcode(ERRCODE_TOO_MANY_ARGUMENTS),
+			 errmsg_plural("cannot pass more than %d argument to a function",
+						   "cannot pass more than %d arguments to a function",
+						   FUNC_MAX_ARGS,
+						   FUNC_MAX_ARGS)));
+
+	/* Set up the function lookup and call data, in the current context */
+	finfo = (FmgrInfo *) palloc0(sizeof(FmgrInfo));
+	fcinfo = (FunctionCallInfo) palloc0(SizeForFunctionCallInfo(nargs));
+	fmgr_info(funcid, finfo);
+	fmgr_info_set_expr((Node *) node, finfo);
+	InitFunctionCallInfoData(*fcinfo, finfo, nargs, inputcollid, NULL, NULL);
+
+	if (finfo->fn_retset)
+		elog(ERROR, "set-valued function called in context that cannot accept a set");
+
+	/*
+	 * Strict two-argument functions of a scan Var and a non-null Const are by
+	 * far the commonest quals, so they get a step of their own that reads the
+	 * Var straight from the slot.  Not when tracking function statistics.
+	 */
+	if (finfo->fn_strict && nargs == 2 &&
+		pgstat_track_functions <= finfo->fn_stats)
+	{
+		ExprState  *arg0 = (ExprState *) linitial(fstate->args);
+		ExprState  *arg1 = (ExprState *) lsecond(fstate->args);
+
+		if (IsA(arg0, ExprState) && IsA(arg0->expr, Var) &&
+			IsA(arg1->expr, Const))
+		{
+			Var		   *variable = (Var *) arg0->expr;
+			Const	   *con = (Const *) arg1->expr;
+
+			if (variable->varno != INNER_VAR &&
+				variable->varno != OUTER_VAR &&
+				variable->varattno > 0 &&
+				!con->constisnull &&
+				ExecFlatCheckVar(b, variable))
+			{
+				fcinfo->args[1].value = con->constvalue;
+				fcinfo->args[0].isnull = false;
+				fcinfo->args[1].isnull = false;
+
+				step = ExecFlatNewStep(b, EEOP_FUNCEXPR_SCANVAR_CONST,
+									   resv, resnull);
+				step->d.func.finfo = finfo;
+				step->d.func.fcinfo = fcinfo;
+				step->d.func.fn_addr = finfo->fn_addr;
+				step->d.func.nargs = nargs;
+				step->d.func.attnum = variable->varattno - 1;
+				return;
+			}
+		}
+	}
+
+	/* Evaluate the arguments directly into the call data */
+	argno = 0;
+	foreach(lc, fstate->args)
+	{
+		ExecFlatCompile(b, (ExprState *) lfirst(lc),
+						&fcinfo->args[argno].value, &fcinfo->args[argno].isnull);
+		argno++;
+	}
+
+	if (pgstat_track_functions > finfo->fn_stats)
+		step = ExecFlatNewStep(b, EEOP_FUNCEXPR_FUSAGE, resv, resnull);
+	else if (finfo->fn_strict && nargs > 0)
+		step = ExecFlatNewStep(b, EEOP_FUNCEXPR_STRICT, resv, resnull);
+	else
+		step = ExecFlatNewStep(b, EEOP_FUNCEXPR, resv, resnull);
+	step->d.func.finfo = finfo;
+	step->d.func.fcinfo = fcinfo;
+	step->d.func.fn_addr = finfo->fn_addr;
+	step->d.func.nargs = nargs;
+	step->d.func.attnum = 0;
+}
+
+/*
+ * Emit the steps for AND, OR or NOT
+ */
+static void
+ExecFlatCompileBool(ExprFlatBuild *b, BoolExprState *bstate,
+					Datum *resv, bool *resnull)
+{
+	BoolExpr   *boolexpr = (BoolExpr *) bstate->xprstate.expr;
+	int			nargs = list_length(bstate->args);
+	int		   *stepnos;
+	bool	   *anynull;
+	ListCell   *lc;
+	int			argno;
+
+	if (boolexpr->boolop == NOT_EXPR)
+	{
+		ExecFlatCompile(b, (ExprState *) linitial(bstate->args),
+						resv, resnull);
+		ExecFlatNewStep(b, EEOP_BOOL_NOT_STEP, resv, resnull);
+		return;
+	}
+
+	if (boolexpr->boolop != AND_EXPR && boolexpr->boolop != OR_EXPR)
+		elog(ERROR, "unrecognized boolop: %d", (int) boolexpr->boolop);
+
+	/* all the arguments share the result location and the NULL tracker */
+	anynull = (bool *) palloc(sizeof(bool));
+	*anynull = false;
+	stepnos = (int *) palloc(nargs * sizeof(int));
+
+	argno = 0;
+	foreach(lc, bstate->args)
+	{
+		ExprFlatStep *step;
+		int			opcode;
+
+		ExecFlatCompile(b, (ExprState *) lfirst(lc), resv, resnull);
+
+		if (boolexpr->boolop == AND_EXPR)
+			opcode = (argno == nargs - 1) ? EEOP_BOOL_AND_STEP_LAST :
+				(argno == 0) ? EEOP_BOOL_AND_STEP_FIRST : EEOP_BOOL_AND_STEP;
+		else
+			opcode = (argno == nargs - 1) ? EEOP_BOOL_OR_STEP_LAST :
+				(argno == 0) ? EEOP_BOOL_OR_STEP_FIRST : EEOP_BOOL_OR_STEP;
+
+		step = ExecFlatNewStep(b, opcode, resv, resnull);
+		step->d.boolexpr.anynull = anynull;
+		stepnos[argno++] = b->nsteps - 1;
+	}
+
+	/* now that we know where the expression ends, fill in the jumps */
+	for (argno = 0; argno < nargs; argno++)
+		b->steps[stepnos[argno]].d.boolexpr.jumpdone = b->nsteps;
+
+	pfree(stepnos);
+}
+
+/*
+ * ExecFlatCheckVar - validate a user-attribute Var against its input slot
+ *
+ * These are the checks ExecEvalScalarVar makes on its first call.  Returns
+ * false, leaving the Var to the tree walker, if it refers to a dropped
+ * column; otherwise notes that the attribute must be deformed.
+ */
+static bool
+ExecFlatCheckVar(ExprFlatBuild *b, Var *variable)
+{
+	AttrNumber	attnum = variable->varattno;
+	TupleTableSlot *slot;
+	int		   *last;
+
+	Assert(attnum > 0);
+
+	switch (variable->varno)
+	{
+		case INNER_VAR:
+			slot = b->econtext->ecxt_innertuple;
+			last = &b->last_inner;
+			break;
+		case OUTER_VAR:
+			slot = b->econtext->ecxt_outertuple;
+			last = &b->last_outer;
+			break;
+		default:
+			slot = b->econtext->ecxt_scantuple;
+			last = &b->last_scan;
+			break;
+	}
+
+	if (slot != NULL)
+	{
+		TupleDesc	slot_tupdesc = slot->tts_tupleDescriptor;
+		Form_pg_attribute attr;
+
+		if (attnum > slot_tupdesc->natts)		/* should never happen */
+			elog(ERROR, "attribute number %d exceeds number of columns %d",
+				 attnum, slot_tupdesc->natts);
+
+		attr = slot_tupdesc->attrs[attnum - 1];
+
+		if (attr->attisdropped)
+			return false;
+
+		if (variable->vartype != attr->atttypid)
+			ereport(ERROR,
+					(errcode(ERRCODE_DATATYPE_MISMATCH),
+					 errmsg("attribute %d has wrong type", attnum),
+					 errdetail("Table has type %s, but query expects %s.",
+							   format_type_be(attr->atttypid),
+							   format_type_be(variable->vartype))));
+	}
+
+	*last = Max(*last, attnum);
+	return true;
+}
+
+/*
+ * Append a step to the program being built
+ */
+static ExprFlatStep *
+ExecFlatNewStep(ExprFlatBuild *b, int opcode, Datum *resv, bool *resnull)
+{
+	ExprFlatStep *step;
+
+	if (b->nsteps >= b->maxsteps)
+	{
+		b->maxsteps *= 2;
+		b->steps = (ExprFlatStep *)
+			repalloc(b->steps, b->maxsteps * sizeof(ExprFlatStep));
+	}
+
+	step = &b->steps[b->nsteps++];
+	memset(step, 0, sizeof(ExprFlatStep));
+	step->opcode = opcode;
+	step->resvalue = resv;
+	step->resnull = resnull;
+	return step;
+}
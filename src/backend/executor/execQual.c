@@ -41,6 +41,7 @@
 #include "access/tupconvert.h"
 #include "catalog/objectaccess.h"
 #include "catalog/pg_type.h"
+#include "executor/execExpr.h"
 #include "executor/execdebug.h"
 #include "executor/nodeSubplan.h"
 #include "funcapi.h"
@@ -1350,8 +1351,11 @@ init_fcache(Oid foid, Oid input_collation, FuncExprState *fcache,
 	fmgr_info_cxt(foid, &(fcache->func), fcacheCxt);
 	fmgr_info_set_expr((Node *) fcache->xprstate.expr, &(fcache->func));
 
-	/* Initialize the function call parameter struct as well */
-	InitFunctionCallInfoData(fcache->fcinfo_data, &(fcache->func),
+	/* Allocate and initialize the function call parameter struct as well */
+	fcache->fcinfo = (FunctionCallInfo)
+		MemoryContextAlloc(fcacheCxt,
+						   SizeForFunctionCallInfo(list_length(fcache->args)));
+	InitFunctionCallInfoData(*fcache->fcinfo, &(fcache->func),
 							 list_length(fcache->args),
 							 input_collation, NULL, NULL);
 
@@ -1515,10 +1519,10 @@ ExecEvalFuncArgs(FunctionCallInfo fcinfo,
 		ExprState  *argstate = (ExprState *) lfirst(arg);
 		ExprDoneCond thisArgIsDone;
 
-		fcinfo->arg[i] = ExecEvalExpr(argstate,
-									  econtext,
-									  &fcinfo->argnull[i],
-									  &thisArgIsDone);
+		fcinfo->args[i].value = ExecEvalExpr(argstate,
+											 econtext,
+											 &fcinfo->args[i].isnull,
+											 &thisArgIsDone);
 
 		if (thisArgIsDone != ExprSingleResult)
 		{
@@ -1740,7 +1744,7 @@ restart:
 	 * previous call (ie, we are continuing the evaluation of a set-valued
 	 * function).  Otherwise, collect the current argument values into fcinfo.
 	 */
-	fcinfo = &fcache->fcinfo_data;
+	fcinfo = fcache->fcinfo;
 	arguments = fcache->args;
 	if (!fcache->setArgsValid)
 	{
@@ -1818,7 +1822,7 @@ restart:
 			{
 				for (i = 0; i < fcinfo->nargs; i++)
 				{
-					if (fcinfo->argnull[i])
+					if (fcinfo->args[i].isnull)
 					{
 						callit = false;
 						break;
@@ -1961,7 +1965,7 @@ restart:
 		{
 			for (i = 0; i < fcinfo->nargs; i++)
 			{
-				if (fcinfo->argnull[i])
+				if (fcinfo->args[i].isnull)
 				{
 					*isNull = true;
 					return (Datum) 0;
@@ -2006,16 +2010,16 @@ ExecMakeFunctionResultNoSets(FuncExprState *fcache,
 		*isDone = ExprSingleResult;
 
 	/* inlined, simplified version of ExecEvalFuncArgs */
-	fcinfo = &fcache->fcinfo_data;
+	fcinfo = fcache->fcinfo;
 	i = 0;
 	foreach(arg, fcache->args)
 	{
 		ExprState  *argstate = (ExprState *) lfirst(arg);
 
-		fcinfo->arg[i] = ExecEvalExpr(argstate,
-									  econtext,
-									  &fcinfo->argnull[i],
-									  NULL);
+		fcinfo->args[i].value = ExecEvalExpr(argstate,
+											 econtext,
+											 &fcinfo->args[i].isnull,
+											 NULL);
 		i++;
 	}
 
@@ -2027,7 +2031,7 @@ ExecMakeFunctionResultNoSets(FuncExprState *fcache,
 	{
 		while (--i >= 0)
 		{
-			if (fcinfo->argnull[i])
+			if (fcinfo->args[i].isnull)
 			{
 				*isNull = true;
 				return (Datum) 0;
@@ -2065,7 +2069,7 @@ ExecMakeTableFunctionResult(ExprState *funcexpr,
 	Oid			funcrettype;
 	bool		returnsTuple;
 	bool		returnsSet = false;
-	FunctionCallInfoData fcinfo;
+	FunctionCallInfo fcinfo;
 	PgStat_FunctionCallUsage fcusage;
 	ReturnSetInfo rsinfo;
 	HeapTupleData tmptup;
@@ -2098,6 +2102,17 @@ ExecMakeTableFunctionResult(ExprState *funcexpr,
 	rsinfo.setResult = NULL;
 	rsinfo.setDesc = NULL;
 
+	/*
+	 * The call parameter struct and the function's argument values are kept
+	 * in argContext.  We can't use the per-tuple context: the argument values
+	 * would disappear when we reset that context in the inner loop.  And the
+	 * caller's CurrentMemoryContext is typically a query-lifespan context, so
+	 * we don't want to leak memory there.  We require the caller to pass a
+	 * separate memory context that can be used for this, and can be reset
+	 * each time through to avoid bloat.
+	 */
+	MemoryContextReset(argContext);
+
 	/*
 	 * Normally the passed expression tree will be a FuncExprState, since the
 	 * grammar only allows a function call at the top level of a table
@@ -2130,24 +2145,19 @@ ExecMakeTableFunctionResult(ExprState *funcexpr,
 						econtext->ecxt_per_query_memory, false);
 		}
 		returnsSet = fcache->func.fn_retset;
-		InitFunctionCallInfoData(fcinfo, &(fcache->func),
-								 list_length(fcache->args),
-								 fcache->fcinfo_data.fncollation,
-								 NULL, (Node *) &rsinfo);
 
 		/*
-		 * Evaluate the function's argument list.
-		 *
-		 * We can't do this in the per-tuple context: the argument values
-		 * would disappear when we reset that context in the inner loop.  And
-		 * the caller's CurrentMemoryContext is typically a query-lifespan
-		 * context, so we don't want to leak memory there.  We require the
-		 * caller to pass a separate memory context that can be used for this,
-		 * and can be reset each time through to avoid bloat.
+		 * Set up the call parameter struct and evaluate the function's
+		 * argument list, both in argContext.
 		 */
-		MemoryContextReset(argContext);
 		oldcontext = MemoryContextSwitchTo(argContext);
-		argDone = ExecEvalFuncArgs(&fcinfo, fcache->args, econtext);
+		fcinfo = (FunctionCallInfo)
+			palloc(SizeForFunctionCallInfo(list_length(fcache->args)));
+		InitFunctionCallInfoData(*fcinfo, &(fcache->func),
+								 list_length(fcache->args),
+								 fcache->fcinfo->fncollation,
+								 NULL, (Node *) &rsinfo);
+		argDone = ExecEvalFuncArgs(fcinfo, fcache->args, econtext);
 		MemoryContextSwitchTo(oldcontext);
 
 		/* We don't allow sets in the arguments of the table function */
@@ -2165,9 +2175,9 @@ ExecMakeTableFunctionResult(ExprState *funcexpr,
 		{
 			int			i;
 
-			for (i = 0; i < fcinfo.nargs; i++)
+			for (i = 0; i < fcinfo->nargs; i++)
 			{
-				if (fcinfo.argnull[i])
+				if (fcinfo->args[i].isnull)
 					goto no_function_result;
 			}
 		}
@@ -2176,7 +2186,9 @@ ExecMakeTableFunctionResult(ExprState *funcexpr,
 	{
 		/* Treat funcexpr as a generic expression */
 		direct_function_call = false;
-		InitFunctionCallInfoData(fcinfo, NULL, 0, InvalidOid, NULL, NULL);
+		fcinfo = (FunctionCallInfo)
+			MemoryContextAlloc(argContext, SizeForFunctionCallInfo(0));
+		InitFunctionCallInfoData(*fcinfo, NULL, 0, InvalidOid, NULL, NULL);
 	}
 
 	/*
@@ -2204,11 +2216,11 @@ ExecMakeTableFunctionResult(ExprState *funcexpr,
 		/* Call the function or expression one time */
 		if (direct_function_call)
 		{
-			pgstat_init_function_usage(&fcinfo, &fcusage);
+			pgstat_init_function_usage(fcinfo, &fcusage);
 
-			fcinfo.isnull = false;
+			fcinfo->isnull = false;
 			rsinfo.isDone = ExprSingleResult;
-			result = FunctionCallInvoke(&fcinfo);
+			result = FunctionCallInvoke(fcinfo);
 
 			pgstat_end_function_usage(&fcusage,
 									  rsinfo.isDone != ExprMultipleResult);
@@ -2216,7 +2228,7 @@ ExecMakeTableFunctionResult(ExprState *funcexpr,
 		else
 		{
 			result = ExecEvalExpr(funcexpr, econtext,
-								  &fcinfo.isnull, &rsinfo.isDone);
+								  &fcinfo->isnull, &rsinfo.isDone);
 		}
 
 		/* Which protocol does function want to use? */
@@ -2256,7 +2268,7 @@ ExecMakeTableFunctionResult(ExprState *funcexpr,
 			 */
 			if (returnsTuple)
 			{
-				if (!fcinfo.isnull)
+				if (!fcinfo->isnull)
 				{
 					HeapTupleHeader td = DatumGetHeapTupleHeader(result);
 
@@ -2317,7 +2329,7 @@ ExecMakeTableFunctionResult(ExprState *funcexpr,
 			else
 			{
 				/* Scalar-type case: just store the function result */
-				tuplestore_putvalues(tupstore, tupdesc, &result, &fcinfo.isnull);
+				tuplestore_putvalues(tupstore, tupdesc, &result, &fcinfo->isnull);
 			}
 
 			/*
@@ -2514,7 +2526,7 @@ ExecEvalDistinct(FuncExprState *fcache,
 	/*
 	 * Evaluate arguments
 	 */
-	fcinfo = &fcache->fcinfo_data;
+	fcinfo = fcache->fcinfo;
 	argDone = ExecEvalFuncArgs(fcinfo, fcache->args, econtext);
 	if (argDone != ExprSingleResult)
 		ereport(ERROR,
@@ -2522,12 +2534,12 @@ ExecEvalDistinct(FuncExprState *fcache,
 				 errmsg("IS DISTINCT FROM does not support set arguments")));
 	Assert(fcinfo->nargs == 2);
 
-	if (fcinfo->argnull[0] && fcinfo->argnull[1])
+	if (fcinfo->args[0].isnull && fcinfo->args[1].isnull)
 	{
 		/* Both NULL? Then is not distinct... */
 		result = BoolGetDatum(FALSE);
 	}
-	else if (fcinfo->argnull[0] || fcinfo->argnull[1])
+	else if (fcinfo->args[0].isnull || fcinfo->args[1].isnull)
 	{
 		/* Only one is NULL? Then is distinct... */
 		result = BoolGetDatum(TRUE);
@@ -2591,7 +2603,7 @@ ExecEvalScalarArrayOp(ScalarArrayOpExprState *sstate,
 	/*
 	 * Evaluate arguments
 	 */
-	fcinfo = &sstate->fxprstate.fcinfo_data;
+	fcinfo = sstate->fxprstate.fcinfo;
 	argDone = ExecEvalFuncArgs(fcinfo, sstate->fxprstate.args, econtext);
 	if (argDone != ExprSingleResult)
 		ereport(ERROR,
@@ -2603,13 +2615,13 @@ ExecEvalScalarArrayOp(ScalarArrayOpExprState *sstate,
 	 * If the array is NULL then we return NULL --- it's not very meaningful
 	 * to do anything else, even if the operator isn't strict.
 	 */
-	if (fcinfo->argnull[1])
+	if (fcinfo->args[1].isnull)
 	{
 		*isNull = true;
 		return (Datum) 0;
 	}
 	/* Else okay to fetch and detoast the array */
-	arr = DatumGetArrayTypeP(fcinfo->arg[1]);
+	arr = DatumGetArrayTypeP(fcinfo->args[1].value);
 
 	/*
 	 * If the array is empty, we return either FALSE or TRUE per the useOr
@@ -2625,7 +2637,7 @@ ExecEvalScalarArrayOp(ScalarArrayOpExprState *sstate,
 	 * If the scalar is NULL, and the function is strict, return NULL; no
 	 * point in iterating the loop.
 	 */
-	if (fcinfo->argnull[0] && sstate->fxprstate.func.fn_strict)
+	if (fcinfo->args[0].isnull && sstate->fxprstate.func.fn_strict)
 	{
 		*isNull = true;
 		return (Datum) 0;
@@ -2663,20 +2675,20 @@ ExecEvalScalarArrayOp(ScalarArrayOpExprState *sstate,
 		/* Get array element, checking for NULL */
 		if (bitmap && (*bitmap & bitmask) == 0)
 		{
-			fcinfo->arg[1] = (Datum) 0;
-			fcinfo->argnull[1] = true;
+			fcinfo->args[1].value = (Datum) 0;
+			fcinfo->args[1].isnull = true;
 		}
 		else
 		{
 			elt = fetch_att(s, typbyval, typlen);
 			s = att_addlength_pointer(s, typlen, s);
 			s = (char *) att_align_nominal(s, typalign);
-			fcinfo->arg[1] = elt;
-			fcinfo->argnull[1] = false;
+			fcinfo->args[1].value = elt;
+			fcinfo->args[1].isnull = false;
 		}
 
 		/* Call comparison function */
-		if (fcinfo->argnull[1] && sstate->fxprstate.func.fn_strict)
+		if (fcinfo->args[1].isnull && sstate->fxprstate.func.fn_strict)
 		{
 			fcinfo->isnull = true;
 			thisresult = (Datum) 0;
@@ -3395,21 +3407,21 @@ ExecEvalRowCompare(RowCompareExprState *rstate,
 	{
 		ExprState  *le = (ExprState *) lfirst(l);
 		ExprState  *re = (ExprState *) lfirst(r);
-		FunctionCallInfoData locfcinfo;
+		LOCAL_FCINFO(locfcinfo, 2);
 
-		InitFunctionCallInfoData(locfcinfo, &(rstate->funcs[i]), 2,
+		InitFunctionCallInfoData(*locfcinfo, &(rstate->funcs[i]), 2,
 								 rstate->collations[i],
 								 NULL, NULL);
-		locfcinfo.arg[0] = ExecEvalExpr(le, econtext,
-										&locfcinfo.argnull[0], NULL);
-		locfcinfo.arg[1] = ExecEvalExpr(re, econtext,
-										&locfcinfo.argnull[1], NULL);
+		locfcinfo->args[0].value = ExecEvalExpr(le, econtext,
+												&locfcinfo->args[0].isnull, NULL);
+		locfcinfo->args[1].value = ExecEvalExpr(re, econtext,
+												&locfcinfo->args[1].isnull, NULL);
 		if (rstate->funcs[i].fn_strict &&
-			(locfcinfo.argnull[0] || locfcinfo.argnull[1]))
+			(locfcinfo->args[0].isnull || locfcinfo->args[1].isnull))
 			return (Datum) 0;	/* force NULL result */
-		locfcinfo.isnull = false;
-		cmpresult = DatumGetInt32(FunctionCallInvoke(&locfcinfo));
-		if (locfcinfo.isnull)
+		locfcinfo->isnull = false;
+		cmpresult = DatumGetInt32(FunctionCallInvoke(locfcinfo));
+		if (locfcinfo->isnull)
 			return (Datum) 0;	/* force NULL result */
 		if (cmpresult != 0)
 			break;				/* no need to compare remaining columns */
@@ -3482,17 +3494,17 @@ ExecEvalMinMax(MinMaxExprState *minmaxExpr, ExprContext *econtext,
 	MinMaxExpr *minmax = (MinMaxExpr *) minmaxExpr->xprstate.expr;
 	Oid			collation = minmax->inputcollid;
 	MinMaxOp	op = minmax->op;
-	FunctionCallInfoData locfcinfo;
+	LOCAL_FCINFO(locfcinfo, 2);
 	ListCell   *arg;
 
 	if (isDone)
 		*isDone = ExprSingleResult;
 	*isNull = true;				/* until we get a result */
 
-	InitFunctionCallInfoData(locfcinfo, &minmaxExpr->cfunc, 2,
+	InitFunctionCallInfoData(*locfcinfo, &minmaxExpr->cfunc, 2,
 							 collation, NULL, NULL);
-	locfcinfo.argnull[0] = false;
-	locfcinfo.argnull[1] = false;
+	locfcinfo->args[0].isnull = false;
+	locfcinfo->args[1].isnull = false;
 
 	foreach(arg, minmaxExpr->args)
 	{
@@ -3514,11 +3526,11 @@ ExecEvalMinMax(MinMaxExprState *minmaxExpr, ExprContext *econtext,
 		else
 		{
 			/* apply comparison function */
-			locfcinfo.arg[0] = result;
-			locfcinfo.arg[1] = value;
-			locfcinfo.isnull = false;
-			cmpresult = DatumGetInt32(FunctionCallInvoke(&locfcinfo));
-			if (locfcinfo.isnull)		/* probably should not happen */
+			locfcinfo->args[0].value = result;
+			locfcinfo->args[1].value = value;
+			locfcinfo->isnull = false;
+			cmpresult = DatumGetInt32(FunctionCallInvoke(locfcinfo));
+			if (locfcinfo->isnull)		/* probably should not happen */
 				continue;
 			if (cmpresult > 0 && op == IS_LEAST)
 				result = value;
@@ -3784,7 +3796,7 @@ ExecEvalNullIf(FuncExprState *nullIfExpr,
 	/*
 	 * Evaluate arguments
 	 */
-	fcinfo = &nullIfExpr->fcinfo_data;
+	fcinfo = nullIfExpr->fcinfo;
 	argDone = ExecEvalFuncArgs(fcinfo, nullIfExpr->args, econtext);
 	if (argDone != ExprSingleResult)
 		ereport(ERROR,
@@ -3793,7 +3805,7 @@ ExecEvalNullIf(FuncExprState *nullIfExpr,
 	Assert(fcinfo->nargs == 2);
 
 	/* if either argument is NULL they can't be equal */
-	if (!fcinfo->argnull[0] && !fcinfo->argnull[1])
+	if (!fcinfo->args[0].isnull && !fcinfo->args[1].isnull)
 	{
 		fcinfo->isnull = false;
 		result = FunctionCallInvoke(fcinfo);
@@ -3806,8 +3818,8 @@ ExecEvalNullIf(FuncExprState *nullIfExpr,
 	}
 
 	/* else return first argument */
-	*isNull = fcinfo->argnull[0];
-	return fcinfo->arg[0];
+	*isNull = fcinfo->args[0].isnull;
+	return fcinfo->args[0].value;
 }
 
 /* ----------------------------------------------------------------
@@ -4345,7 +4357,7 @@ ExecEvalArrayCoerceExpr(ArrayCoerceExprState *astate,
 {
 	ArrayCoerceExpr *acoerce = (ArrayCoerceExpr *) astate->xprstate.expr;
 	Datum		result;
-	FunctionCallInfoData locfcinfo;
+	LOCAL_FCINFO(locfcinfo, 3);
 
 	result = ExecEvalExpr(astate->arg, econtext, isNull, isDone);
 
@@ -4394,16 +4406,16 @@ ExecEvalArrayCoerceExpr(ArrayCoerceExprState *astate,
 	 *
 	 * Note: coercion functions are assumed to not use collation.
 	 */
-	InitFunctionCallInfoData(locfcinfo, &(astate->elemfunc), 3,
+	InitFunctionCallInfoData(*locfcinfo, &(astate->elemfunc), 3,
 							 InvalidOid, NULL, NULL);
-	locfcinfo.arg[0] = result;
-	locfcinfo.arg[1] = Int32GetDatum(acoerce->resulttypmod);
-	locfcinfo.arg[2] = BoolGetDatum(acoerce->isExplicit);
-	locfcinfo.argnull[0] = false;
-	locfcinfo.argnull[1] = false;
-	locfcinfo.argnull[2] = false;
-
-	return array_map(&locfcinfo, astate->resultelemtype, astate->amstate);
+	locfcinfo->args[0].value = result;
+	locfcinfo->args[1].value = Int32GetDatum(acoerce->resulttypmod);
+	locfcinfo->args[2].value = BoolGetDatum(acoerce->isExplicit);
+	locfcinfo->args[0].isnull = false;
+	locfcinfo->args[1].isnull = false;
+	locfcinfo->args[2].isnull = false;
+
+	return array_map(locfcinfo, astate->resultelemtype, astate->amstate);
 }
 
 /* ----------------------------------------------------------------
@@ -5194,6 +5206,15 @@ ExecInitExpr(Expr *node, PlanState *parent)
 	/* Common code for all state-node types */
 	state->expr = node;
 
+	/*
+	 * Have suitable expressions compiled into a flat program on first use.
+	 * The state tree built above is kept, both for the parts of the
+	 * expression the program doesn't handle itself and for callers that
+	 * inspect it.
+	 */
+	if (ExecFlatExprSupported(node))
+		state->evalfunc = ExecEvalFlatExprInit;
+
 	return state;
 }
 
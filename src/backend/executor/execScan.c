@@ -19,6 +19,7 @@
 #include "postgres.h"
 
 #include "executor/executor.h"
+#include "executor/nodeHash.h"
 #include "miscadmin.h"
 #include "utils/memutils.h"
 
@@ -136,10 +137,11 @@ ExecScan(ScanState *node,
 	econtext = node->ps.ps_ExprContext;
 
 	/*
-	 * If we have neither a qual to check nor a projection to do, just skip
-	 * all the overhead and return the raw scan tuple.
+	 * If we have neither a qual to check nor a projection to do, nor a
+	 * runtime filter to apply, just skip all the overhead and return the raw
+	 * scan tuple.
 	 */
-	if (!qual && !projInfo)
+	if (!qual && !projInfo && !node->ss_RuntimeFilter)
 	{
 		ResetExprContext(econtext);
 		return ExecScanFetch(node, accessMtd, recheckMtd);
@@ -208,9 +210,15 @@ ExecScan(ScanState *node,
 		if (!qual || ExecQual(qual, econtext, false))
 		{
 			/*
-			 * Found a satisfactory scan tuple.
+			 * Found a satisfactory scan tuple, unless a hash join above us
+			 * knows it has no join partner.
 			 */
-			if (projInfo)
+			if (node->ss_RuntimeFilter != NULL &&
+				!ExecHashRuntimeFilterPass(node->ss_RuntimeFilter, econtext))
+			{
+				InstrCountFiltered3(node, 1);
+			}
+			else if (projInfo)
 			{
 				/*
 				 * Form a projection tuple, store it in the result tuple slot
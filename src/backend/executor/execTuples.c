@@ -123,6 +123,7 @@ MakeTupleTableSlot(void)
 	slot->tts_values = NULL;
 	slot->tts_isnull = NULL;
 	slot->tts_mintuple = NULL;
+	slot->tts_deform = NULL;
 
 	return slot;
 }
@@ -180,6 +181,8 @@ ExecResetTupleTable(List *tupleTable,	/* tuple table */
 				pfree(slot->tts_values);
 			if (slot->tts_isnull)
 				pfree(slot->tts_isnull);
+			if (slot->tts_deform)
+				pfree(slot->tts_deform);
 			pfree(slot);
 		}
 	}
@@ -227,6 +230,8 @@ ExecDropSingleTupleTableSlot(TupleTableSlot *slot)
 		pfree(slot->tts_values);
 	if (slot->tts_isnull)
 		pfree(slot->tts_isnull);
+	if (slot->tts_deform)
+		pfree(slot->tts_deform);
 	pfree(slot);
 }
 
@@ -250,12 +255,15 @@ void
 ExecSetSlotDescriptor(TupleTableSlot *slot,		/* slot to change */
 					  TupleDesc tupdesc)		/* new tuple descriptor */
 {
+	MemoryContext oldcontext;
+
 	/* For safety, make sure slot is empty before changing it */
 	ExecClearTuple(slot);
 
 	/*
-	 * Release any old descriptor.  Also release old Datum/isnull arrays if
-	 * present (we don't bother to check if they could be re-used).
+	 * Release any old descriptor.  Also release old Datum/isnull arrays and
+	 * deform program if present (we don't bother to check if they could be
+	 * re-used).
 	 */
 	if (slot->tts_tupleDescriptor)
 		ReleaseTupleDesc(slot->tts_tupleDescriptor);
@@ -264,6 +272,8 @@ ExecSetSlotDescriptor(TupleTableSlot *slot,		/* slot to change */
 		pfree(slot->tts_values);
 	if (slot->tts_isnull)
 		pfree(slot->tts_isnull);
+	if (slot->tts_deform)
+		pfree(slot->tts_deform);
 
 	/*
 	 * Install the new descriptor; if it's refcounted, bump its refcount.
@@ -279,6 +289,14 @@ ExecSetSlotDescriptor(TupleTableSlot *slot,		/* slot to change */
 		MemoryContextAlloc(slot->tts_mcxt, tupdesc->natts * sizeof(Datum));
 	slot->tts_isnull = (bool *)
 		MemoryContextAlloc(slot->tts_mcxt, tupdesc->natts * sizeof(bool));
+
+	/*
+	 * Precompute how to extract the descriptor's leading fixed-width
+	 * attributes, so that slot_deform_tuple needn't work it out per tuple.
+	 */
+	oldcontext = MemoryContextSwitchTo(slot->tts_mcxt);
+	slot->tts_deform = slot_build_deform_program(tupdesc);
+	MemoryContextSwitchTo(oldcontext);
 }
 
 /* --------------------------------
@@ -34,9 +34,15 @@
  *	  input tuples and eliminate duplicates (if required) before performing
  *	  the above-depicted process.  (However, we don't do that for ordered-set
  *	  aggregates; their "ORDER BY" inputs are ordinary aggregate arguments
- *	  so far as this module is concerned.)	Note that partial aggregation
- *	  is not supported in these cases, since we couldn't ensure global
- *	  ordering or distinctness of the inputs.
+ *	  so far as this module is concerned.)	A DISTINCT aggregate without
+ *	  ORDER BY that doesn't care about the order of its input instead
+ *	  remembers the inputs it has seen in a hash table, and skips the
+ *	  transition step for repeats; this also works in hashed aggregation,
+ *	  where many groups are in progress at once.  If the table of a sorted
+ *	  group grows past work_mem, the inputs it hasn't seen are sorted as
+ *	  usual instead.  Note that partial aggregation is not supported in
+ *	  these cases, since we couldn't ensure global ordering or distinctness
+ *	  of the inputs.
  *
  *	  If transfunc is marked "strict" in pg_proc and initcond is NULL,
  *	  then the first non-NULL input_value is assigned directly to transvalue,
@@ -69,10 +75,11 @@
  *	  pass-by-reference, we have to be careful to copy it into a longer-lived
  *	  memory context, and free the prior value to avoid memory leakage.  We
  *	  store transvalues in another set of econtexts, aggstate->aggcontexts
- *	  (one per grouping set, see below), which are also used for the hashtable
- *	  structures in AGG_HASHED mode.  These econtexts are rescanned, not just
- *	  reset, at group boundaries so that aggregate transition functions can
- *	  register shutdown callbacks via AggRegisterCallback.
+ *	  (one per grouping set, see below), or, for hashed grouping sets, in
+ *	  aggstate->hashcontext, which also holds the hashtable structures.
+ *	  These econtexts are rescanned, not just reset, at group boundaries so
+ *	  that aggregate transition functions can register shutdown callbacks via
+ *	  AggRegisterCallback.
  *
  *	  The node's regular econtext (aggstate->ss.ps.ps_ExprContext) is used to
  *	  run finalize functions and compute the output tuple; this context can be
@@ -136,7 +143,43 @@
  *	  sensitive to the grouping set for which the aggregate function is
  *	  currently being called.
  *
- *	  TODO: AGG_HASHED doesn't support multiple grouping sets yet.
+ *	  Grouping sets can also be computed by hashing.  In AGG_HASHED mode
+ *	  each grouping set gets its own hash table, and every input tuple is
+ *	  entered into all of them in a single pass; the tables are then read
+ *	  out one after another.  In AGG_MIXED mode some sets are hashed and
+ *	  the rest are computed by the sorted phases as above: the hash tables
+ *	  are filled while the first sorted phase reads the input, and emptied
+ *	  once the last sorted phase has finished.  When hashing is used, all
+ *	  the hashed sets belong to phase 0, and the sorted phases of AGG_MIXED
+ *	  mode are numbered from 1; in AGG_SORTED mode, phase 0 is the first
+ *	  sorted phase as before.  Spilling to disk is only done when there is
+ *	  exactly one hash table and no sorted phase; the planner only chooses
+ *	  to hash several sets when it expects the tables to fit in work_mem.
+ *
+ *	  Batch mode:
+ *
+ *	  When the input is a SeqScan that can return its rows in batches (see
+ *	  execBatch.c), there are no grouping sets, and every transition state
+ *	  uses one of a handful of common transition functions (count, sum,
+ *	  min and max over int4, int8, float8 and date) with a plain column as
+ *	  its input, plain and hashed aggregation read whole batches from the
+ *	  scan.  Each transition function is then replaced by a loop over the
+ *	  selected rows that computes exactly what the function would have.
+ *	  Anything else runs a row at a time.
+ *
+ *	  Spilling to disk:
+ *
+ *	  In AGG_HASHED mode, once the memory used by the hash table and the
+ *	  transition values exceeds work_mem, we stop adding new groups to it.
+ *	  Input tuples belonging to groups already in the table are still
+ *	  aggregated as usual, but any other tuple is written out to one of
+ *	  several temporary files, chosen by its hash value.  When the input is
+ *	  exhausted we emit the groups in the table, then empty it and process
+ *	  each spill file in turn as if it were the input, spilling again if
+ *	  necessary with a different choice of hash bits.  Since every pass
+ *	  keeps at least one group in memory, this always terminates, though
+ *	  transition values that grow after their group was created can still
+ *	  make the table exceed work_mem.
  *
  * Portions Copyright (c) 1996-2016, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
@@ -149,21 +192,29 @@
 
 #include "postgres.h"
 
+#include <math.h>
+
+#include "access/hash.h"
 #include "access/htup_details.h"
 #include "catalog/objectaccess.h"
 #include "catalog/pg_aggregate.h"
+#include "catalog/pg_operator.h"
 #include "catalog/pg_proc.h"
 #include "catalog/pg_type.h"
 #include "executor/executor.h"
+#include "executor/execBatch.h"
 #include "executor/nodeAgg.h"
+#include "executor/nodeSeqscan.h"
 #include "miscadmin.h"
 #include "nodes/nodeFuncs.h"
 #include "optimizer/clauses.h"
 #include "optimizer/tlist.h"
 #include "parser/parse_agg.h"
 #include "parser/parse_coerce.h"
+#include "storage/buffile.h"
 #include "utils/acl.h"
 #include "utils/builtins.h"
+#include "utils/fmgroids.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
 #include "utils/syscache.h"
@@ -171,6 +222,10 @@
 #include "utils/datum.h"
 
 
+/* Initial size of the hash tables that eliminate DISTINCT inputs */
+#define DISTINCT_HASH_NBUCKETS	32
+
+
 /*
  * AggStatePerTransData - per aggregate state value information
  *
@@ -319,18 +374,36 @@ typedef struct AggStatePerTransData
 
 	Tuplesortstate **sortstates;	/* sort objects, if DISTINCT or ORDER BY */
 
+	/*
+	 * A DISTINCT aggregate without ORDER BY may instead eliminate duplicates
+	 * with a hash table (see aggref_distinct_is_hashable), passing each input
+	 * on to the transition function as soon as it is first seen.  The table
+	 * is keyed on a group identifier followed by the input columns.  Sorted
+	 * grouping sets get a fresh table for each group, kept in the group's
+	 * aggcontext, and use identifier zero; the groups of the hashed sets all
+	 * share one table in the hashcontext, and are identified by the address
+	 * of their per-group state.
+	 */
+	bool		hashDistinct;
+	TupleTableSlot *distinctslot;	/* group identifier and input columns */
+	AttrNumber *distinctColIdx; /* key columns in distinctslot */
+	FmgrInfo   *distinctEqfns;	/* equality functions for the key columns */
+	FmgrInfo   *distinctHashfns;	/* hash functions for the key columns */
+	TupleHashTable *distincttables;		/* one per sorted grouping set */
+	TupleHashTable hashdistincttable;	/* shared by all hashed groups */
+
 	/*
 	 * This field is a pre-initialized FunctionCallInfo struct used for
 	 * calling this aggregate's transfn.  We save a few cycles per row by not
 	 * re-initializing the unchanging fields; which isn't much, but it seems
 	 * worth the extra space consumption.
 	 */
-	FunctionCallInfoData transfn_fcinfo;
+	FunctionCallInfo transfn_fcinfo;
 
 	/* Likewise for serialization and deserialization functions */
-	FunctionCallInfoData serialfn_fcinfo;
+	FunctionCallInfo serialfn_fcinfo;
 
-	FunctionCallInfoData deserialfn_fcinfo;
+	FunctionCallInfo deserialfn_fcinfo;
 }	AggStatePerTransData;
 
 /*
@@ -435,33 +508,117 @@ typedef struct AggStatePerPhaseData
 }	AggStatePerPhaseData;
 
 /*
- * To implement hashed aggregation, we need a hashtable that stores a
- * representative tuple and an array of AggStatePerGroup structs for each
- * distinct set of GROUP BY column values.  We compute the hash key from
- * the GROUP BY columns.
+ * AggStatePerHashData - per-hashtable state
+ *
+ * When doing grouping sets with hashing, we have one of these for each
+ * grouping set.  (When doing hashing without grouping sets, we have just one
+ * of them.)
+ */
+typedef struct AggStatePerHashData
+{
+	TupleHashTable hashtable;	/* hash table with one entry per group */
+	TupleHashIterator hashiter; /* for iterating through hash table */
+	TupleTableSlot *hashslot;	/* slot for loading hash table */
+	FmgrInfo   *hashfunctions;	/* per-grouping-field hash fns */
+	FmgrInfo   *eqfunctions;	/* per-grouping-field equality fns */
+	int			numCols;		/* number of hash key columns */
+	List	   *hash_needed;	/* list of columns needed in hash table */
+	Agg		   *aggnode;		/* original Agg node, for numGroups etc. */
+}	AggStatePerHashData;
+
+/*
+ * Spill files being written by the current pass.  A tuple's file is chosen
+ * by the high bits of a hash value remixed with the spill depth, so that
+ * each pass splits the groups differently, and independently of the low
+ * bits the hash table itself uses.
  */
-typedef struct AggHashEntryData *AggHashEntry;
+typedef struct HashAggSpill
+{
+	int			npartitions;	/* number of spill files, a power of 2 */
+	int			shift;			/* right shift to get the partition number */
+	BufFile   **partitions;		/* spill files, or NULL if not yet opened */
+	int64	   *ntuples;		/* number of tuples written to each */
+} HashAggSpill;
+
+/* A spill file waiting to be processed */
+typedef struct HashAggBatch
+{
+	BufFile    *input;			/* rewound spill file */
+	int			depth;			/* number of times its tuples were spilled */
+	int64		input_tuples;	/* number of tuples in the file */
+} HashAggBatch;
 
-typedef struct AggHashEntryData
+/*
+ * Transition functions we can apply to a batch of input values directly.
+ * Minimum and maximum of date use the int4 kernels.
+ */
+typedef enum AggBatchKind
 {
-	TupleHashEntryData shared;	/* common header for hash table entries */
-	/* per-aggregate transition status array */
-	AggStatePerGroupData pergroup[FLEXIBLE_ARRAY_MEMBER];
-}	AggHashEntryData;
+	AGG_BATCH_COUNT_STAR,
+	AGG_BATCH_COUNT,
+	AGG_BATCH_SUM_INT4,
+	AGG_BATCH_SUM_FLOAT8,
+	AGG_BATCH_MIN_INT4,
+	AGG_BATCH_MAX_INT4,
+	AGG_BATCH_MIN_INT8,
+	AGG_BATCH_MAX_INT8,
+	AGG_BATCH_MIN_FLOAT8,
+	AGG_BATCH_MAX_FLOAT8
+} AggBatchKind;
+
+typedef struct AggBatchKernel
+{
+	Oid			transfn_oid;	/* transition function replaced */
+	Oid			inputtype;		/* its input type, or InvalidOid for any */
+	int			numTransInputs;
+	AggBatchKind kind;
+} AggBatchKernel;
+
+static const AggBatchKernel agg_batch_kernels[] = {
+	{F_INT8INC, InvalidOid, 0, AGG_BATCH_COUNT_STAR},
+	{F_INT8INC_ANY, InvalidOid, 1, AGG_BATCH_COUNT},
+	{F_INT4_SUM, INT4OID, 1, AGG_BATCH_SUM_INT4},
+	{F_FLOAT8PL, FLOAT8OID, 1, AGG_BATCH_SUM_FLOAT8},
+	{F_INT4SMALLER, INT4OID, 1, AGG_BATCH_MIN_INT4},
+	{F_INT4LARGER, INT4OID, 1, AGG_BATCH_MAX_INT4},
+	{F_DATE_SMALLER, DATEOID, 1, AGG_BATCH_MIN_INT4},
+	{F_DATE_LARGER, DATEOID, 1, AGG_BATCH_MAX_INT4},
+	{F_INT8SMALLER, INT8OID, 1, AGG_BATCH_MIN_INT8},
+	{F_INT8LARGER, INT8OID, 1, AGG_BATCH_MAX_INT8},
+	{F_FLOAT8SMALLER, FLOAT8OID, 1, AGG_BATCH_MIN_FLOAT8},
+	{F_FLOAT8LARGER, FLOAT8OID, 1, AGG_BATCH_MAX_FLOAT8},
+};
+
+/* Batch mode state; its existence means we're using batch mode */
+typedef struct AggBatchState
+{
+	TupleBatch *batch;			/* the input scan's batch */
+	AggBatchKind *kinds;		/* kernel for each transition state */
+	int		   *cols;			/* batch column of its input, or -1 */
+} AggBatchState;
 
+static void select_current_set(AggState *aggstate, int setno, bool is_hash);
 static void initialize_phase(AggState *aggstate, int newphase);
 static TupleTableSlot *fetch_input_tuple(AggState *aggstate);
 static void initialize_aggregates(AggState *aggstate,
 					  AggStatePerGroup pergroup,
 					  int numReset);
+static void initialize_aggregate_sort(AggState *aggstate,
+						  AggStatePerTrans pertrans, int setno);
 static void advance_transition_function(AggState *aggstate,
 							AggStatePerTrans pertrans,
 							AggStatePerGroup pergroupstate);
-static void advance_aggregates(AggState *aggstate, AggStatePerGroup pergroup);
+static void advance_aggregates(AggState *aggstate, AggStatePerGroup pergroup,
+				   AggStatePerGroup *pergroups);
 static void advance_combine_function(AggState *aggstate,
 						 AggStatePerTrans pertrans,
 						 AggStatePerGroup pergroupstate);
 static void combine_aggregates(AggState *aggstate, AggStatePerGroup pergroup);
+static bool distinct_input_is_new(AggState *aggstate,
+					  AggStatePerTrans pertrans,
+					  int setno,
+					  AggStatePerGroup pergroupstate,
+					  TupleTableSlot *slot);
 static void process_ordered_aggregate_single(AggState *aggstate,
 								 AggStatePerTrans pertrans,
 								 AggStatePerGroup pergroupstate);
@@ -481,24 +638,44 @@ static void prepare_projection_slot(AggState *aggstate,
 						int currentSet);
 static void finalize_aggregates(AggState *aggstate,
 					AggStatePerAgg peragg,
-					AggStatePerGroup pergroup,
-					int currentSet);
+					AggStatePerGroup pergroup);
 static TupleTableSlot *project_aggregates(AggState *aggstate);
 static Bitmapset *find_unaggregated_cols(AggState *aggstate);
 static bool find_unaggregated_cols_walker(Node *node, Bitmapset **colnos);
 static void build_hash_table(AggState *aggstate);
-static AggHashEntry lookup_hash_entry(AggState *aggstate,
+static void find_hash_columns(AggState *aggstate);
+static TupleHashEntryData *lookup_hash_entry(AggState *aggstate, int setno,
 				  TupleTableSlot *inputslot);
+static bool lookup_hash_entries(AggState *aggstate);
+static TupleHashEntryData *find_hash_entry(AggState *aggstate, int setno);
+static Size hash_agg_memory(AggState *aggstate);
+static void hash_agg_enter_spill_mode(AggState *aggstate);
+static uint32 hash_agg_hash_value(AggState *aggstate);
+static void hash_agg_spill_tuple(AggState *aggstate, TupleTableSlot *slot);
+static TupleTableSlot *hash_agg_read_tuple(BufFile *file,
+					TupleTableSlot *slot);
+static void hash_agg_finish_pass(AggState *aggstate);
+static void hash_agg_reset_spill(AggState *aggstate);
 static TupleTableSlot *agg_retrieve_direct(AggState *aggstate);
 static void agg_fill_hash_table(AggState *aggstate);
+static bool agg_refill_hash_table(AggState *aggstate);
 static TupleTableSlot *agg_retrieve_hash_table(AggState *aggstate);
+static void agg_batch_init(AggState *aggstate);
+static const AggBatchKernel *agg_batch_match(AggStatePerTrans pertrans,
+				int *col);
+static void agg_batch_advance(AggState *aggstate, AggStatePerGroup pergroup,
+				  int *sel, int nsel);
+static TupleTableSlot *agg_retrieve_batch(AggState *aggstate);
+static void agg_batch_spill_row(AggState *aggstate, int row);
+static void agg_fill_hash_table_batch(AggState *aggstate);
 static Datum GetAggInitVal(Datum textInitVal, Oid transtype);
 static void build_pertrans_for_aggref(AggStatePerTrans pertrans,
 						  AggState *aggsate, EState *estate,
 						  Aggref *aggref, Oid aggtransfn, Oid aggtranstype,
 						  Oid aggserialfn, Oid aggdeserialfn,
 						  Datum initValue, bool initValueIsNull,
-						  Oid *inputTypes, int numArguments);
+						  Oid *inputTypes, int numArguments,
+						  bool hashDistinct);
 static int find_compatible_peragg(Aggref *newagg, AggState *aggstate,
 					   int lastaggno, List **same_input_transnos);
 static int find_compatible_pertrans(AggState *aggstate, Aggref *newagg,
@@ -508,9 +685,29 @@ static int find_compatible_pertrans(AggState *aggstate, Aggref *newagg,
 						 List *transnos);
 
 
+/*
+ * Select the current grouping set; affects current_set and
+ * curaggcontext.  Hashed grouping sets all keep their transition values in
+ * hashcontext, sorted ones in the aggcontext of their set.
+ */
+static void
+select_current_set(AggState *aggstate, int setno, bool is_hash)
+{
+	if (is_hash)
+		aggstate->curaggcontext = aggstate->hashcontext;
+	else
+		aggstate->curaggcontext = aggstate->aggcontexts[setno];
+
+	aggstate->current_set = setno;
+}
+
 /*
  * Switch to phase "newphase", which must either be 0 (to reset) or
  * current_phase + 1. Juggle the tuplesorts accordingly.
+ *
+ * A phase without a sort node reads the outer plan's output directly; that
+ * is phase 0, and in AGG_MIXED mode also phase 1, which the hash tables are
+ * filled alongside.
  */
 static void
 initialize_phase(AggState *aggstate, int newphase)
@@ -527,7 +724,7 @@ initialize_phase(AggState *aggstate, int newphase)
 		aggstate->sort_in = NULL;
 	}
 
-	if (newphase == 0)
+	if (newphase == 0 || aggstate->phases[newphase].sortnode == NULL)
 	{
 		/*
 		 * Discard any existing output tuplesort.
@@ -554,7 +751,8 @@ initialize_phase(AggState *aggstate, int newphase)
 	 * If this isn't the last phase, we need to sort appropriately for the
 	 * next phase in sequence.
 	 */
-	if (newphase < aggstate->numphases - 1)
+	if (newphase < aggstate->numphases - 1 &&
+		aggstate->phases[newphase + 1].sortnode != NULL)
 	{
 		Sort	   *sortnode = aggstate->phases[newphase + 1].sortnode;
 		PlanState  *outerNode = outerPlanState(aggstate);
@@ -600,6 +798,46 @@ fetch_input_tuple(AggState *aggstate)
 	return slot;
 }
 
+/*
+ * Start the sort that a DISTINCT/ORDER BY aggregate's input is collected in,
+ * for grouping set setno.
+ *
+ * The sort is kept in the per-query context, whatever the caller's
+ * CurrentMemoryContext.
+ */
+static void
+initialize_aggregate_sort(AggState *aggstate, AggStatePerTrans pertrans,
+						  int setno)
+{
+	MemoryContext oldContext;
+
+	oldContext = MemoryContextSwitchTo(aggstate->ss.ps.state->es_query_cxt);
+
+	/*
+	 * We use a plain Datum sorter when there's a single input column;
+	 * otherwise sort the full tuple.  (See comments for
+	 * process_ordered_aggregate_single.)
+	 */
+	if (pertrans->numInputs == 1)
+		pertrans->sortstates[setno] =
+			tuplesort_begin_datum(pertrans->evaldesc->attrs[0]->atttypid,
+								  pertrans->sortOperators[0],
+								  pertrans->sortCollations[0],
+								  pertrans->sortNullsFirst[0],
+								  work_mem, false);
+	else
+		pertrans->sortstates[setno] =
+			tuplesort_begin_heap(pertrans->evaldesc,
+								 pertrans->numSortCols,
+								 pertrans->sortColIdx,
+								 pertrans->sortOperators,
+								 pertrans->sortCollations,
+								 pertrans->sortNullsFirst,
+								 work_mem, false);
+
+	MemoryContextSwitchTo(oldContext);
+}
+
 /*
  * (Re)Initialize an individual aggregate.
  *
@@ -613,9 +851,38 @@ initialize_aggregate(AggState *aggstate, AggStatePerTrans pertrans,
 					 AggStatePerGroup pergroupstate)
 {
 	/*
-	 * Start a fresh sort operation for each DISTINCT/ORDER BY aggregate.
+	 * A sorted group of a hashed DISTINCT aggregate needs a fresh hash table;
+	 * the old one went away with the aggcontext's previous contents.  The
+	 * hashed groups share a table, which is built when first needed.  A sort
+	 * is only started if the table outgrows work_mem, but one may be left
+	 * over from an uncompleted group in case of rescan.
+	 */
+	if (pertrans->hashDistinct)
+	{
+		if (aggstate->curaggcontext != aggstate->hashcontext)
+		{
+			pertrans->distincttables[aggstate->current_set] =
+				BuildTupleHashTable(pertrans->numDistinctCols,
+									pertrans->distinctColIdx + 1,
+									pertrans->distinctEqfns + 1,
+									pertrans->distinctHashfns + 1,
+									DISTINCT_HASH_NBUCKETS, 0,
+						 aggstate->curaggcontext->ecxt_per_tuple_memory,
+							 aggstate->tmpcontext->ecxt_per_tuple_memory);
+
+			if (pertrans->sortstates[aggstate->current_set])
+			{
+				tuplesort_end(pertrans->sortstates[aggstate->current_set]);
+				pertrans->sortstates[aggstate->current_set] = NULL;
+			}
+		}
+	}
+
+	/*
+	 * Start a fresh sort operation for each other DISTINCT/ORDER BY
+	 * aggregate.
 	 */
-	if (pertrans->numSortCols > 0)
+	else if (pertrans->numSortCols > 0)
 	{
 		/*
 		 * In case of rescan, maybe there could be an uncompleted sort
@@ -624,28 +891,7 @@ initialize_aggregate(AggState *aggstate, AggStatePerTrans pertrans,
 		if (pertrans->sortstates[aggstate->current_set])
 			tuplesort_end(pertrans->sortstates[aggstate->current_set]);
 
-
-		/*
-		 * We use a plain Datum sorter when there's a single input column;
-		 * otherwise sort the full tuple.  (See comments for
-		 * process_ordered_aggregate_single.)
-		 */
-		if (pertrans->numInputs == 1)
-			pertrans->sortstates[aggstate->current_set] =
-				tuplesort_begin_datum(pertrans->evaldesc->attrs[0]->atttypid,
-									  pertrans->sortOperators[0],
-									  pertrans->sortCollations[0],
-									  pertrans->sortNullsFirst[0],
-									  work_mem, false);
-		else
-			pertrans->sortstates[aggstate->current_set] =
-				tuplesort_begin_heap(pertrans->evaldesc,
-									 pertrans->numSortCols,
-									 pertrans->sortColIdx,
-									 pertrans->sortOperators,
-									 pertrans->sortCollations,
-									 pertrans->sortNullsFirst,
-									 work_mem, false);
+		initialize_aggregate_sort(aggstate, pertrans, aggstate->current_set);
 	}
 
 	/*
@@ -661,7 +907,7 @@ initialize_aggregate(AggState *aggstate, AggStatePerTrans pertrans,
 		MemoryContext oldContext;
 
 		oldContext = MemoryContextSwitchTo(
-		aggstate->aggcontexts[aggstate->current_set]->ecxt_per_tuple_memory);
+		aggstate->curaggcontext->ecxt_per_tuple_memory);
 		pergroupstate->transValue = datumCopy(pertrans->initValue,
 											  pertrans->transtypeByVal,
 											  pertrans->transtypeLen);
@@ -712,7 +958,7 @@ initialize_aggregates(AggState *aggstate,
 
 			pergroupstate = &pergroup[transno + (setno * (aggstate->numtrans))];
 
-			aggstate->current_set = setno;
+			select_current_set(aggstate, setno, false);
 
 			initialize_aggregate(aggstate, pertrans, pergroupstate);
 		}
@@ -735,7 +981,7 @@ advance_transition_function(AggState *aggstate,
 							AggStatePerTrans pertrans,
 							AggStatePerGroup pergroupstate)
 {
-	FunctionCallInfo fcinfo = &pertrans->transfn_fcinfo;
+	FunctionCallInfo fcinfo = pertrans->transfn_fcinfo;
 	MemoryContext oldContext;
 	Datum		newVal;
 
@@ -750,7 +996,7 @@ advance_transition_function(AggState *aggstate,
 
 		for (i = 1; i <= numTransInputs; i++)
 		{
-			if (fcinfo->argnull[i])
+			if (fcinfo->args[i].isnull)
 				return;
 		}
 		if (pergroupstate->noTransValue)
@@ -765,8 +1011,8 @@ advance_transition_function(AggState *aggstate,
 			 * do not need to pfree the old transValue, since it's NULL.
 			 */
 			oldContext = MemoryContextSwitchTo(
-											   aggstate->aggcontexts[aggstate->current_set]->ecxt_per_tuple_memory);
-			pergroupstate->transValue = datumCopy(fcinfo->arg[1],
+											   aggstate->curaggcontext->ecxt_per_tuple_memory);
+			pergroupstate->transValue = datumCopy(fcinfo->args[1].value,
 												  pertrans->transtypeByVal,
 												  pertrans->transtypeLen);
 			pergroupstate->transValueIsNull = false;
@@ -795,8 +1041,8 @@ advance_transition_function(AggState *aggstate,
 	/*
 	 * OK to call the transition function
 	 */
-	fcinfo->arg[0] = pergroupstate->transValue;
-	fcinfo->argnull[0] = pergroupstate->transValueIsNull;
+	fcinfo->args[0].value = pergroupstate->transValue;
+	fcinfo->args[0].isnull = pergroupstate->transValueIsNull;
 	fcinfo->isnull = false;		/* just in case transfn doesn't set it */
 
 	newVal = FunctionCallInvoke(fcinfo);
@@ -813,7 +1059,7 @@ advance_transition_function(AggState *aggstate,
 	{
 		if (!fcinfo->isnull)
 		{
-			MemoryContextSwitchTo(aggstate->aggcontexts[aggstate->current_set]->ecxt_per_tuple_memory);
+			MemoryContextSwitchTo(aggstate->curaggcontext->ecxt_per_tuple_memory);
 			newVal = datumCopy(newVal,
 							   pertrans->transtypeByVal,
 							   pertrans->transtypeLen);
@@ -831,19 +1077,30 @@ advance_transition_function(AggState *aggstate,
 /*
  * Advance each aggregate transition state for one input tuple.  The input
  * tuple has been stored in tmpcontext->ecxt_outertuple, so that it is
- * accessible to ExecEvalExpr.  pergroup is the array of per-group structs to
- * use (this might be in a hashtable entry).
+ * accessible to ExecEvalExpr.
+ *
+ * pergroup is the array of per-group structs of the current phase's sorted
+ * grouping sets, and pergroups holds one pointer to the per-group structs of
+ * each hashed grouping set (these are in hashtable entries).  Either may be
+ * NULL if there are no sets of that kind to advance.
  *
  * When called, CurrentMemoryContext should be the per-query context.
  */
 static void
-advance_aggregates(AggState *aggstate, AggStatePerGroup pergroup)
+advance_aggregates(AggState *aggstate, AggStatePerGroup pergroup,
+				   AggStatePerGroup *pergroups)
 {
 	int			transno;
 	int			setno = 0;
-	int			numGroupingSets = Max(aggstate->phase->numsets, 1);
+	int			numGroupingSets = 0;
+	int			numHashes = 0;
 	int			numTrans = aggstate->numtrans;
 
+	if (pergroup)
+		numGroupingSets = Max(aggstate->phase->numsets, 1);
+	if (pergroups)
+		numHashes = aggstate->num_hashes;
+
 	for (transno = 0; transno < numTrans; transno++)
 	{
 		AggStatePerTrans pertrans = &aggstate->pertrans[transno];
@@ -867,7 +1124,7 @@ advance_aggregates(AggState *aggstate, AggStatePerGroup pergroup)
 		/* Evaluate the current input expressions for this aggregate */
 		slot = ExecProject(pertrans->evalproj, NULL);
 
-		if (pertrans->numSortCols > 0)
+		if (pertrans->numSortCols > 0 && !pertrans->hashDistinct)
 		{
 			/* DISTINCT and/or ORDER BY case */
 			Assert(slot->tts_nvalid == pertrans->numInputs);
@@ -890,6 +1147,7 @@ advance_aggregates(AggState *aggstate, AggStatePerGroup pergroup)
 					continue;
 			}
 
+			/* the planner never hashes a set with DISTINCT/ORDER BY aggs */
 			for (setno = 0; setno < numGroupingSets; setno++)
 			{
 				/* OK, put the tuple into the tuplesort object */
@@ -903,23 +1161,57 @@ advance_aggregates(AggState *aggstate, AggStatePerGroup pergroup)
 		}
 		else
 		{
-			/* We can apply the transition function immediately */
-			FunctionCallInfo fcinfo = &pertrans->transfn_fcinfo;
+			/*
+			 * We can apply the transition function immediately, except for
+			 * inputs that a hashed DISTINCT aggregate has seen before.
+			 */
+			FunctionCallInfo fcinfo = pertrans->transfn_fcinfo;
+
+			if (pertrans->hashDistinct && pertrans->transfn.fn_strict)
+			{
+				/* don't bother remembering inputs the transfn would ignore */
+				for (i = 0; i < numTransInputs; i++)
+				{
+					if (slot->tts_isnull[i])
+						break;
+				}
+				if (i < numTransInputs)
+					continue;
+			}
 
 			/* Load values into fcinfo */
 			/* Start from 1, since the 0th arg will be the transition value */
 			Assert(slot->tts_nvalid >= numTransInputs);
 			for (i = 0; i < numTransInputs; i++)
 			{
-				fcinfo->arg[i + 1] = slot->tts_values[i];
-				fcinfo->argnull[i + 1] = slot->tts_isnull[i];
+				fcinfo->args[i + 1].value = slot->tts_values[i];
+				fcinfo->args[i + 1].isnull = slot->tts_isnull[i];
 			}
 
 			for (setno = 0; setno < numGroupingSets; setno++)
 			{
 				AggStatePerGroup pergroupstate = &pergroup[transno + (setno * numTrans)];
 
-				aggstate->current_set = setno;
+				if (pertrans->hashDistinct &&
+					!distinct_input_is_new(aggstate, pertrans, setno,
+										   NULL, slot))
+					continue;
+
+				select_current_set(aggstate, setno, false);
+
+				advance_transition_function(aggstate, pertrans, pergroupstate);
+			}
+
+			for (setno = 0; setno < numHashes; setno++)
+			{
+				AggStatePerGroup pergroupstate = &pergroups[setno][transno];
+
+				if (pertrans->hashDistinct &&
+					!distinct_input_is_new(aggstate, pertrans, setno,
+										   pergroupstate, slot))
+					continue;
+
+				select_current_set(aggstate, setno, true);
 
 				advance_transition_function(aggstate, pertrans, pergroupstate);
 			}
@@ -948,7 +1240,7 @@ combine_aggregates(AggState *aggstate, AggStatePerGroup pergroup)
 		AggStatePerTrans pertrans = &aggstate->pertrans[transno];
 		AggStatePerGroup pergroupstate = &pergroup[transno];
 		TupleTableSlot *slot;
-		FunctionCallInfo fcinfo = &pertrans->transfn_fcinfo;
+		FunctionCallInfo fcinfo = pertrans->transfn_fcinfo;
 
 		/* Evaluate the current input expressions for this aggregate */
 		slot = ExecProject(pertrans->evalproj, NULL);
@@ -963,19 +1255,19 @@ combine_aggregates(AggState *aggstate, AggStatePerGroup pergroup)
 			/* Don't call a strict deserialization function with NULL input */
 			if (pertrans->deserialfn.fn_strict && slot->tts_isnull[0])
 			{
-				fcinfo->arg[1] = slot->tts_values[0];
-				fcinfo->argnull[1] = slot->tts_isnull[0];
+				fcinfo->args[1].value = slot->tts_values[0];
+				fcinfo->args[1].isnull = slot->tts_isnull[0];
 			}
 			else
 			{
-				FunctionCallInfo dsinfo = &pertrans->deserialfn_fcinfo;
+				FunctionCallInfo dsinfo = pertrans->deserialfn_fcinfo;
 				MemoryContext oldContext;
 
-				dsinfo->arg[0] = slot->tts_values[0];
-				dsinfo->argnull[0] = slot->tts_isnull[0];
+				dsinfo->args[0].value = slot->tts_values[0];
+				dsinfo->args[0].isnull = slot->tts_isnull[0];
 				/* Dummy second argument for type-safety reasons */
-				dsinfo->arg[1] = PointerGetDatum(NULL);
-				dsinfo->argnull[1] = false;
+				dsinfo->args[1].value = PointerGetDatum(NULL);
+				dsinfo->args[1].isnull = false;
 
 				/*
 				 * We run the deserialization functions in per-input-tuple
@@ -983,16 +1275,16 @@ combine_aggregates(AggState *aggstate, AggStatePerGroup pergroup)
 				 */
 				oldContext = MemoryContextSwitchTo(aggstate->tmpcontext->ecxt_per_tuple_memory);
 
-				fcinfo->arg[1] = FunctionCallInvoke(dsinfo);
-				fcinfo->argnull[1] = dsinfo->isnull;
+				fcinfo->args[1].value = FunctionCallInvoke(dsinfo);
+				fcinfo->args[1].isnull = dsinfo->isnull;
 
 				MemoryContextSwitchTo(oldContext);
 			}
 		}
 		else
 		{
-			fcinfo->arg[1] = slot->tts_values[0];
-			fcinfo->argnull[1] = slot->tts_isnull[0];
+			fcinfo->args[1].value = slot->tts_values[0];
+			fcinfo->args[1].isnull = slot->tts_isnull[0];
 		}
 
 		advance_combine_function(aggstate, pertrans, pergroupstate);
@@ -1013,14 +1305,14 @@ advance_combine_function(AggState *aggstate,
 						 AggStatePerTrans pertrans,
 						 AggStatePerGroup pergroupstate)
 {
-	FunctionCallInfo fcinfo = &pertrans->transfn_fcinfo;
+	FunctionCallInfo fcinfo = pertrans->transfn_fcinfo;
 	MemoryContext oldContext;
 	Datum		newVal;
 
 	if (pertrans->transfn.fn_strict)
 	{
 		/* if we're asked to merge to a NULL state, then do nothing */
-		if (fcinfo->argnull[1])
+		if (fcinfo->args[1].isnull)
 			return;
 
 		if (pergroupstate->noTransValue)
@@ -1033,14 +1325,14 @@ advance_combine_function(AggState *aggstate,
 			if (!pertrans->transtypeByVal)
 			{
 				oldContext = MemoryContextSwitchTo(
-												   aggstate->aggcontexts[aggstate->current_set]->ecxt_per_tuple_memory);
-				pergroupstate->transValue = datumCopy(fcinfo->arg[1],
-													pertrans->transtypeByVal,
+												   aggstate->curaggcontext->ecxt_per_tuple_memory);
+				pergroupstate->transValue = datumCopy(fcinfo->args[1].value,
+													  pertrans->transtypeByVal,
 													  pertrans->transtypeLen);
 				MemoryContextSwitchTo(oldContext);
 			}
 			else
-				pergroupstate->transValue = fcinfo->arg[1];
+				pergroupstate->transValue = fcinfo->args[1].value;
 
 			pergroupstate->transValueIsNull = false;
 			pergroupstate->noTransValue = false;
@@ -1057,8 +1349,8 @@ advance_combine_function(AggState *aggstate,
 	/*
 	 * OK to call the combine function
 	 */
-	fcinfo->arg[0] = pergroupstate->transValue;
-	fcinfo->argnull[0] = pergroupstate->transValueIsNull;
+	fcinfo->args[0].value = pergroupstate->transValue;
+	fcinfo->args[0].isnull = pergroupstate->transValueIsNull;
 	fcinfo->isnull = false;		/* just in case combine func doesn't set it */
 
 	newVal = FunctionCallInvoke(fcinfo);
@@ -1075,7 +1367,7 @@ advance_combine_function(AggState *aggstate,
 	{
 		if (!fcinfo->isnull)
 		{
-			MemoryContextSwitchTo(aggstate->aggcontexts[aggstate->current_set]->ecxt_per_tuple_memory);
+			MemoryContextSwitchTo(aggstate->curaggcontext->ecxt_per_tuple_memory);
 			newVal = datumCopy(newVal,
 							   pertrans->transtypeByVal,
 							   pertrans->transtypeLen);
@@ -1091,6 +1383,89 @@ advance_combine_function(AggState *aggstate,
 }
 
 
+/*
+ * Check whether the current input of a hashed DISTINCT aggregate has not
+ * been seen before in its group, and remember it if so.
+ *
+ * pergroupstate is the group's state if it belongs to a hashed grouping set,
+ * or NULL for the current group of sorted grouping set setno.  slot holds
+ * the evaluated inputs.
+ *
+ * Once the aggcontext of a sorted grouping set has grown past work_mem, we
+ * stop adding inputs to the group's table.  Inputs that aren't in it yet go
+ * into a sort instead, exactly as if the aggregate couldn't hash, and we
+ * report them as not new; finalize_aggregates feeds them to the transition
+ * function, dropping the duplicates among them.  None of them can duplicate
+ * an input that was passed on directly, since those are all in the table.
+ * The hashed grouping sets' shared table is in the hashcontext and counts
+ * towards the hash tables' memory; the planner only hashes such grouping
+ * sets when it expects all the DISTINCT inputs to fit in work_mem.
+ */
+static bool
+distinct_input_is_new(AggState *aggstate, AggStatePerTrans pertrans,
+					  int setno, AggStatePerGroup pergroupstate,
+					  TupleTableSlot *slot)
+{
+	TupleTableSlot *distinctslot = pertrans->distinctslot;
+	TupleHashTable table;
+	int64		groupid;
+	bool		isnew;
+	int			i;
+
+	if (pergroupstate == NULL)
+		table = pertrans->distincttables[setno];
+	else
+	{
+		/* the hashcontext was reset since we last needed it, if it's NULL */
+		if (pertrans->hashdistincttable == NULL)
+			pertrans->hashdistincttable =
+				BuildTupleHashTable(pertrans->numDistinctCols + 1,
+									pertrans->distinctColIdx,
+									pertrans->distinctEqfns,
+									pertrans->distinctHashfns,
+									DISTINCT_HASH_NBUCKETS, 0,
+							 aggstate->hashcontext->ecxt_per_tuple_memory,
+							 aggstate->tmpcontext->ecxt_per_tuple_memory);
+		table = pertrans->hashdistincttable;
+	}
+
+	groupid = (int64) (uintptr_t) pergroupstate;
+
+	ExecClearTuple(distinctslot);
+	distinctslot->tts_values[0] = Int64GetDatumFast(groupid);
+	distinctslot->tts_isnull[0] = false;
+	for (i = 0; i < pertrans->numInputs; i++)
+	{
+		distinctslot->tts_values[i + 1] = slot->tts_values[i];
+		distinctslot->tts_isnull[i + 1] = slot->tts_isnull[i];
+	}
+	ExecStoreVirtualTuple(distinctslot);
+
+	if (pergroupstate == NULL && pertrans->sortstates[setno] != NULL)
+	{
+		/* the table is full, so sort anything that isn't in it */
+		if (LookupTupleHashEntry(table, distinctslot, NULL) == NULL)
+		{
+			if (pertrans->numInputs == 1)
+				tuplesort_putdatum(pertrans->sortstates[setno],
+								   slot->tts_values[0],
+								   slot->tts_isnull[0]);
+			else
+				tuplesort_puttupleslot(pertrans->sortstates[setno], slot);
+		}
+		return false;
+	}
+
+	(void) LookupTupleHashEntry(table, distinctslot, &isnew);
+
+	if (isnew && pergroupstate == NULL &&
+		MemoryContextMemAllocated(aggstate->aggcontexts[setno]->ecxt_per_tuple_memory,
+								  true) > work_mem * 1024L)
+		initialize_aggregate_sort(aggstate, pertrans, setno);
+
+	return isnew;
+}
+
 /*
  * Run the transition function for a DISTINCT or ORDER BY aggregate
  * with only one input.  This is called after we have completed
@@ -1126,7 +1501,7 @@ process_ordered_aggregate_single(AggState *aggstate,
 	bool		isDistinct = (pertrans->numDistinctCols > 0);
 	Datum		newAbbrevVal = (Datum) 0;
 	Datum		oldAbbrevVal = (Datum) 0;
-	FunctionCallInfo fcinfo = &pertrans->transfn_fcinfo;
+	FunctionCallInfo fcinfo = pertrans->transfn_fcinfo;
 	Datum	   *newVal;
 	bool	   *isNull;
 
@@ -1135,8 +1510,8 @@ process_ordered_aggregate_single(AggState *aggstate,
 	tuplesort_performsort(pertrans->sortstates[aggstate->current_set]);
 
 	/* Load the column into argument 1 (arg 0 will be transition value) */
-	newVal = fcinfo->arg + 1;
-	isNull = fcinfo->argnull + 1;
+	newVal = &fcinfo->args[1].value;
+	isNull = &fcinfo->args[1].isnull;
 
 	/*
 	 * Note: if input type is pass-by-ref, the datums returned by the sort are
@@ -1212,7 +1587,7 @@ process_ordered_aggregate_multi(AggState *aggstate,
 								AggStatePerGroup pergroupstate)
 {
 	MemoryContext workcontext = aggstate->tmpcontext->ecxt_per_tuple_memory;
-	FunctionCallInfo fcinfo = &pertrans->transfn_fcinfo;
+	FunctionCallInfo fcinfo = pertrans->transfn_fcinfo;
 	TupleTableSlot *slot1 = pertrans->evalslot;
 	TupleTableSlot *slot2 = pertrans->uniqslot;
 	int			numTransInputs = pertrans->numTransInputs;
@@ -1251,8 +1626,8 @@ process_ordered_aggregate_multi(AggState *aggstate,
 			/* Start from 1, since the 0th arg will be the transition value */
 			for (i = 0; i < numTransInputs; i++)
 			{
-				fcinfo->arg[i + 1] = slot1->tts_values[i];
-				fcinfo->argnull[i + 1] = slot1->tts_isnull[i];
+				fcinfo->args[i + 1].value = slot1->tts_values[i];
+				fcinfo->args[i + 1].isnull = slot1->tts_isnull[i];
 			}
 
 			advance_transition_function(aggstate, pertrans, pergroupstate);
@@ -1303,7 +1678,7 @@ finalize_aggregate(AggState *aggstate,
 				   AggStatePerGroup pergroupstate,
 				   Datum *resultVal, bool *resultIsNull)
 {
-	FunctionCallInfoData fcinfo;
+	LOCAL_FCINFO(fcinfo, FUNC_MAX_ARGS);
 	bool		anynull = false;
 	MemoryContext oldContext;
 	int			i;
@@ -1323,11 +1698,11 @@ finalize_aggregate(AggState *aggstate,
 	{
 		ExprState  *expr = (ExprState *) lfirst(lc);
 
-		fcinfo.arg[i] = ExecEvalExpr(expr,
-									 aggstate->ss.ps.ps_ExprContext,
-									 &fcinfo.argnull[i],
-									 NULL);
-		anynull |= fcinfo.argnull[i];
+		fcinfo->args[i].value = ExecEvalExpr(expr,
+											 aggstate->ss.ps.ps_ExprContext,
+											 &fcinfo->args[i].isnull,
+											 NULL);
+		anynull |= fcinfo->args[i].isnull;
 		i++;
 	}
 
@@ -1341,25 +1716,25 @@ finalize_aggregate(AggState *aggstate,
 		/* set up aggstate->curpertrans for AggGetAggref() */
 		aggstate->curpertrans = pertrans;
 
-		InitFunctionCallInfoData(fcinfo, &peragg->finalfn,
+		InitFunctionCallInfoData(*fcinfo, &peragg->finalfn,
 								 numFinalArgs,
 								 pertrans->aggCollation,
 								 (void *) aggstate, NULL);
 
 		/* Fill in the transition state value */
-		fcinfo.arg[0] = pergroupstate->transValue;
-		fcinfo.argnull[0] = pergroupstate->transValueIsNull;
+		fcinfo->args[0].value = pergroupstate->transValue;
+		fcinfo->args[0].isnull = pergroupstate->transValueIsNull;
 		anynull |= pergroupstate->transValueIsNull;
 
 		/* Fill any remaining argument positions with nulls */
 		for (; i < numFinalArgs; i++)
 		{
-			fcinfo.arg[i] = (Datum) 0;
-			fcinfo.argnull[i] = true;
+			fcinfo->args[i].value = (Datum) 0;
+			fcinfo->args[i].isnull = true;
 			anynull = true;
 		}
 
-		if (fcinfo.flinfo->fn_strict && anynull)
+		if (fcinfo->flinfo->fn_strict && anynull)
 		{
 			/* don't call a strict function with NULL inputs */
 			*resultVal = (Datum) 0;
@@ -1367,8 +1742,8 @@ finalize_aggregate(AggState *aggstate,
 		}
 		else
 		{
-			*resultVal = FunctionCallInvoke(&fcinfo);
-			*resultIsNull = fcinfo.isnull;
+			*resultVal = FunctionCallInvoke(fcinfo);
+			*resultIsNull = fcinfo->isnull;
 		}
 		aggstate->curpertrans = NULL;
 	}
@@ -1422,10 +1797,10 @@ finalize_partialaggregate(AggState *aggstate,
 		}
 		else
 		{
-			FunctionCallInfo fcinfo = &pertrans->serialfn_fcinfo;
+			FunctionCallInfo fcinfo = pertrans->serialfn_fcinfo;
 
-			fcinfo->arg[0] = pergroupstate->transValue;
-			fcinfo->argnull[0] = pergroupstate->transValueIsNull;
+			fcinfo->args[0].value = pergroupstate->transValue;
+			fcinfo->args[0].isnull = pergroupstate->transValueIsNull;
 
 			*resultVal = FunctionCallInvoke(fcinfo);
 			*resultIsNull = fcinfo->isnull;
@@ -1511,26 +1886,21 @@ prepare_projection_slot(AggState *aggstate, TupleTableSlot *slot, int currentSet
 /*
  * Compute the final value of all aggregates for one group.
  *
- * This function handles only one grouping set at a time.
+ * This function handles only one grouping set at a time, which the caller
+ * must have selected.  pergroup points to the per-group structs of that set.
  *
  * Results are stored in the output econtext aggvalues/aggnulls.
  */
 static void
 finalize_aggregates(AggState *aggstate,
 					AggStatePerAgg peraggs,
-					AggStatePerGroup pergroup,
-					int currentSet)
+					AggStatePerGroup pergroup)
 {
 	ExprContext *econtext = aggstate->ss.ps.ps_ExprContext;
 	Datum	   *aggvalues = econtext->ecxt_aggvalues;
 	bool	   *aggnulls = econtext->ecxt_aggnulls;
 	int			aggno;
 
-	Assert(currentSet == 0 ||
-		   ((Agg *) aggstate->ss.ps.plan)->aggstrategy != AGG_HASHED);
-
-	aggstate->current_set = currentSet;
-
 	for (aggno = 0; aggno < aggstate->numaggs; aggno++)
 	{
 		AggStatePerAgg peragg = &peraggs[aggno];
@@ -1538,11 +1908,18 @@ finalize_aggregates(AggState *aggstate,
 		AggStatePerTrans pertrans = &aggstate->pertrans[transno];
 		AggStatePerGroup pergroupstate;
 
-		pergroupstate = &pergroup[transno + (currentSet * (aggstate->numtrans))];
+		pergroupstate = &pergroup[transno];
 
-		if (pertrans->numSortCols > 0)
+		/*
+		 * A hashed DISTINCT aggregate only has a sort to process if its table
+		 * filled up (see distinct_input_is_new).
+		 */
+		if (pertrans->numSortCols > 0 &&
+			(!pertrans->hashDistinct ||
+			 (aggstate->curaggcontext != aggstate->hashcontext &&
+			  pertrans->sortstates[aggstate->current_set] != NULL)))
 		{
-			Assert(((Agg *) aggstate->ss.ps.plan)->aggstrategy != AGG_HASHED);
+			Assert(aggstate->curaggcontext != aggstate->hashcontext);
 
 			if (pertrans->numInputs == 1)
 				process_ordered_aggregate_single(aggstate,
@@ -1644,36 +2021,46 @@ find_unaggregated_cols_walker(Node *node, Bitmapset **colnos)
 }
 
 /*
- * Initialize the hash table to empty.
+ * Initialize the hash tables to empty, one for each hashed grouping set.
  *
- * The hash table always lives in the aggcontext memory context.
+ * The hash tables always live in the hashcontext memory context.
  */
 static void
 build_hash_table(AggState *aggstate)
 {
-	Agg		   *node = (Agg *) aggstate->ss.ps.plan;
 	MemoryContext tmpmem = aggstate->tmpcontext->ecxt_per_tuple_memory;
-	Size		entrysize;
+	Size		additionalsize;
+	int			i;
 
-	Assert(node->aggstrategy == AGG_HASHED);
-	Assert(node->numGroups > 0);
+	Assert(aggstate->aggstrategy == AGG_HASHED ||
+		   aggstate->aggstrategy == AGG_MIXED);
 
-	entrysize = offsetof(AggHashEntryData, pergroup) +
-		aggstate->numaggs * sizeof(AggStatePerGroupData);
+	/* Any DISTINCT tables of the hashed groups went with the old ones */
+	for (i = 0; i < aggstate->numtrans; i++)
+		aggstate->pertrans[i].hashdistincttable = NULL;
 
-	aggstate->hashtable = BuildTupleHashTable(node->numCols,
-											  node->grpColIdx,
-											  aggstate->phase->eqfunctions,
-											  aggstate->hashfunctions,
-											  node->numGroups,
-											  entrysize,
-							 aggstate->aggcontexts[0]->ecxt_per_tuple_memory,
-											  tmpmem);
+	additionalsize = aggstate->numaggs * sizeof(AggStatePerGroupData);
+
+	for (i = 0; i < aggstate->num_hashes; ++i)
+	{
+		AggStatePerHash perhash = &aggstate->perhash[i];
+
+		Assert(perhash->aggnode->numGroups > 0);
+
+		perhash->hashtable = BuildTupleHashTable(perhash->numCols,
+												 perhash->aggnode->grpColIdx,
+												 perhash->eqfunctions,
+												 perhash->hashfunctions,
+												 perhash->aggnode->numGroups,
+												 additionalsize,
+							   aggstate->hashcontext->ecxt_per_tuple_memory,
+												 tmpmem);
+	}
 }
 
 /*
- * Create a list of the tuple columns that actually need to be stored in
- * hashtable entries.  The incoming tuples from the child plan node will
+ * Create, for each hash table, a list of the tuple columns that actually
+ * need to be stored in its entries.  The incoming tuples from the child plan node will
  * contain grouping columns, other columns referenced in our targetlist and
  * qual, columns used to compute the aggregate functions, and perhaps just
  * junk columns we don't use at all.  Only columns of the first two types
@@ -1690,32 +2077,60 @@ build_hash_table(AggState *aggstate)
  * Note that the list is preserved over ExecReScanAgg, so we allocate it in
  * the per-query context (unlike the hash table itself).
  *
+ * With grouping sets, columns that are grouped by some other set but not by
+ * this one must not be stored, since they are not constant within this
+ * set's groups; the output projection reads them as NULL anyway.
+ *
  * Note: at present, searching the tlist/qual is not really necessary since
  * the parser should disallow any unaggregated references to ungrouped
  * columns.  However, the search will be needed when we add support for
  * SQL99 semantics that allow use of "functionally dependent" columns that
  * haven't been explicitly grouped by.
  */
-static List *
+static void
 find_hash_columns(AggState *aggstate)
 {
-	Agg		   *node = (Agg *) aggstate->ss.ps.plan;
-	Bitmapset  *colnos;
-	List	   *collist;
-	int			i;
+	Bitmapset  *base_colnos;
+	int			j;
 
 	/* Find Vars that will be needed in tlist and qual */
-	colnos = find_unaggregated_cols(aggstate);
-	/* Add in all the grouping columns */
-	for (i = 0; i < node->numCols; i++)
-		colnos = bms_add_member(colnos, node->grpColIdx[i]);
-	/* Convert to list, using lcons so largest element ends up first */
-	collist = NIL;
-	while ((i = bms_first_member(colnos)) >= 0)
-		collist = lcons_int(i, collist);
-	bms_free(colnos);
-
-	return collist;
+	base_colnos = find_unaggregated_cols(aggstate);
+
+	for (j = 0; j < aggstate->num_hashes; ++j)
+	{
+		AggStatePerHash perhash = &aggstate->perhash[j];
+		Bitmapset  *colnos = bms_copy(base_colnos);
+		AttrNumber *grpColIdx = perhash->aggnode->grpColIdx;
+		List	   *collist;
+		int			i;
+
+		/* Leave out the columns grouped only by other sets */
+		if (aggstate->phases[0].grouped_cols)
+		{
+			Bitmapset  *grouped_cols = aggstate->phases[0].grouped_cols[j];
+			ListCell   *lc;
+
+			foreach(lc, aggstate->all_grouped_cols)
+			{
+				int			attnum = lfirst_int(lc);
+
+				if (!bms_is_member(attnum, grouped_cols))
+					colnos = bms_del_member(colnos, attnum);
+			}
+		}
+		/* Add in all the grouping columns */
+		for (i = 0; i < perhash->numCols; i++)
+			colnos = bms_add_member(colnos, grpColIdx[i]);
+		/* Convert to list, using lcons so largest element ends up first */
+		collist = NIL;
+		while ((i = bms_first_member(colnos)) >= 0)
+			collist = lcons_int(i, collist);
+		bms_free(colnos);
+
+		perhash->hash_needed = collist;
+	}
+
+	bms_free(base_colnos);
 }
 
 /*
@@ -1729,28 +2144,29 @@ hash_agg_entry_size(int numAggs)
 {
 	Size		entrysize;
 
-	/* This must match build_hash_table */
-	entrysize = offsetof(AggHashEntryData, pergroup) +
-		numAggs * sizeof(AggStatePerGroupData);
-	entrysize = MAXALIGN(entrysize);
-	/* Account for hashtable overhead (assuming fill factor = 1) */
-	entrysize += 3 * sizeof(void *);
+	/* This must match build_hash_table and find_hash_entry */
+	entrysize = sizeof(TupleHashEntryData) +
+		MAXALIGN(numAggs * sizeof(AggStatePerGroupData));
+	/* Account for empty buckets (the table is kept at most 80% full) */
+	entrysize += sizeof(TupleHashEntryData) / 4;
 	return entrysize;
 }
 
 /*
- * Find or create a hashtable entry for the tuple group containing the
- * given tuple.
+ * Find or create an entry in the hash table of grouping set "setno" for the
+ * tuple group containing the given tuple.  If the group isn't in the table
+ * and we have run out of memory for new groups, the tuple is spilled to disk
+ * and NULL is returned.
  *
  * When called, CurrentMemoryContext should be the per-query context.
  */
-static AggHashEntry
-lookup_hash_entry(AggState *aggstate, TupleTableSlot *inputslot)
+static TupleHashEntryData *
+lookup_hash_entry(AggState *aggstate, int setno, TupleTableSlot *inputslot)
 {
-	TupleTableSlot *hashslot = aggstate->hashslot;
+	AggStatePerHash perhash = &aggstate->perhash[setno];
+	TupleTableSlot *hashslot = perhash->hashslot;
 	ListCell   *l;
-	AggHashEntry entry;
-	bool		isnew;
+	TupleHashEntryData *entry;
 
 	/* if first time through, initialize hashslot by cloning input slot */
 	if (hashslot->tts_tupleDescriptor == NULL)
@@ -1761,8 +2177,8 @@ lookup_hash_entry(AggState *aggstate, TupleTableSlot *inputslot)
 	}
 
 	/* transfer just the needed columns into hashslot */
-	slot_getsomeattrs(inputslot, linitial_int(aggstate->hash_needed));
-	foreach(l, aggstate->hash_needed)
+	slot_getsomeattrs(inputslot, linitial_int(perhash->hash_needed));
+	foreach(l, perhash->hash_needed)
 	{
 		int			varNumber = lfirst_int(l) - 1;
 
@@ -1771,124 +2187,454 @@ lookup_hash_entry(AggState *aggstate, TupleTableSlot *inputslot)
 	}
 
 	/* find or create the hashtable entry using the filtered tuple */
-	entry = (AggHashEntry) LookupTupleHashEntry(aggstate->hashtable,
-												hashslot,
-												&isnew);
+	entry = find_hash_entry(aggstate, setno);
 
-	if (isnew)
-	{
-		/* initialize aggregates for new tuple group */
-		initialize_aggregates(aggstate, entry->pergroup, 0);
-	}
+	if (entry == NULL)
+		hash_agg_spill_tuple(aggstate, inputslot);
 
 	return entry;
 }
 
 /*
- * ExecAgg -
+ * Look up the current input tuple, in tmpcontext->ecxt_outertuple, in the
+ * hash table of every hashed grouping set, and store pointers to the
+ * per-group structs of its groups in hash_pergroup.  Returns false if the
+ * tuple was spilled to disk instead, in which case it must not be aggregated
+ * now.  (Spilling only happens with a single hash table, so there is never
+ * a partially processed tuple.)
  *
- *	  ExecAgg receives tuples from its outer subplan and aggregates over
- *	  the appropriate attribute for each aggregate function use (Aggref
- *	  node) appearing in the targetlist or qual of the node.  The number
- *	  of tuples to aggregate over depends on whether grouped or plain
- *	  aggregation is selected.  In grouped aggregation, we produce a result
- *	  row for each group; in plain aggregation there's a single result row
- *	  for the whole query.  In either case, the value of each aggregate is
- *	  stored in the expression context to be used when ExecProject evaluates
- *	  the result tuple.
+ * When called, CurrentMemoryContext should be the per-query context.
  */
-TupleTableSlot *
-ExecAgg(AggState *node)
+static bool
+lookup_hash_entries(AggState *aggstate)
 {
-	TupleTableSlot *result;
+	TupleTableSlot *inputslot = aggstate->tmpcontext->ecxt_outertuple;
+	AggStatePerGroup *pergroup = aggstate->hash_pergroup;
+	int			setno;
 
-	/*
-	 * Check to see if we're still projecting out tuples from a previous agg
-	 * tuple (because there is a function-returning-set in the projection
-	 * expressions).  If so, try to project another one.
-	 */
-	if (node->ss.ps.ps_TupFromTlist)
+	for (setno = 0; setno < aggstate->num_hashes; setno++)
 	{
-		ExprDoneCond isDone;
+		TupleHashEntryData *entry;
 
-		result = ExecProject(node->ss.ps.ps_ProjInfo, &isDone);
-		if (isDone == ExprMultipleResult)
-			return result;
-		/* Done with that source tuple... */
-		node->ss.ps.ps_TupFromTlist = false;
+		entry = lookup_hash_entry(aggstate, setno, inputslot);
+		if (entry == NULL)
+			return false;
+		pergroup[setno] = (AggStatePerGroup) entry->additional;
 	}
 
-	/*
-	 * (We must do the ps_TupFromTlist check first, because in some cases
-	 * agg_done gets set before we emit the final aggregate tuple, and we have
-	 * to finish running SRFs for it.)
-	 */
-	if (!node->agg_done)
+	return true;
+}
+
+/*
+ * Find or create the entry in the hash table of grouping set "setno" for
+ * the group whose columns have been loaded into its hashslot.  Returns NULL
+ * if the group isn't in the table and we have stopped adding new groups.
+ */
+static TupleHashEntryData *
+find_hash_entry(AggState *aggstate, int setno)
+{
+	AggStatePerHash perhash = &aggstate->perhash[setno];
+	TupleHashEntryData *entry;
+	bool		isnew;
+
+	if (aggstate->hash_spill_mode)
+		return LookupTupleHashEntry(perhash->hashtable,
+									perhash->hashslot,
+									NULL);
+
+	entry = LookupTupleHashEntry(perhash->hashtable,
+								 perhash->hashslot,
+								 &isnew);
+
+	if (isnew)
 	{
-		/* Dispatch based on strategy */
-		switch (node->phase->aggnode->aggstrategy)
-		{
-			case AGG_HASHED:
-				if (!node->table_filled)
-					agg_fill_hash_table(node);
-				result = agg_retrieve_hash_table(node);
-				break;
-			default:
-				result = agg_retrieve_direct(node);
-				break;
-		}
+		AggStatePerGroup pergroup;
+		int			transno;
 
-		if (!TupIsNull(result))
-			return result;
+		/* the transition states are kept in the table's context too */
+		pergroup = (AggStatePerGroup)
+			MemoryContextAlloc(perhash->hashtable->tablecxt,
+							 sizeof(AggStatePerGroupData) * aggstate->numaggs);
+		entry->additional = pergroup;
+
+		/* initialize aggregates for new tuple group */
+		select_current_set(aggstate, setno, true);
+		for (transno = 0; transno < aggstate->numtrans; transno++)
+			initialize_aggregate(aggstate, &aggstate->pertrans[transno],
+								 &pergroup[transno]);
+
+		/*
+		 * Having created at least one group in this pass, we can stop adding
+		 * more if we're over the limit and still be sure of progress.  We
+		 * only spill when there is a single hash table and no sorted phase;
+		 * otherwise we just keep track of the memory used for EXPLAIN.
+		 */
+		if (hash_agg_memory(aggstate) > aggstate->hash_mem_limit &&
+			aggstate->aggstrategy == AGG_HASHED &&
+			aggstate->num_hashes == 1)
+			hash_agg_enter_spill_mode(aggstate);
 	}
 
-	return NULL;
+	return entry;
 }
 
 /*
- * ExecAgg for non-hashed case
+ * Return the memory used by the hash table and the transition values in it,
+ * and keep track of the peak for EXPLAIN.
  */
-static TupleTableSlot *
-agg_retrieve_direct(AggState *aggstate)
+static Size
+hash_agg_memory(AggState *aggstate)
 {
-	Agg		   *node = aggstate->phase->aggnode;
-	ExprContext *econtext;
-	ExprContext *tmpcontext;
-	AggStatePerAgg peragg;
-	AggStatePerGroup pergroup;
-	TupleTableSlot *outerslot;
-	TupleTableSlot *firstSlot;
-	TupleTableSlot *result;
-	bool		hasGroupingSets = aggstate->phase->numsets > 0;
-	int			numGroupingSets = Max(aggstate->phase->numsets, 1);
-	int			currentSet;
-	int			nextSetSize;
-	int			numReset;
-	int			i;
+	Size		mem;
 
-	/*
-	 * get state info from node
-	 *
-	 * econtext is the per-output-tuple expression context
-	 *
-	 * tmpcontext is the per-input-tuple expression context
-	 */
-	econtext = aggstate->ss.ps.ps_ExprContext;
-	tmpcontext = aggstate->tmpcontext;
+	mem = MemoryContextMemAllocated(aggstate->hashcontext->ecxt_per_tuple_memory,
+									true);
+	if (mem > aggstate->hash_mem_peak)
+		aggstate->hash_mem_peak = mem;
 
-	peragg = aggstate->peragg;
-	pergroup = aggstate->pergroup;
-	firstSlot = aggstate->ss.ss_ScanTupleSlot;
+	return mem;
+}
 
-	/*
-	 * We loop retrieving groups until we find one matching
-	 * aggstate->ss.ps.qual
-	 *
-	 * For grouping sets, we have the invariant that aggstate->projected_set
-	 * is either -1 (initial call) or the index (starting from 0) in
-	 * gset_lengths for the group we just completed (either by projecting a
-	 * row or by discarding it in the qual).
-	 */
+/*
+ * Stop adding new groups to the hash table, and set up the spill files that
+ * the input tuples of any other groups will be written to instead.
+ *
+ * We choose enough files that each can be expected to fit in memory on its
+ * own, but since every open file holds a buffer, not so many that their
+ * buffers take more than a quarter of work_mem.
+ */
+static void
+hash_agg_enter_spill_mode(AggState *aggstate)
+{
+	HashAggSpill *spill;
+	long		ngroups;
+	double		nfiles;
+	int			npartitions;
+	int			nbits;
+
+	ngroups = aggstate->perhash[0].hashtable->hashtab->members;
+	nfiles = aggstate->hash_pass_groups / Max(ngroups, 1);
+
+	npartitions = HASHAGG_MIN_PARTITIONS;
+	nbits = HASHAGG_MIN_PARTITION_BITS;
+	while (npartitions < HASHAGG_MAX_PARTITIONS && npartitions < nfiles &&
+		   (Size) npartitions * 2 * BLCKSZ <= aggstate->hash_mem_limit / 4)
+	{
+		npartitions <<= 1;
+		nbits++;
+	}
+
+	spill = (HashAggSpill *) palloc(sizeof(HashAggSpill));
+	spill->npartitions = npartitions;
+	spill->shift = 32 - nbits;
+	spill->partitions = (BufFile **) palloc0(npartitions * sizeof(BufFile *));
+	spill->ntuples = (int64 *) palloc0(npartitions * sizeof(int64));
+
+	aggstate->hash_spill = spill;
+	aggstate->hash_spill_mode = true;
+}
+
+/*
+ * Compute the hash value used to choose the spill file for the group in
+ * hashslot.  The grouping columns are combined as in the hash table, then
+ * the result is remixed with the depth of the spill files being written.
+ */
+static uint32
+hash_agg_hash_value(AggState *aggstate)
+{
+	AggStatePerHash perhash = &aggstate->perhash[0];
+	AttrNumber *grpColIdx = perhash->aggnode->grpColIdx;
+	TupleTableSlot *hashslot = perhash->hashslot;
+	MemoryContext oldContext;
+	uint32		hashkey = 0;
+	int			i;
+
+	/* hash functions might leak, so run them in the per-tuple context */
+	oldContext = MemoryContextSwitchTo(aggstate->tmpcontext->ecxt_per_tuple_memory);
+
+	for (i = 0; i < perhash->numCols; i++)
+	{
+		int			varNumber = grpColIdx[i] - 1;
+
+		/* rotate hashkey left 1 bit at each step */
+		hashkey = (hashkey << 1) | ((hashkey & 0x80000000) ? 1 : 0);
+
+		/* treat nulls as having hash key 0 */
+		if (!hashslot->tts_isnull[varNumber])
+		{
+			uint32		hkey;
+
+			hkey = DatumGetUInt32(FunctionCall1(&perhash->hashfunctions[i],
+											hashslot->tts_values[varNumber]));
+			hashkey ^= hkey;
+		}
+	}
+
+	MemoryContextSwitchTo(oldContext);
+
+	return DatumGetUInt32(hash_uint32(hashkey ^ (uint32) aggstate->hash_depth));
+}
+
+/*
+ * Write an input tuple whose group isn't in the hash table to the spill file
+ * for its hash value.  The group's columns must be loaded in hashslot.
+ */
+static void
+hash_agg_spill_tuple(AggState *aggstate, TupleTableSlot *slot)
+{
+	HashAggSpill *spill = aggstate->hash_spill;
+	MinimalTuple tuple;
+	int			partition;
+	size_t		written;
+
+	partition = hash_agg_hash_value(aggstate) >> spill->shift;
+
+	if (spill->partitions[partition] == NULL)
+		spill->partitions[partition] = BufFileCreateTemp(false);
+
+	tuple = ExecFetchSlotMinimalTuple(slot);
+	written = BufFileWrite(spill->partitions[partition],
+						   (void *) tuple, tuple->t_len);
+	if (written != tuple->t_len)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+			   errmsg("could not write to hash-aggregate temporary file: %m")));
+
+	spill->ntuples[partition]++;
+	aggstate->hash_disk_used += tuple->t_len;
+}
+
+/*
+ * Read the next tuple from a spill file into the given slot, or return NULL
+ * at the end of the file.
+ */
+static TupleTableSlot *
+hash_agg_read_tuple(BufFile *file, TupleTableSlot *slot)
+{
+	uint32		t_len;
+	MinimalTuple tuple;
+	size_t		nread;
+
+	nread = BufFileRead(file, (void *) &t_len, sizeof(uint32));
+	if (nread == 0)
+		return ExecClearTuple(slot);
+	if (nread != sizeof(uint32))
+		ereport(ERROR,
+				(errcode_for_file_access(),
+			  errmsg("could not read from hash-aggregate temporary file: %m")));
+
+	tuple = (MinimalTuple) palloc(t_len);
+	tuple->t_len = t_len;
+	nread = BufFileRead(file,
+						(void *) ((char *) tuple + sizeof(uint32)),
+						t_len - sizeof(uint32));
+	if (nread != t_len - sizeof(uint32))
+		ereport(ERROR,
+				(errcode_for_file_access(),
+			  errmsg("could not read from hash-aggregate temporary file: %m")));
+
+	return ExecStoreMinimalTuple(tuple, slot, true);
+}
+
+/*
+ * At the end of a pass over the input, queue up the spill files written
+ * during it, if any, to be processed once the hash table has been emitted.
+ */
+static void
+hash_agg_finish_pass(AggState *aggstate)
+{
+	HashAggSpill *spill = aggstate->hash_spill;
+	int			i;
+
+	/* transition values may have grown since the last new group */
+	(void) hash_agg_memory(aggstate);
+
+	if (spill == NULL)
+		return;
+
+	for (i = 0; i < spill->npartitions; i++)
+	{
+		BufFile    *file = spill->partitions[i];
+		HashAggBatch *batch;
+
+		if (file == NULL)
+			continue;
+
+		if (BufFileSeek(file, 0, 0L, SEEK_SET))
+			ereport(ERROR,
+					(errcode_for_file_access(),
+			  errmsg("could not rewind hash-aggregate temporary file: %m")));
+
+		batch = (HashAggBatch *) palloc(sizeof(HashAggBatch));
+		batch->input = file;
+		batch->depth = aggstate->hash_depth + 1;
+		batch->input_tuples = spill->ntuples[i];
+
+		/* process the newest files first, to keep fewer of them around */
+		aggstate->hash_batches = lcons(batch, aggstate->hash_batches);
+	}
+
+	pfree(spill->partitions);
+	pfree(spill->ntuples);
+	pfree(spill);
+	aggstate->hash_spill = NULL;
+	aggstate->hash_spill_mode = false;
+}
+
+/*
+ * Close any spill files, whether being written or waiting to be processed.
+ */
+static void
+hash_agg_reset_spill(AggState *aggstate)
+{
+	HashAggSpill *spill = aggstate->hash_spill;
+	ListCell   *lc;
+
+	if (spill != NULL)
+	{
+		int			i;
+
+		for (i = 0; i < spill->npartitions; i++)
+		{
+			if (spill->partitions[i] != NULL)
+				BufFileClose(spill->partitions[i]);
+		}
+		pfree(spill->partitions);
+		pfree(spill->ntuples);
+		pfree(spill);
+		aggstate->hash_spill = NULL;
+	}
+	aggstate->hash_spill_mode = false;
+
+	foreach(lc, aggstate->hash_batches)
+	{
+		HashAggBatch *batch = (HashAggBatch *) lfirst(lc);
+
+		BufFileClose(batch->input);
+		pfree(batch);
+	}
+	list_free(aggstate->hash_batches);
+	aggstate->hash_batches = NIL;
+}
+
+/*
+ * ExecAgg -
+ *
+ *	  ExecAgg receives tuples from its outer subplan and aggregates over
+ *	  the appropriate attribute for each aggregate function use (Aggref
+ *	  node) appearing in the targetlist or qual of the node.  The number
+ *	  of tuples to aggregate over depends on whether grouped or plain
+ *	  aggregation is selected.  In grouped aggregation, we produce a result
+ *	  row for each group; in plain aggregation there's a single result row
+ *	  for the whole query.  In either case, the value of each aggregate is
+ *	  stored in the expression context to be used when ExecProject evaluates
+ *	  the result tuple.
+ */
+TupleTableSlot *
+ExecAgg(AggState *node)
+{
+	TupleTableSlot *result;
+
+	/*
+	 * Check to see if we're still projecting out tuples from a previous agg
+	 * tuple (because there is a function-returning-set in the projection
+	 * expressions).  If so, try to project another one.
+	 */
+	if (node->ss.ps.ps_TupFromTlist)
+	{
+		ExprDoneCond isDone;
+
+		result = ExecProject(node->ss.ps.ps_ProjInfo, &isDone);
+		if (isDone == ExprMultipleResult)
+			return result;
+		/* Done with that source tuple... */
+		node->ss.ps.ps_TupFromTlist = false;
+	}
+
+	/*
+	 * (We must do the ps_TupFromTlist check first, because in some cases
+	 * agg_done gets set before we emit the final aggregate tuple, and we have
+	 * to finish running SRFs for it.)
+	 */
+	if (!node->agg_done)
+	{
+		/* Dispatch based on strategy */
+		switch (node->phase->aggnode->aggstrategy)
+		{
+			case AGG_HASHED:
+				if (!node->table_filled)
+				{
+					if (node->batchstate)
+						agg_fill_hash_table_batch(node);
+					else
+						agg_fill_hash_table(node);
+				}
+				result = agg_retrieve_hash_table(node);
+				break;
+			case AGG_MIXED:
+				/* the sorted phases are done and have filled the tables */
+				Assert(node->table_filled);
+				result = agg_retrieve_hash_table(node);
+				break;
+			default:
+				if (node->batchstate)
+					result = agg_retrieve_batch(node);
+				else
+					result = agg_retrieve_direct(node);
+				break;
+		}
+
+		if (!TupIsNull(result))
+			return result;
+	}
+
+	return NULL;
+}
+
+/*
+ * ExecAgg for non-hashed case, and for the sorted phases of AGG_MIXED mode
+ */
+static TupleTableSlot *
+agg_retrieve_direct(AggState *aggstate)
+{
+	Agg		   *node = aggstate->phase->aggnode;
+	ExprContext *econtext;
+	ExprContext *tmpcontext;
+	AggStatePerAgg peragg;
+	AggStatePerGroup pergroup;
+	TupleTableSlot *outerslot;
+	TupleTableSlot *firstSlot;
+	TupleTableSlot *result;
+	bool		hasGroupingSets = aggstate->phase->numsets > 0;
+	int			numGroupingSets = Max(aggstate->phase->numsets, 1);
+	int			currentSet;
+	int			nextSetSize;
+	int			numReset;
+	int			i;
+
+	/*
+	 * get state info from node
+	 *
+	 * econtext is the per-output-tuple expression context
+	 *
+	 * tmpcontext is the per-input-tuple expression context
+	 */
+	econtext = aggstate->ss.ps.ps_ExprContext;
+	tmpcontext = aggstate->tmpcontext;
+
+	peragg = aggstate->peragg;
+	pergroup = aggstate->pergroup;
+	firstSlot = aggstate->ss.ss_ScanTupleSlot;
+
+	/*
+	 * We loop retrieving groups until we find one matching
+	 * aggstate->ss.ps.qual
+	 *
+	 * For grouping sets, we have the invariant that aggstate->projected_set
+	 * is either -1 (initial call) or the index (starting from 0) in
+	 * gset_lengths for the group we just completed (either by projecting a
+	 * row or by discarding it in the qual).
+	 */
 	while (!aggstate->agg_done)
 	{
 		/*
@@ -1942,6 +2688,20 @@ agg_retrieve_direct(AggState *aggstate)
 				node = aggstate->phase->aggnode;
 				numReset = numGroupingSets;
 			}
+			else if (aggstate->aggstrategy == AGG_MIXED)
+			{
+				/*
+				 * Mixed mode; we've output all the grouped stuff and have
+				 * full hashtables, so switch to outputting those.
+				 */
+				initialize_phase(aggstate, 0);
+				aggstate->table_filled = true;
+				aggstate->hash_batches_used = 1;
+				select_current_set(aggstate, 0, true);
+				ResetTupleHashIterator(aggstate->perhash[0].hashtable,
+									   &aggstate->perhash[0].hashiter);
+				return agg_retrieve_hash_table(aggstate);
+			}
 			else
 			{
 				aggstate->agg_done = true;
@@ -2091,10 +2851,24 @@ agg_retrieve_direct(AggState *aggstate)
 				 */
 				for (;;)
 				{
+					/*
+					 * During the first sorted phase of mixed mode, we also
+					 * feed every input tuple into the hash tables.
+					 */
+					bool		fill_hash = (aggstate->aggstrategy == AGG_MIXED &&
+											 aggstate->current_phase == 1);
+
+					if (fill_hash)
+						lookup_hash_entries(aggstate);
+
 					if (DO_AGGSPLIT_COMBINE(aggstate->aggsplit))
+					{
+						select_current_set(aggstate, 0, false);
 						combine_aggregates(aggstate, pergroup);
+					}
 					else
-						advance_aggregates(aggstate, pergroup);
+						advance_aggregates(aggstate, pergroup,
+									 fill_hash ? aggstate->hash_pergroup : NULL);
 
 					/* Reset per-input-tuple context after each tuple */
 					ResetExprContext(tmpcontext);
@@ -2154,7 +2928,10 @@ agg_retrieve_direct(AggState *aggstate)
 
 		prepare_projection_slot(aggstate, econtext->ecxt_outertuple, currentSet);
 
-		finalize_aggregates(aggstate, peragg, pergroup, currentSet);
+		select_current_set(aggstate, currentSet, false);
+
+		finalize_aggregates(aggstate, peragg,
+							pergroup + (currentSet * aggstate->numtrans));
 
 		/*
 		 * If there's no row to project right now, we must continue rather
@@ -2170,13 +2947,12 @@ agg_retrieve_direct(AggState *aggstate)
 }
 
 /*
- * ExecAgg for hashed case: phase 1, read input and build hash table
+ * ExecAgg for hashed case: phase 1, read input and build hash tables
  */
 static void
 agg_fill_hash_table(AggState *aggstate)
 {
 	ExprContext *tmpcontext;
-	AggHashEntry entry;
 	TupleTableSlot *outerslot;
 
 	/*
@@ -2186,6 +2962,12 @@ agg_fill_hash_table(AggState *aggstate)
 	 */
 	tmpcontext = aggstate->tmpcontext;
 
+	aggstate->hash_depth = 0;
+	aggstate->hash_pass_groups = ((Agg *) aggstate->ss.ps.plan)->numGroups;
+	aggstate->hash_batches_used = 1;
+	aggstate->hash_mem_peak = 0;
+	aggstate->hash_disk_used = 0;
+
 	/*
 	 * Process each outer-plan tuple, and then fetch the next one, until we
 	 * exhaust the outer plan.
@@ -2198,26 +2980,104 @@ agg_fill_hash_table(AggState *aggstate)
 		/* set up for advance_aggregates call */
 		tmpcontext->ecxt_outertuple = outerslot;
 
-		/* Find or build hashtable entry for this tuple's group */
-		entry = lookup_hash_entry(aggstate, outerslot);
-
-		/* Advance the aggregates */
-		if (DO_AGGSPLIT_COMBINE(aggstate->aggsplit))
-			combine_aggregates(aggstate, entry->pergroup);
-		else
-			advance_aggregates(aggstate, entry->pergroup);
+		/*
+		 * Find or build the hashtable entries for this tuple's groups, and
+		 * advance the aggregates, unless the tuple was spilled
+		 */
+		if (lookup_hash_entries(aggstate))
+		{
+			if (DO_AGGSPLIT_COMBINE(aggstate->aggsplit))
+			{
+				select_current_set(aggstate, 0, true);
+				combine_aggregates(aggstate, aggstate->hash_pergroup[0]);
+			}
+			else
+				advance_aggregates(aggstate, NULL, aggstate->hash_pergroup);
+		}
 
 		/* Reset per-input-tuple context after each tuple */
 		ResetExprContext(tmpcontext);
 	}
 
+	hash_agg_finish_pass(aggstate);
+
 	aggstate->table_filled = true;
-	/* Initialize to walk the hash table */
-	ResetTupleHashIterator(aggstate->hashtable, &aggstate->hashiter);
+	/* Initialize to walk the first hash table */
+	select_current_set(aggstate, 0, true);
+	ResetTupleHashIterator(aggstate->perhash[0].hashtable,
+						   &aggstate->perhash[0].hashiter);
 }
 
 /*
- * ExecAgg for hashed case: phase 2, retrieving groups from hash table
+ * ExecAgg for hashed case: once all the groups in the hash table have been
+ * returned, empty it and fill it again from the next spill file.  Returns
+ * false if there are no spill files left.
+ */
+static bool
+agg_refill_hash_table(AggState *aggstate)
+{
+	ExprContext *tmpcontext = aggstate->tmpcontext;
+	TupleTableSlot *spillslot = aggstate->hash_spill_slot;
+	TupleTableSlot *slot;
+	HashAggBatch *batch;
+
+	if (aggstate->hash_batches == NIL)
+		return false;
+
+	/* spilling only happens with a single hash table */
+	Assert(aggstate->num_hashes == 1);
+
+	batch = (HashAggBatch *) linitial(aggstate->hash_batches);
+	aggstate->hash_batches = list_delete_first(aggstate->hash_batches);
+
+	/*
+	 * Release the old hash table and transition values.  The representative
+	 * tuple of the last group returned points into them, so clear it first.
+	 */
+	ExecClearTuple(aggstate->ss.ss_ScanTupleSlot);
+	ReScanExprContext(aggstate->hashcontext);
+	build_hash_table(aggstate);
+
+	aggstate->hash_depth = batch->depth;
+	aggstate->hash_pass_groups = batch->input_tuples;
+	aggstate->hash_batches_used++;
+
+	for (;;)
+	{
+		slot = hash_agg_read_tuple(batch->input, spillslot);
+		if (TupIsNull(slot))
+			break;
+		tmpcontext->ecxt_outertuple = slot;
+
+		if (lookup_hash_entries(aggstate))
+		{
+			if (DO_AGGSPLIT_COMBINE(aggstate->aggsplit))
+			{
+				select_current_set(aggstate, 0, true);
+				combine_aggregates(aggstate, aggstate->hash_pergroup[0]);
+			}
+			else
+				advance_aggregates(aggstate, NULL, aggstate->hash_pergroup);
+		}
+
+		ResetExprContext(tmpcontext);
+	}
+
+	BufFileClose(batch->input);
+	pfree(batch);
+
+	hash_agg_finish_pass(aggstate);
+
+	select_current_set(aggstate, 0, true);
+	ResetTupleHashIterator(aggstate->perhash[0].hashtable,
+						   &aggstate->perhash[0].hashiter);
+
+	return true;
+}
+
+/*
+ * ExecAgg for hashed case: phase 2, retrieving groups from the hash tables,
+ * one grouping set after another
  */
 static TupleTableSlot *
 agg_retrieve_hash_table(AggState *aggstate)
@@ -2225,7 +3085,7 @@ agg_retrieve_hash_table(AggState *aggstate)
 	ExprContext *econtext;
 	AggStatePerAgg peragg;
 	AggStatePerGroup pergroup;
-	AggHashEntry entry;
+	TupleHashEntryData *entry;
 	TupleTableSlot *firstSlot;
 	TupleTableSlot *result;
 
@@ -2243,12 +3103,29 @@ agg_retrieve_hash_table(AggState *aggstate)
 	 */
 	while (!aggstate->agg_done)
 	{
+		AggStatePerHash perhash = &aggstate->perhash[aggstate->current_set];
+
 		/*
 		 * Find the next entry in the hash table
 		 */
-		entry = (AggHashEntry) ScanTupleHashTable(&aggstate->hashiter);
+		entry = ScanTupleHashTable(perhash->hashtable, &perhash->hashiter);
 		if (entry == NULL)
 		{
+			int			nextset = aggstate->current_set + 1;
+
+			/* Go on to the next grouping set's table, if any */
+			if (nextset < aggstate->num_hashes)
+			{
+				select_current_set(aggstate, nextset, true);
+				perhash = &aggstate->perhash[nextset];
+				ResetTupleHashIterator(perhash->hashtable, &perhash->hashiter);
+				continue;
+			}
+
+			/* Go on to the next spill file, if any */
+			if (agg_refill_hash_table(aggstate))
+				continue;
+
 			/* No more entries in hashtable, so done */
 			aggstate->agg_done = TRUE;
 			return NULL;
@@ -2267,13 +3144,15 @@ agg_retrieve_hash_table(AggState *aggstate)
 		 * Store the copied first input tuple in the tuple table slot reserved
 		 * for it, so that it can be used in ExecProject.
 		 */
-		ExecStoreMinimalTuple(entry->shared.firstTuple,
+		ExecStoreMinimalTuple(entry->firstTuple,
 							  firstSlot,
 							  false);
 
-		pergroup = entry->pergroup;
+		prepare_projection_slot(aggstate, firstSlot, aggstate->current_set);
 
-		finalize_aggregates(aggstate, peragg, pergroup, 0);
+		pergroup = (AggStatePerGroup) entry->additional;
+
+		finalize_aggregates(aggstate, peragg, pergroup);
 
 		/*
 		 * Use the representative input tuple for any references to
@@ -2290,6 +3169,387 @@ agg_retrieve_hash_table(AggState *aggstate)
 	return NULL;
 }
 
+/*
+ * Set up batch mode, if the input and all transition states allow it
+ */
+static void
+agg_batch_init(AggState *aggstate)
+{
+	PlanState  *outerstate = outerPlanState(aggstate);
+	Agg		   *node = (Agg *) aggstate->ss.ps.plan;
+	Bitmapset  *needed = NULL;
+	AggBatchState *batchstate;
+	TupleBatch *batch;
+	ListCell   *lc;
+	int			transno;
+
+	if (!IsA(outerstate, SeqScanState))
+		return;
+	if (node->aggstrategy == AGG_SORTED ||
+		aggstate->numphases > 1 || aggstate->phase->numsets > 0 ||
+		DO_AGGSPLIT_COMBINE(aggstate->aggsplit))
+		return;
+
+	/* check every transition state before setting anything up */
+	for (transno = 0; transno < aggstate->numtrans; transno++)
+	{
+		int			col;
+
+		if (agg_batch_match(&aggstate->pertrans[transno], &col) == NULL)
+		{
+			bms_free(needed);
+			return;
+		}
+		if (col >= 0)
+			needed = bms_add_member(needed, col + 1);
+	}
+
+	/* in hashed mode we also need the grouping and tlist columns */
+	if (aggstate->num_hashes > 0)
+	{
+		foreach(lc, aggstate->perhash[0].hash_needed)
+			needed = bms_add_member(needed, lfirst_int(lc));
+	}
+
+	batch = ExecSeqScanBatchInit((SeqScanState *) outerstate, needed);
+	bms_free(needed);
+	if (batch == NULL)
+		return;
+
+	batchstate = (AggBatchState *) palloc(sizeof(AggBatchState));
+	batchstate->batch = batch;
+	batchstate->kinds = (AggBatchKind *) palloc(Max(aggstate->numtrans, 1) *
+												sizeof(AggBatchKind));
+	batchstate->cols = (int *) palloc(Max(aggstate->numtrans, 1) * sizeof(int));
+	for (transno = 0; transno < aggstate->numtrans; transno++)
+	{
+		const AggBatchKernel *k;
+
+		k = agg_batch_match(&aggstate->pertrans[transno],
+							&batchstate->cols[transno]);
+		batchstate->kinds[transno] = k->kind;
+	}
+	aggstate->batchstate = batchstate;
+}
+
+/*
+ * Find the batch kernel for a transition state, if it has one.  *col is set
+ * to the input column the kernel reads (numbered from 0), or -1 if none.
+ */
+static const AggBatchKernel *
+agg_batch_match(AggStatePerTrans pertrans, int *col)
+{
+	Oid			inputtype = InvalidOid;
+	int			i;
+
+	*col = -1;
+	if (pertrans->aggfilter != NULL || pertrans->numSortCols > 0 ||
+		pertrans->numTransInputs > 1 || !pertrans->transtypeByVal)
+		return NULL;
+
+	if (pertrans->numTransInputs == 1)
+	{
+		TargetEntry *tle = (TargetEntry *) linitial(pertrans->aggref->args);
+		Var		   *var = (Var *) tle->expr;
+
+		if (!IsA(var, Var) || var->varno != OUTER_VAR ||
+			var->varattno <= 0)
+			return NULL;
+		inputtype = var->vartype;
+		*col = var->varattno - 1;
+	}
+
+	for (i = 0; i < lengthof(agg_batch_kernels); i++)
+	{
+		const AggBatchKernel *k = &agg_batch_kernels[i];
+
+		if (k->transfn_oid == pertrans->transfn_oid &&
+			k->numTransInputs == pertrans->numTransInputs &&
+			(k->inputtype == InvalidOid || k->inputtype == inputtype))
+			return k;
+	}
+
+	return NULL;
+}
+
+/*
+ * Fold the selected non-null values of a column into a by-value transition
+ * value, the way a strict transition function with a NULL initial value
+ * would: the first input becomes the transition value, and each later one
+ * is combined with it by "combine", written in terms of acc, the transition
+ * value so far, and v, the input.
+ */
+#define AGG_BATCH_FOLD(acctype, accfromdatum, acctodatum, \
+					   vtype, vfromdatum, combine) \
+	do { \
+		acctype		acc = 0; \
+		bool		accnull = pergroupstate->transValueIsNull; \
+		\
+		if (!accnull) \
+			acc = accfromdatum(pergroupstate->transValue); \
+		for (i = 0; i < nsel; i++) \
+		{ \
+			int			row = sel[i]; \
+			vtype		v; \
+			\
+			if (isnull[row]) \
+				continue; \
+			v = vfromdatum(values[row]); \
+			if (accnull) \
+			{ \
+				acc = v; \
+				accnull = false; \
+			} \
+			else \
+				acc = (combine); \
+		} \
+		if (!accnull) \
+		{ \
+			pergroupstate->transValue = acctodatum(acc); \
+			pergroupstate->transValueIsNull = false; \
+			pergroupstate->noTransValue = false; \
+		} \
+	} while (0)
+
+/*
+ * float8pl, with the same overflow check
+ */
+static inline float8
+agg_batch_float8_pl(float8 acc, float8 v)
+{
+	float8		result = acc + v;
+
+	if (isinf(result) && !isinf(acc) && !isinf(v))
+		ereport(ERROR,
+				(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+				 errmsg("value out of range: overflow")));
+	return result;
+}
+
+/*
+ * Advance all the transition states in pergroup over the given rows of the
+ * current batch
+ */
+static void
+agg_batch_advance(AggState *aggstate, AggStatePerGroup pergroup,
+				  int *sel, int nsel)
+{
+	AggBatchState *batchstate = aggstate->batchstate;
+	TupleBatch *batch = batchstate->batch;
+	int			transno;
+
+	for (transno = 0; transno < aggstate->numtrans; transno++)
+	{
+		AggStatePerGroup pergroupstate = &pergroup[transno];
+		int			col = batchstate->cols[transno];
+		Datum	   *values = NULL;
+		bool	   *isnull = NULL;
+		int64		count;
+		int			i;
+
+		if (col >= 0)
+		{
+			values = batch->values[col];
+			isnull = batch->isnull[col];
+		}
+
+		switch (batchstate->kinds[transno])
+		{
+			case AGG_BATCH_COUNT_STAR:
+				pergroupstate->transValue =
+					Int64GetDatum(DatumGetInt64(pergroupstate->transValue) + nsel);
+				break;
+
+			case AGG_BATCH_COUNT:
+				count = 0;
+				for (i = 0; i < nsel; i++)
+					count += !isnull[sel[i]];
+				pergroupstate->transValue =
+					Int64GetDatum(DatumGetInt64(pergroupstate->transValue) + count);
+				break;
+
+			case AGG_BATCH_SUM_INT4:
+				/* int4_sum isn't strict, but has the same effect */
+				AGG_BATCH_FOLD(int64, DatumGetInt64, Int64GetDatum,
+							   int32, DatumGetInt32, acc + v);
+				break;
+
+			case AGG_BATCH_SUM_FLOAT8:
+				AGG_BATCH_FOLD(float8, DatumGetFloat8, Float8GetDatum,
+							   float8, DatumGetFloat8,
+							   agg_batch_float8_pl(acc, v));
+				break;
+
+			case AGG_BATCH_MIN_INT4:
+				AGG_BATCH_FOLD(int32, DatumGetInt32, Int32GetDatum,
+							   int32, DatumGetInt32, (acc < v) ? acc : v);
+				break;
+
+			case AGG_BATCH_MAX_INT4:
+				AGG_BATCH_FOLD(int32, DatumGetInt32, Int32GetDatum,
+							   int32, DatumGetInt32, (acc > v) ? acc : v);
+				break;
+
+			case AGG_BATCH_MIN_INT8:
+				AGG_BATCH_FOLD(int64, DatumGetInt64, Int64GetDatum,
+							   int64, DatumGetInt64, (acc < v) ? acc : v);
+				break;
+
+			case AGG_BATCH_MAX_INT8:
+				AGG_BATCH_FOLD(int64, DatumGetInt64, Int64GetDatum,
+							   int64, DatumGetInt64, (acc > v) ? acc : v);
+				break;
+
+				/* keep ties and NaNs as float8smaller/float8larger do */
+			case AGG_BATCH_MIN_FLOAT8:
+				AGG_BATCH_FOLD(float8, DatumGetFloat8, Float8GetDatum,
+							   float8, DatumGetFloat8,
+							   (float8_cmp_internal(acc, v) < 0) ? acc : v);
+				break;
+
+			case AGG_BATCH_MAX_FLOAT8:
+				AGG_BATCH_FOLD(float8, DatumGetFloat8, Float8GetDatum,
+							   float8, DatumGetFloat8,
+							   (float8_cmp_internal(acc, v) > 0) ? acc : v);
+				break;
+		}
+	}
+}
+
+/*
+ * ExecAgg for plain aggregation in batch mode
+ */
+static TupleTableSlot *
+agg_retrieve_batch(AggState *aggstate)
+{
+	ExprContext *econtext = aggstate->ss.ps.ps_ExprContext;
+	SeqScanState *scanstate = (SeqScanState *) outerPlanState(aggstate);
+	TupleBatch *batch = aggstate->batchstate->batch;
+	AggStatePerGroup pergroup = aggstate->pergroup;
+
+	ReScanExprContext(econtext);
+	ReScanExprContext(aggstate->aggcontexts[0]);
+
+	initialize_aggregates(aggstate, pergroup, 1);
+
+	while (ExecSeqScanNextBatch(scanstate))
+		agg_batch_advance(aggstate, pergroup, batch->sel, batch->nsel);
+
+	aggstate->agg_done = true;
+
+	/*
+	 * Without grouping there can't be any references to input columns
+	 * outside the aggregates, so we needn't supply a representative row.
+	 */
+	econtext->ecxt_outertuple = aggstate->ss.ss_ScanTupleSlot;
+
+	prepare_projection_slot(aggstate, econtext->ecxt_outertuple, 0);
+
+	select_current_set(aggstate, 0, false);
+
+	finalize_aggregates(aggstate, aggstate->peragg, pergroup);
+
+	return project_aggregates(aggstate);
+}
+
+/*
+ * Spill a row of the current batch whose group isn't in the hash table.  The
+ * row is formed from the batch's columns; the scan's other output columns
+ * aren't needed, and are written as NULLs.
+ */
+static void
+agg_batch_spill_row(AggState *aggstate, int row)
+{
+	TupleBatch *batch = aggstate->batchstate->batch;
+	TupleTableSlot *spillslot = aggstate->hash_spill_slot;
+	int			natts = spillslot->tts_tupleDescriptor->natts;
+	int			col;
+
+	ExecClearTuple(spillslot);
+	for (col = 0; col < natts; col++)
+	{
+		if (col < batch->ncols && batch->values[col] != NULL)
+		{
+			spillslot->tts_values[col] = batch->values[col][row];
+			spillslot->tts_isnull[col] = batch->isnull[col][row];
+		}
+		else
+		{
+			spillslot->tts_values[col] = (Datum) 0;
+			spillslot->tts_isnull[col] = true;
+		}
+	}
+	ExecStoreVirtualTuple(spillslot);
+
+	hash_agg_spill_tuple(aggstate, spillslot);
+}
+
+/*
+ * ExecAgg for hashed aggregation in batch mode: read input and build hash
+ * table
+ */
+static void
+agg_fill_hash_table_batch(AggState *aggstate)
+{
+	SeqScanState *scanstate = (SeqScanState *) outerPlanState(aggstate);
+	TupleBatch *batch = aggstate->batchstate->batch;
+	AggStatePerHash perhash = &aggstate->perhash[0];
+	TupleTableSlot *hashslot = perhash->hashslot;
+
+	/* as in lookup_hash_entry */
+	if (hashslot->tts_tupleDescriptor == NULL)
+	{
+		ExecSetSlotDescriptor(hashslot, ExecGetResultType(&scanstate->ss.ps));
+		ExecStoreAllNullTuple(hashslot);
+	}
+
+	aggstate->hash_depth = 0;
+	aggstate->hash_pass_groups = ((Agg *) aggstate->ss.ps.plan)->numGroups;
+	aggstate->hash_batches_used = 1;
+	aggstate->hash_mem_peak = 0;
+	aggstate->hash_disk_used = 0;
+
+	while (ExecSeqScanNextBatch(scanstate))
+	{
+		int			i;
+
+		for (i = 0; i < batch->nsel; i++)
+		{
+			int			row = batch->sel[i];
+			TupleHashEntryData *entry;
+			ListCell   *l;
+
+			/* output column n of the scan is batch column n - 1 */
+			foreach(l, perhash->hash_needed)
+			{
+				int			varNumber = lfirst_int(l) - 1;
+
+				hashslot->tts_values[varNumber] = batch->values[varNumber][row];
+				hashslot->tts_isnull[varNumber] = batch->isnull[varNumber][row];
+			}
+
+			entry = find_hash_entry(aggstate, 0);
+			if (entry == NULL)
+			{
+				agg_batch_spill_row(aggstate, row);
+				continue;
+			}
+
+			agg_batch_advance(aggstate, (AggStatePerGroup) entry->additional,
+							  &batch->sel[i], 1);
+		}
+
+		ResetExprContext(aggstate->tmpcontext);
+	}
+
+	hash_agg_finish_pass(aggstate);
+
+	aggstate->table_filled = true;
+	/* Initialize to walk the hash table */
+	select_current_set(aggstate, 0, true);
+	ResetTupleHashIterator(perhash->hashtable, &perhash->hashiter);
+}
+
 /* -----------------
  * ExecInitAgg
  *
@@ -2309,12 +3569,16 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 				transno,
 				aggno;
 	int			phase;
+	int			phaseidx;
 	ListCell   *l;
 	Bitmapset  *all_grouped_cols = NULL;
 	int			numGroupingSets = 1;
 	int			numPhases;
+	int			numHashes;
 	int			i = 0;
 	int			j = 0;
+	bool		use_hashing = (node->aggstrategy == AGG_HASHED ||
+							   node->aggstrategy == AGG_MIXED);
 
 	/* check for unsupported flags */
 	Assert(!(eflags & (EXEC_FLAG_BACKWARD | EXEC_FLAG_MARK)));
@@ -2329,9 +3593,9 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 	aggstate->aggs = NIL;
 	aggstate->numaggs = 0;
 	aggstate->numtrans = 0;
+	aggstate->aggstrategy = node->aggstrategy;
 	aggstate->aggsplit = node->aggsplit;
 	aggstate->maxsets = 0;
-	aggstate->hashfunctions = NULL;
 	aggstate->projected_set = -1;
 	aggstate->current_set = 0;
 	aggstate->peragg = NULL;
@@ -2341,18 +3605,29 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 	aggstate->agg_done = false;
 	aggstate->pergroup = NULL;
 	aggstate->grp_firstTuple = NULL;
-	aggstate->hashtable = NULL;
+	aggstate->num_hashes = 0;
+	aggstate->perhash = NULL;
+	aggstate->hash_pergroup = NULL;
+	aggstate->hashcontext = NULL;
+	aggstate->hash_mem_limit = work_mem * 1024L;
+	aggstate->hash_spill_mode = false;
+	aggstate->hash_spill = NULL;
+	aggstate->hash_batches = NIL;
+	aggstate->hash_spill_slot = NULL;
 	aggstate->sort_in = NULL;
 	aggstate->sort_out = NULL;
 
 	/*
 	 * Calculate the maximum number of grouping sets in any phase; this
-	 * determines the size of some allocations.
+	 * determines the size of some allocations.  Also calculate the number of
+	 * phases: all the hashed grouping sets are handled together in phase 0,
+	 * and each sorted rollup gets a phase of its own.
 	 */
+	numHashes = use_hashing ? 1 : 0;
+	numPhases = 1;
+
 	if (node->groupingSets)
 	{
-		Assert(node->aggstrategy != AGG_HASHED);
-
 		numGroupingSets = list_length(node->groupingSets);
 
 		foreach(l, node->chain)
@@ -2361,22 +3636,29 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 
 			numGroupingSets = Max(numGroupingSets,
 								  list_length(agg->groupingSets));
+
+			if (agg->aggstrategy == AGG_HASHED)
+				++numHashes;
+			else
+				++numPhases;
 		}
 	}
+	Assert(node->aggstrategy != AGG_MIXED || numPhases > 1);
 
 	aggstate->maxsets = numGroupingSets;
-	aggstate->numphases = numPhases = 1 + list_length(node->chain);
+	aggstate->numphases = numPhases;
 
 	aggstate->aggcontexts = (ExprContext **)
 		palloc0(sizeof(ExprContext *) * numGroupingSets);
 
 	/*
 	 * Create expression contexts.  We need three or more, one for
-	 * per-input-tuple processing, one for per-output-tuple processing, and
-	 * one for each grouping set.  The per-tuple memory context of the
-	 * per-grouping-set ExprContexts (aggcontexts) replaces the standalone
-	 * memory context formerly used to hold transition values.  We cheat a
-	 * little by using ExecAssignExprContext() to build all of them.
+	 * per-input-tuple processing, one for per-output-tuple processing, one
+	 * for each grouping set, and one for all the hash tables if hashing.  The
+	 * per-tuple memory context of the per-grouping-set ExprContexts
+	 * (aggcontexts) replaces the standalone memory context formerly used to
+	 * hold transition values.  We cheat a little by using
+	 * ExecAssignExprContext() to build all of them.
 	 *
 	 * NOTE: the details of what is stored in aggcontexts and what is stored
 	 * in the regular per-query memory context are driven by a simple
@@ -2392,6 +3674,12 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 		aggstate->aggcontexts[i] = aggstate->ss.ps.ps_ExprContext;
 	}
 
+	if (use_hashing)
+	{
+		ExecAssignExprContext(estate, &aggstate->ss.ps);
+		aggstate->hashcontext = aggstate->ss.ps.ps_ExprContext;
+	}
+
 	ExecAssignExprContext(estate, &aggstate->ss.ps);
 
 	/*
@@ -2399,7 +3687,6 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 	 */
 	ExecInitScanTupleSlot(estate, &aggstate->ss);
 	ExecInitResultTupleSlot(estate, &aggstate->ss.ps);
-	aggstate->hashslot = ExecInitExtraTupleSlot(estate);
 	aggstate->sort_slot = ExecInitExtraTupleSlot(estate);
 
 	/*
@@ -2436,6 +3723,12 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 	if (node->chain)
 		ExecSetSlotDescriptor(aggstate->sort_slot,
 						 aggstate->ss.ss_ScanTupleSlot->tts_tupleDescriptor);
+	if (node->aggstrategy == AGG_HASHED)
+	{
+		aggstate->hash_spill_slot = ExecInitExtraTupleSlot(estate);
+		ExecSetSlotDescriptor(aggstate->hash_spill_slot,
+						 aggstate->ss.ss_ScanTupleSlot->tts_tupleDescriptor);
+	}
 
 	/*
 	 * Initialize result tuple type and projection info.
@@ -2464,23 +3757,41 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 
 	/*
 	 * For each phase, prepare grouping set data and fmgr lookup data for
-	 * compare functions.  Accumulate all_grouped_cols in passing.
+	 * compare functions.  Accumulate all_grouped_cols in passing.  Each
+	 * hashed Agg node in the chain (and the top node, if hashing) becomes a
+	 * hash table of phase 0 rather than a phase of its own.
 	 */
 
 	aggstate->phases = palloc0(numPhases * sizeof(AggStatePerPhaseData));
 
-	for (phase = 0; phase < numPhases; ++phase)
+	aggstate->num_hashes = numHashes;
+	if (numHashes)
+	{
+		aggstate->perhash = palloc0(sizeof(AggStatePerHashData) * numHashes);
+		aggstate->phases[0].numsets = 0;
+		aggstate->phases[0].aggnode = node;
+		if (node->groupingSets)
+		{
+			aggstate->phases[0].gset_lengths = palloc(numHashes * sizeof(int));
+			aggstate->phases[0].grouped_cols = palloc(numHashes * sizeof(Bitmapset *));
+		}
+	}
+
+	phase = use_hashing ? 1 : 0;
+	numHashes = 0;
+
+	for (phaseidx = 0; phaseidx <= list_length(node->chain); ++phaseidx)
 	{
-		AggStatePerPhase phasedata = &aggstate->phases[phase];
+		AggStatePerPhase phasedata;
 		Agg		   *aggnode;
 		Sort	   *sortnode;
 		int			num_sets;
 
-		if (phase > 0)
+		if (phaseidx > 0)
 		{
-			aggnode = list_nth(node->chain, phase - 1);
+			aggnode = list_nth(node->chain, phaseidx - 1);
 			sortnode = (Sort *) aggnode->plan.lefttree;
-			Assert(IsA(sortnode, Sort));
+			Assert(sortnode == NULL || IsA(sortnode, Sort));
 		}
 		else
 		{
@@ -2488,6 +3799,44 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 			sortnode = NULL;
 		}
 
+		if (aggnode->aggstrategy == AGG_HASHED ||
+			aggnode->aggstrategy == AGG_MIXED)
+		{
+			AggStatePerHash perhash = &aggstate->perhash[numHashes];
+
+			phasedata = &aggstate->phases[0];
+
+			perhash->aggnode = aggnode;
+			perhash->numCols = aggnode->numCols;
+			perhash->hashslot = ExecInitExtraTupleSlot(estate);
+			execTuplesHashPrepare(aggnode->numCols,
+								  aggnode->grpOperators,
+								  &perhash->eqfunctions,
+								  &perhash->hashfunctions);
+
+			if (phasedata->grouped_cols)
+			{
+				Bitmapset  *cols = NULL;
+
+				for (j = 0; j < aggnode->numCols; ++j)
+					cols = bms_add_member(cols, aggnode->grpColIdx[j]);
+
+				phasedata->grouped_cols[numHashes] = cols;
+				phasedata->gset_lengths[numHashes] = aggnode->numCols;
+				phasedata->numsets = numHashes + 1;
+
+				all_grouped_cols = bms_add_members(all_grouped_cols, cols);
+			}
+
+			++numHashes;
+			continue;
+		}
+
+		/* the first sorted phase of mixed mode reads the input directly */
+		Assert(sortnode != NULL || phase <= 1);
+
+		phasedata = &aggstate->phases[phase++];
+
 		phasedata->numsets = num_sets = list_length(aggnode->groupingSets);
 
 		if (num_sets)
@@ -2515,7 +3864,7 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 		}
 		else
 		{
-			Assert(phase == 0);
+			Assert(phaseidx == 0);
 
 			phasedata->gset_lengths = NULL;
 			phasedata->grouped_cols = NULL;
@@ -2545,21 +3894,16 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 		aggstate->all_grouped_cols = lcons_int(i, aggstate->all_grouped_cols);
 
 	/*
-	 * Hashing can only appear in the initial phase.
-	 */
-
-	if (node->aggstrategy == AGG_HASHED)
-		execTuplesHashPrepare(node->numCols,
-							  node->grpOperators,
-							  &aggstate->phases[0].eqfunctions,
-							  &aggstate->hashfunctions);
-
-	/*
-	 * Initialize current phase-dependent values to initial phase
+	 * Initialize current phase-dependent values to initial phase.  In mixed
+	 * mode that is the first sorted phase, which fills the hash tables of
+	 * phase 0 as it goes.
 	 */
 
 	aggstate->current_phase = 0;
 	initialize_phase(aggstate, 0);
+	if (node->aggstrategy == AGG_MIXED)
+		initialize_phase(aggstate, 1);
+	select_current_set(aggstate, 0, node->aggstrategy == AGG_HASHED);
 
 	/*
 	 * Set up aggregate-result storage in the output expr context, and also
@@ -2575,14 +3919,17 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 	aggstate->peragg = peraggs;
 	aggstate->pertrans = pertransstates;
 
-	if (node->aggstrategy == AGG_HASHED)
+	if (use_hashing)
 	{
 		build_hash_table(aggstate);
 		aggstate->table_filled = false;
+		aggstate->hash_pergroup = (AggStatePerGroup *)
+			palloc0(sizeof(AggStatePerGroup) * aggstate->num_hashes);
 		/* Compute the columns we actually need to hash on */
-		aggstate->hash_needed = find_hash_columns(aggstate);
+		find_hash_columns(aggstate);
 	}
-	else
+
+	if (node->aggstrategy != AGG_HASHED)
 	{
 		AggStatePerGroup pergroup;
 
@@ -2653,6 +4000,7 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 		Datum		textInitVal;
 		Datum		initValue;
 		bool		initValueIsNull;
+		bool		hashDistinct;
 
 		/* Planner should have assigned aggregate to correct level */
 		Assert(aggref->agglevelsup == 0);
@@ -2865,6 +4213,19 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 												serialfn_oid, deserialfn_oid,
 												  initValue, initValueIsNull,
 													same_input_transnos);
+
+		/*
+		 * A DISTINCT aggregate that must see its input in order can't share
+		 * the state of one that eliminates duplicates by hashing, nor vice
+		 * versa.
+		 */
+		hashDistinct = aggref_distinct_is_hashable(aggref,
+												   aggform->aggcombinefn,
+												   aggtranstype);
+		if (existing_transno != -1 &&
+			pertransstates[existing_transno].hashDistinct != hashDistinct)
+			existing_transno = -1;
+
 		if (existing_transno != -1)
 		{
 			/*
@@ -2881,7 +4242,8 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 									  aggref, transfn_oid, aggtranstype,
 									  serialfn_oid, deserialfn_oid,
 									  initValue, initValueIsNull,
-									  inputTypes, numArguments);
+									  inputTypes, numArguments,
+									  hashDistinct);
 			peragg->transno = transno;
 		}
 		ReleaseSysCache(aggTuple);
@@ -2894,6 +4256,9 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 	aggstate->numaggs = aggno + 1;
 	aggstate->numtrans = transno + 1;
 
+	/* See if the input can be read in batches */
+	agg_batch_init(aggstate);
+
 	return aggstate;
 }
 
@@ -2903,7 +4268,8 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
  * This initializes all the fields in 'pertrans'. 'aggref' is the aggregate
  * to initialize the state for. 'aggtransfn', 'aggtranstype', and the rest
  * of the arguments could be calculated from 'aggref', but the caller has
- * calculated them already, so might as well pass them.
+ * calculated them already, so might as well pass them.  'hashDistinct' says
+ * whether a DISTINCT aggregate eliminates duplicates by hashing.
  */
 static void
 build_pertrans_for_aggref(AggStatePerTrans pertrans,
@@ -2912,7 +4278,8 @@ build_pertrans_for_aggref(AggStatePerTrans pertrans,
 						  Oid aggtransfn, Oid aggtranstype,
 						  Oid aggserialfn, Oid aggdeserialfn,
 						  Datum initValue, bool initValueIsNull,
-						  Oid *inputTypes, int numArguments)
+						  Oid *inputTypes, int numArguments,
+						  bool hashDistinct)
 {
 	int			numGroupingSets = Max(aggstate->maxsets, 1);
 	Expr	   *serialfnexpr = NULL;
@@ -2966,7 +4333,9 @@ build_pertrans_for_aggref(AggStatePerTrans pertrans,
 		fmgr_info(aggtransfn, &pertrans->transfn);
 		fmgr_info_set_expr((Node *) combinefnexpr, &pertrans->transfn);
 
-		InitFunctionCallInfoData(pertrans->transfn_fcinfo,
+		pertrans->transfn_fcinfo =
+			(FunctionCallInfo) palloc(SizeForFunctionCallInfo(2));
+		InitFunctionCallInfoData(*pertrans->transfn_fcinfo,
 								 &pertrans->transfn,
 								 2,
 								 pertrans->aggCollation,
@@ -3004,7 +4373,9 @@ build_pertrans_for_aggref(AggStatePerTrans pertrans,
 		fmgr_info(aggtransfn, &pertrans->transfn);
 		fmgr_info_set_expr((Node *) transfnexpr, &pertrans->transfn);
 
-		InitFunctionCallInfoData(pertrans->transfn_fcinfo,
+		pertrans->transfn_fcinfo = (FunctionCallInfo)
+			palloc(SizeForFunctionCallInfo(pertrans->numTransInputs + 1));
+		InitFunctionCallInfoData(*pertrans->transfn_fcinfo,
 								 &pertrans->transfn,
 								 pertrans->numTransInputs + 1,
 								 pertrans->aggCollation,
@@ -3042,7 +4413,9 @@ build_pertrans_for_aggref(AggStatePerTrans pertrans,
 		fmgr_info(aggserialfn, &pertrans->serialfn);
 		fmgr_info_set_expr((Node *) serialfnexpr, &pertrans->serialfn);
 
-		InitFunctionCallInfoData(pertrans->serialfn_fcinfo,
+		pertrans->serialfn_fcinfo =
+			(FunctionCallInfo) palloc(SizeForFunctionCallInfo(1));
+		InitFunctionCallInfoData(*pertrans->serialfn_fcinfo,
 								 &pertrans->serialfn,
 								 1,
 								 InvalidOid,
@@ -3056,7 +4429,9 @@ build_pertrans_for_aggref(AggStatePerTrans pertrans,
 		fmgr_info(aggdeserialfn, &pertrans->deserialfn);
 		fmgr_info_set_expr((Node *) deserialfnexpr, &pertrans->deserialfn);
 
-		InitFunctionCallInfoData(pertrans->deserialfn_fcinfo,
+		pertrans->deserialfn_fcinfo =
+			(FunctionCallInfo) palloc(SizeForFunctionCallInfo(2));
+		InitFunctionCallInfoData(*pertrans->deserialfn_fcinfo,
 								 &pertrans->deserialfn,
 								 2,
 								 InvalidOid,
@@ -3128,14 +4503,67 @@ build_pertrans_for_aggref(AggStatePerTrans pertrans,
 
 	pertrans->numSortCols = numSortCols;
 	pertrans->numDistinctCols = numDistinctCols;
+	pertrans->hashDistinct = hashDistinct;
+
+	if (hashDistinct)
+	{
+		TupleDesc	distinctdesc;
+		Oid		   *eqOperators;
+
+		/*
+		 * The DISTINCT clause covers all the inputs, so there's nothing to
+		 * sort.  Set up the hash table keys, with the group identifier in
+		 * front of the inputs.
+		 */
+		Assert(numDistinctCols == numInputs);
+
+		distinctdesc = CreateTemplateTupleDesc(numInputs + 1, false);
+		TupleDescInitEntry(distinctdesc, (AttrNumber) 1, NULL,
+						   INT8OID, -1, 0);
+		for (i = 0; i < numInputs; i++)
+			TupleDescCopyEntry(distinctdesc, (AttrNumber) (i + 2),
+							   pertrans->evaldesc, (AttrNumber) (i + 1));
+		pertrans->distinctslot = ExecInitExtraTupleSlot(estate);
+		ExecSetSlotDescriptor(pertrans->distinctslot, distinctdesc);
+
+		pertrans->distinctColIdx =
+			(AttrNumber *) palloc((numDistinctCols + 1) * sizeof(AttrNumber));
+		eqOperators = (Oid *) palloc((numDistinctCols + 1) * sizeof(Oid));
+
+		pertrans->distinctColIdx[0] = 1;
+		eqOperators[0] = Int8EqualOperator;
+		i = 1;
+		foreach(lc, sortlist)
+		{
+			SortGroupClause *sortcl = (SortGroupClause *) lfirst(lc);
+			TargetEntry *tle = get_sortgroupclause_tle(sortcl, aggref->args);
+
+			pertrans->distinctColIdx[i] = tle->resno + 1;
+			eqOperators[i] = sortcl->eqop;
+			i++;
+		}
+
+		execTuplesHashPrepare(numDistinctCols + 1,
+							  eqOperators,
+							  &pertrans->distinctEqfns,
+							  &pertrans->distinctHashfns);
+		pertrans->distincttables = (TupleHashTable *)
+			palloc0(sizeof(TupleHashTable) * numGroupingSets);
+	}
 
+	/*
+	 * Set up for sorting too, since even a hashed DISTINCT aggregate falls
+	 * back to sorting the input of a sorted group that outgrows work_mem.
+	 */
 	if (numSortCols > 0)
 	{
 		/*
-		 * We don't implement DISTINCT or ORDER BY aggs in the HASHED case
-		 * (yet)
+		 * We don't implement ORDER BY aggs, nor DISTINCT aggs that need
+		 * sorting, in the HASHED case (yet)
 		 */
-		Assert(((Agg *) aggstate->ss.ps.plan)->aggstrategy != AGG_HASHED);
+		Assert(hashDistinct ||
+			   (((Agg *) aggstate->ss.ps.plan)->aggstrategy != AGG_HASHED &&
+				((Agg *) aggstate->ss.ps.plan)->aggstrategy != AGG_MIXED));
 
 		/* If we have only one input, we need its len/byval info. */
 		if (numInputs == 1)
@@ -3384,6 +4812,11 @@ ExecEndAgg(AggState *node)
 	/* And ensure any agg shutdown callbacks have been called */
 	for (setno = 0; setno < numGroupingSets; setno++)
 		ReScanExprContext(node->aggcontexts[setno]);
+	if (node->hashcontext)
+		ReScanExprContext(node->hashcontext);
+
+	/* Close any spill files */
+	hash_agg_reset_spill(node);
 
 	/*
 	 * We don't actually free any ExprContexts here (see comment in
@@ -3428,14 +4861,21 @@ ExecReScanAgg(AggState *node)
 		 * If we do have the hash table, and the subplan does not have any
 		 * parameter changes, and none of our own parameter changes affect
 		 * input expressions of the aggregated functions, then we can just
-		 * rescan the existing hash table; no need to build it again.
+		 * rescan the existing hash table; no need to build it again.  That
+		 * only works if it held every group, though, with none spilled.
 		 */
 		if (outerPlan->chgParam == NULL &&
-			!bms_overlap(node->ss.ps.chgParam, aggnode->aggParams))
+			!bms_overlap(node->ss.ps.chgParam, aggnode->aggParams) &&
+			node->hash_disk_used == 0)
 		{
-			ResetTupleHashIterator(node->hashtable, &node->hashiter);
+			select_current_set(node, 0, true);
+			ResetTupleHashIterator(node->perhash[0].hashtable,
+								   &node->perhash[0].hashiter);
 			return;
 		}
+
+		/* Forget any spilled tuples of the previous scan */
+		hash_agg_reset_spill(node);
 	}
 
 	/* Make sure we have closed any open tuplesorts */
@@ -3460,15 +4900,17 @@ ExecReScanAgg(AggState *node)
 	 * rather than just reset because transfns may have registered callbacks
 	 * that need to be run now.)
 	 *
-	 * Note that with AGG_HASHED, the hash table is allocated in a sub-context
-	 * of the aggcontext. This used to be an issue, but now, resetting a
-	 * context automatically deletes sub-contexts too.
+	 * Note that with AGG_HASHED, the hash tables are allocated in a
+	 * sub-context of the hashcontext. This used to be an issue, but now,
+	 * resetting a context automatically deletes sub-contexts too.
 	 */
 
 	for (setno = 0; setno < numGroupingSets; setno++)
 	{
 		ReScanExprContext(node->aggcontexts[setno]);
 	}
+	if (node->hashcontext)
+		ReScanExprContext(node->hashcontext);
 
 	/* Release first tuple of group, if we have made a copy */
 	if (node->grp_firstTuple != NULL)
@@ -3482,13 +4924,16 @@ ExecReScanAgg(AggState *node)
 	MemSet(econtext->ecxt_aggvalues, 0, sizeof(Datum) * node->numaggs);
 	MemSet(econtext->ecxt_aggnulls, 0, sizeof(bool) * node->numaggs);
 
-	if (aggnode->aggstrategy == AGG_HASHED)
+	if (aggnode->aggstrategy == AGG_HASHED ||
+		aggnode->aggstrategy == AGG_MIXED)
 	{
-		/* Rebuild an empty hash table */
+		/* Rebuild empty hash tables */
 		build_hash_table(node);
 		node->table_filled = false;
+		node->hash_mem_peak = 0;
 	}
-	else
+
+	if (aggnode->aggstrategy != AGG_HASHED)
 	{
 		/*
 		 * Reset the per-group state (in particular, mark transvalues null)
@@ -3496,8 +4941,10 @@ ExecReScanAgg(AggState *node)
 		MemSet(node->pergroup, 0,
 			 sizeof(AggStatePerGroupData) * node->numaggs * numGroupingSets);
 
-		/* reset to phase 0 */
+		/* reset to phase 0, or to the first sorted phase in mixed mode */
 		initialize_phase(node, 0);
+		if (aggnode->aggstrategy == AGG_MIXED)
+			initialize_phase(node, 1);
 
 		node->input_done = false;
 		node->projected_set = -1;
@@ -3538,7 +4985,7 @@ AggCheckCallContext(FunctionCallInfo fcinfo, MemoryContext *aggcontext)
 		if (aggcontext)
 		{
 			AggState   *aggstate = ((AggState *) fcinfo->context);
-			ExprContext *cxt = aggstate->aggcontexts[aggstate->current_set];
+			ExprContext *cxt = aggstate->curaggcontext;
 
 			*aggcontext = cxt->ecxt_per_tuple_memory;
 		}
@@ -3627,7 +5074,7 @@ AggRegisterCallback(FunctionCallInfo fcinfo,
 	if (fcinfo->context && IsA(fcinfo->context, AggState))
 	{
 		AggState   *aggstate = (AggState *) fcinfo->context;
-		ExprContext *cxt = aggstate->aggcontexts[aggstate->current_set];
+		ExprContext *cxt = aggstate->curaggcontext;
 
 		RegisterExprContextCallback(cxt, func, arg);
 
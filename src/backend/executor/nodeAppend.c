@@ -17,6 +17,9 @@
  *		ExecAppend		- retrieve the next tuple from the node
  *		ExecEndAppend	- shut down the append node
  *		ExecReScanAppend - rescan the append node
+ *		ExecAppendEstimate, ExecAppendInitializeDSM,
+ *		ExecAppendReInitializeDSM, ExecAppendInitializeWorker
+ *						- parallel append support
  *
  *	 NOTES
  *		Each append node contains a list of one or more subplans which
@@ -53,14 +56,47 @@
  *			  nil	nil		 Scan	 Scan	  Scan	   Scan
  *							  |		  |		   |		|
  *							person employee student student-emp
+ *
+ *		A parallel-aware Append doesn't have each participant run all of
+ *		its subplans in turn.  Instead, the participants take subplans
+ *		from a shared list: each non-partial subplan is handed to just one
+ *		participant, while a partial subplan (one whose output is itself
+ *		divided among the participants, such as a Parallel Seq Scan) can be
+ *		joined by any number of them until it is exhausted.  Workers start
+ *		at the front of the list, where the planner puts the non-partial
+ *		subplans in descending order of cost; the leader, which also has
+ *		to deal with the workers' output, starts at the back, where the
+ *		partial subplans are.
  */
 
 #include "postgres.h"
 
 #include "executor/execdebug.h"
 #include "executor/nodeAppend.h"
+#include "miscadmin.h"
+#include "storage/spin.h"
+
+/*
+ * Shared state for a parallel-aware Append.
+ *
+ * pa_next_plan is the subplan a worker should try next, or
+ * INVALID_SUBPLAN_INDEX once every subplan has been handed out.  A subplan
+ * is marked finished as soon as it is handed out if it is non-partial, or
+ * once some participant has run it to completion if it is partial.
+ */
+typedef struct ParallelAppendState
+{
+	slock_t		pa_mutex;		/* protects the fields below */
+	int			pa_next_plan;	/* next subplan for a worker to try */
+	bool		pa_finished[FLEXIBLE_ARRAY_MEMBER];
+} ParallelAppendState;
+
+#define INVALID_SUBPLAN_INDEX		-1
 
 static bool exec_append_initialize_next(AppendState *appendstate);
+static bool exec_append_parallel_next(AppendState *node);
+static bool exec_append_parallel_next_leader(AppendState *node);
+static bool exec_append_parallel_next_worker(AppendState *node);
 
 
 /* ----------------------------------------------------------------
@@ -176,10 +212,16 @@ ExecInitAppend(Append *node, EState *estate, int eflags)
 	appendstate->ps.ps_ProjInfo = NULL;
 
 	/*
-	 * initialize to scan first subplan
+	 * initialize to scan first subplan; but a parallel-aware Append can't
+	 * choose one until we know whether it has shared state
 	 */
-	appendstate->as_whichplan = 0;
-	exec_append_initialize_next(appendstate);
+	if (node->plan.parallel_aware)
+		appendstate->as_whichplan = INVALID_SUBPLAN_INDEX;
+	else
+	{
+		appendstate->as_whichplan = 0;
+		exec_append_initialize_next(appendstate);
+	}
 
 	return appendstate;
 }
@@ -193,6 +235,10 @@ ExecInitAppend(Append *node, EState *estate, int eflags)
 TupleTableSlot *
 ExecAppend(AppendState *node)
 {
+	if (node->as_whichplan == INVALID_SUBPLAN_INDEX &&
+		!exec_append_parallel_next(node))
+		return ExecClearTuple(node->ps.ps_ResultTupleSlot);
+
 	for (;;)
 	{
 		PlanState  *subnode;
@@ -218,6 +264,17 @@ ExecAppend(AppendState *node)
 			return result;
 		}
 
+		/*
+		 * A parallel-aware Append asks for another subplan; it always scans
+		 * forward.
+		 */
+		if (node->ps.plan->parallel_aware)
+		{
+			if (!exec_append_parallel_next(node))
+				return ExecClearTuple(node->ps.ps_ResultTupleSlot);
+			continue;
+		}
+
 		/*
 		 * Go on to the "next" subplan in the appropriate direction. If no
 		 * more subplans, return the empty slot set up for us by
@@ -285,6 +342,239 @@ ExecReScanAppend(AppendState *node)
 		if (subnode->chgParam == NULL)
 			ExecReScan(subnode);
 	}
-	node->as_whichplan = 0;
-	exec_append_initialize_next(node);
+	if (node->ps.plan->parallel_aware)
+	{
+		/* shared state, if any, is reset by ExecAppendReInitializeDSM */
+		node->as_whichplan = INVALID_SUBPLAN_INDEX;
+	}
+	else
+	{
+		node->as_whichplan = 0;
+		exec_append_initialize_next(node);
+	}
+}
+
+/* ----------------------------------------------------------------
+ *		exec_append_parallel_next
+ *
+ *		Choose the next subplan for a parallel-aware Append to run,
+ *		setting as_whichplan.  Returns false if there's nothing left.
+ *
+ *		If there's no shared state, because we are being run outside
+ *		parallel mode (say, by a Gather that got no workers), we are the
+ *		only participant and just run every subplan in turn.
+ * ----------------------------------------------------------------
+ */
+static bool
+exec_append_parallel_next(AppendState *node)
+{
+	if (node->as_pstate == NULL)
+	{
+		if (node->as_whichplan >= node->as_nplans - 1)
+			return false;
+		node->as_whichplan++;
+		return true;
+	}
+
+	if (IsParallelWorker())
+		return exec_append_parallel_next_worker(node);
+	else
+		return exec_append_parallel_next_leader(node);
+}
+
+/* ----------------------------------------------------------------
+ *		exec_append_parallel_next_leader
+ *
+ *		The leader works backwards from the last subplan, so that it
+ *		mostly ends up helping with partial subplans, which it can
+ *		abandon at any time to read tuples from the workers, rather than
+ *		being stuck with a whole non-partial one.
+ * ----------------------------------------------------------------
+ */
+static bool
+exec_append_parallel_next_leader(AppendState *node)
+{
+	ParallelAppendState *pstate = node->as_pstate;
+	Append	   *append = (Append *) node->ps.plan;
+
+	SpinLockAcquire(&pstate->pa_mutex);
+
+	/* Mark just-completed subplan as finished, or start at the end. */
+	if (node->as_whichplan != INVALID_SUBPLAN_INDEX)
+		pstate->pa_finished[node->as_whichplan] = true;
+	else
+		node->as_whichplan = node->as_nplans - 1;
+
+	/* Loop until we find a subplan nobody has finished yet. */
+	while (pstate->pa_finished[node->as_whichplan])
+	{
+		if (node->as_whichplan == 0)
+		{
+			pstate->pa_next_plan = INVALID_SUBPLAN_INDEX;
+			node->as_whichplan = INVALID_SUBPLAN_INDEX;
+			SpinLockRelease(&pstate->pa_mutex);
+			return false;
+		}
+		node->as_whichplan--;
+	}
+
+	/* If non-partial, nobody else may run it. */
+	if (node->as_whichplan < append->first_partial_plan)
+		pstate->pa_finished[node->as_whichplan] = true;
+
+	SpinLockRelease(&pstate->pa_mutex);
+
+	return true;
+}
+
+/* ----------------------------------------------------------------
+ *		exec_append_parallel_next_worker
+ *
+ *		Workers take subplans from the front of the list in turn, so
+ *		that the non-partial subplans get spread across them, and once
+ *		those have all been handed out they go round the partial
+ *		subplans until every one of those is finished.
+ * ----------------------------------------------------------------
+ */
+static bool
+exec_append_parallel_next_worker(AppendState *node)
+{
+	ParallelAppendState *pstate = node->as_pstate;
+	Append	   *append = (Append *) node->ps.plan;
+	int			first_partial_plan = append->first_partial_plan;
+
+	SpinLockAcquire(&pstate->pa_mutex);
+
+	/* Mark just-completed subplan as finished. */
+	if (node->as_whichplan != INVALID_SUBPLAN_INDEX)
+		pstate->pa_finished[node->as_whichplan] = true;
+
+	/* If all the plans are already done, we have nothing to do. */
+	if (pstate->pa_next_plan == INVALID_SUBPLAN_INDEX)
+	{
+		node->as_whichplan = INVALID_SUBPLAN_INDEX;
+		SpinLockRelease(&pstate->pa_mutex);
+		return false;
+	}
+
+	/* Remember where we started, so we know when we've been everywhere. */
+	node->as_whichplan = pstate->pa_next_plan;
+
+	/* Loop until we find a subplan nobody has finished yet. */
+	while (pstate->pa_finished[pstate->pa_next_plan])
+	{
+		if (pstate->pa_next_plan < node->as_nplans - 1)
+			pstate->pa_next_plan++;
+		else if (node->as_whichplan > first_partial_plan)
+		{
+			/* Wrap around to the first partial plan. */
+			pstate->pa_next_plan = first_partial_plan;
+		}
+		else
+		{
+			/* At the last plan, with no earlier partial plans to revisit. */
+			pstate->pa_next_plan = node->as_whichplan;
+		}
+
+		if (pstate->pa_next_plan == node->as_whichplan)
+		{
+			/* We've tried everything. */
+			pstate->pa_next_plan = INVALID_SUBPLAN_INDEX;
+			node->as_whichplan = INVALID_SUBPLAN_INDEX;
+			SpinLockRelease(&pstate->pa_mutex);
+			return false;
+		}
+	}
+
+	/* Pick the plan we found, and advance pa_next_plan for the next worker. */
+	node->as_whichplan = pstate->pa_next_plan;
+	if (pstate->pa_next_plan < node->as_nplans - 1)
+		pstate->pa_next_plan++;
+	else if (first_partial_plan < node->as_nplans)
+		pstate->pa_next_plan = first_partial_plan;
+	else
+	{
+		/*
+		 * There are no partial plans, and we just took the last non-partial
+		 * one, so there's nothing more for the other workers to do.
+		 */
+		pstate->pa_next_plan = INVALID_SUBPLAN_INDEX;
+	}
+
+	/* If non-partial, nobody else may run it. */
+	if (node->as_whichplan < first_partial_plan)
+		pstate->pa_finished[node->as_whichplan] = true;
+
+	SpinLockRelease(&pstate->pa_mutex);
+
+	return true;
+}
+
+/* ----------------------------------------------------------------
+ *						Parallel Append Support
+ * ----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------
+ *		ExecAppendEstimate
+ *
+ *		Compute the amount of space we'll need in the parallel
+ *		query DSM, and inform pcxt->estimator about our needs.
+ * ----------------------------------------------------------------
+ */
+void
+ExecAppendEstimate(AppendState *node, ParallelContext *pcxt)
+{
+	node->pstate_len =
+		add_size(offsetof(ParallelAppendState, pa_finished),
+				 mul_size(sizeof(bool), node->as_nplans));
+
+	shm_toc_estimate_chunk(&pcxt->estimator, node->pstate_len);
+	shm_toc_estimate_keys(&pcxt->estimator, 1);
+}
+
+/* ----------------------------------------------------------------
+ *		ExecAppendInitializeDSM
+ *
+ *		Set up the shared state for a parallel append.
+ * ----------------------------------------------------------------
+ */
+void
+ExecAppendInitializeDSM(AppendState *node, ParallelContext *pcxt)
+{
+	ParallelAppendState *pstate;
+
+	pstate = shm_toc_allocate(pcxt->toc, node->pstate_len);
+	memset(pstate, 0, node->pstate_len);
+	SpinLockInit(&pstate->pa_mutex);
+	shm_toc_insert(pcxt->toc, node->ps.plan->plan_node_id, pstate);
+
+	node->as_pstate = pstate;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecAppendReInitializeDSM
+ *
+ *		Reset the shared state before beginning a fresh scan.
+ * ----------------------------------------------------------------
+ */
+void
+ExecAppendReInitializeDSM(AppendState *node, ParallelContext *pcxt)
+{
+	ParallelAppendState *pstate = node->as_pstate;
+
+	pstate->pa_next_plan = 0;
+	memset(pstate->pa_finished, 0, sizeof(bool) * node->as_nplans);
+}
+
+/* ----------------------------------------------------------------
+ *		ExecAppendInitializeWorker
+ *
+ *		Copy relevant information from TOC into planstate.
+ * ----------------------------------------------------------------
+ */
+void
+ExecAppendInitializeWorker(AppendState *node, shm_toc *toc)
+{
+	node->as_pstate = shm_toc_lookup(toc, node->ps.plan->plan_node_id);
 }
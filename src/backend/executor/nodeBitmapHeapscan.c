@@ -32,16 +32,23 @@
  *		ExecInitBitmapHeapScan		creates and initializes state info.
  *		ExecReScanBitmapHeapScan	prepares to rescan the plan.
  *		ExecEndBitmapHeapScan		releases all storage.
+ *		ExecBitmapHeapEstimate		estimates DSM space for parallel scan
+ *		ExecBitmapHeapInitializeDSM initialize DSM for parallel scan
+ *		ExecBitmapHeapInitializeWorker attach to DSM info in parallel worker
  */
 #include "postgres.h"
 
 #include "access/relscan.h"
 #include "access/transam.h"
+#include "access/visibilitymap.h"
 #include "executor/execdebug.h"
 #include "executor/nodeBitmapHeapscan.h"
+#include "miscadmin.h"
 #include "pgstat.h"
 #include "storage/bufmgr.h"
+#include "storage/condition_variable.h"
 #include "storage/predicate.h"
+#include "storage/spin.h"
 #include "utils/memutils.h"
 #include "utils/rel.h"
 #include "utils/spccache.h"
@@ -49,8 +56,46 @@
 #include "utils/tqual.h"
 
 
+/*
+ * Shared state for a parallel bitmap heap scan.
+ *
+ * All participants build one shared, lossy TIDBitmap together: each runs
+ * the child BitmapIndexScan, whose index AM divides the index among the
+ * attached scans, and ORs what it finds into the shared bitmap.  Nobody may
+ * start on the heap until everyone who got a share of the index is done,
+ * which nbuilders tracks; the last one out wakes the rest through cv, and
+ * after that the bitmap hands out heap pages to
+ * whoever asks next.  The shared bitmap and the index AM's parallel scan
+ * descriptor follow this struct at the given offsets.
+ */
+typedef struct ParallelBitmapHeapState
+{
+	slock_t		mutex;			/* protects nbuilders */
+	int			nbuilders;		/* participants still adding to the bitmap */
+	ConditionVariable cv;		/* signaled when nbuilders reaches zero */
+	Size		tbm_offset;		/* offset of the shared TIDBitmap */
+	Size		iscan_offset;	/* offset of the ParallelIndexScanDesc */
+} ParallelBitmapHeapState;
+
+/*
+ * How far to read ahead within a run of lossy pages.  This matches the size
+ * of the bulk-read buffer ring, so that we don't get ahead of what the ring
+ * can hold once the pages are read for real.
+ */
+#define BITMAP_READAHEAD_PAGES	(256 * 1024 / BLCKSZ)
+
+#define ParallelBitmapHeapTBM(pstate) \
+	((void *) ((char *) (pstate) + (pstate)->tbm_offset))
+#define ParallelBitmapHeapIndexScan(pstate) \
+	((ParallelIndexScanDesc) ((char *) (pstate) + (pstate)->iscan_offset))
+
 static TupleTableSlot *BitmapHeapNext(BitmapHeapScanState *node);
-static void bitgetpage(HeapScanDesc scan, TBMIterateResult *tbmres);
+static TIDBitmap *BitmapHeapBuildShared(BitmapHeapScanState *node);
+static BitmapIndexScanState *BitmapHeapGetIndexScan(BitmapHeapScanState *node);
+static void bitgetpage(HeapScanDesc scan, TBMIterateResult *tbmres,
+		   BufferAccessStrategy strategy);
+static void BitmapReadAhead(BitmapHeapScanState *node, HeapScanDesc scan,
+				BlockNumber blockno);
 
 
 /* ----------------------------------------------------------------
@@ -101,7 +146,10 @@ BitmapHeapNext(BitmapHeapScanState *node)
 	 */
 	if (tbm == NULL)
 	{
-		tbm = (TIDBitmap *) MultiExecProcNode(outerPlanState(node));
+		if (node->pstate != NULL)
+			tbm = BitmapHeapBuildShared(node);
+		else
+			tbm = (TIDBitmap *) MultiExecProcNode(outerPlanState(node));
 
 		if (!tbm || !IsA(tbm, TIDBitmap))
 			elog(ERROR, "unrecognized result from subplan");
@@ -130,6 +178,8 @@ BitmapHeapNext(BitmapHeapScanState *node)
 		 */
 		if (tbmres == NULL)
 		{
+			bool		inrun;
+
 			node->tbmres = tbmres = tbm_iterate(tbmiterator);
 			if (tbmres == NULL)
 			{
@@ -166,14 +216,68 @@ BitmapHeapNext(BitmapHeapScanState *node)
 			}
 
 			/*
-			 * Fetch the current heap page and identify candidate tuples.
+			 * We can skip fetching the heap page if we don't need any fields
+			 * from the heap, and the bitmap entries don't need rechecking,
+			 * and all tuples on the page are visible to our transaction.
+			 * Then the bitmap alone tells us how many tuples to return.
+			 */
+			node->skip_fetch = (node->can_skip_fetch &&
+								!tbmres->recheck &&
+								VM_ALL_VISIBLE(node->ss.ss_currentRelation,
+											   tbmres->blockno,
+											   &node->vmbuffer));
+
+			/*
+			 * A run of consecutive lossy pages, as summarizing index AMs like
+			 * BRIN and Hippo produce, is read just like a seqscan would read
+			 * it: with read-ahead, whether or not effective_io_concurrency
+			 * asks for prefetching, and through the bulk-read ring if the
+			 * table is big enough to have one, so as not to push everything
+			 * else out of shared buffers.  Pages outside runs are read the
+			 * usual way, since they may well be wanted again.
 			 */
-			bitgetpage(scan, tbmres);
+			if (tbmres->ntuples < 0 && tbmres->runend > tbmres->blockno)
+				node->run_end = Min(tbmres->runend, scan->rs_nblocks - 1);
+			inrun = (tbmres->ntuples < 0 &&
+					 node->run_end != InvalidBlockNumber &&
+					 tbmres->blockno <= node->run_end);
+			if (inrun)
+				BitmapReadAhead(node, scan, tbmres->blockno);
+
+			if (node->skip_fetch)
+			{
+				/* can't be lossy in the skip_fetch case */
+				Assert(tbmres->ntuples >= 0);
+
+				/* no need to hang on to the previous page anymore */
+				if (BufferIsValid(scan->rs_cbuf))
+				{
+					ReleaseBuffer(scan->rs_cbuf);
+					scan->rs_cbuf = InvalidBuffer;
+				}
+				scan->rs_ntuples = tbmres->ntuples;
+
+				/*
+				 * Without the tuples we can't take tuple-level predicate
+				 * locks, so lock the whole page, as index-only scans do.
+				 */
+				PredicateLockPage(scan->rs_rd, tbmres->blockno,
+								  scan->rs_snapshot);
+			}
+			else
+			{
+				/*
+				 * Fetch the current heap page and identify candidate tuples.
+				 */
+				bitgetpage(scan, tbmres, inrun ? scan->rs_strategy : NULL);
+			}
 
 			if (tbmres->ntuples >= 0)
 				node->exact_pages++;
 			else
 				node->lossy_pages++;
+			if (node->skip_fetch)
+				node->skipped_pages++;
 
 			/*
 			 * Set rs_cindex to first slot to examine
@@ -248,11 +352,32 @@ BitmapHeapNext(BitmapHeapScanState *node)
 					break;
 				}
 				node->prefetch_pages++;
+
+				/* As above, no need to prefetch a page we won't fetch */
+				if (node->can_skip_fetch &&
+					!tbmpre->recheck &&
+					tbmpre->blockno < scan->rs_nblocks &&
+					VM_ALL_VISIBLE(node->ss.ss_currentRelation,
+								   tbmpre->blockno,
+								   &node->pvmbuffer))
+					continue;
+
 				PrefetchBuffer(scan->rs_rd, MAIN_FORKNUM, tbmpre->blockno);
 			}
 		}
 #endif   /* USE_PREFETCH */
 
+		/*
+		 * If we skipped the heap page, every tuple of it that the bitmap
+		 * mentions is a match, and nobody needs its contents; hand back an
+		 * empty tuple for each.
+		 */
+		if (node->skip_fetch)
+		{
+			pgstat_count_heap_fetch(scan->rs_rd);
+			return ExecStoreAllNullTuple(slot);
+		}
+
 		/*
 		 * Okay to fetch the tuple
 		 */
@@ -305,15 +430,110 @@ BitmapHeapNext(BitmapHeapScanState *node)
 	return ExecClearTuple(slot);
 }
 
+/*
+ * BitmapHeapBuildShared - subroutine for BitmapHeapNext()
+ *
+ * Take part in building the shared bitmap of a parallel scan, and wait
+ * until it is complete.
+ */
+static TIDBitmap *
+BitmapHeapBuildShared(BitmapHeapScanState *node)
+{
+	ParallelBitmapHeapState *pstate = node->pstate;
+	BitmapIndexScanState *indexstate = BitmapHeapGetIndexScan(node);
+	TIDBitmap  *tbm;
+	bool		last;
+
+	tbm = tbm_attach_shared(ParallelBitmapHeapTBM(pstate));
+
+	SpinLockAcquire(&pstate->mutex);
+	pstate->nbuilders++;
+	SpinLockRelease(&pstate->mutex);
+
+	/* have the index scan OR its share of the pages into the shared bitmap */
+	indexstate->biss_result = tbm;
+	if ((TIDBitmap *) MultiExecProcNode((PlanState *) indexstate) != tbm)
+		elog(ERROR, "unrecognized result from subplan");
+
+	SpinLockAcquire(&pstate->mutex);
+	last = (--pstate->nbuilders == 0);
+	SpinLockRelease(&pstate->mutex);
+
+	/*
+	 * Wait for the others.  Anyone arriving from now on will find the index
+	 * scan exhausted, so once the count drops to zero the bitmap is final;
+	 * whoever brings it there wakes everybody else.
+	 */
+	if (last)
+	{
+		ConditionVariableBroadcast(&pstate->cv);
+		return tbm;
+	}
+
+	ConditionVariablePrepareToSleep(&pstate->cv);
+	for (;;)
+	{
+		SpinLockAcquire(&pstate->mutex);
+		last = (pstate->nbuilders == 0);
+		SpinLockRelease(&pstate->mutex);
+		if (last)
+			break;
+		ConditionVariableSleep(&pstate->cv);
+	}
+	ConditionVariableCancelSleep();
+
+	return tbm;
+}
+
+/*
+ * BitmapHeapGetIndexScan - get the index scan feeding a parallel scan
+ *
+ * The planner only makes a bitmap heap scan parallel-aware when its bitmap
+ * comes straight from a single index.
+ */
+static BitmapIndexScanState *
+BitmapHeapGetIndexScan(BitmapHeapScanState *node)
+{
+	PlanState  *outerPlan = outerPlanState(node);
+
+	if (!IsA(outerPlan, BitmapIndexScanState))
+		elog(ERROR, "parallel bitmap heap scan requires a bitmap index scan");
+	return (BitmapIndexScanState *) outerPlan;
+}
+
+/*
+ * BitmapReadAhead - subroutine for BitmapHeapNext()
+ *
+ * Make sure read-ahead has been requested for the pages of the current
+ * lossy run that follow blockno, up to BITMAP_READAHEAD_PAGES of them.
+ */
+static void
+BitmapReadAhead(BitmapHeapScanState *node, HeapScanDesc scan,
+				BlockNumber blockno)
+{
+#ifdef USE_PREFETCH
+	BlockNumber target;
+
+	if (node->readahead_block <= blockno)
+		node->readahead_block = blockno + 1;
+	target = Min(node->run_end, blockno + BITMAP_READAHEAD_PAGES);
+
+	while (node->readahead_block <= target)
+		PrefetchBuffer(scan->rs_rd, MAIN_FORKNUM, node->readahead_block++);
+#endif   /* USE_PREFETCH */
+}
+
 /*
  * bitgetpage - subroutine for BitmapHeapNext()
  *
- * This routine reads and pins the specified page of the relation, then
- * builds an array indicating which tuples on the page are both potentially
- * interesting according to the bitmap, and visible according to the snapshot.
+ * This routine reads and pins the specified page of the relation, using the
+ * given buffer access strategy (NULL for the default), then builds an array
+ * indicating which tuples on the page are both potentially interesting
+ * according to the bitmap, and visible according to the snapshot.
  */
 static void
-bitgetpage(HeapScanDesc scan, TBMIterateResult *tbmres)
+bitgetpage(HeapScanDesc scan, TBMIterateResult *tbmres,
+		   BufferAccessStrategy strategy)
 {
 	BlockNumber page = tbmres->blockno;
 	Buffer		buffer;
@@ -325,9 +545,10 @@ bitgetpage(HeapScanDesc scan, TBMIterateResult *tbmres)
 	 */
 	Assert(page < scan->rs_nblocks);
 
-	scan->rs_cbuf = ReleaseAndReadBuffer(scan->rs_cbuf,
-										 scan->rs_rd,
-										 page);
+	if (BufferIsValid(scan->rs_cbuf))
+		ReleaseBuffer(scan->rs_cbuf);
+	scan->rs_cbuf = ReadBufferExtended(scan->rs_rd, MAIN_FORKNUM, page,
+									   RBM_NORMAL, strategy);
 	buffer = scan->rs_cbuf;
 	snapshot = scan->rs_snapshot;
 
@@ -464,6 +685,28 @@ ExecReScanBitmapHeapScan(BitmapHeapScanState *node)
 	node->tbmiterator = NULL;
 	node->tbmres = NULL;
 	node->prefetch_iterator = NULL;
+	node->run_end = InvalidBlockNumber;
+	node->readahead_block = 0;
+	node->skip_fetch = false;
+	if (node->vmbuffer != InvalidBuffer)
+		ReleaseBuffer(node->vmbuffer);
+	node->vmbuffer = InvalidBuffer;
+	if (node->pvmbuffer != InvalidBuffer)
+		ReleaseBuffer(node->pvmbuffer);
+	node->pvmbuffer = InvalidBuffer;
+
+	/*
+	 * Reset the shared state too.  This only happens in the leader, while no
+	 * workers are running.
+	 */
+	if (node->pstate != NULL)
+	{
+		BitmapIndexScanState *indexstate = BitmapHeapGetIndexScan(node);
+
+		tbm_shared_reset(ParallelBitmapHeapTBM(node->pstate));
+		node->pstate->nbuilders = 0;
+		index_parallelrescan(indexstate->biss_ScanDesc);
+	}
 
 	ExecScanReScan(&node->ss);
 
@@ -516,6 +759,10 @@ ExecEndBitmapHeapScan(BitmapHeapScanState *node)
 		tbm_end_iterate(node->prefetch_iterator);
 	if (node->tbm)
 		tbm_free(node->tbm);
+	if (node->vmbuffer != InvalidBuffer)
+		ReleaseBuffer(node->vmbuffer);
+	if (node->pvmbuffer != InvalidBuffer)
+		ReleaseBuffer(node->pvmbuffer);
 
 	/*
 	 * close heap scan
@@ -562,11 +809,29 @@ ExecInitBitmapHeapScan(BitmapHeapScan *node, EState *estate, int eflags)
 	scanstate->tbmres = NULL;
 	scanstate->exact_pages = 0;
 	scanstate->lossy_pages = 0;
+	scanstate->skipped_pages = 0;
 	scanstate->prefetch_iterator = NULL;
 	scanstate->prefetch_pages = 0;
 	scanstate->prefetch_target = 0;
 	/* may be updated below */
 	scanstate->prefetch_maximum = target_prefetch_pages;
+	scanstate->run_end = InvalidBlockNumber;
+	scanstate->readahead_block = 0;
+	scanstate->skip_fetch = false;
+	scanstate->vmbuffer = InvalidBuffer;
+	scanstate->pvmbuffer = InvalidBuffer;
+	scanstate->pscan_len = 0;
+
+	/*
+	 * We can potentially skip fetching heap pages if we do not need any
+	 * columns of the table, either for checking non-indexable quals or for
+	 * returning data.  This test is a bit simplistic, as it checks the
+	 * stronger condition that there's no qual or return tlist at all.  But in
+	 * most cases it's probably not worth working harder than that.
+	 */
+	scanstate->can_skip_fetch = (node->scan.plan.qual == NIL &&
+								 node->scan.plan.targetlist == NIL);
+	scanstate->pstate = NULL;
 
 	/*
 	 * Miscellaneous initialization
@@ -653,3 +918,95 @@ ExecInitBitmapHeapScan(BitmapHeapScan *node, EState *estate, int eflags)
 	 */
 	return scanstate;
 }
+
+/* ----------------------------------------------------------------
+ *						Parallel Scan Support
+ * ----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------
+ *		ExecBitmapHeapEstimate
+ *
+ *		estimates the space required to serialize bitmap heap scan node.
+ * ----------------------------------------------------------------
+ */
+void
+ExecBitmapHeapEstimate(BitmapHeapScanState *node,
+					   ParallelContext *pcxt)
+{
+	EState	   *estate = node->ss.ps.state;
+	BitmapIndexScanState *indexstate = BitmapHeapGetIndexScan(node);
+	Size		size;
+
+	size = MAXALIGN(sizeof(ParallelBitmapHeapState));
+	size = add_size(size, MAXALIGN(tbm_shared_estimate(
+						node->ss.ss_currentScanDesc->rs_nblocks)));
+	size = add_size(size,
+					index_parallelscan_estimate(indexstate->biss_RelationDesc,
+												estate->es_snapshot));
+	node->pscan_len = size;
+
+	shm_toc_estimate_chunk(&pcxt->estimator, node->pscan_len);
+	shm_toc_estimate_keys(&pcxt->estimator, 1);
+}
+
+/* ----------------------------------------------------------------
+ *		ExecBitmapHeapInitializeDSM
+ *
+ *		Set up the shared bitmap and the parallel index scan.
+ * ----------------------------------------------------------------
+ */
+void
+ExecBitmapHeapInitializeDSM(BitmapHeapScanState *node,
+							ParallelContext *pcxt)
+{
+	EState	   *estate = node->ss.ps.state;
+	BitmapIndexScanState *indexstate = BitmapHeapGetIndexScan(node);
+	BlockNumber nblocks = node->ss.ss_currentScanDesc->rs_nblocks;
+	ParallelBitmapHeapState *pstate;
+
+	pstate = shm_toc_allocate(pcxt->toc, node->pscan_len);
+	SpinLockInit(&pstate->mutex);
+	pstate->nbuilders = 0;
+	ConditionVariableInit(&pstate->cv);
+	pstate->tbm_offset = MAXALIGN(sizeof(ParallelBitmapHeapState));
+	pstate->iscan_offset = pstate->tbm_offset +
+		MAXALIGN(tbm_shared_estimate(nblocks));
+
+	tbm_shared_initialize(ParallelBitmapHeapTBM(pstate), nblocks);
+	index_parallelscan_initialize(node->ss.ss_currentRelation,
+								  indexstate->biss_RelationDesc,
+								  estate->es_snapshot,
+								  ParallelBitmapHeapIndexScan(pstate));
+
+	shm_toc_insert(pcxt->toc, node->ss.ps.plan->plan_node_id, pstate);
+
+	node->pstate = pstate;
+	index_parallelscan_attach(indexstate->biss_ScanDesc,
+							  ParallelBitmapHeapIndexScan(pstate));
+
+	/*
+	 * Pages are handed out to whichever participant asks next, so a private
+	 * prefetch iterator has no way to know what this backend will read.
+	 */
+	node->prefetch_maximum = 0;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecBitmapHeapInitializeWorker
+ *
+ *		Copy relevant information from TOC into planstate.
+ * ----------------------------------------------------------------
+ */
+void
+ExecBitmapHeapInitializeWorker(BitmapHeapScanState *node, shm_toc *toc)
+{
+	BitmapIndexScanState *indexstate = BitmapHeapGetIndexScan(node);
+	ParallelBitmapHeapState *pstate;
+
+	pstate = shm_toc_lookup(toc, node->ss.ps.plan->plan_node_id);
+	node->pstate = pstate;
+	index_parallelscan_attach(indexstate->biss_ScanDesc,
+							  ParallelBitmapHeapIndexScan(pstate));
+	node->prefetch_maximum = 0;
+}
@@ -17,6 +17,11 @@
  *		MultiExecHash	- generate an in-memory hash table of the relation
  *		ExecInitHash	- initialize node and subnodes
  *		ExecEndHash		- shutdown node and subnodes
+ *
+ *		ExecHashEstimate		estimates DSM space for a shared hash table
+ *		ExecHashInitializeDSM	initializes a shared hash table
+ *		ExecHashReInitializeDSM resets it for a rescan
+ *		ExecHashInitializeWorker attaches to it in a parallel worker
  */
 
 #include "postgres.h"
@@ -25,6 +30,7 @@
 #include <limits.h>
 
 #include "access/htup_details.h"
+#include "access/parallel.h"
 #include "catalog/pg_statistic.h"
 #include "commands/tablespace.h"
 #include "executor/execdebug.h"
@@ -39,7 +45,6 @@
 
 
 static void ExecHashIncreaseNumBatches(HashJoinTable hashtable);
-static void ExecHashIncreaseNumBuckets(HashJoinTable hashtable);
 static void ExecHashBuildSkewHash(HashJoinTable hashtable, Hash *node,
 					  int mcvsToUse);
 static void ExecHashSkewTableInsert(HashJoinTable hashtable,
@@ -47,9 +52,32 @@ static void ExecHashSkewTableInsert(HashJoinTable hashtable,
 						uint32 hashvalue,
 						int bucketNumber);
 static void ExecHashRemoveNextSkewBucket(HashJoinTable hashtable);
+static void ExecHashStartRuntimeFilter(HashRuntimeFilter filter,
+						   double ntuples);
+static void ExecHashFinishRuntimeFilter(HashRuntimeFilter filter);
 
 static void *dense_alloc(HashJoinTable hashtable, Size size);
 
+static Node *MultiExecParallelHash(HashState *node);
+static void ExecParallelHashTableInsert(HashJoinTable hashtable,
+							TupleTableSlot *slot,
+							uint32 hashvalue);
+static HashJoinTuple ExecParallelHashTupleAlloc(HashJoinTable hashtable,
+						   Size size);
+static bool ExecParallelHashClaimSpace(ParallelHashJoinState *pstate,
+						   Size size, Size *offset);
+static void ExecParallelHashOverflow(HashJoinTable hashtable);
+static void ExecParallelHashSetNumBatches(HashJoinTable hashtable, int nbatch);
+static void ExecParallelHashDumpTable(HashJoinTable hashtable);
+static void ExecParallelHashBatchFileName(char *name, bool inner,
+							  int batchno, int participant);
+static Size ExecParallelHashComputeSize(Hash *node, int nparticipants,
+							ParallelHashJoinState *pstate);
+static void ExecParallelHashResetState(ParallelHashJoinState *pstate);
+
+/* Number of shared buckets claimed at a time while dumping the table */
+#define PHJ_DUMP_BUCKETS		1024
+
 /* ----------------------------------------------------------------
  *		ExecHash
  *
@@ -76,10 +104,15 @@ MultiExecHash(HashState *node)
 	PlanState  *outerNode;
 	List	   *hashkeys;
 	HashJoinTable hashtable;
+	HashRuntimeFilter filter;
 	TupleTableSlot *slot;
 	ExprContext *econtext;
 	uint32		hashvalue;
 
+	/* building a shared hash table is different enough to be kept apart */
+	if (node->parallel_state != NULL)
+		return MultiExecParallelHash(node);
+
 	/* must provide our own instrumentation support */
 	if (node->ps.instrument)
 		InstrStartNode(node->ps.instrument);
@@ -96,6 +129,14 @@ MultiExecHash(HashState *node)
 	hashkeys = node->hashkeys;
 	econtext = node->ps.ps_ExprContext;
 
+	/*
+	 * if our parent wants a runtime filter, every hash value goes into it,
+	 * whichever batch its tuple belongs to
+	 */
+	filter = node->runtimefilter;
+	if (filter != NULL)
+		ExecHashStartRuntimeFilter(filter, node->ps.plan->plan_rows);
+
 	/*
 	 * get all inner tuples and insert into the hash table (or temp files)
 	 */
@@ -112,6 +153,9 @@ MultiExecHash(HashState *node)
 		{
 			int			bucketNumber;
 
+			if (filter != NULL)
+				bloom_add_hash(filter->bloom, hashvalue);
+
 			bucketNumber = ExecHashGetSkewBucket(hashtable, hashvalue);
 			if (bucketNumber != INVALID_SKEW_BUCKET_NO)
 			{
@@ -129,6 +173,9 @@ MultiExecHash(HashState *node)
 		}
 	}
 
+	if (filter != NULL)
+		ExecHashFinishRuntimeFilter(filter);
+
 	/* resize the hash table if needed (NTUP_PER_BUCKET exceeded) */
 	if (hashtable->nbuckets != hashtable->nbuckets_optimal)
 		ExecHashIncreaseNumBuckets(hashtable);
@@ -174,6 +221,7 @@ ExecInitHash(Hash *node, EState *estate, int eflags)
 	hashstate->ps.state = estate;
 	hashstate->hashtable = NULL;
 	hashstate->hashkeys = NIL;	/* will be set by parent HashJoin */
+	hashstate->parallel_state = NULL;	/* set up later, if parallel-aware */
 
 	/*
 	 * Miscellaneous initialization
@@ -240,11 +288,16 @@ ExecEndHash(HashState *node)
  *		ExecHashTableCreate
  *
  *		create an empty hashtable data structure for hashjoin.
+ *
+ *		If the Hash node is parallel-aware, the table mostly describes our
+ *		view of the shared hash table, and no private buckets are made.
  * ----------------------------------------------------------------
  */
 HashJoinTable
-ExecHashTableCreate(Hash *node, List *hashOperators, bool keepNulls)
+ExecHashTableCreate(HashState *state, List *hashOperators, bool keepNulls)
 {
+	Hash	   *node = (Hash *) state->ps.plan;
+	ParallelHashJoinState *pstate = state->parallel_state;
 	HashJoinTable hashtable;
 	Plan	   *outerNode;
 	int			nbuckets;
@@ -263,9 +316,18 @@ ExecHashTableCreate(Hash *node, List *hashOperators, bool keepNulls)
 	 */
 	outerNode = outerPlan(node);
 
-	ExecChooseHashTableSize(outerNode->plan_rows, outerNode->plan_width,
-							OidIsValid(node->skewTable),
-							&nbuckets, &nbatch, &num_skew_mcvs);
+	if (pstate != NULL)
+	{
+		/* The leader has already sized the shared table for us */
+		nbuckets = pstate->nbuckets > 0 ? pstate->nbuckets :
+			pstate->batch_nbuckets;
+		nbatch = 1;
+		num_skew_mcvs = 0;
+	}
+	else
+		ExecChooseHashTableSize(outerNode->plan_rows, outerNode->plan_width,
+								OidIsValid(node->skewTable),
+								&nbuckets, &nbatch, &num_skew_mcvs);
 
 	/* nbuckets must be a power of 2 */
 	log2_nbuckets = my_log2(nbuckets);
@@ -306,6 +368,26 @@ ExecHashTableCreate(Hash *node, List *hashOperators, bool keepNulls)
 	hashtable->spaceAllowedSkew =
 		hashtable->spaceAllowed * SKEW_WORK_MEM_PERCENT / 100;
 	hashtable->chunks = NULL;
+	hashtable->parallel_state = pstate;
+	hashtable->participant = ParallelWorkerNumber + 1;
+	hashtable->shared_buckets = NULL;
+	hashtable->chunk_pos = 0;
+	hashtable->chunk_end = 0;
+	hashtable->shared_nbatch = 0;
+	hashtable->log2_shared_nbatch = 0;
+	hashtable->shared_curbatch = -1;
+	hashtable->read_participant = 0;
+	hashtable->read_file = NULL;
+
+	if (pstate != NULL)
+	{
+		/* batches are handled separately, and are never split further */
+		hashtable->nbatch_original = pstate->planned_nbatch;
+		hashtable->growEnabled = false;
+		if (pstate->nbuckets > 0)
+			hashtable->shared_buckets = (pg_atomic_uint32 *)
+				((char *) pstate + pstate->buckets_offset);
+	}
 
 #ifdef HJDEBUG
 	printf("Hashjoin %p: initial nbatch = %d, nbuckets = %d\n",
@@ -368,6 +450,19 @@ ExecHashTableCreate(Hash *node, List *hashOperators, bool keepNulls)
 		PrepareTempTablespaces();
 	}
 
+	if (pstate != NULL)
+	{
+		/* Someone may have run out of shared space already */
+		SpinLockAcquire(&pstate->mutex);
+		nbatch = pstate->nbatch;
+		SpinLockRelease(&pstate->mutex);
+		ExecParallelHashSetNumBatches(hashtable, nbatch);
+
+		MemoryContextSwitchTo(oldcxt);
+
+		return hashtable;
+	}
+
 	/*
 	 * Prepare context for the first-scan space allocations; allocate the
 	 * hashbucket array therein, and set each bucket "empty".
@@ -552,6 +647,72 @@ ExecChooseHashTableSize(double ntuples, int tupwidth, bool useskew,
 	*numbatches = nbatch;
 }
 
+/*
+ * Compute the size of a shared hash table for a parallel-aware hash join,
+ * given the estimated total size of the inner relation and the number of
+ * participants that will build it.
+ *
+ * The table may use the work_mem of all the participants.  If the inner
+ * relation fits, we leave room in the area for up to twice the estimated
+ * number of tuples, since the table can't grow later, and return
+ * *numbatches = 1.  Otherwise there will be no shared table at all;
+ * *area_size is set to zero, and *numbuckets and *numbatches describe the
+ * private per-batch hash tables that will be used instead.
+ *
+ * This is exported so that the planner's costsize.c can use it.
+ */
+void
+ExecChooseParallelHashTableSize(double ntuples, int tupwidth,
+								int nparticipants,
+								int *numbuckets,
+								int *numbatches,
+								Size *area_size)
+{
+	int			tupsize;
+	double		inner_rel_bytes;
+	double		space_allowed;
+	double		dbuckets;
+	double		darea;
+	int			nbuckets;
+	int			num_skew_mcvs;
+
+	/* Force a plausible relation size if no info */
+	if (ntuples <= 0.0)
+		ntuples = 1000.0;
+
+	/* Estimate tupsize the same way as ExecChooseHashTableSize */
+	tupsize = HJTUPLE_OVERHEAD +
+		MAXALIGN(SizeofMinimalTupleHeader) +
+		MAXALIGN(tupwidth);
+	inner_rel_bytes = ntuples * tupsize;
+
+	space_allowed = (double) work_mem * 1024L * nparticipants;
+	space_allowed = Min(space_allowed, (double) HJ_SHARED_MAX_AREA_SIZE);
+
+	/* one bucket per expected tuple, as a power of 2 */
+	dbuckets = ceil(ntuples / NTUP_PER_BUCKET);
+	dbuckets = Min(dbuckets, INT_MAX / 2);
+	nbuckets = Max((int) dbuckets, 1024);
+	nbuckets = 1 << my_log2(nbuckets);
+
+	if (inner_rel_bytes + nbuckets * sizeof(pg_atomic_uint32) > space_allowed)
+	{
+		/* It won't fit, so plan to use private per-batch tables instead */
+		ExecChooseHashTableSize(ntuples, tupwidth, false,
+								numbuckets, numbatches, &num_skew_mcvs);
+		*numbatches = Max(*numbatches, 2);
+		*area_size = 0;
+		return;
+	}
+
+	darea = Max(2.0 * inner_rel_bytes, 1024.0 * 1024.0);
+	darea = Min(darea, space_allowed - nbuckets * sizeof(pg_atomic_uint32));
+
+	*numbuckets = nbuckets;
+	*numbatches = 1;
+	*area_size = MAXALIGN_DOWN((Size) darea);
+}
+
 
 /* ----------------------------------------------------------------
  *		ExecHashTableDestroy
@@ -577,6 +738,16 @@ ExecHashTableDestroy(HashJoinTable hashtable)
 			BufFileClose(hashtable->outerBatchFile[i]);
 	}
 
+	/*
+	 * A parallel-aware join's files are numbered from batch 0, and belong to
+	 * a shared file set.  Don't touch the shared state here: the DSM segment
+	 * may be gone already.
+	 */
+	if (hashtable->shared_nbatch > 1)
+		ExecParallelHashCloseBatchFiles(hashtable);
+	if (hashtable->read_file)
+		BufFileClose(hashtable->read_file);
+
 	/* Release working memory (batchCxt is a child, so it goes away too) */
 	MemoryContextDelete(hashtable->hashCxt);
 
@@ -703,7 +874,7 @@ ExecHashIncreaseNumBatches(HashJoinTable hashtable)
 				memcpy(copyTuple, hashTuple, hashTupleSize);
 
 				/* and add it back to the appropriate bucket */
-				copyTuple->next = hashtable->buckets[bucketno];
+				copyTuple->next.unshared = hashtable->buckets[bucketno];
 				hashtable->buckets[bucketno] = copyTuple;
 			}
 			else
@@ -755,7 +926,7 @@ ExecHashIncreaseNumBatches(HashJoinTable hashtable)
  *		increase the original number of buckets in order to reduce
  *		number of tuples per bucket
  */
-static void
+void
 ExecHashIncreaseNumBuckets(HashJoinTable hashtable)
 {
 	HashMemoryChunk chunk;
@@ -804,7 +975,7 @@ ExecHashIncreaseNumBuckets(HashJoinTable hashtable)
 									  &bucketno, &batchno);
 
 			/* add the tuple to the proper bucket */
-			hashTuple->next = hashtable->buckets[bucketno];
+			hashTuple->next.unshared = hashtable->buckets[bucketno];
 			hashtable->buckets[bucketno] = hashTuple;
 
 			/* advance index past the tuple */
@@ -866,7 +1037,7 @@ ExecHashTableInsert(HashJoinTable hashtable,
 		HeapTupleHeaderClearMatch(HJTUPLE_MINTUPLE(hashTuple));
 
 		/* Push it onto the front of the bucket's list */
-		hashTuple->next = hashtable->buckets[bucketno];
+		hashTuple->next.unshared = hashtable->buckets[bucketno];
 		hashtable->buckets[bucketno] = hashTuple;
 
 		/*
@@ -1001,6 +1172,118 @@ ExecHashGetHashValue(HashJoinTable hashtable,
 	return true;
 }
 
+/*
+ * ExecHashStartRuntimeFilter
+ *		Set up an empty Bloom filter for about ntuples inner hash values
+ */
+static void
+ExecHashStartRuntimeFilter(HashRuntimeFilter filter, double ntuples)
+{
+	ExecHashResetRuntimeFilter(filter);
+	filter->bloom = bloom_create((int64) Min(ntuples, (double) PG_INT32_MAX),
+								 Max(work_mem / 4, 64), 0);
+}
+
+/*
+ * ExecHashFinishRuntimeFilter
+ *		Give up on a filter that came out too full to reject much
+ *
+ * That happens when there are many more inner tuples than we planned for.
+ */
+static void
+ExecHashFinishRuntimeFilter(HashRuntimeFilter filter)
+{
+	if (bloom_prop_bits_set(filter->bloom) > RUNTIME_FILTER_MAX_FILL)
+		ExecHashResetRuntimeFilter(filter);
+}
+
+/*
+ * ExecHashResetRuntimeFilter
+ *		Discard a runtime filter's Bloom filter, so that all rows pass
+ *
+ * The owning hash join must do this whenever its hash table goes away, since
+ * the filter describes that table's contents.
+ */
+void
+ExecHashResetRuntimeFilter(HashRuntimeFilter filter)
+{
+	if (filter->bloom != NULL)
+		bloom_free(filter->bloom);
+	filter->bloom = NULL;
+	filter->ntested = 0;
+	filter->nrejected = 0;
+}
+
+/*
+ * ExecHashRuntimeFilterPass
+ *		Might the current scan tuple (econtext->ecxt_scantuple) find a join
+ *		partner in the hash table the filter was built from?
+ *
+ * A false result is definite; true may be a false positive.  The hash value
+ * is computed exactly as ExecHashGetHashValue does for outer tuples of a join
+ * that doesn't need to keep unmatched outer tuples.  The caller is expected
+ * to reset the per-tuple memory afterwards.
+ */
+bool
+ExecHashRuntimeFilterPass(HashRuntimeFilter filter, ExprContext *econtext)
+{
+	uint32		hashkey = 0;
+	ListCell   *hk;
+	int			i = 0;
+	bool		pass = true;
+	MemoryContext oldContext;
+
+	if (filter->bloom == NULL)
+		return true;
+
+	oldContext = MemoryContextSwitchTo(econtext->ecxt_per_tuple_memory);
+
+	foreach(hk, filter->hashkeys)
+	{
+		ExprState  *keyexpr = (ExprState *) lfirst(hk);
+		Datum		keyval;
+		bool		isNull;
+
+		/* rotate hashkey left 1 bit at each step */
+		hashkey = (hashkey << 1) | ((hashkey & 0x80000000) ? 1 : 0);
+
+		keyval = ExecEvalExpr(keyexpr, econtext, &isNull, NULL);
+
+		if (isNull)
+		{
+			if (filter->hashStrict[i])
+			{
+				pass = false;	/* cannot match */
+				break;
+			}
+			/* else, leave hashkey unmodified, equivalent to hashcode 0 */
+		}
+		else
+			hashkey ^= DatumGetUInt32(FunctionCall1(&filter->hashfunctions[i],
+													keyval));
+
+		i++;
+	}
+
+	MemoryContextSwitchTo(oldContext);
+
+	if (pass)
+		pass = !bloom_lacks_hash(filter->bloom, hashkey);
+
+	/*
+	 * If the filter isn't earning its keep over the first rows, stop
+	 * consulting it.
+	 */
+	filter->ntested += 1;
+	if (!pass)
+		filter->nrejected += 1;
+	if (filter->ntested == RUNTIME_FILTER_TRIAL_ROWS &&
+		filter->nrejected < RUNTIME_FILTER_TRIAL_ROWS * RUNTIME_FILTER_MIN_REJECT)
+		ExecHashResetRuntimeFilter(filter);
+
+	return pass;
+}
+
 /*
  * ExecHashGetBucketAndBatch
  *		Determine the bucket number and batch number for a hash value
@@ -1070,12 +1353,21 @@ ExecScanHashBucket(HashJoinState *hjstate,
 	 * bucket, or NULL if it's time to start scanning a new bucket.
 	 *
 	 * If the tuple hashed to a skew bucket then scan the skew bucket
-	 * otherwise scan the standard hashtable bucket.
+	 * otherwise scan the standard hashtable bucket.  A shared hash table
+	 * links its tuples by offset instead of by pointer.
 	 */
 	if (hashTuple != NULL)
-		hashTuple = hashTuple->next;
+		hashTuple = HJ_NEXT_TUPLE(hashtable, hashTuple);
 	else if (hjstate->hj_CurSkewBucketNo != INVALID_SKEW_BUCKET_NO)
 		hashTuple = hashtable->skewBucket[hjstate->hj_CurSkewBucketNo]->tuples;
+	else if (hashtable->shared_buckets != NULL)
+	{
+		pg_atomic_uint32 *head;
+
+		head = &hashtable->shared_buckets[hjstate->hj_CurBucketNo];
+		hashTuple = HJ_SHARED_TUPLE(hashtable->parallel_state,
+									pg_atomic_read_u32(head));
+	}
 	else
 		hashTuple = hashtable->buckets[hjstate->hj_CurBucketNo];
 
@@ -1101,7 +1393,7 @@ ExecScanHashBucket(HashJoinState *hjstate,
 			}
 		}
 
-		hashTuple = hashTuple->next;
+		hashTuple = HJ_NEXT_TUPLE(hashtable, hashTuple);
 	}
 
 	/*
@@ -1152,7 +1444,7 @@ ExecScanHashTableForUnmatched(HashJoinState *hjstate, ExprContext *econtext)
 		 * bucket.
 		 */
 		if (hashTuple != NULL)
-			hashTuple = hashTuple->next;
+			hashTuple = hashTuple->next.unshared;
 		else if (hjstate->hj_CurBucketNo < hashtable->nbuckets)
 		{
 			hashTuple = hashtable->buckets[hjstate->hj_CurBucketNo];
@@ -1191,7 +1483,7 @@ ExecScanHashTableForUnmatched(HashJoinState *hjstate, ExprContext *econtext)
 				return true;
 			}
 
-			hashTuple = hashTuple->next;
+			hashTuple = hashTuple->next.unshared;
 		}
 	}
 
@@ -1244,7 +1536,8 @@ ExecHashTableResetMatchFlags(HashJoinTable hashtable)
 	/* Reset all flags in the main table ... */
 	for (i = 0; i < hashtable->nbuckets; i++)
 	{
-		for (tuple = hashtable->buckets[i]; tuple != NULL; tuple = tuple->next)
+		for (tuple = hashtable->buckets[i]; tuple != NULL;
+			 tuple = tuple->next.unshared)
 			HeapTupleHeaderClearMatch(HJTUPLE_MINTUPLE(tuple));
 	}
 
@@ -1254,7 +1547,8 @@ ExecHashTableResetMatchFlags(HashJoinTable hashtable)
 		int			j = hashtable->skewBucketNums[i];
 		HashSkewBucket *skewBucket = hashtable->skewBucket[j];
 
-		for (tuple = skewBucket->tuples; tuple != NULL; tuple = tuple->next)
+		for (tuple = skewBucket->tuples; tuple != NULL;
+			 tuple = tuple->next.unshared)
 			HeapTupleHeaderClearMatch(HJTUPLE_MINTUPLE(tuple));
 	}
 }
@@ -1506,7 +1800,7 @@ ExecHashSkewTableInsert(HashJoinTable hashtable,
 	HeapTupleHeaderClearMatch(HJTUPLE_MINTUPLE(hashTuple));
 
 	/* Push it onto the front of the skew bucket's list */
-	hashTuple->next = hashtable->skewBucket[bucketNumber]->tuples;
+	hashTuple->next.unshared = hashtable->skewBucket[bucketNumber]->tuples;
 	hashtable->skewBucket[bucketNumber]->tuples = hashTuple;
 
 	/* Account for space used, and back off if we've used too much */
@@ -1555,7 +1849,7 @@ ExecHashRemoveNextSkewBucket(HashJoinTable hashtable)
 	hashTuple = bucket->tuples;
 	while (hashTuple != NULL)
 	{
-		HashJoinTuple nextHashTuple = hashTuple->next;
+		HashJoinTuple nextHashTuple = hashTuple->next.unshared;
 		MinimalTuple tuple;
 		Size		tupleSize;
 
@@ -1581,7 +1875,7 @@ ExecHashRemoveNextSkewBucket(HashJoinTable hashtable)
 			memcpy(copyTuple, hashTuple, tupleSize);
 			pfree(hashTuple);
 
-			copyTuple->next = hashtable->buckets[bucketno];
+			copyTuple->next.unshared = hashtable->buckets[bucketno];
 			hashtable->buckets[bucketno] = copyTuple;
 
 			/* We have reduced skew space, but overall space doesn't change */
@@ -1710,3 +2004,642 @@ dense_alloc(HashJoinTable hashtable, Size size)
 	/* return pointer to the start of the tuple memory */
 	return ptr;
 }
+
+/* ----------------------------------------------------------------
+ *		MultiExecParallelHash
+ *
+ *		do our part in building a shared hash table
+ *
+ * Every participant inserts its share of the inner relation into the
+ * shared table, or into batch files once it has overflowed.  After that,
+ * if there are batches, any tuples in the shared table are dumped out to
+ * batch files too.  Participants that show up late join in whatever phase
+ * the build has reached.  The caller (ExecHashJoin) takes over when we
+ * return, still attached to the build barrier.
+ * ----------------------------------------------------------------
+ */
+static Node *
+MultiExecParallelHash(HashState *node)
+{
+	ParallelHashJoinState *pstate = node->parallel_state;
+	HashJoinTable hashtable = node->hashtable;
+	PlanState  *outerNode = outerPlanState(node);
+	ExprContext *econtext = node->ps.ps_ExprContext;
+	TupleTableSlot *slot;
+	uint32		hashvalue;
+	double		ntuples = 0;
+	int			nbatch;
+	int			phase;
+
+	/* must provide our own instrumentation support */
+	if (node->ps.instrument)
+		InstrStartNode(node->ps.instrument);
+
+	phase = BarrierAttach(&pstate->build_barrier);
+
+	if (phase == PHJ_BUILD_HASHING_INNER)
+	{
+		for (;;)
+		{
+			slot = ExecProcNode(outerNode);
+			if (TupIsNull(slot))
+				break;
+			econtext->ecxt_innertuple = slot;
+			if (ExecHashGetHashValue(hashtable, econtext, node->hashkeys,
+									 false, hashtable->keepNulls,
+									 &hashvalue))
+			{
+				ExecParallelHashTableInsert(hashtable, slot, hashvalue);
+				ntuples += 1;
+			}
+		}
+
+		SpinLockAcquire(&pstate->mutex);
+		pstate->total_tuples += ntuples;
+		SpinLockRelease(&pstate->mutex);
+
+		BarrierArriveAndWait(&pstate->build_barrier);
+		phase = PHJ_BUILD_DUMPING;
+	}
+
+	/* All the inner tuples are in by now; see whether they all fit. */
+	SpinLockAcquire(&pstate->mutex);
+	hashtable->totalTuples = pstate->total_tuples;
+	nbatch = pstate->nbatch;
+	SpinLockRelease(&pstate->mutex);
+	ExecParallelHashSetNumBatches(hashtable, nbatch);
+
+	if (pstate->nbuckets > 0)
+		hashtable->spacePeak =
+			(Size) pg_atomic_read_u32(&pstate->space_used) * MAXIMUM_ALIGNOF +
+			pstate->nbuckets * sizeof(pg_atomic_uint32);
+
+	if (nbatch > 1)
+	{
+		if (phase == PHJ_BUILD_DUMPING)
+		{
+			ExecParallelHashDumpTable(hashtable);
+			ExecParallelHashCloseBatchFiles(hashtable);
+			BarrierArriveAndWait(&pstate->build_barrier);
+		}
+
+		/* From now on, each batch gets a private table of its own */
+		hashtable->shared_buckets = NULL;
+		hashtable->nbuckets = pstate->batch_nbuckets;
+		hashtable->nbuckets_optimal = pstate->batch_nbuckets;
+		hashtable->log2_nbuckets = my_log2(pstate->batch_nbuckets);
+		hashtable->log2_nbuckets_optimal = hashtable->log2_nbuckets;
+	}
+
+	/*
+	 * Each participant inserted only some of the inner tuples, so a runtime
+	 * filter has to be built from the finished shared table.  If we've gone
+	 * to batches, the tuples are scattered across everyone's files, and we
+	 * just do without.
+	 */
+	if (node->runtimefilter != NULL)
+	{
+		HashRuntimeFilter filter = node->runtimefilter;
+
+		ExecHashResetRuntimeFilter(filter);
+		if (hashtable->shared_buckets != NULL)
+		{
+			int			i;
+
+			ExecHashStartRuntimeFilter(filter, hashtable->totalTuples);
+			for (i = 0; i < hashtable->nbuckets; i++)
+			{
+				HashJoinTuple hashTuple;
+
+				hashTuple = HJ_SHARED_TUPLE(pstate,
+						   pg_atomic_read_u32(&hashtable->shared_buckets[i]));
+				while (hashTuple != NULL)
+				{
+					bloom_add_hash(filter->bloom, hashTuple->hashvalue);
+					hashTuple = HJ_NEXT_TUPLE(hashtable, hashTuple);
+				}
+			}
+			ExecHashFinishRuntimeFilter(filter);
+		}
+	}
+
+	/* must provide our own instrumentation support */
+	if (node->ps.instrument)
+		InstrStopNode(node->ps.instrument, ntuples);
+
+	return NULL;
+}
+
+/*
+ * ExecParallelHashTableInsert
+ *		insert a tuple into the shared hash table, or into one of our batch
+ *		files if the table has overflowed
+ */
+static void
+ExecParallelHashTableInsert(HashJoinTable hashtable,
+							TupleTableSlot *slot,
+							uint32 hashvalue)
+{
+	ParallelHashJoinState *pstate = hashtable->parallel_state;
+	MinimalTuple tuple = ExecFetchSlotMinimalTuple(slot);
+	int			batchno;
+
+	if (hashtable->shared_nbatch == 1)
+	{
+		HashJoinTuple hashTuple;
+
+		hashTuple = ExecParallelHashTupleAlloc(hashtable,
+											HJTUPLE_OVERHEAD + tuple->t_len);
+		if (hashTuple != NULL)
+		{
+			pg_atomic_uint32 *head;
+			uint32		offset = HJ_SHARED_OFFSET(pstate, hashTuple);
+
+			hashTuple->hashvalue = hashvalue;
+			memcpy(HJTUPLE_MINTUPLE(hashTuple), tuple, tuple->t_len);
+			HeapTupleHeaderClearMatch(HJTUPLE_MINTUPLE(hashTuple));
+
+			/*
+			 * Push it onto the front of the bucket's list.  The
+			 * compare-and-swap acts as a memory barrier, so the tuple's
+			 * contents are visible to anyone who can see it in the list.
+			 */
+			head = &hashtable->shared_buckets[hashvalue &
+											  (hashtable->nbuckets - 1)];
+			hashTuple->next.shared = pg_atomic_read_u32(head);
+			while (!pg_atomic_compare_exchange_u32(head,
+												   &hashTuple->next.shared,
+												   offset))
+				;
+			return;
+		}
+
+		/* No room left, so switch to batches */
+		ExecParallelHashOverflow(hashtable);
+	}
+
+	batchno = ExecParallelHashGetBatch(hashtable, hashvalue);
+	ExecHashJoinSaveTuple(tuple, hashvalue,
+						  ExecParallelHashGetBatchFile(hashtable, true,
+													   batchno));
+}
+
+/*
+ * ExecParallelHashTupleAlloc
+ *		allocate space for a tuple in the shared area
+ *
+ * Like dense_alloc, we hand out space from chunks of HASH_CHUNK_SIZE, except
+ * that the chunks are claimed from the shared area and are never freed.
+ * Returns NULL if the area is full.
+ */
+static HashJoinTuple
+ExecParallelHashTupleAlloc(HashJoinTable hashtable, Size size)
+{
+	ParallelHashJoinState *pstate = hashtable->parallel_state;
+	Size		offset;
+
+	size = MAXALIGN(size);
+
+	/* Large tuples get exactly the space they need */
+	if (size > HASH_CHUNK_THRESHOLD)
+	{
+		if (!ExecParallelHashClaimSpace(pstate, size, &offset))
+			return NULL;
+		return (HashJoinTuple) ((char *) pstate + offset);
+	}
+
+	/* Start a new chunk if there's not enough room in the current one */
+	if (hashtable->chunk_end - hashtable->chunk_pos < size)
+	{
+		if (!ExecParallelHashClaimSpace(pstate, HASH_CHUNK_SIZE, &offset))
+			return NULL;
+		hashtable->chunk_pos = offset;
+		hashtable->chunk_end = offset + HASH_CHUNK_SIZE;
+	}
+
+	offset = hashtable->chunk_pos;
+	hashtable->chunk_pos += size;
+
+	return (HashJoinTuple) ((char *) pstate + offset);
+}
+
+/*
+ * ExecParallelHashClaimSpace
+ *		claim 'size' bytes of the shared area
+ *
+ * On success, *offset is set to the offset of the space from the start of
+ * pstate.  Returns false if there isn't enough space left.
+ */
+static bool
+ExecParallelHashClaimSpace(ParallelHashJoinState *pstate, Size size,
+						   Size *offset)
+{
+	uint32		units = size / MAXIMUM_ALIGNOF;
+	uint32		limit = pstate->area_size / MAXIMUM_ALIGNOF;
+	uint32		used;
+
+	Assert(size % MAXIMUM_ALIGNOF == 0);
+
+	used = pg_atomic_read_u32(&pstate->space_used);
+	do
+	{
+		if (units > limit - used)
+			return false;
+	} while (!pg_atomic_compare_exchange_u32(&pstate->space_used,
+											 &used, used + units));
+
+	*offset = pstate->area_offset + (Size) used * MAXIMUM_ALIGNOF;
+	return true;
+}
+
+/*
+ * ExecParallelHashOverflow
+ *		switch to batches, because the shared area is full
+ *
+ * The first participant to get here chooses the number of batches, and
+ * everyone else goes along with it.  We don't know how much more of the
+ * inner relation is still to come, so we guess that it's as big again as
+ * what has been loaded so far, and aim for batches that fit in work_mem.
+ */
+static void
+ExecParallelHashOverflow(HashJoinTable hashtable)
+{
+	ParallelHashJoinState *pstate = hashtable->parallel_state;
+	double		dbatch;
+	int			nbatch;
+
+	dbatch = ceil(2.0 * pstate->area_size / (work_mem * 1024.0));
+	nbatch = 2;
+	while (nbatch < dbatch && nbatch < INT_MAX / 2)
+		nbatch <<= 1;
+
+	SpinLockAcquire(&pstate->mutex);
+	if (pstate->nbatch == 1)
+		pstate->nbatch = nbatch;
+	else
+		nbatch = pstate->nbatch;
+	SpinLockRelease(&pstate->mutex);
+
+#ifdef HJDEBUG
+	printf("Hashjoin %p: shared hash table full, using %d batches\n",
+		   hashtable, nbatch);
+#endif
+
+	ExecParallelHashSetNumBatches(hashtable, nbatch);
+}
+
+/*
+ * ExecParallelHashSetNumBatches
+ *		set up to use the given number of batches
+ *
+ * The number of batches of a parallel-aware join changes at most once,
+ * from 1 to its final value.
+ */
+static void
+ExecParallelHashSetNumBatches(HashJoinTable hashtable, int nbatch)
+{
+	MemoryContext oldcxt;
+
+	if (hashtable->shared_nbatch == nbatch)
+		return;
+	Assert(hashtable->shared_nbatch <= 1);
+
+	hashtable->shared_nbatch = nbatch;
+	hashtable->log2_shared_nbatch = my_log2(nbatch);
+	if (nbatch == 1)
+		return;
+
+	oldcxt = MemoryContextSwitchTo(hashtable->hashCxt);
+	hashtable->innerBatchFile = (BufFile **)
+		palloc0(nbatch * sizeof(BufFile *));
+	hashtable->outerBatchFile = (BufFile **)
+		palloc0(nbatch * sizeof(BufFile *));
+	MemoryContextSwitchTo(oldcxt);
+}
+
+/*
+ * ExecParallelHashDumpTable
+ *		write the tuples in the shared hash table out to batch files
+ *
+ * Participants claim ranges of buckets until there are none left.
+ */
+static void
+ExecParallelHashDumpTable(HashJoinTable hashtable)
+{
+	ParallelHashJoinState *pstate = hashtable->parallel_state;
+	uint32		nbuckets = (uint32) pstate->nbuckets;
+	uint32		start;
+
+	while ((start = pg_atomic_fetch_add_u32(&pstate->next_bucket,
+											PHJ_DUMP_BUCKETS)) < nbuckets)
+	{
+		uint32		end = Min(start + PHJ_DUMP_BUCKETS, nbuckets);
+		uint32		i;
+
+		for (i = start; i < end; i++)
+		{
+			HashJoinTuple hashTuple;
+
+			hashTuple = HJ_SHARED_TUPLE(pstate,
+							pg_atomic_read_u32(&hashtable->shared_buckets[i]));
+			while (hashTuple != NULL)
+			{
+				int			batchno;
+
+				batchno = ExecParallelHashGetBatch(hashtable,
+												   hashTuple->hashvalue);
+				ExecHashJoinSaveTuple(HJTUPLE_MINTUPLE(hashTuple),
+									  hashTuple->hashvalue,
+						ExecParallelHashGetBatchFile(hashtable, true, batchno));
+				hashTuple = HJ_SHARED_TUPLE(pstate, hashTuple->next.shared);
+			}
+		}
+
+		CHECK_FOR_INTERRUPTS();
+	}
+}
+
+/*
+ * ExecParallelHashGetBatch
+ *		determine the batch number for a hash value in a parallel-aware join
+ *
+ * We use the high bits of the hash value, so that the batch number is
+ * independent of the bucket number whatever size the tables are.
+ */
+int
+ExecParallelHashGetBatch(HashJoinTable hashtable, uint32 hashvalue)
+{
+	if (hashtable->shared_nbatch <= 1)
+		return 0;
+	return hashvalue >> (32 - hashtable->log2_shared_nbatch);
+}
+
+/*
+ * ExecParallelHashBatchFileName
+ *		name of a participant's inner or outer file for a batch
+ */
+static void
+ExecParallelHashBatchFileName(char *name, bool inner, int batchno,
+							  int participant)
+{
+	snprintf(name, MAXPGPATH, "%c%d.%d", inner ? 'i' : 'o',
+			 batchno, participant);
+}
+
+/*
+ * ExecParallelHashGetBatchFile
+ *		get a pointer to our inner or outer file for a batch, for use with
+ *		ExecHashJoinSaveTuple
+ *
+ * The file is created in the shared file set if we haven't got it open.
+ * Each file is written in a single stretch and then closed for good with
+ * ExecParallelHashCloseBatchFiles, after which other participants may read
+ * it.
+ */
+BufFile **
+ExecParallelHashGetBatchFile(HashJoinTable hashtable, bool inner, int batchno)
+{
+	BufFile   **files;
+
+	Assert(batchno >= 0 && batchno < hashtable->shared_nbatch);
+	files = inner ? hashtable->innerBatchFile : hashtable->outerBatchFile;
+
+	if (files[batchno] == NULL)
+	{
+		char		name[MAXPGPATH];
+
+		ExecParallelHashBatchFileName(name, inner, batchno,
+									  hashtable->participant);
+		files[batchno] = BufFileCreateShared(&hashtable->parallel_state->fileset,
+											 name);
+	}
+
+	return &files[batchno];
+}
+
+/*
+ * ExecParallelHashCloseBatchFiles
+ *		close all the batch files we have open for writing
+ */
+void
+ExecParallelHashCloseBatchFiles(HashJoinTable hashtable)
+{
+	int			i;
+
+	for (i = 0; i < hashtable->shared_nbatch; i++)
+	{
+		if (hashtable->innerBatchFile[i])
+			BufFileClose(hashtable->innerBatchFile[i]);
+		hashtable->innerBatchFile[i] = NULL;
+		if (hashtable->outerBatchFile[i])
+			BufFileClose(hashtable->outerBatchFile[i]);
+		hashtable->outerBatchFile[i] = NULL;
+	}
+}
+
+/*
+ * ExecParallelHashOpenBatchFile
+ *		open a participant's inner or outer file for a batch, for reading
+ *
+ * Returns NULL if that participant didn't write any tuples to it.
+ */
+BufFile *
+ExecParallelHashOpenBatchFile(HashJoinTable hashtable, bool inner,
+							  int batchno, int participant)
+{
+	char		name[MAXPGPATH];
+
+	ExecParallelHashBatchFileName(name, inner, batchno, participant);
+
+	return BufFileOpenShared(&hashtable->parallel_state->fileset, name);
+}
+
+/*
+ * ExecParallelHashDeleteBatch
+ *		delete all the files for a batch, once it has been processed
+ */
+void
+ExecParallelHashDeleteBatch(HashJoinTable hashtable, int batchno)
+{
+	ParallelHashJoinState *pstate = hashtable->parallel_state;
+	char		name[MAXPGPATH];
+	int			i;
+
+	for (i = 0; i < pstate->nparticipants; i++)
+	{
+		ExecParallelHashBatchFileName(name, true, batchno, i);
+		BufFileDeleteShared(&pstate->fileset, name);
+		ExecParallelHashBatchFileName(name, false, batchno, i);
+		BufFileDeleteShared(&pstate->fileset, name);
+	}
+}
+
+/* ----------------------------------------------------------------
+ *						Parallel Hash Support
+ * ----------------------------------------------------------------
+ */
+
+/*
+ * ExecParallelHashComputeSize
+ *
+ * Decide how big the shared state for a parallel-aware hash join needs to
+ * be, and return its total size.  If pstate isn't NULL, also fill in its
+ * sizing fields.
+ */
+static Size
+ExecParallelHashComputeSize(Hash *node, int nparticipants,
+							ParallelHashJoinState *pstate)
+{
+	Plan	   *outerNode = outerPlan(node);
+	int			nbuckets;
+	int			nbatch;
+	int			batch_nbuckets;
+	int			batch_nbatch;
+	int			num_skew_mcvs;
+	Size		area_size;
+	Size		buckets_offset;
+	Size		area_offset;
+
+	ExecChooseParallelHashTableSize(node->rows_total, outerNode->plan_width,
+									nparticipants,
+									&nbuckets, &nbatch, &area_size);
+	if (nbatch > 1)
+	{
+		/* no shared table, just batches */
+		batch_nbuckets = nbuckets;
+		nbuckets = 0;
+	}
+	else
+	{
+		/* in case we overflow, size the batches' tables for work_mem */
+		ExecChooseHashTableSize(node->rows_total, outerNode->plan_width,
+								false, &batch_nbuckets, &batch_nbatch,
+								&num_skew_mcvs);
+	}
+
+	buckets_offset = MAXALIGN(sizeof(ParallelHashJoinState));
+	area_offset = buckets_offset +
+		MAXALIGN(mul_size(nbuckets, sizeof(pg_atomic_uint32)));
+
+	if (pstate != NULL)
+	{
+		pstate->nparticipants = nparticipants;
+		pstate->nbuckets = nbuckets;
+		pstate->log2_nbuckets = nbuckets > 0 ? my_log2(nbuckets) : 0;
+		pstate->batch_nbuckets = batch_nbuckets;
+		pstate->planned_nbatch = nbatch;
+		pstate->area_size = area_size;
+		pstate->buckets_offset = buckets_offset;
+		pstate->area_offset = area_offset;
+	}
+
+	return add_size(area_offset, area_size);
+}
+
+/*
+ * ExecParallelHashResetState
+ *
+ * Put the shared state back the way it was before anyone started to build
+ * the table.
+ */
+static void
+ExecParallelHashResetState(ParallelHashJoinState *pstate)
+{
+	pg_atomic_uint32 *buckets;
+	int			i;
+
+	pstate->nbatch = pstate->planned_nbatch;
+	pstate->total_tuples = 0;
+	pg_atomic_init_u32(&pstate->space_used, 0);
+	pg_atomic_init_u32(&pstate->next_bucket, 0);
+	pg_atomic_init_u32(&pstate->next_batch, 0);
+	BarrierInit(&pstate->build_barrier, 0);
+
+	buckets = (pg_atomic_uint32 *) ((char *) pstate + pstate->buckets_offset);
+	for (i = 0; i < pstate->nbuckets; i++)
+		pg_atomic_init_u32(&buckets[i], 0);
+}
+
+/* ----------------------------------------------------------------
+ *		ExecHashEstimate
+ *
+ *		estimates the space required for the shared hash table.
+ * ----------------------------------------------------------------
+ */
+void
+ExecHashEstimate(HashState *node, ParallelContext *pcxt)
+{
+	Size		size;
+
+	size = ExecParallelHashComputeSize((Hash *) node->ps.plan,
+									   pcxt->nworkers + 1, NULL);
+	shm_toc_estimate_chunk(&pcxt->estimator, size);
+	shm_toc_estimate_keys(&pcxt->estimator, 1);
+}
+
+/* ----------------------------------------------------------------
+ *		ExecHashInitializeDSM
+ *
+ *		Set up the shared hash table.
+ * ----------------------------------------------------------------
+ */
+void
+ExecHashInitializeDSM(HashState *node, ParallelContext *pcxt)
+{
+	Hash	   *plan = (Hash *) node->ps.plan;
+	ParallelHashJoinState *pstate;
+	Size		size;
+
+	/*
+	 * Without a DSM segment there can be no workers, and nowhere to hang the
+	 * shared file set from; just build a private hash table in that case.
+	 */
+	if (pcxt->seg == NULL)
+		return;
+
+	size = ExecParallelHashComputeSize(plan, pcxt->nworkers + 1, NULL);
+	pstate = shm_toc_allocate(pcxt->toc, size);
+	ExecParallelHashComputeSize(plan, pcxt->nworkers + 1, pstate);
+	pstate->handle = dsm_segment_handle(pcxt->seg);
+	SpinLockInit(&pstate->mutex);
+	SharedFileSetInit(&pstate->fileset, pcxt->seg);
+	ExecParallelHashResetState(pstate);
+
+	shm_toc_insert(pcxt->toc, plan->plan.plan_node_id, pstate);
+	node->parallel_state = pstate;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecHashReInitializeDSM
+ *
+ *		Reset the shared hash table for a rescan.  The workers from the
+ *		previous scan have all exited by now.
+ * ----------------------------------------------------------------
+ */
+void
+ExecHashReInitializeDSM(HashState *node, ParallelContext *pcxt)
+{
+	ParallelHashJoinState *pstate = node->parallel_state;
+
+	if (pstate == NULL)
+		return;
+
+	SharedFileSetDeleteAll(&pstate->fileset);
+	ExecParallelHashResetState(pstate);
+}
+
+/* ----------------------------------------------------------------
+ *		ExecHashInitializeWorker
+ *
+ *		Attach to the shared hash table.
+ * ----------------------------------------------------------------
+ */
+void
+ExecHashInitializeWorker(HashState *node, shm_toc *toc)
+{
+	ParallelHashJoinState *pstate;
+
+	pstate = shm_toc_lookup(toc, node->ps.plan->plan_node_id);
+	SharedFileSetAttach(&pstate->fileset, dsm_find_mapping(pstate->handle));
+	node->parallel_state = pstate;
+}
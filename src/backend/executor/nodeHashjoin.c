@@ -21,6 +21,10 @@
 #include "executor/nodeHash.h"
 #include "executor/nodeHashjoin.h"
 #include "miscadmin.h"
+#include "nodes/nodeFuncs.h"
+#include "optimizer/clauses.h"
+#include "parser/parsetree.h"
+#include "utils/lsyscache.h"
 #include "utils/memutils.h"
 
 
@@ -39,6 +43,9 @@
 /* Returns true if doing null-fill on inner relation */
 #define HJ_FILL_INNER(hjstate)	((hjstate)->hj_NullOuterTupleSlot != NULL)
 
+/* GUC parameter */
+bool		enable_runtime_filter = true;
+
 static TupleTableSlot *ExecHashJoinOuterGetTuple(PlanState *outerNode,
 						  HashJoinState *hjstate,
 						  uint32 *hashvalue);
@@ -47,6 +54,14 @@ static TupleTableSlot *ExecHashJoinGetSavedTuple(HashJoinState *hjstate,
 						  uint32 *hashvalue,
 						  TupleTableSlot *tupleSlot);
 static bool ExecHashJoinNewBatch(HashJoinState *hjstate);
+static bool ExecParallelHashJoinFinishBuild(HashJoinState *hjstate);
+static void ExecParallelHashJoinPartitionOuter(HashJoinState *hjstate);
+static TupleTableSlot *ExecParallelHashJoinOuterGetTuple(HashJoinState *hjstate,
+								  uint32 *hashvalue);
+static bool ExecParallelHashJoinNewBatch(HashJoinState *hjstate);
+static void ExecHashJoinInitRuntimeFilter(HashJoinState *hjstate,
+							  HashJoin *node);
+static Node *runtime_filter_key_mutator(Node *node, List *outer_tlist);
 
 
 /* ----------------------------------------------------------------
@@ -141,8 +156,13 @@ ExecHashJoin(HashJoinState *node)
 				 * The only way to make the check is to try to fetch a tuple
 				 * from the outer plan node.  If we succeed, we have to stash
 				 * it away for later consumption by ExecHashJoinOuterGetTuple.
+				 *
+				 * A parallel-aware join doesn't try this, since each
+				 * participant sees only part of the outer relation anyway.
 				 */
-				if (HJ_FILL_INNER(node))
+				if (hashNode->parallel_state != NULL)
+					node->hj_FirstOuterTupleSlot = NULL;
+				else if (HJ_FILL_INNER(node))
 				{
 					/* no chance to not build the hash table */
 					node->hj_FirstOuterTupleSlot = NULL;
@@ -166,7 +186,7 @@ ExecHashJoin(HashJoinState *node)
 				/*
 				 * create the hash table
 				 */
-				hashtable = ExecHashTableCreate((Hash *) hashNode->ps.plan,
+				hashtable = ExecHashTableCreate(hashNode,
 												node->hj_HashOperators,
 												HJ_FILL_INNER(node));
 				node->hj_HashTable = hashtable;
@@ -177,6 +197,17 @@ ExecHashJoin(HashJoinState *node)
 				hashNode->hashtable = hashtable;
 				(void) MultiExecProcNode((PlanState *) hashNode);
 
+				/*
+				 * A parallel-aware join has more to do before it can start
+				 * returning tuples.
+				 */
+				if (hashtable->parallel_state != NULL)
+				{
+					if (!ExecParallelHashJoinFinishBuild(node))
+						return NULL;
+					continue;
+				}
+
 				/*
 				 * If the inner relation is completely empty, and we're not
 				 * doing a left outer join, we can quit without scanning the
@@ -296,7 +327,14 @@ ExecHashJoin(HashJoinState *node)
 				if (joinqual == NIL || ExecQual(joinqual, econtext, false))
 				{
 					node->hj_MatchedOuter = true;
-					HeapTupleHeaderSetMatch(HJTUPLE_MINTUPLE(node->hj_CurTuple));
+
+					/*
+					 * Only right and full joins care about the match flags,
+					 * and a shared hash table mustn't be written to, so don't
+					 * set the flag otherwise.
+					 */
+					if (HJ_FILL_INNER(node))
+						HeapTupleHeaderSetMatch(HJTUPLE_MINTUPLE(node->hj_CurTuple));
 
 					/* In an antijoin, we never return a matched tuple */
 					if (node->js.jointype == JOIN_ANTI)
@@ -591,9 +629,117 @@ ExecInitHashJoin(HashJoin *node, EState *estate, int eflags)
 	hjstate->hj_MatchedOuter = false;
 	hjstate->hj_OuterNotEmpty = false;
 
+	ExecHashJoinInitRuntimeFilter(hjstate, node);
+
 	return hjstate;
 }
 
+/*
+ * ExecHashJoinInitRuntimeFilter
+ *		Arrange for the Hash node to build a Bloom filter over the inner hash
+ *		values, and for the outer scan to discard rows that fail it
+ *
+ * Only worth it, and only correct, when an outer tuple without a join partner
+ * produces no output, and only possible when the outer plan is a scan that
+ * can evaluate the outer hash keys against its own scan tuple.  Rows the scan
+ * throws away never reach us, so we needn't hash or probe them at all.
+ */
+static void
+ExecHashJoinInitRuntimeFilter(HashJoinState *hjstate, HashJoin *node)
+{
+	PlanState  *outerState = outerPlanState(hjstate);
+	List	   *outer_tlist = outerState->plan->targetlist;
+	HashRuntimeFilter filter;
+	List	   *keys = NIL;
+	int			nkeys;
+	int			i;
+	ListCell   *lc;
+
+	if (!enable_runtime_filter)
+		return;
+
+	if (node->join.jointype != JOIN_INNER &&
+		node->join.jointype != JOIN_SEMI &&
+		node->join.jointype != JOIN_RIGHT)
+		return;
+
+	if (!IsA(outerState, SeqScanState) &&
+		!IsA(outerState, BitmapHeapScanState))
+		return;
+
+	/*
+	 * Rewrite each outer hash key in terms of the scan's own tuple, by
+	 * substituting the scan's targetlist expressions for our OUTER_VAR
+	 * references.  Anything that would behave differently when evaluated
+	 * for every scanned row, rather than once per row reaching the join,
+	 * rules the filter out.
+	 */
+	foreach(lc, node->hashclauses)
+	{
+		OpExpr	   *hclause = (OpExpr *) lfirst(lc);
+		Node	   *key;
+
+		Assert(IsA(hclause, OpExpr));
+		key = runtime_filter_key_mutator((Node *) linitial(hclause->args),
+										 outer_tlist);
+		if (contain_volatile_functions(key) ||
+			contain_subplans(key) ||
+			expression_returns_set(key))
+			return;
+		keys = lappend(keys, key);
+	}
+
+	nkeys = list_length(keys);
+	filter = (HashRuntimeFilter) palloc0(sizeof(HashRuntimeFilterData));
+	filter->hashkeys = (List *) ExecInitExpr((Expr *) keys, outerState);
+	filter->hashfunctions = (FmgrInfo *) palloc(nkeys * sizeof(FmgrInfo));
+	filter->hashStrict = (bool *) palloc(nkeys * sizeof(bool));
+
+	/* look up the outer hash functions just as ExecHashTableCreate does */
+	i = 0;
+	foreach(lc, hjstate->hj_HashOperators)
+	{
+		Oid			hashop = lfirst_oid(lc);
+		Oid			left_hashfn;
+		Oid			right_hashfn;
+
+		if (!get_op_hash_functions(hashop, &left_hashfn, &right_hashfn))
+			elog(ERROR, "could not find hash function for hash operator %u",
+				 hashop);
+		fmgr_info(left_hashfn, &filter->hashfunctions[i]);
+		filter->hashStrict[i] = op_strict(hashop);
+		i++;
+	}
+
+	hjstate->hj_RuntimeFilter = filter;
+	((ScanState *) outerState)->ss_RuntimeFilter = filter;
+	((HashState *) innerPlanState(hjstate))->runtimefilter = filter;
+}
+
+/*
+ * runtime_filter_key_mutator
+ *		Replace OUTER_VAR Vars with the outer scan's matching tlist entries
+ */
+static Node *
+runtime_filter_key_mutator(Node *node, List *outer_tlist)
+{
+	if (node == NULL)
+		return NULL;
+	if (IsA(node, Var) && ((Var *) node)->varno == OUTER_VAR)
+	{
+		Var		   *var = (Var *) node;
+		TargetEntry *tle;
+
+		tle = get_tle_by_resno(outer_tlist, var->varattno);
+		if (tle == NULL)
+			elog(ERROR, "hash key references nonexistent outer column %d",
+				 var->varattno);
+		return (Node *) copyObject(tle->expr);
+	}
+	return expression_tree_mutator(node, runtime_filter_key_mutator,
+								   (void *) outer_tlist);
+}
+
 /* ----------------------------------------------------------------
  *		ExecEndHashJoin
  *
@@ -652,6 +798,10 @@ ExecHashJoinOuterGetTuple(PlanState *outerNode,
 	int			curbatch = hashtable->curbatch;
 	TupleTableSlot *slot;
 
+	/* parallel-aware joins read their batches differently */
+	if (hashtable->shared_curbatch >= 0)
+		return ExecParallelHashJoinOuterGetTuple(hjstate, hashvalue);
+
 	if (curbatch == 0)			/* if it is the first pass */
 	{
 		/*
@@ -730,6 +880,9 @@ ExecHashJoinNewBatch(HashJoinState *hjstate)
 	TupleTableSlot *slot;
 	uint32		hashvalue;
 
+	if (hashtable->parallel_state != NULL)
+		return ExecParallelHashJoinNewBatch(hjstate);
+
 	nbatch = hashtable->nbatch;
 	curbatch = hashtable->curbatch;
 
@@ -952,7 +1105,12 @@ ExecReScanHashJoin(HashJoinState *node)
 	 */
 	if (node->hj_HashTable != NULL)
 	{
+		/*
+		 * A parallel-aware join's shared hash table is rebuilt from scratch
+		 * by the new set of participants, so we can't keep ours.
+		 */
 		if (node->hj_HashTable->nbatch == 1 &&
+			node->hj_HashTable->parallel_state == NULL &&
 			node->js.ps.righttree->chgParam == NULL)
 		{
 			/*
@@ -983,6 +1141,8 @@ ExecReScanHashJoin(HashJoinState *node)
 			/* must destroy and rebuild hash table */
 			ExecHashTableDestroy(node->hj_HashTable);
 			node->hj_HashTable = NULL;
+			if (node->hj_RuntimeFilter != NULL)
+				ExecHashResetRuntimeFilter(node->hj_RuntimeFilter);
 			node->hj_JoinState = HJ_BUILD_HASHTABLE;
 
 			/*
@@ -1011,3 +1171,198 @@ ExecReScanHashJoin(HashJoinState *node)
 	if (node->js.ps.lefttree->chgParam == NULL)
 		ExecReScan(node->js.ps.lefttree);
 }
+
+/* ----------------------------------------------------------------
+ *						Parallel Hash Join Support
+ * ----------------------------------------------------------------
+ */
+
+/*
+ * ExecParallelHashJoinFinishBuild
+ *		finish building a parallel-aware hash join, once our Hash node has
+ *		done its part, and set the next state of the join
+ *
+ * If the shared hash table held the whole inner relation, we can start
+ * probing it right away.  Otherwise everyone partitions their share of the
+ * outer relation into batch files, and then we go on to take batches.
+ * Either way we detach from the build barrier, since nobody will need to
+ * wait for us again.  Returns false if the join can't produce any tuples.
+ */
+static bool
+ExecParallelHashJoinFinishBuild(HashJoinState *hjstate)
+{
+	HashJoinTable hashtable = hjstate->hj_HashTable;
+	Barrier    *build_barrier = &hashtable->parallel_state->build_barrier;
+
+	/*
+	 * If the inner relation is completely empty, and we're not doing a left
+	 * outer join, we can quit without scanning the outer relation.  Every
+	 * participant comes to the same conclusion.
+	 */
+	if (hashtable->totalTuples == 0 && !HJ_FILL_OUTER(hjstate))
+	{
+		BarrierDetach(build_barrier);
+		return false;
+	}
+
+	if (hashtable->shared_nbatch > 1)
+	{
+		if (BarrierPhase(build_barrier) == PHJ_BUILD_HASHING_OUTER)
+		{
+			ExecParallelHashJoinPartitionOuter(hjstate);
+			BarrierArriveAndWait(build_barrier);
+		}
+		Assert(BarrierPhase(build_barrier) == PHJ_BUILD_RUNNING);
+		hjstate->hj_JoinState = HJ_NEED_NEW_BATCH;
+	}
+	else
+		hjstate->hj_JoinState = HJ_NEED_NEW_OUTER;
+
+	BarrierDetach(build_barrier);
+
+	return true;
+}
+
+/*
+ * ExecParallelHashJoinPartitionOuter
+ *		write our share of the outer relation out to batch files
+ */
+static void
+ExecParallelHashJoinPartitionOuter(HashJoinState *hjstate)
+{
+	PlanState  *outerNode = outerPlanState(hjstate);
+	HashJoinTable hashtable = hjstate->hj_HashTable;
+	ExprContext *econtext = hjstate->js.ps.ps_ExprContext;
+	TupleTableSlot *slot;
+	uint32		hashvalue;
+
+	for (;;)
+	{
+		slot = ExecProcNode(outerNode);
+		if (TupIsNull(slot))
+			break;
+		econtext->ecxt_outertuple = slot;
+		if (ExecHashGetHashValue(hashtable, econtext,
+								 hjstate->hj_OuterHashKeys,
+								 true,	/* outer tuple */
+								 HJ_FILL_OUTER(hjstate),
+								 &hashvalue))
+		{
+			int			batchno;
+
+			batchno = ExecParallelHashGetBatch(hashtable, hashvalue);
+			ExecHashJoinSaveTuple(ExecFetchSlotMinimalTuple(slot), hashvalue,
+						ExecParallelHashGetBatchFile(hashtable, false, batchno));
+		}
+	}
+
+	/* Make the files available to the participants that will read them */
+	ExecParallelHashCloseBatchFiles(hashtable);
+}
+
+/*
+ * ExecParallelHashJoinOuterGetTuple
+ *		get the next outer tuple of the current batch
+ *
+ * The batch's outer tuples are spread over one file per participant, which
+ * we read in turn.
+ */
+static TupleTableSlot *
+ExecParallelHashJoinOuterGetTuple(HashJoinState *hjstate, uint32 *hashvalue)
+{
+	HashJoinTable hashtable = hjstate->hj_HashTable;
+	TupleTableSlot *slot;
+
+	while (hashtable->read_participant <
+		   hashtable->parallel_state->nparticipants)
+	{
+		if (hashtable->read_file == NULL)
+			hashtable->read_file =
+				ExecParallelHashOpenBatchFile(hashtable, false,
+											  hashtable->shared_curbatch,
+											  hashtable->read_participant);
+		if (hashtable->read_file != NULL)
+		{
+			slot = ExecHashJoinGetSavedTuple(hjstate,
+											 hashtable->read_file,
+											 hashvalue,
+											 hjstate->hj_OuterTupleSlot);
+			if (!TupIsNull(slot))
+				return slot;
+			BufFileClose(hashtable->read_file);
+			hashtable->read_file = NULL;
+		}
+		hashtable->read_participant++;
+	}
+
+	/* End of this batch */
+	return NULL;
+}
+
+/*
+ * ExecParallelHashJoinNewBatch
+ *		take the next unclaimed batch of a parallel-aware hash join, and
+ *		load its inner tuples into our private hash table
+ *
+ * Each batch is processed entirely by the participant that claims it.
+ * Returns false if there are no batches left.
+ */
+static bool
+ExecParallelHashJoinNewBatch(HashJoinState *hjstate)
+{
+	HashJoinTable hashtable = hjstate->hj_HashTable;
+	ParallelHashJoinState *pstate = hashtable->parallel_state;
+	TupleTableSlot *slot;
+	uint32		hashvalue;
+	int			batchno;
+	int			i;
+
+	/* The shared hash table is only probed once */
+	if (hashtable->shared_nbatch == 1)
+		return false;
+
+	/* Nobody else will need the previous batch's files */
+	if (hashtable->shared_curbatch >= 0)
+	{
+		ExecParallelHashDeleteBatch(hashtable, hashtable->shared_curbatch);
+		hashtable->shared_curbatch = -1;
+	}
+
+	batchno = (int) pg_atomic_fetch_add_u32(&pstate->next_batch, 1);
+	if (batchno >= hashtable->shared_nbatch)
+		return false;			/* no more batches */
+
+	hashtable->shared_curbatch = batchno;
+	hashtable->read_participant = 0;
+
+	/*
+	 * Load the batch's inner tuples from all participants' files.  Since our
+	 * private table has only one batch, they all go into it.
+	 */
+	ExecHashTableReset(hashtable);
+	hashtable->totalTuples = 0;
+	for (i = 0; i < pstate->nparticipants; i++)
+	{
+		BufFile    *innerFile;
+
+		innerFile = ExecParallelHashOpenBatchFile(hashtable, true, batchno, i);
+		if (innerFile == NULL)
+			continue;
+
+		while ((slot = ExecHashJoinGetSavedTuple(hjstate,
+												 innerFile,
+												 &hashvalue,
+												 hjstate->hj_HashTupleSlot)))
+		{
+			ExecHashTableInsert(hashtable, slot, hashvalue);
+			hashtable->totalTuples += 1;
+		}
+
+		BufFileClose(innerFile);
+	}
+
+	/* resize the hash table if needed (NTUP_PER_BUCKET exceeded) */
+	ExecHashIncreaseNumBuckets(hashtable);
+
+	return true;
+}
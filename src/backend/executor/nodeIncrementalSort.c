@@ -0,0 +1,419 @@
+/*-------------------------------------------------------------------------
+ *
+ * nodeIncrementalSort.c
+ *	  Routines to handle incremental sorting of relations.
+ *
+ * Portions Copyright (c) 1996-2016, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  src/backend/executor/nodeIncrementalSort.c
+ *
+ * DESCRIPTION
+ *
+ *	Incremental sort is a specially optimized kind of multikey sort, used
+ *	when the input is already sorted by a prefix of the required keys.
+ *	For example, if the input is sorted by (a, b) and we want (a, b, c, d),
+ *	only runs of tuples with equal a and b need sorting, so we can read
+ *	one such run, sort it, emit it, and go on to the next.  That means
+ *	sorting many small sets instead of one large one, which is cheaper and
+ *	far less likely to spill to disk, and the first tuples come out long
+ *	before the input is exhausted, which is what a LIMIT wants.
+ *
+ *	Runs of a single tuple, or a handful, would make the per-sort overhead
+ *	dominate, so we don't stop at every change of the presorted keys.
+ *	Instead each batch collects at least INCREMENTAL_SORT_MIN_BATCH_SIZE
+ *	tuples and then carries on to the end of the current run.  Since every
+ *	batch is sorted on all of the sort keys, it doesn't matter that a batch
+ *	may contain several runs, so long as it never splits one.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "postgres.h"
+
+#include "executor/execdebug.h"
+#include "executor/nodeIncrementalSort.h"
+#include "miscadmin.h"
+#include "utils/tuplesort.h"
+
+static void preparePresortedKeys(IncrementalSortState *node);
+static bool isCurrentGroup(IncrementalSortState *node,
+			   TupleTableSlot *pivot, TupleTableSlot *tuple);
+static void finishBatch(IncrementalSortState *node);
+
+
+/*
+ * Set up the comparators for the presorted columns.
+ *
+ * We use the sort operators' comparison functions rather than looking up
+ * equality operators, so that "equal" means exactly what the sort thinks.
+ */
+static void
+preparePresortedKeys(IncrementalSortState *node)
+{
+	IncrementalSort *plannode = (IncrementalSort *) node->ss.ps.plan;
+	int			presortedCols = plannode->presortedCols;
+	int			i;
+
+	node->presortedKeys = (SortSupport)
+		palloc0(presortedCols * sizeof(SortSupportData));
+
+	for (i = 0; i < presortedCols; i++)
+	{
+		SortSupport sortKey = node->presortedKeys + i;
+
+		sortKey->ssup_cxt = CurrentMemoryContext;
+		sortKey->ssup_collation = plannode->sort.collations[i];
+		sortKey->ssup_nulls_first = plannode->sort.nullsFirst[i];
+		sortKey->ssup_attno = plannode->sort.sortColIdx[i];
+		sortKey->abbreviate = false;
+
+		PrepareSortSupportFromOrderingOp(plannode->sort.sortOperators[i],
+										 sortKey);
+	}
+}
+
+/*
+ * Check whether a given tuple belongs to the same run of presorted keys as
+ * the pivot tuple.
+ */
+static bool
+isCurrentGroup(IncrementalSortState *node,
+			   TupleTableSlot *pivot, TupleTableSlot *tuple)
+{
+	int			presortedCols;
+	int			i;
+
+	presortedCols = ((IncrementalSort *) node->ss.ps.plan)->presortedCols;
+
+	/*
+	 * The last presorted column is the one most likely to differ, since the
+	 * input is sorted on the earlier ones, so compare in reverse order.
+	 */
+	for (i = presortedCols - 1; i >= 0; i--)
+	{
+		SortSupport sortKey = node->presortedKeys + i;
+		Datum		datumA,
+					datumB;
+		bool		isnullA,
+					isnullB;
+
+		datumA = slot_getattr(pivot, sortKey->ssup_attno, &isnullA);
+		datumB = slot_getattr(tuple, sortKey->ssup_attno, &isnullB);
+
+		if (ApplySortComparator(datumA, isnullA,
+								datumB, isnullB,
+								sortKey) != 0)
+			return false;
+	}
+	return true;
+}
+
+/*
+ * Release the tuplesort for a batch we have finished returning.
+ */
+static void
+finishBatch(IncrementalSortState *node)
+{
+	if (node->tuplesortstate != NULL)
+	{
+		tuplesort_end((Tuplesortstate *) node->tuplesortstate);
+		node->tuplesortstate = NULL;
+	}
+}
+
+/* ----------------------------------------------------------------
+ *		ExecIncrementalSort
+ *
+ *		Returns the next tuple of the current sorted batch.  When the
+ *		batch runs out, reads the next batch from the outer plan and
+ *		sorts that.
+ *
+ *		Conditions:
+ *		  -- none.
+ *
+ *		Initial States:
+ *		  -- the outer child is prepared to return the first tuple.
+ * ----------------------------------------------------------------
+ */
+TupleTableSlot *
+ExecIncrementalSort(IncrementalSortState *node)
+{
+	IncrementalSort *plannode = (IncrementalSort *) node->ss.ps.plan;
+	EState	   *estate = node->ss.ps.state;
+	ScanDirection dir;
+	Tuplesortstate *tuplesortstate;
+	PlanState  *outerNode;
+	TupleTableSlot *slot;
+	int64		nTuples;
+
+	/* We only support forward scans; see ExecSupportsBackwardScan */
+	Assert(ScanDirectionIsForward(estate->es_direction));
+
+	/*
+	 * If we're in the middle of a batch, return its next tuple.
+	 */
+	if (node->tuplesortstate != NULL)
+	{
+		slot = node->ss.ps.ps_ResultTupleSlot;
+		(void) tuplesort_gettupleslot((Tuplesortstate *) node->tuplesortstate,
+									  true, slot, NULL);
+		if (!TupIsNull(slot))
+		{
+			node->bound_Done++;
+			return slot;
+		}
+		finishBatch(node);
+	}
+
+	/*
+	 * Nothing left if the outer plan is exhausted and no tuple was carried
+	 * over from the last batch, or if we've returned all the tuples a
+	 * bounded sort was asked for.
+	 */
+	if ((node->outerNodeDone && TupIsNull(node->group_pivot)) ||
+		(node->bounded && node->bound_Done >= node->bound))
+		return ExecClearTuple(node->ss.ps.ps_ResultTupleSlot);
+
+	SO1_printf("ExecIncrementalSort: %s\n",
+			   "sorting next batch");
+
+	/*
+	 * Want to scan subplan in the forward direction while creating the
+	 * sorted data.
+	 */
+	dir = estate->es_direction;
+	estate->es_direction = ForwardScanDirection;
+
+	outerNode = outerPlanState(node);
+	tuplesortstate = tuplesort_begin_heap(ExecGetResultType(outerNode),
+										  plannode->sort.numCols,
+										  plannode->sort.sortColIdx,
+										  plannode->sort.sortOperators,
+										  plannode->sort.collations,
+										  plannode->sort.nullsFirst,
+										  work_mem,
+										  false);
+	if (node->bounded)
+		tuplesort_set_bound(tuplesortstate,
+							node->bound - node->bound_Done);
+	node->tuplesortstate = (void *) tuplesortstate;
+
+	/* Start with the tuple that ended the last batch, if any. */
+	nTuples = 0;
+	if (!TupIsNull(node->group_pivot))
+	{
+		tuplesort_puttupleslot(tuplesortstate, node->group_pivot);
+		ExecClearTuple(node->group_pivot);
+		nTuples++;
+	}
+
+	/*
+	 * Read tuples until we have at least INCREMENTAL_SORT_MIN_BATCH_SIZE of
+	 * them and have come to the end of the run the last of those belongs to.
+	 * The tuple that starts the next run is kept in group_pivot for the next
+	 * batch.
+	 */
+	for (;;)
+	{
+		slot = ExecProcNode(outerNode);
+
+		if (TupIsNull(slot))
+		{
+			node->outerNodeDone = true;
+			ExecClearTuple(node->group_pivot);
+			break;
+		}
+
+		if (nTuples < INCREMENTAL_SORT_MIN_BATCH_SIZE)
+		{
+			tuplesort_puttupleslot(tuplesortstate, slot);
+			nTuples++;
+
+			/* Remember the last tuple of the minimal batch. */
+			if (nTuples == INCREMENTAL_SORT_MIN_BATCH_SIZE)
+				ExecCopySlot(node->group_pivot, slot);
+		}
+		else if (isCurrentGroup(node, node->group_pivot, slot))
+		{
+			tuplesort_puttupleslot(tuplesortstate, slot);
+			nTuples++;
+		}
+		else
+		{
+			ExecCopySlot(node->group_pivot, slot);
+			break;
+		}
+	}
+
+	tuplesort_performsort(tuplesortstate);
+
+	/* Keep track of the largest batch for EXPLAIN ANALYZE. */
+	if (node->ss.ps.instrument != NULL)
+	{
+		const char *sortMethod;
+		const char *spaceType;
+		long		spaceUsed;
+
+		tuplesort_get_stats(tuplesortstate, &sortMethod, &spaceType,
+							&spaceUsed);
+		if (node->sortMethod == NULL || spaceUsed > node->maxSpace)
+		{
+			node->sortMethod = sortMethod;
+			node->spaceType = spaceType;
+			node->maxSpace = spaceUsed;
+		}
+	}
+	node->nbatches++;
+
+	estate->es_direction = dir;
+
+	SO1_printf("ExecIncrementalSort: %s\n", "sorting done");
+
+	slot = node->ss.ps.ps_ResultTupleSlot;
+	(void) tuplesort_gettupleslot(tuplesortstate, true, slot, NULL);
+	if (!TupIsNull(slot))
+		node->bound_Done++;
+	return slot;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecInitIncrementalSort
+ *
+ *		Creates the run-time state information for the incremental sort
+ *		node produced by the planner and initializes its outer subtree.
+ * ----------------------------------------------------------------
+ */
+IncrementalSortState *
+ExecInitIncrementalSort(IncrementalSort *node, EState *estate, int eflags)
+{
+	IncrementalSortState *incrsortstate;
+
+	SO1_printf("ExecInitIncrementalSort: %s\n",
+			   "initializing incremental sort node");
+
+	/*
+	 * Incremental sort can't be used with either EXEC_FLAG_BACKWARD or
+	 * EXEC_FLAG_MARK, because we keep only the current batch in memory.
+	 */
+	Assert((eflags & (EXEC_FLAG_BACKWARD | EXEC_FLAG_MARK)) == 0);
+
+	/*
+	 * create state structure
+	 */
+	incrsortstate = makeNode(IncrementalSortState);
+	incrsortstate->ss.ps.plan = (Plan *) node;
+	incrsortstate->ss.ps.state = estate;
+
+	incrsortstate->bounded = false;
+	incrsortstate->bound_Done = 0;
+	incrsortstate->outerNodeDone = false;
+	incrsortstate->tuplesortstate = NULL;
+	incrsortstate->nbatches = 0;
+	incrsortstate->sortMethod = NULL;
+	incrsortstate->spaceType = NULL;
+	incrsortstate->maxSpace = 0;
+
+	/*
+	 * Miscellaneous initialization
+	 *
+	 * Sort nodes don't initialize their ExprContexts because they never call
+	 * ExecQual or ExecProject.
+	 */
+
+	/*
+	 * tuple table initialization
+	 *
+	 * sort nodes only return scan tuples from their sorted relation.
+	 */
+	ExecInitResultTupleSlot(estate, &incrsortstate->ss.ps);
+	ExecInitScanTupleSlot(estate, &incrsortstate->ss);
+
+	/*
+	 * initialize child nodes
+	 *
+	 * We shield the child node from the need to support REWIND, BACKWARD, or
+	 * MARK/RESTORE.
+	 */
+	eflags &= ~(EXEC_FLAG_REWIND | EXEC_FLAG_BACKWARD | EXEC_FLAG_MARK);
+
+	outerPlanState(incrsortstate) = ExecInitNode(outerPlan(node), estate,
+												 eflags);
+
+	/*
+	 * initialize tuple type.  no need to initialize projection info because
+	 * this node doesn't do projections.
+	 */
+	ExecAssignResultTypeFromTL(&incrsortstate->ss.ps);
+	ExecAssignScanTypeFromOuterPlan(&incrsortstate->ss);
+	incrsortstate->ss.ps.ps_ProjInfo = NULL;
+
+	/* slot to hold the pivot tuple between calls */
+	incrsortstate->group_pivot = ExecInitExtraTupleSlot(estate);
+	ExecSetSlotDescriptor(incrsortstate->group_pivot,
+						  ExecGetResultType(outerPlanState(incrsortstate)));
+
+	preparePresortedKeys(incrsortstate);
+
+	SO1_printf("ExecInitIncrementalSort: %s\n",
+			   "incremental sort node initialized");
+
+	return incrsortstate;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecEndIncrementalSort(node)
+ * ----------------------------------------------------------------
+ */
+void
+ExecEndIncrementalSort(IncrementalSortState *node)
+{
+	SO1_printf("ExecEndIncrementalSort: %s\n",
+			   "shutting down incremental sort node");
+
+	/*
+	 * clean out the tuple table
+	 */
+	ExecClearTuple(node->ss.ss_ScanTupleSlot);
+	/* must drop pointer to sort result tuple */
+	ExecClearTuple(node->ss.ps.ps_ResultTupleSlot);
+	ExecClearTuple(node->group_pivot);
+
+	/*
+	 * Release tuplesort resources
+	 */
+	finishBatch(node);
+
+	/*
+	 * shut down the subplan
+	 */
+	ExecEndNode(outerPlanState(node));
+
+	SO1_printf("ExecEndIncrementalSort: %s\n",
+			   "incremental sort node shutdown");
+}
+
+void
+ExecReScanIncrementalSort(IncrementalSortState *node)
+{
+	PlanState  *outerPlan = outerPlanState(node);
+
+	/*
+	 * We keep only the current batch, so there's nothing to rewind; always
+	 * start again from the beginning of the input.
+	 */
+	ExecClearTuple(node->ss.ps.ps_ResultTupleSlot);
+	ExecClearTuple(node->group_pivot);
+	finishBatch(node);
+	node->outerNodeDone = false;
+	node->bound_Done = 0;
+
+	/*
+	 * if chgParam of subnode is not null then plan will be re-scanned by
+	 * first ExecProcNode.
+	 */
+	if (outerPlan->chgParam == NULL)
+		ExecReScan(outerPlan);
+}
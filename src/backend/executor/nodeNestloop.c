@@ -23,7 +23,81 @@
 
 #include "executor/execdebug.h"
 #include "executor/nodeNestloop.h"
+#include "miscadmin.h"
+#include "nodes/nodeFuncs.h"
 #include "utils/memutils.h"
+#include "utils/sortsupport.h"
+#include "utils/typcache.h"
+
+
+/*
+ * Batched probing
+ *
+ * When the inner side is an index scan parameterized by the outer row, each
+ * outer row costs a descent of the index and, most likely, random heap
+ * fetches.  Instead, we can collect a batch of outer rows, sort them on the
+ * parameter values, and probe the index in that order: successive probes
+ * then tend to land on the same or neighbouring index leaf pages, which the
+ * btree code can start from directly, and on heap pages that are already in
+ * the buffer cache.  The join rows each probe produces are kept with the
+ * outer row they belong to and returned in the original outer order, so the
+ * output is just what the ordinary nested loop would produce.
+ *
+ * The join rows kept for a batch may take at most work_mem.  If a probe
+ * would go over that, we throw away what it produced and stop probing ahead:
+ * that outer row and any others not yet probed are joined only when their
+ * turn comes to be returned, streaming their rows like the ordinary nested
+ * loop does.  A batch of one outer row is always handled that way.
+ *
+ * Batches start small and double in size up to NL_BATCH_MAX_SIZE, so that a
+ * query that only wants the first few rows doesn't pay for a big batch.  If
+ * the planner expects only the first few rows to be fetched at all, they
+ * start at a single row.  A batch that ran out of work_mem makes the next
+ * one smaller again.
+ */
+#define NL_BATCH_INITIAL_SIZE	16
+#define NL_BATCH_MAX_SIZE		1024
+
+/* GUC parameter */
+bool		enable_nestloop_batching = true;
+
+typedef struct NestLoopBatchEntry
+{
+	MinimalTuple outer;			/* copy of the outer row */
+	bool		probed;			/* has it been joined ahead of time? */
+	List	   *results;		/* if so, its join rows, as MinimalTuples */
+} NestLoopBatchEntry;
+
+typedef struct NestLoopBatchData
+{
+	int			nkeys;			/* number of nestParams */
+	SortSupport sortkeys;		/* how to sort on each of them */
+	int			maxsize;		/* allocated length of the arrays below */
+	int			initsize;		/* size of the first batch */
+	int			size;			/* outer rows to collect next time */
+	int			nentries;		/* outer rows in the current batch */
+	NestLoopBatchEntry *entries;	/* the batch, in outer order */
+	Datum	   *keys;			/* nentries * nkeys parameter values */
+	bool	   *nulls;
+	int		   *order;			/* entry indexes in probe order */
+	int			nextentry;		/* next entry to return results of */
+	ListCell   *nextresult;		/* next result to return, if any */
+	bool		outerdone;		/* outer plan is exhausted */
+	bool		probing;		/* inner scan is open for outerslot's row */
+	bool		matched;		/* ... and has found a match for it */
+	TupleTableSlot *outerslot;	/* holds the outer row being probed for */
+	MemoryContext context;		/* holds rows of the current batch */
+	Size		space;			/* memory used by them */
+	bool		overflowed;		/* did they reach work_mem? */
+} NestLoopBatchData;
+
+static TupleTableSlot *ExecNestLoopBatched(NestLoopState *node);
+static bool ExecNestLoopFillBatch(NestLoopState *node);
+static bool ExecNestLoopProbeAhead(NestLoopState *node, int n);
+static void ExecNestLoopStartProbe(NestLoopState *node, int n);
+static TupleTableSlot *ExecNestLoopProbeNext(NestLoopState *node);
+static int	batch_entry_cmp(const void *a, const void *b, void *arg);
+static void ExecNestLoopInitBatch(NestLoopState *nlstate, NestLoop *node);
 
 
 /* ----------------------------------------------------------------
@@ -81,6 +155,9 @@ ExecNestLoop(NestLoopState *node)
 	innerPlan = innerPlanState(node);
 	econtext = node->js.ps.ps_ExprContext;
 
+	if (node->nl_Batch != NULL)
+		return ExecNestLoopBatched(node);
+
 	/*
 	 * Check to see if we're still projecting out tuples from a previous join
 	 * tuple (because there is a function-returning-set in the projection
@@ -288,6 +365,363 @@ ExecNestLoop(NestLoopState *node)
 	}
 }
 
+/* ----------------------------------------------------------------
+ *		ExecNestLoopBatched
+ *
+ *		ExecNestLoop for a join that probes its inner side in batches
+ * ----------------------------------------------------------------
+ */
+static TupleTableSlot *
+ExecNestLoopBatched(NestLoopState *node)
+{
+	NestLoopBatchData *batch = node->nl_Batch;
+
+	for (;;)
+	{
+		/* stream the join rows of an outer row that wasn't probed ahead */
+		if (batch->probing)
+		{
+			TupleTableSlot *result = ExecNestLoopProbeNext(node);
+
+			if (!TupIsNull(result))
+				return result;
+			continue;
+		}
+
+		/* return the next saved join row, if any remain */
+		if (batch->nextresult != NULL)
+		{
+			MinimalTuple tuple = (MinimalTuple) lfirst(batch->nextresult);
+
+			batch->nextresult = lnext(batch->nextresult);
+			return ExecStoreMinimalTuple(tuple,
+										 node->js.ps.ps_ResultTupleSlot,
+										 false);
+		}
+
+		/* move on to the next outer row of the batch */
+		if (batch->nextentry < batch->nentries)
+		{
+			int			n = batch->nextentry++;
+
+			if (batch->entries[n].probed)
+				batch->nextresult = list_head(batch->entries[n].results);
+			else
+				ExecNestLoopStartProbe(node, n);
+			continue;
+		}
+
+		/* otherwise, on to the next batch */
+		if (!ExecNestLoopFillBatch(node))
+			return NULL;
+	}
+}
+
+/*
+ * ExecNestLoopFillBatch
+ *		Read the next batch of outer rows and join as many of them as fit
+ *
+ * Returns false if the outer plan had no rows left.
+ */
+static bool
+ExecNestLoopFillBatch(NestLoopState *node)
+{
+	NestLoopBatchData *batch = node->nl_Batch;
+	NestLoop   *nl = (NestLoop *) node->js.ps.plan;
+	PlanState  *outerPlan = outerPlanState(node);
+	MemoryContext oldcontext;
+	int			i;
+
+	ExecClearTuple(batch->outerslot);
+	MemoryContextReset(batch->context);
+	batch->space = 0;
+	batch->overflowed = false;
+	batch->nentries = 0;
+	batch->nextentry = 0;
+	batch->nextresult = NULL;
+
+	while (!batch->outerdone && batch->nentries < batch->size)
+	{
+		TupleTableSlot *outerTupleSlot;
+		NestLoopBatchEntry *entry;
+		Datum	   *keys;
+		bool	   *nulls;
+		ListCell   *lc;
+
+		outerTupleSlot = ExecProcNode(outerPlan);
+		if (TupIsNull(outerTupleSlot))
+		{
+			batch->outerdone = true;
+			break;
+		}
+
+		entry = &batch->entries[batch->nentries];
+		oldcontext = MemoryContextSwitchTo(batch->context);
+		entry->outer = ExecCopySlotMinimalTuple(outerTupleSlot);
+		entry->probed = false;
+		entry->results = NIL;
+		MemoryContextSwitchTo(oldcontext);
+		batch->space += GetMemoryChunkSpace(entry->outer);
+
+		/*
+		 * Fetch the parameter values from our copy, so that any pass-by-ref
+		 * ones stay valid until the batch is done.
+		 */
+		ExecStoreMinimalTuple(entry->outer, batch->outerslot, false);
+		keys = &batch->keys[batch->nentries * batch->nkeys];
+		nulls = &batch->nulls[batch->nentries * batch->nkeys];
+		i = 0;
+		foreach(lc, nl->nestParams)
+		{
+			NestLoopParam *nlp = (NestLoopParam *) lfirst(lc);
+
+			/* Param value should be an OUTER_VAR var */
+			Assert(IsA(nlp->paramval, Var));
+			Assert(nlp->paramval->varno == OUTER_VAR);
+			Assert(nlp->paramval->varattno > 0);
+			keys[i] = slot_getattr(batch->outerslot,
+								   nlp->paramval->varattno,
+								   &nulls[i]);
+			i++;
+		}
+
+		batch->order[batch->nentries] = batch->nentries;
+		batch->nentries++;
+	}
+
+	if (batch->nentries == 0)
+		return false;
+
+	/*
+	 * Probe the inner side in parameter order, until the saved rows fill
+	 * work_mem.  A lone outer row gains nothing from being probed ahead.
+	 */
+	if (batch->nentries > 1)
+	{
+		qsort_arg(batch->order, batch->nentries, sizeof(int),
+				  batch_entry_cmp, batch);
+
+		for (i = 0; i < batch->nentries; i++)
+		{
+			CHECK_FOR_INTERRUPTS();
+
+			if (!ExecNestLoopProbeAhead(node, batch->order[i]))
+				break;
+		}
+	}
+
+	/* size the next batch */
+	if (batch->overflowed)
+		batch->size = Max(batch->size / 2, 1);
+	else if (batch->size < batch->maxsize)
+		batch->size = Min(batch->size * 2, batch->maxsize);
+
+	return true;
+}
+
+/*
+ * ExecNestLoopProbeAhead
+ *		Join outer row n of the batch, saving the join rows with it
+ *
+ * Returns false, having saved nothing, if the rows would take the batch
+ * over work_mem.
+ */
+static bool
+ExecNestLoopProbeAhead(NestLoopState *node, int n)
+{
+	NestLoopBatchData *batch = node->nl_Batch;
+	NestLoopBatchEntry *entry = &batch->entries[n];
+	Size		oldspace = batch->space;
+	TupleTableSlot *result;
+	MemoryContext oldcontext;
+
+	ExecNestLoopStartProbe(node, n);
+	for (;;)
+	{
+		MinimalTuple tuple;
+
+		result = ExecNestLoopProbeNext(node);
+		if (TupIsNull(result))
+			break;
+
+		oldcontext = MemoryContextSwitchTo(batch->context);
+		tuple = ExecCopySlotMinimalTuple(result);
+		entry->results = lappend(entry->results, tuple);
+		MemoryContextSwitchTo(oldcontext);
+		batch->space += GetMemoryChunkSpace(tuple);
+
+		if (batch->space > work_mem * 1024L)
+		{
+			/* leave this row to be joined when its turn comes */
+			batch->probing = false;
+			list_free_deep(entry->results);
+			entry->results = NIL;
+			batch->space = oldspace;
+			batch->overflowed = true;
+			return false;
+		}
+	}
+
+	entry->probed = true;
+	return true;
+}
+
+/*
+ * ExecNestLoopStartProbe
+ *		Start joining outer row n of the batch
+ *
+ * ExecNestLoopProbeNext then returns its join rows.
+ */
+static void
+ExecNestLoopStartProbe(NestLoopState *node, int n)
+{
+	NestLoopBatchData *batch = node->nl_Batch;
+	NestLoop   *nl = (NestLoop *) node->js.ps.plan;
+	PlanState  *innerPlan = innerPlanState(node);
+	ExprContext *econtext = node->js.ps.ps_ExprContext;
+	Datum	   *keys = &batch->keys[n * batch->nkeys];
+	bool	   *nulls = &batch->nulls[n * batch->nkeys];
+	ListCell   *lc;
+	int			i;
+
+	ExecStoreMinimalTuple(batch->entries[n].outer, batch->outerslot, false);
+	econtext->ecxt_outertuple = batch->outerslot;
+
+	i = 0;
+	foreach(lc, nl->nestParams)
+	{
+		NestLoopParam *nlp = (NestLoopParam *) lfirst(lc);
+		int			paramno = nlp->paramno;
+		ParamExecData *prm;
+
+		prm = &(econtext->ecxt_param_exec_vals[paramno]);
+		prm->value = keys[i];
+		prm->isnull = nulls[i];
+		/* Flag parameter value as changed */
+		innerPlan->chgParam = bms_add_member(innerPlan->chgParam,
+											 paramno);
+		i++;
+	}
+	ExecReScan(innerPlan);
+
+	batch->probing = true;
+	batch->matched = false;
+}
+
+/*
+ * ExecNestLoopProbeNext
+ *		Return the next join row for the outer row being probed
+ *
+ * This does for one outer row what ExecNestLoop does, including the
+ * null-extended row of a left join or antijoin.  Returns NULL, and ends the
+ * probe, once there are no more.
+ */
+static TupleTableSlot *
+ExecNestLoopProbeNext(NestLoopState *node)
+{
+	NestLoopBatchData *batch = node->nl_Batch;
+	PlanState  *innerPlan = innerPlanState(node);
+	List	   *joinqual = node->js.joinqual;
+	List	   *otherqual = node->js.ps.qual;
+	ExprContext *econtext = node->js.ps.ps_ExprContext;
+	ExprDoneCond isDone;
+	TupleTableSlot *result;
+
+	/* a semijoin ends the probe as soon as it returns its match */
+	if (!batch->probing)
+		return NULL;
+
+	ResetExprContext(econtext);
+
+	for (;;)
+	{
+		TupleTableSlot *innerTupleSlot;
+
+		innerTupleSlot = ExecProcNode(innerPlan);
+		if (TupIsNull(innerTupleSlot))
+			break;
+		econtext->ecxt_innertuple = innerTupleSlot;
+
+		if (ExecQual(joinqual, econtext, false))
+		{
+			batch->matched = true;
+
+			/* In an antijoin, we never return a matched tuple */
+			if (node->js.jointype == JOIN_ANTI)
+				break;
+
+			/* In a semijoin, the first match is all we need */
+			if (node->js.jointype == JOIN_SEMI)
+				batch->probing = false;
+
+			if (otherqual == NIL || ExecQual(otherqual, econtext, false))
+			{
+				result = ExecProject(node->js.ps.ps_ProjInfo, &isDone);
+				/* we don't batch if the targetlist has set-returning functions */
+				Assert(isDone == ExprSingleResult);
+				return result;
+			}
+			else
+				InstrCountFiltered2(node, 1);
+
+			if (!batch->probing)
+				return NULL;
+		}
+		else
+			InstrCountFiltered1(node, 1);
+
+		ResetExprContext(econtext);
+	}
+
+	batch->probing = false;
+
+	if (!batch->matched &&
+		(node->js.jointype == JOIN_LEFT ||
+		 node->js.jointype == JOIN_ANTI))
+	{
+		econtext->ecxt_innertuple = node->nl_NullInnerTupleSlot;
+
+		if (otherqual == NIL || ExecQual(otherqual, econtext, false))
+		{
+			result = ExecProject(node->js.ps.ps_ProjInfo, &isDone);
+			Assert(isDone == ExprSingleResult);
+			return result;
+		}
+		else
+			InstrCountFiltered2(node, 1);
+	}
+
+	return NULL;
+}
+
+/*
+ * qsort_arg comparator for batch entry indexes, ordering by parameter
+ * values and then by position in the batch
+ */
+static int
+batch_entry_cmp(const void *a, const void *b, void *arg)
+{
+	NestLoopBatchData *batch = (NestLoopBatchData *) arg;
+	int			n1 = *(const int *) a;
+	int			n2 = *(const int *) b;
+	int			i;
+
+	for (i = 0; i < batch->nkeys; i++)
+	{
+		int			k1 = n1 * batch->nkeys + i;
+		int			k2 = n2 * batch->nkeys + i;
+		int			compare;
+
+		compare = ApplySortComparator(batch->keys[k1], batch->nulls[k1],
+									  batch->keys[k2], batch->nulls[k2],
+									  &batch->sortkeys[i]);
+		if (compare != 0)
+			return compare;
+	}
+
+	return (n1 < n2) ? -1 : (n1 > n2);
+}
+
 /* ----------------------------------------------------------------
  *		ExecInitNestLoop
  * ----------------------------------------------------------------
@@ -381,12 +815,88 @@ ExecInitNestLoop(NestLoop *node, EState *estate, int eflags)
 	nlstate->nl_NeedNewOuter = true;
 	nlstate->nl_MatchedOuter = false;
 
+	ExecNestLoopInitBatch(nlstate, node);
+
 	NL1_printf("ExecInitNestLoop: %s\n",
 			   "node initialized");
 
 	return nlstate;
 }
 
+/*
+ * ExecNestLoopInitBatch
+ *		Set up batched probing, if it can be used for this join
+ *
+ * That's the case if the inner side is an index scan on parameters we pass
+ * it, each of which we know how to sort, and we never need to return more
+ * than one row per join row we project.
+ */
+static void
+ExecNestLoopInitBatch(NestLoopState *nlstate, NestLoop *node)
+{
+	PlanState  *innerState = innerPlanState(nlstate);
+	NestLoopBatchData *batch;
+	int			nkeys;
+	int			i;
+	ListCell   *lc;
+
+	if (!enable_nestloop_batching || node->nestParams == NIL)
+		return;
+
+	if (!IsA(innerState, IndexScanState) &&
+		!IsA(innerState, IndexOnlyScanState))
+		return;
+
+	if (expression_returns_set((Node *) node->join.plan.targetlist))
+		return;
+
+	nkeys = list_length(node->nestParams);
+	batch = (NestLoopBatchData *) palloc0(sizeof(NestLoopBatchData));
+	batch->nkeys = nkeys;
+	batch->sortkeys = (SortSupport) palloc0(nkeys * sizeof(SortSupportData));
+
+	i = 0;
+	foreach(lc, node->nestParams)
+	{
+		NestLoopParam *nlp = (NestLoopParam *) lfirst(lc);
+		TypeCacheEntry *typentry;
+		SortSupport sortkey = &batch->sortkeys[i];
+
+		typentry = lookup_type_cache(exprType((Node *) nlp->paramval),
+									 TYPECACHE_LT_OPR);
+		if (!OidIsValid(typentry->lt_opr))
+		{
+			pfree(batch->sortkeys);
+			pfree(batch);
+			return;
+		}
+
+		sortkey->ssup_cxt = CurrentMemoryContext;
+		sortkey->ssup_collation = exprCollation((Node *) nlp->paramval);
+		sortkey->ssup_nulls_first = false;
+		sortkey->ssup_attno = i + 1;
+		PrepareSortSupportFromOrderingOp(typentry->lt_opr, sortkey);
+		i++;
+	}
+
+	batch->maxsize = NL_BATCH_MAX_SIZE;
+	batch->initsize = node->fast_start ? 1 : NL_BATCH_INITIAL_SIZE;
+	batch->size = batch->initsize;
+	batch->entries = (NestLoopBatchEntry *)
+		palloc(batch->maxsize * sizeof(NestLoopBatchEntry));
+	batch->keys = (Datum *) palloc(batch->maxsize * nkeys * sizeof(Datum));
+	batch->nulls = (bool *) palloc(batch->maxsize * nkeys * sizeof(bool));
+	batch->order = (int *) palloc(batch->maxsize * sizeof(int));
+	batch->outerslot = ExecInitExtraTupleSlot(nlstate->js.ps.state);
+	ExecSetSlotDescriptor(batch->outerslot,
+						  ExecGetResultType(outerPlanState(nlstate)));
+	batch->context = AllocSetContextCreate(CurrentMemoryContext,
+										   "NestLoop batch",
+										   ALLOCSET_DEFAULT_SIZES);
+
+	nlstate->nl_Batch = batch;
+}
+
 /* ----------------------------------------------------------------
  *		ExecEndNestLoop
  *
@@ -409,6 +919,12 @@ ExecEndNestLoop(NestLoopState *node)
 	 */
 	ExecClearTuple(node->js.ps.ps_ResultTupleSlot);
 
+	if (node->nl_Batch != NULL)
+	{
+		ExecClearTuple(node->nl_Batch->outerslot);
+		MemoryContextDelete(node->nl_Batch->context);
+	}
+
 	/*
 	 * close down subplans
 	 */
@@ -444,4 +960,20 @@ ExecReScanNestLoop(NestLoopState *node)
 	node->js.ps.ps_TupFromTlist = false;
 	node->nl_NeedNewOuter = true;
 	node->nl_MatchedOuter = false;
+
+	if (node->nl_Batch != NULL)
+	{
+		NestLoopBatchData *batch = node->nl_Batch;
+
+		ExecClearTuple(batch->outerslot);
+		MemoryContextReset(batch->context);
+		batch->space = 0;
+		batch->overflowed = false;
+		batch->nentries = 0;
+		batch->nextentry = 0;
+		batch->nextresult = NULL;
+		batch->outerdone = false;
+		batch->probing = false;
+		batch->size = batch->initsize;
+	}
 }
@@ -0,0 +1,767 @@
+/*-------------------------------------------------------------------------
+ *
+ * nodeResultCache.c
+ *	  Routines to handle caching of results from parameterized nodes
+ *
+ * Portions Copyright (c) 1996-2016, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  src/backend/executor/nodeResultCache.c
+ *
+ * DESCRIPTION
+ *
+ *	ResultCache nodes sit above a parameterized subplan, typically the inner
+ *	side of a nested loop, and remember the tuples it produced for each set
+ *	of parameter values.  When the node is rescanned with parameter values
+ *	that are already in the cache, the cached tuples are returned and the
+ *	subplan is not run at all.  That pays off when the outer side of the
+ *	join supplies the same values many times over, as in lookups from a
+ *	large table into a small one.
+ *
+ *	The cache is a hash table keyed by the values of the node's param_exprs,
+ *	evaluated at the start of each scan.  Keys are compared by their binary
+ *	images rather than with the datatypes' equality operators: values that
+ *	are equal but not identical (say, numeric 1.0 and 1.00) can make the
+ *	subplan produce different output, so only identical values may share
+ *	an entry.  That also means any datatype can be used as a key.
+ *
+ *	The memory used by the cache entries is bounded by work_mem.  Entries
+ *	are kept in a list in least-recently-used order, and when adding a
+ *	tuple takes us over the limit, we evict entries from the front of that
+ *	list until we're under it again.  If an entry is too large to fit by
+ *	itself, we give up on caching it and just pass the subplan's tuples
+ *	through for the rest of that scan.
+ *
+ *	An entry is only complete once the subplan has been run to exhaustion
+ *	for its parameters.  If our parent stops fetching early, as a semi-join
+ *	does after the first match, the entry is left incomplete and will be
+ *	refilled the next time its key is looked up.  When the planner knows
+ *	that the parent never wants more than one row per scan, it sets
+ *	singlerow, and the entry is marked complete after its first tuple.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "postgres.h"
+
+#include "access/hash.h"
+#include "access/htup_details.h"
+#include "executor/executor.h"
+#include "executor/nodeResultCache.h"
+#include "miscadmin.h"
+#include "nodes/nodeFuncs.h"
+#include "utils/datum.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+
+/* States of the ExecResultCache state machine */
+#define RC_CACHE_LOOKUP				1	/* at the start of a scan */
+#define RC_CACHE_FETCH_NEXT_TUPLE	2	/* returning tuples from the cache */
+#define RC_FILLING_CACHE			3	/* reading the subplan into an entry */
+#define RC_CACHE_BYPASS_MODE		4	/* reading the subplan, not caching */
+#define RC_END_OF_SCAN				5	/* ready for a rescan */
+
+/*
+ * A cached tuple.  Each entry's tuples form a singly linked list, in the
+ * order the subplan returned them.
+ */
+typedef struct ResultCacheTuple
+{
+	MinimalTuple mintuple;		/* the cached tuple */
+	struct ResultCacheTuple *next;	/* next tuple of the same entry */
+} ResultCacheTuple;
+
+/*
+ * A cache entry.  These are allocated separately from the hash table's own
+ * array, so that pointers to them stay valid while the table is modified.
+ */
+typedef struct ResultCacheEntry
+{
+	MinimalTuple params;		/* the cache key */
+	uint32		hash;			/* hash value of the key */
+	bool		complete;		/* did we read the subplan to the end? */
+	Size		mem_used;		/* memory charged for this entry */
+	ResultCacheTuple *tuplehead;	/* first cached tuple, or NULL */
+	dlist_node	lru_node;		/* position in rcstate->lru_list */
+} ResultCacheEntry;
+
+/* The hash table's element type */
+typedef struct ResultCacheHashEntry
+{
+	ResultCacheEntry *entry;	/* the key, and everything else */
+	uint32		status;			/* hash status */
+	uint32		hash;			/* hash value (cached) */
+} ResultCacheHashEntry;
+
+/*
+ * The memory charged to the cache for an entry holding no tuples, and for
+ * each tuple.  These disregard palloc overhead and the hash table's slack,
+ * the same way tuple hash tables do.
+ */
+#define EMPTY_ENTRY_MEMORY_BYTES(e) \
+	(sizeof(ResultCacheEntry) + sizeof(ResultCacheHashEntry) + \
+	 (e)->params->t_len)
+#define CACHE_TUPLE_BYTES(t) \
+	(sizeof(ResultCacheTuple) + (t)->mintuple->t_len)
+
+static uint32 ResultCacheHash_hash(struct resultcache_hash *tb,
+					 const ResultCacheEntry *key);
+static bool ResultCacheHash_equal(struct resultcache_hash *tb,
+					  const ResultCacheEntry *key1,
+					  const ResultCacheEntry *key2);
+
+/*
+ * Lookups pass a NULL key, meaning "the parameter values in probeslot";
+ * entries already in the table are identified by their own pointer.
+ */
+#define SH_PREFIX resultcache
+#define SH_ELEMENT_TYPE ResultCacheHashEntry
+#define SH_KEY_TYPE ResultCacheEntry *
+#define SH_KEY entry
+#define SH_HASH_KEY(tb, key) ResultCacheHash_hash(tb, key)
+#define SH_EQUAL(tb, a, b) ResultCacheHash_equal(tb, a, b)
+#define SH_SCOPE static inline
+#define SH_STORE_HASH
+#define SH_GET_HASH(tb, a) a->hash
+#define SH_DECLARE
+#define SH_DEFINE
+#include "lib/simplehash.h"
+
+
+/*
+ * ResultCacheHash_hash
+ *		Hash function for the cache's hash table.
+ *
+ * For a NULL key, hash the binary images of the values in probeslot.  The
+ * result must agree with ResultCacheHash_equal, which uses datumIsEqual.
+ */
+static uint32
+ResultCacheHash_hash(struct resultcache_hash *tb, const ResultCacheEntry *key)
+{
+	ResultCacheState *rcstate = (ResultCacheState *) tb->private_data;
+	TupleTableSlot *pslot = rcstate->probeslot;
+	uint32		hashkey = 0;
+	int			i;
+
+	if (key != NULL)
+		return key->hash;
+
+	for (i = 0; i < rcstate->nkeys; i++)
+	{
+		/* rotate hashkey left 1 bit at each step */
+		hashkey = (hashkey << 1) | ((hashkey & 0x80000000) ? 1 : 0);
+
+		if (!pslot->tts_isnull[i])	/* treat nulls as having hash key 0 */
+		{
+			Datum		value = pslot->tts_values[i];
+			uint32		hkey;
+
+			if (rcstate->keytypbyval[i])
+				hkey = DatumGetUInt32(hash_any((unsigned char *) &value,
+											   sizeof(Datum)));
+			else
+				hkey = DatumGetUInt32(hash_any((unsigned char *) DatumGetPointer(value),
+											   datumGetSize(value, false,
+												   rcstate->keytyplen[i])));
+			hashkey ^= hkey;
+		}
+	}
+
+	return hashkey;
+}
+
+/*
+ * ResultCacheHash_equal
+ *		Equality function for the cache's hash table.
+ *
+ * key1 is always an entry in the table.  key2 is either another entry or
+ * NULL, for the parameter values in probeslot.
+ */
+static bool
+ResultCacheHash_equal(struct resultcache_hash *tb, const ResultCacheEntry *key1,
+					  const ResultCacheEntry *key2)
+{
+	ResultCacheState *rcstate = (ResultCacheState *) tb->private_data;
+	TupleTableSlot *tslot = rcstate->tableslot;
+	TupleTableSlot *pslot = rcstate->probeslot;
+	int			i;
+
+	if (key2 != NULL)
+		return key1 == key2;
+
+	ExecStoreMinimalTuple(key1->params, tslot, false);
+	slot_getallattrs(tslot);
+
+	for (i = 0; i < rcstate->nkeys; i++)
+	{
+		if (tslot->tts_isnull[i] != pslot->tts_isnull[i])
+			return false;
+		if (tslot->tts_isnull[i])
+			continue;
+		if (!datumIsEqual(tslot->tts_values[i], pslot->tts_values[i],
+						  rcstate->keytypbyval[i], rcstate->keytyplen[i]))
+			return false;
+	}
+	return true;
+}
+
+/*
+ * prepare_probe_slot
+ *		Evaluate the cache key expressions into probeslot.
+ */
+static void
+prepare_probe_slot(ResultCacheState *rcstate)
+{
+	TupleTableSlot *pslot = rcstate->probeslot;
+	ExprContext *econtext = rcstate->ss.ps.ps_ExprContext;
+	MemoryContext oldcontext;
+	ListCell   *lc;
+	int			i = 0;
+
+	ResetExprContext(econtext);
+	oldcontext = MemoryContextSwitchTo(econtext->ecxt_per_tuple_memory);
+
+	ExecClearTuple(pslot);
+	foreach(lc, rcstate->param_exprs)
+	{
+		ExprState  *exprstate = (ExprState *) lfirst(lc);
+
+		pslot->tts_values[i] = ExecEvalExpr(exprstate, econtext,
+											&pslot->tts_isnull[i], NULL);
+		i++;
+	}
+	ExecStoreVirtualTuple(pslot);
+
+	MemoryContextSwitchTo(oldcontext);
+}
+
+/*
+ * create_cache_table
+ *		(Re)create the hash table, in an empty tableContext.
+ */
+static void
+create_cache_table(ResultCacheState *rcstate)
+{
+	ResultCache *node = (ResultCache *) rcstate->ss.ps.plan;
+	uint32		nbuckets;
+
+	/* The planner's estimate is a good first guess; growing is cheap */
+	nbuckets = Max(node->est_entries, 64);
+	nbuckets = Min(nbuckets, 1024 * 1024);
+
+	rcstate->hashtable = resultcache_create(rcstate->tableContext, nbuckets,
+											rcstate);
+	dlist_init(&rcstate->lru_list);
+	rcstate->mem_used = 0;
+}
+
+/*
+ * entry_purge_tuples
+ *		Free all the tuples of a cache entry, leaving it empty.
+ */
+static void
+entry_purge_tuples(ResultCacheState *rcstate, ResultCacheEntry *entry)
+{
+	ResultCacheTuple *tuple = entry->tuplehead;
+
+	while (tuple != NULL)
+	{
+		ResultCacheTuple *next = tuple->next;
+
+		rcstate->mem_used -= CACHE_TUPLE_BYTES(tuple);
+		entry->mem_used -= CACHE_TUPLE_BYTES(tuple);
+		pfree(tuple->mintuple);
+		pfree(tuple);
+		tuple = next;
+	}
+
+	entry->tuplehead = NULL;
+	entry->complete = false;
+}
+
+/*
+ * remove_cache_entry
+ *		Remove an entry from the cache and free it.
+ */
+static void
+remove_cache_entry(ResultCacheState *rcstate, ResultCacheEntry *entry)
+{
+	entry_purge_tuples(rcstate, entry);
+
+	dlist_delete(&entry->lru_node);
+	resultcache_delete(rcstate->hashtable, entry);
+
+	rcstate->mem_used -= EMPTY_ENTRY_MEMORY_BYTES(entry);
+	pfree(entry->params);
+	pfree(entry);
+}
+
+/*
+ * cache_purge_all
+ *		Remove every entry from the cache.
+ */
+static void
+cache_purge_all(ResultCacheState *rcstate)
+{
+	MemoryContextReset(rcstate->tableContext);
+	create_cache_table(rcstate);
+	rcstate->entry = NULL;
+	rcstate->last_tuple = NULL;
+}
+
+/*
+ * cache_reduce_memory
+ *		Evict entries, least recently used first, until the cache fits in
+ *		work_mem again.
+ *
+ * The current scan's entry, which is the most recently used one, is never
+ * evicted.  Returns false if the cache is still over the limit, meaning the
+ * current entry is too large by itself.
+ */
+static bool
+cache_reduce_memory(ResultCacheState *rcstate, ResultCacheEntry *current)
+{
+	dlist_mutable_iter iter;
+
+	dlist_foreach_modify(iter, &rcstate->lru_list)
+	{
+		ResultCacheEntry *entry = dlist_container(ResultCacheEntry, lru_node,
+												  iter.cur);
+
+		if (rcstate->mem_used <= rcstate->mem_limit || entry == current)
+			break;
+
+		remove_cache_entry(rcstate, entry);
+		rcstate->stats.cache_evictions++;
+	}
+
+	return rcstate->mem_used <= rcstate->mem_limit;
+}
+
+/*
+ * cache_lookup
+ *		Find the entry for the parameter values in probeslot, creating an
+ *		empty one if there is none.
+ *
+ * *found tells which happened.  Returns NULL if a new entry would not fit
+ * in work_mem even with every other entry evicted.
+ */
+static ResultCacheEntry *
+cache_lookup(ResultCacheState *rcstate, bool *found)
+{
+	ResultCacheHashEntry *hentry;
+	ResultCacheEntry *entry;
+	MemoryContext oldcontext;
+
+	hentry = resultcache_lookup(rcstate->hashtable, NULL);
+	if (hentry != NULL)
+	{
+		entry = hentry->entry;
+		*found = true;
+
+		/* Move it to the most recently used end of the list */
+		dlist_delete(&entry->lru_node);
+		dlist_push_tail(&rcstate->lru_list, &entry->lru_node);
+		return entry;
+	}
+
+	*found = false;
+
+	oldcontext = MemoryContextSwitchTo(rcstate->tableContext);
+	entry = (ResultCacheEntry *) palloc(sizeof(ResultCacheEntry));
+	entry->params = ExecCopySlotMinimalTuple(rcstate->probeslot);
+	entry->hash = ResultCacheHash_hash(rcstate->hashtable, NULL);
+	entry->complete = false;
+	entry->tuplehead = NULL;
+	entry->mem_used = EMPTY_ENTRY_MEMORY_BYTES(entry);
+	MemoryContextSwitchTo(oldcontext);
+
+	(void) resultcache_insert(rcstate->hashtable, entry, found);
+	Assert(!*found);
+	dlist_push_tail(&rcstate->lru_list, &entry->lru_node);
+
+	rcstate->mem_used += entry->mem_used;
+	rcstate->stats.mem_peak = Max(rcstate->stats.mem_peak, rcstate->mem_used);
+
+	if (rcstate->mem_used > rcstate->mem_limit &&
+		!cache_reduce_memory(rcstate, entry))
+	{
+		remove_cache_entry(rcstate, entry);
+		return NULL;
+	}
+
+	return entry;
+}
+
+/*
+ * cache_store_tuple
+ *		Add the tuple in slot to the current scan's entry.
+ *
+ * Returns false if that took the entry beyond what fits in work_mem.
+ */
+static bool
+cache_store_tuple(ResultCacheState *rcstate, TupleTableSlot *slot)
+{
+	ResultCacheEntry *entry = rcstate->entry;
+	ResultCacheTuple *tuple;
+	MemoryContext oldcontext;
+
+	oldcontext = MemoryContextSwitchTo(rcstate->tableContext);
+	tuple = (ResultCacheTuple *) palloc(sizeof(ResultCacheTuple));
+	tuple->mintuple = ExecCopySlotMinimalTuple(slot);
+	tuple->next = NULL;
+	MemoryContextSwitchTo(oldcontext);
+
+	if (entry->tuplehead == NULL)
+		entry->tuplehead = tuple;
+	else
+		rcstate->last_tuple->next = tuple;
+	rcstate->last_tuple = tuple;
+
+	rcstate->mem_used += CACHE_TUPLE_BYTES(tuple);
+	entry->mem_used += CACHE_TUPLE_BYTES(tuple);
+	rcstate->stats.mem_peak = Max(rcstate->stats.mem_peak, rcstate->mem_used);
+
+	if (rcstate->mem_used > rcstate->mem_limit)
+	{
+		/*
+		 * If the entry can't fit even on its own, don't throw away the rest
+		 * of the cache finding that out.
+		 */
+		if (entry->mem_used > rcstate->mem_limit)
+			return false;
+		return cache_reduce_memory(rcstate, entry);
+	}
+
+	return true;
+}
+
+/*
+ * start_bypass_mode
+ *		Give up on caching the current scan's results.
+ */
+static void
+start_bypass_mode(ResultCacheState *rcstate)
+{
+	remove_cache_entry(rcstate, rcstate->entry);
+	rcstate->entry = NULL;
+	rcstate->last_tuple = NULL;
+	rcstate->stats.cache_overflows++;
+	rcstate->rc_status = RC_CACHE_BYPASS_MODE;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecResultCache
+ *
+ *		Return the next tuple of the current scan, from the cache if we
+ *		have seen its parameter values before, else from the subplan.
+ * ----------------------------------------------------------------
+ */
+TupleTableSlot *
+ExecResultCache(ResultCacheState *node)
+{
+	PlanState  *outerNode = outerPlanState(node);
+	TupleTableSlot *outerslot;
+	ResultCacheEntry *entry;
+	bool		found;
+
+	switch (node->rc_status)
+	{
+		case RC_CACHE_LOOKUP:
+			prepare_probe_slot(node);
+			entry = cache_lookup(node, &found);
+
+			if (found && entry->complete)
+			{
+				node->stats.cache_hits++;
+				node->entry = entry;
+				node->last_tuple = entry->tuplehead;
+
+				if (node->last_tuple == NULL)
+				{
+					/* the subplan returned no rows for these parameters */
+					node->rc_status = RC_END_OF_SCAN;
+					return NULL;
+				}
+
+				node->rc_status = RC_CACHE_FETCH_NEXT_TUPLE;
+				return ExecStoreMinimalTuple(node->last_tuple->mintuple,
+											 node->ss.ps.ps_ResultTupleSlot,
+											 false);
+			}
+
+			node->stats.cache_misses++;
+
+			/* An entry left incomplete by an earlier scan must be refilled */
+			if (found)
+				entry_purge_tuples(node, entry);
+
+			node->entry = entry;
+			node->last_tuple = NULL;
+
+			outerslot = ExecProcNode(outerNode);
+			if (TupIsNull(outerslot))
+			{
+				if (entry != NULL)
+					entry->complete = true;
+				node->rc_status = RC_END_OF_SCAN;
+				return NULL;
+			}
+
+			if (entry == NULL)
+			{
+				/* not even an empty entry fits; cache nothing this time */
+				node->stats.cache_overflows++;
+				node->rc_status = RC_CACHE_BYPASS_MODE;
+			}
+			else if (!cache_store_tuple(node, outerslot))
+				start_bypass_mode(node);
+			else if (node->singlerow)
+			{
+				/* our parent won't ask for another row for this scan */
+				entry->complete = true;
+				node->rc_status = RC_CACHE_FETCH_NEXT_TUPLE;
+			}
+			else
+				node->rc_status = RC_FILLING_CACHE;
+
+			return outerslot;
+
+		case RC_CACHE_FETCH_NEXT_TUPLE:
+			Assert(node->last_tuple != NULL);
+
+			node->last_tuple = node->last_tuple->next;
+			if (node->last_tuple == NULL)
+			{
+				node->rc_status = RC_END_OF_SCAN;
+				return NULL;
+			}
+
+			return ExecStoreMinimalTuple(node->last_tuple->mintuple,
+										 node->ss.ps.ps_ResultTupleSlot,
+										 false);
+
+		case RC_FILLING_CACHE:
+			entry = node->entry;
+			Assert(entry != NULL && !entry->complete);
+
+			outerslot = ExecProcNode(outerNode);
+			if (TupIsNull(outerslot))
+			{
+				entry->complete = true;
+				node->rc_status = RC_END_OF_SCAN;
+				return NULL;
+			}
+
+			if (!cache_store_tuple(node, outerslot))
+				start_bypass_mode(node);
+
+			return outerslot;
+
+		case RC_CACHE_BYPASS_MODE:
+			outerslot = ExecProcNode(outerNode);
+			if (TupIsNull(outerslot))
+			{
+				node->rc_status = RC_END_OF_SCAN;
+				return NULL;
+			}
+			return outerslot;
+
+		case RC_END_OF_SCAN:
+			/* we've already returned everything for this scan */
+			return NULL;
+
+		default:
+			elog(ERROR, "unrecognized result cache status: %d",
+				 node->rc_status);
+			return NULL;		/* keep compiler quiet */
+	}
+}
+
+/*
+ * collect_paramids_walker
+ *		Collect the ids of the PARAM_EXEC Params in an expression.
+ */
+static bool
+collect_paramids_walker(Node *node, Bitmapset **paramids)
+{
+	if (node == NULL)
+		return false;
+	if (IsA(node, Param))
+	{
+		Param	   *param = (Param *) node;
+
+		if (param->paramkind == PARAM_EXEC)
+			*paramids = bms_add_member(*paramids, param->paramid);
+		return false;
+	}
+	return expression_tree_walker(node, collect_paramids_walker,
+								  (void *) paramids);
+}
+
+/* ----------------------------------------------------------------
+ *		ExecInitResultCache
+ * ----------------------------------------------------------------
+ */
+ResultCacheState *
+ExecInitResultCache(ResultCache *node, EState *estate, int eflags)
+{
+	ResultCacheState *rcstate;
+	ListCell   *lc;
+	int			i;
+
+	/* check for unsupported flags */
+	Assert(!(eflags & (EXEC_FLAG_BACKWARD | EXEC_FLAG_MARK)));
+
+	/*
+	 * create state structure
+	 */
+	rcstate = makeNode(ResultCacheState);
+	rcstate->ss.ps.plan = (Plan *) node;
+	rcstate->ss.ps.state = estate;
+
+	/*
+	 * Miscellaneous initialization
+	 *
+	 * We need an ExprContext to evaluate the cache key expressions in.
+	 */
+	ExecAssignExprContext(estate, &rcstate->ss.ps);
+
+	/*
+	 * tuple table initialization
+	 */
+	ExecInitResultTupleSlot(estate, &rcstate->ss.ps);
+	ExecInitScanTupleSlot(estate, &rcstate->ss);
+
+	/*
+	 * initialize child nodes
+	 *
+	 * We shield the child node from the need to support BACKWARD or
+	 * MARK/RESTORE; it's rescanned for every cache miss.
+	 */
+	eflags &= ~(EXEC_FLAG_BACKWARD | EXEC_FLAG_MARK);
+
+	outerPlanState(rcstate) = ExecInitNode(outerPlan(node), estate, eflags);
+
+	/*
+	 * initialize tuple type.  no need to initialize projection info because
+	 * this node doesn't do projections.
+	 */
+	ExecAssignResultTypeFromTL(&rcstate->ss.ps);
+	ExecAssignScanTypeFromOuterPlan(&rcstate->ss);
+	rcstate->ss.ps.ps_ProjInfo = NULL;
+
+	/*
+	 * Set up the cache key: its expressions, its tuple descriptor, the type
+	 * details needed to hash and compare binary images, and the slots used
+	 * to look at keys.
+	 */
+	rcstate->nkeys = list_length(node->param_exprs);
+	rcstate->param_exprs = (List *) ExecInitExpr((Expr *) node->param_exprs,
+												 (PlanState *) rcstate);
+	rcstate->hashkeydesc = ExecTypeFromExprList(node->param_exprs);
+	rcstate->keytyplen = (int16 *) palloc(rcstate->nkeys * sizeof(int16));
+	rcstate->keytypbyval = (bool *) palloc(rcstate->nkeys * sizeof(bool));
+	i = 0;
+	foreach(lc, node->param_exprs)
+	{
+		get_typlenbyval(exprType((Node *) lfirst(lc)),
+						&rcstate->keytyplen[i], &rcstate->keytypbyval[i]);
+		i++;
+	}
+	rcstate->tableslot = MakeSingleTupleTableSlot(rcstate->hashkeydesc);
+	rcstate->probeslot = MakeSingleTupleTableSlot(rcstate->hashkeydesc);
+
+	rcstate->keyparamids = NULL;
+	(void) collect_paramids_walker((Node *) node->param_exprs,
+								   &rcstate->keyparamids);
+
+	rcstate->singlerow = node->singlerow;
+	rcstate->mem_limit = work_mem * 1024L;
+	memset(&rcstate->stats, 0, sizeof(ResultCacheInstrumentation));
+
+	rcstate->tableContext = AllocSetContextCreate(CurrentMemoryContext,
+												  "ResultCache table",
+												  ALLOCSET_DEFAULT_SIZES);
+	create_cache_table(rcstate);
+
+	rcstate->entry = NULL;
+	rcstate->last_tuple = NULL;
+	rcstate->rc_status = RC_CACHE_LOOKUP;
+
+	return rcstate;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecEndResultCache
+ * ----------------------------------------------------------------
+ */
+void
+ExecEndResultCache(ResultCacheState *node)
+{
+	/*
+	 * clean out the tuple table
+	 */
+	ExecClearTuple(node->ss.ss_ScanTupleSlot);
+	ExecClearTuple(node->ss.ps.ps_ResultTupleSlot);
+	ExecDropSingleTupleTableSlot(node->tableslot);
+	ExecDropSingleTupleTableSlot(node->probeslot);
+
+	/*
+	 * free the cache
+	 */
+	MemoryContextDelete(node->tableContext);
+
+	/*
+	 * free exprcontext
+	 */
+	ExecFreeExprContext(&node->ss.ps);
+
+	/*
+	 * shut down the subplan
+	 */
+	ExecEndNode(outerPlanState(node));
+}
+
+/* ----------------------------------------------------------------
+ *		ExecReScanResultCache
+ * ----------------------------------------------------------------
+ */
+void
+ExecReScanResultCache(ResultCacheState *node)
+{
+	PlanState  *outerPlan = outerPlanState(node);
+
+	/*
+	 * If a parameter that isn't part of the cache key has changed, the
+	 * cached results may no longer be right for any key.
+	 */
+	if (bms_nonempty_difference(outerPlan->chgParam, node->keyparamids))
+		cache_purge_all(node);
+
+	/* Look up the (possibly new) parameter values on the next fetch */
+	node->rc_status = RC_CACHE_LOOKUP;
+	node->entry = NULL;
+	node->last_tuple = NULL;
+
+	/*
+	 * if chgParam of subnode is not null then plan will be re-scanned by
+	 * first ExecProcNode.
+	 */
+	if (outerPlan->chgParam == NULL)
+		ExecReScan(outerPlan);
+}
+
+/*
+ * ExecEstimateCacheEntryOverheadBytes
+ *		For use in the planner, estimate the memory a cache entry holding
+ *		ntuples tuples takes beyond the tuples themselves.
+ */
+double
+ExecEstimateCacheEntryOverheadBytes(double ntuples)
+{
+	return sizeof(ResultCacheEntry) + sizeof(ResultCacheHashEntry) +
+		sizeof(ResultCacheTuple) * ntuples;
+}
@@ -20,6 +20,9 @@
  *		ExecEndSeqScan			releases any storage allocated.
  *		ExecReScanSeqScan		rescans the relation
  *
+ *		ExecSeqScanBatchInit	sets up to return rows in batches
+ *		ExecSeqScanNextBatch	retrieves the next batch of rows
+ *
  *		ExecSeqScanEstimate		estimates DSM space needed for parallel scan
  *		ExecSeqScanInitializeDSM initialize DSM for parallel scan
  *		ExecSeqScanInitializeWorker attach to DSM info in parallel worker
@@ -27,8 +30,11 @@
 #include "postgres.h"
 
 #include "access/relscan.h"
+#include "executor/execBatch.h"
 #include "executor/execdebug.h"
+#include "executor/instrument.h"
 #include "executor/nodeSeqscan.h"
+#include "miscadmin.h"
 #include "utils/rel.h"
 
 static void InitScanRelation(SeqScanState *node, EState *estate, int eflags);
@@ -129,6 +135,152 @@ ExecSeqScan(SeqScanState *node)
 					(ExecScanRecheckMtd) SeqRecheck);
 }
 
+/* ----------------------------------------------------------------
+ *		ExecSeqScanBatchInit
+ *
+ *		Sets up the scan to return its rows a batch at a time, through
+ *		ExecSeqScanNextBatch, to a parent that reads only the output
+ *		columns in 'needed' (numbered from 1).  Column i - 1 of the
+ *		returned batch holds output column i.
+ *
+ *		Returns NULL if the scan can't do that, in which case the parent
+ *		must use ExecProcNode as usual.
+ * ----------------------------------------------------------------
+ */
+TupleBatch *
+ExecSeqScanBatchInit(SeqScanState *node, Bitmapset *needed)
+{
+	Plan	   *plan = node->ss.ps.plan;
+	TupleDesc	tupdesc = RelationGetDescr(node->ss.ss_currentRelation);
+	TupleBatch *batch;
+	ListCell   *lc;
+	int			colno;
+
+	if (!enable_batch_execution)
+		return NULL;
+
+	/*
+	 * Batches skip the projection entirely, so it had better not do
+	 * anything but pick out columns.
+	 */
+	foreach(lc, plan->targetlist)
+	{
+		TargetEntry *tle = (TargetEntry *) lfirst(lc);
+
+		if (!IsA(tle->expr, Var))
+			return NULL;
+	}
+
+	/* EvalPlanQual substitutes test tuples for the scan; don't bother */
+	if (node->ss.ps.state->es_epqTuple != NULL)
+		return NULL;
+
+	/* every output column wanted must be a plain pass-by-value attribute */
+	colno = -1;
+	while ((colno = bms_next_member(needed, colno)) >= 0)
+	{
+		TargetEntry *tle;
+		Var		   *var;
+
+		if (colno < 1 || colno > list_length(plan->targetlist))
+			return NULL;
+		tle = (TargetEntry *) list_nth(plan->targetlist, colno - 1);
+		var = (Var *) tle->expr;
+		if (var->varattno <= 0 ||
+			var->varattno > tupdesc->natts ||
+			!tupdesc->attrs[var->varattno - 1]->attbyval)
+			return NULL;
+	}
+
+	if (!ExecBatchQualsSupported(plan->qual))
+		return NULL;
+
+	/* all set; nothing below can fail */
+	batch = ExecBatchCreate(list_length(plan->targetlist),
+							list_length(plan->targetlist) + tupdesc->natts);
+
+	colno = -1;
+	while ((colno = bms_next_member(needed, colno)) >= 0)
+	{
+		TargetEntry *tle = (TargetEntry *) list_nth(plan->targetlist, colno - 1);
+
+		ExecBatchSetColumn(batch, colno - 1, ((Var *) tle->expr)->varattno);
+	}
+
+	ExecBatchCompileQuals(batch, plan->qual,
+						  &node->batchquals, &node->nbatchquals);
+
+	node->batch = batch;
+	return batch;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecSeqScanNextBatch
+ *
+ *		Loads the next batch of rows into the node's batch and selects
+ *		the ones passing the quals.  Returns false when the scan is done.
+ *		Some batches may have no rows selected.
+ * ----------------------------------------------------------------
+ */
+bool
+ExecSeqScanNextBatch(SeqScanState *node)
+{
+	TupleBatch *batch = node->batch;
+	HeapScanDesc scandesc = node->ss.ss_currentScanDesc;
+	EState	   *estate = node->ss.ps.state;
+	TupleTableSlot *slot = node->ss.ss_ScanTupleSlot;
+	Instrumentation *instr = node->ss.ps.instrument;
+
+	Assert(batch != NULL);
+
+	/* heap_getnext would start over if called again at the end */
+	if (node->batch_done)
+		return false;
+
+	CHECK_FOR_INTERRUPTS();
+
+	if (instr)
+		InstrStartNode(instr);
+
+	/* as in SeqNext */
+	if (scandesc == NULL)
+	{
+		scandesc = heap_beginscan(node->ss.ss_currentRelation,
+								  estate->es_snapshot,
+								  0, NULL);
+		node->ss.ss_currentScanDesc = scandesc;
+	}
+
+	/*
+	 * Only by-value columns are batched, so nothing in the batch depends on
+	 * the buffer pin the slot holds; it's fine for the scan to move on.
+	 */
+	batch->nrows = 0;
+	while (batch->nrows < BATCH_SIZE)
+	{
+		HeapTuple	tuple = heap_getnext(scandesc, estate->es_direction);
+
+		if (tuple == NULL)
+		{
+			node->batch_done = true;
+			break;
+		}
+		ExecStoreTuple(tuple, slot, scandesc->rs_cbuf, false);
+		ExecBatchLoadRow(batch, slot);
+	}
+	ExecClearTuple(slot);
+
+	ExecBatchFilter(batch, node->batchquals, node->nbatchquals);
+
+	if (instr)
+	{
+		InstrCountFiltered1(node, batch->nrows - batch->nsel);
+		InstrStopNode(instr, batch->nsel);
+	}
+
+	return batch->nrows > 0;
+}
+
 /* ----------------------------------------------------------------
  *		InitScanRelation
  *
@@ -279,6 +431,7 @@ ExecReScanSeqScan(SeqScanState *node)
 	if (scan != NULL)
 		heap_rescan(scan,		/* scan desc */
 					NULL);		/* new scan keys */
+	node->batch_done = false;
 
 	ExecScanReScan((ScanState *) node);
 }
@@ -37,6 +37,7 @@
 #include "catalog/objectaccess.h"
 #include "catalog/pg_aggregate.h"
 #include "catalog/pg_proc.h"
+#include "catalog/pg_type.h"
 #include "executor/executor.h"
 #include "executor/nodeWindowAgg.h"
 #include "miscadmin.h"
@@ -106,6 +107,7 @@ typedef struct WindowStatePerAggData
 	Oid			transfn_oid;
 	Oid			invtransfn_oid; /* may be InvalidOid */
 	Oid			finalfn_oid;	/* may be InvalidOid */
+	Oid			combinefn_oid;	/* InvalidOid unless segtree_ok */
 
 	/*
 	 * fmgr lookup data for transition functions --- only valid when
@@ -115,6 +117,7 @@ typedef struct WindowStatePerAggData
 	FmgrInfo	transfn;
 	FmgrInfo	invtransfn;
 	FmgrInfo	finalfn;
+	FmgrInfo	combinefn;
 
 	int			numFinalArgs;	/* number of arguments to pass to finalfn */
 
@@ -152,6 +155,19 @@ typedef struct WindowStatePerAggData
 
 	int64		transValueCount;	/* number of currently-aggregated rows */
 
+	/*
+	 * Segment tree of partial transition values for the current partition,
+	 * built only if segtree_ok and the tree fits in work_mem.  Leaves (one
+	 * per partition row) live at [segtree_size, 2 * segtree_size); each inner
+	 * node i holds the combination of nodes 2i and 2i+1.  segtree is NULL if
+	 * the aggregate is evaluated the ordinary way in this partition.
+	 */
+	bool		segtree_ok;		/* could we use a segment tree? */
+	int32		transtypeWidth; /* estimated width of a transition value */
+	int64		segtree_size;	/* number of leaves */
+	Datum	   *segtree;
+	bool	   *segtreenulls;
+
 	/* Data local to eval_windowaggregates() */
 	bool		restart;		/* need to restart this agg in this cycle? */
 } WindowStatePerAggData;
@@ -169,6 +185,16 @@ static void finalize_windowaggregate(WindowAggState *winstate,
 						 WindowStatePerFunc perfuncstate,
 						 WindowStatePerAgg peraggstate,
 						 Datum *result, bool *isnull);
+static void combine_windowaggregate(WindowAggState *winstate,
+						WindowStatePerFunc perfuncstate,
+						WindowStatePerAgg peraggstate,
+						MemoryContext aggcontext,
+						Datum *transValue, bool *transValueIsNull,
+						bool *noTransValue,
+						Datum newValue, bool newValueIsNull);
+static void build_windowaggregate_segtrees(WindowAggState *winstate);
+static bool window_float_transtype(Oid transtype);
+static int	eval_windowaggregates_segtree(WindowAggState *winstate);
 
 static void eval_windowaggregates(WindowAggState *winstate);
 static void eval_windowfunction(WindowAggState *winstate,
@@ -241,8 +267,7 @@ advance_windowaggregate(WindowAggState *winstate,
 {
 	WindowFuncExprState *wfuncstate = perfuncstate->wfuncstate;
 	int			numArguments = perfuncstate->numArguments;
-	FunctionCallInfoData fcinfodata;
-	FunctionCallInfo fcinfo = &fcinfodata;
+	LOCAL_FCINFO(fcinfo, FUNC_MAX_ARGS);
 	Datum		newVal;
 	ListCell   *arg;
 	int			i;
@@ -271,8 +296,8 @@ advance_windowaggregate(WindowAggState *winstate,
 	{
 		ExprState  *argstate = (ExprState *) lfirst(arg);
 
-		fcinfo->arg[i] = ExecEvalExpr(argstate, econtext,
-									  &fcinfo->argnull[i], NULL);
+		fcinfo->args[i].value = ExecEvalExpr(argstate, econtext,
+											 &fcinfo->args[i].isnull, NULL);
 		i++;
 	}
 
@@ -285,7 +310,7 @@ advance_windowaggregate(WindowAggState *winstate,
 		 */
 		for (i = 1; i <= numArguments; i++)
 		{
-			if (fcinfo->argnull[i])
+			if (fcinfo->args[i].isnull)
 			{
 				MemoryContextSwitchTo(oldContext);
 				return;
@@ -304,7 +329,7 @@ advance_windowaggregate(WindowAggState *winstate,
 		if (peraggstate->transValueCount == 0 && peraggstate->transValueIsNull)
 		{
 			MemoryContextSwitchTo(peraggstate->aggcontext);
-			peraggstate->transValue = datumCopy(fcinfo->arg[1],
+			peraggstate->transValue = datumCopy(fcinfo->args[1].value,
 												peraggstate->transtypeByVal,
 												peraggstate->transtypeLen);
 			peraggstate->transValueIsNull = false;
@@ -337,8 +362,8 @@ advance_windowaggregate(WindowAggState *winstate,
 							 numArguments + 1,
 							 perfuncstate->winCollation,
 							 (void *) winstate, NULL);
-	fcinfo->arg[0] = peraggstate->transValue;
-	fcinfo->argnull[0] = peraggstate->transValueIsNull;
+	fcinfo->args[0].value = peraggstate->transValue;
+	fcinfo->args[0].isnull = peraggstate->transValueIsNull;
 	winstate->curaggcontext = peraggstate->aggcontext;
 	newVal = FunctionCallInvoke(fcinfo);
 	winstate->curaggcontext = NULL;
@@ -403,8 +428,7 @@ advance_windowaggregate_base(WindowAggState *winstate,
 {
 	WindowFuncExprState *wfuncstate = perfuncstate->wfuncstate;
 	int			numArguments = perfuncstate->numArguments;
-	FunctionCallInfoData fcinfodata;
-	FunctionCallInfo fcinfo = &fcinfodata;
+	LOCAL_FCINFO(fcinfo, FUNC_MAX_ARGS);
 	Datum		newVal;
 	ListCell   *arg;
 	int			i;
@@ -433,8 +457,8 @@ advance_windowaggregate_base(WindowAggState *winstate,
 	{
 		ExprState  *argstate = (ExprState *) lfirst(arg);
 
-		fcinfo->arg[i] = ExecEvalExpr(argstate, econtext,
-									  &fcinfo->argnull[i], NULL);
+		fcinfo->args[i].value = ExecEvalExpr(argstate, econtext,
+											 &fcinfo->args[i].isnull, NULL);
 		i++;
 	}
 
@@ -447,7 +471,7 @@ advance_windowaggregate_base(WindowAggState *winstate,
 		 */
 		for (i = 1; i <= numArguments; i++)
 		{
-			if (fcinfo->argnull[i])
+			if (fcinfo->args[i].isnull)
 			{
 				MemoryContextSwitchTo(oldContext);
 				return true;
@@ -493,8 +517,8 @@ advance_windowaggregate_base(WindowAggState *winstate,
 							 numArguments + 1,
 							 perfuncstate->winCollation,
 							 (void *) winstate, NULL);
-	fcinfo->arg[0] = peraggstate->transValue;
-	fcinfo->argnull[0] = peraggstate->transValueIsNull;
+	fcinfo->args[0].value = peraggstate->transValue;
+	fcinfo->args[0].isnull = peraggstate->transValueIsNull;
 	winstate->curaggcontext = peraggstate->aggcontext;
 	newVal = FunctionCallInvoke(fcinfo);
 	winstate->curaggcontext = NULL;
@@ -560,27 +584,27 @@ finalize_windowaggregate(WindowAggState *winstate,
 	if (OidIsValid(peraggstate->finalfn_oid))
 	{
 		int			numFinalArgs = peraggstate->numFinalArgs;
-		FunctionCallInfoData fcinfo;
+		LOCAL_FCINFO(fcinfo, FUNC_MAX_ARGS);
 		bool		anynull;
 		int			i;
 
-		InitFunctionCallInfoData(fcinfo, &(peraggstate->finalfn),
+		InitFunctionCallInfoData(*fcinfo, &(peraggstate->finalfn),
 								 numFinalArgs,
 								 perfuncstate->winCollation,
 								 (void *) winstate, NULL);
-		fcinfo.arg[0] = peraggstate->transValue;
-		fcinfo.argnull[0] = peraggstate->transValueIsNull;
+		fcinfo->args[0].value = peraggstate->transValue;
+		fcinfo->args[0].isnull = peraggstate->transValueIsNull;
 		anynull = peraggstate->transValueIsNull;
 
 		/* Fill any remaining argument positions with nulls */
 		for (i = 1; i < numFinalArgs; i++)
 		{
-			fcinfo.arg[i] = (Datum) 0;
-			fcinfo.argnull[i] = true;
+			fcinfo->args[i].value = (Datum) 0;
+			fcinfo->args[i].isnull = true;
 			anynull = true;
 		}
 
-		if (fcinfo.flinfo->fn_strict && anynull)
+		if (fcinfo->flinfo->fn_strict && anynull)
 		{
 			/* don't call a strict function with NULL inputs */
 			*result = (Datum) 0;
@@ -589,9 +613,9 @@ finalize_windowaggregate(WindowAggState *winstate,
 		else
 		{
 			winstate->curaggcontext = peraggstate->aggcontext;
-			*result = FunctionCallInvoke(&fcinfo);
+			*result = FunctionCallInvoke(fcinfo);
 			winstate->curaggcontext = NULL;
-			*isnull = fcinfo.isnull;
+			*isnull = fcinfo->isnull;
 		}
 	}
 	else
@@ -612,6 +636,334 @@ finalize_windowaggregate(WindowAggState *winstate,
 	MemoryContextSwitchTo(oldContext);
 }
 
+/*
+ * combine_windowaggregate
+ * parallel to advance_combine_function in nodeAgg.c
+ *
+ * Merge the partial transition value newValue into *transValue, which is
+ * kept in aggcontext.  *noTransValue must be initialized to true when the
+ * aggregate's initial value is NULL, so that a strict combine function can
+ * adopt the first non-NULL input as its state.  newValue is never modified.
+ */
+static void
+combine_windowaggregate(WindowAggState *winstate,
+						WindowStatePerFunc perfuncstate,
+						WindowStatePerAgg peraggstate,
+						MemoryContext aggcontext,
+						Datum *transValue, bool *transValueIsNull,
+						bool *noTransValue,
+						Datum newValue, bool newValueIsNull)
+{
+	LOCAL_FCINFO(fcinfo, 2);
+	MemoryContext oldContext;
+	Datum		newVal;
+
+	if (peraggstate->combinefn.fn_strict)
+	{
+		/* nothing happens when there's a NULL input */
+		if (newValueIsNull)
+			return;
+
+		if (*noTransValue)
+		{
+			/*
+			 * The first non-NULL input becomes the transition value.  We
+			 * must copy it, since both the tree and the combine function may
+			 * hold on to what we store here.
+			 */
+			oldContext = MemoryContextSwitchTo(aggcontext);
+			*transValue = datumCopy(newValue,
+									peraggstate->transtypeByVal,
+									peraggstate->transtypeLen);
+			MemoryContextSwitchTo(oldContext);
+			*transValueIsNull = false;
+			*noTransValue = false;
+			return;
+		}
+
+		/* Don't call a strict function with NULL inputs */
+		if (*transValueIsNull)
+			return;
+	}
+
+	oldContext = MemoryContextSwitchTo(winstate->tmpcontext->ecxt_per_tuple_memory);
+
+	InitFunctionCallInfoData(*fcinfo, &(peraggstate->combinefn),
+							 2,
+							 perfuncstate->winCollation,
+							 (void *) winstate, NULL);
+	fcinfo->args[0].value = *transValue;
+	fcinfo->args[0].isnull = *transValueIsNull;
+	fcinfo->args[1].value = newValue;
+	fcinfo->args[1].isnull = newValueIsNull;
+	winstate->curaggcontext = aggcontext;
+	newVal = FunctionCallInvoke(fcinfo);
+	winstate->curaggcontext = NULL;
+
+	/*
+	 * If pass-by-ref datatype, must copy the new value into aggcontext and
+	 * pfree the prior transValue.  But if the combine function returned a
+	 * pointer to its first input, we don't need to do anything.
+	 */
+	if (!peraggstate->transtypeByVal &&
+		DatumGetPointer(newVal) != DatumGetPointer(*transValue))
+	{
+		if (!fcinfo->isnull)
+		{
+			MemoryContextSwitchTo(aggcontext);
+			newVal = datumCopy(newVal,
+							   peraggstate->transtypeByVal,
+							   peraggstate->transtypeLen);
+		}
+		if (!*transValueIsNull)
+			pfree(DatumGetPointer(*transValue));
+	}
+
+	MemoryContextSwitchTo(oldContext);
+	*transValue = newVal;
+	*transValueIsNull = fcinfo->isnull;
+	*noTransValue = false;
+}
+
+/*
+ * build_windowaggregate_segtrees
+ * build the segment trees of the current partition's aggregates
+ *
+ * Called on the first row of each partition.  The whole partition is read
+ * once; each row's transition value, computed from the aggregate's initial
+ * value, becomes a leaf, and the inner nodes are then filled in bottom-up
+ * using the combine function.  Aggregates whose tree would not fit in
+ * work_mem are left without one and evaluated by eval_windowaggregates'
+ * usual restart logic.
+ */
+static void
+build_windowaggregate_segtrees(WindowAggState *winstate)
+{
+	WindowObject agg_winobj = winstate->agg_winobj;
+	TupleTableSlot *temp_slot = winstate->temp_slot_1;
+	WindowStatePerAgg peraggstate;
+	MemoryContext oldContext;
+	int64		nrows;
+	int64		pos;
+	int			numtrees;
+	int			i;
+
+	for (i = 0; i < winstate->numaggs; i++)
+	{
+		if (winstate->peragg[i].segtree_ok)
+			break;
+	}
+	if (i >= winstate->numaggs)
+		return;					/* nothing to do */
+
+	spool_tuples(winstate, -1);
+	nrows = winstate->spooled_rows;
+
+	/* Allocate the trees that fit */
+	numtrees = 0;
+	for (i = 0; i < winstate->numaggs; i++)
+	{
+		double		nodesize;
+
+		peraggstate = &winstate->peragg[i];
+		peraggstate->segtree = NULL;
+		peraggstate->segtreenulls = NULL;
+		if (!peraggstate->segtree_ok)
+			continue;
+
+		nodesize = sizeof(Datum) + sizeof(bool);
+		if (!peraggstate->transtypeByVal)
+			nodesize += MAXALIGN(peraggstate->transtypeWidth);
+		if (2.0 * nrows * nodesize > work_mem * 1024.0 ||
+			2.0 * nrows * sizeof(Datum) > MaxAllocSize)
+			continue;
+
+		oldContext = MemoryContextSwitchTo(peraggstate->aggcontext);
+		peraggstate->segtree = (Datum *) palloc(2 * nrows * sizeof(Datum));
+		peraggstate->segtreenulls = (bool *) palloc(2 * nrows * sizeof(bool));
+		MemoryContextSwitchTo(oldContext);
+		peraggstate->segtree_size = nrows;
+		numtrees++;
+	}
+	if (numtrees == 0)
+		return;
+
+	/* Fill in the leaves, one partition row at a time */
+	for (pos = 0; pos < nrows; pos++)
+	{
+		if (!window_gettupleslot(agg_winobj, pos, temp_slot))
+			elog(ERROR, "could not fetch partition row " INT64_FORMAT, pos);
+
+		/* Set tuple context for evaluation of aggregate arguments */
+		winstate->tmpcontext->ecxt_outertuple = temp_slot;
+
+		for (i = 0; i < winstate->numaggs; i++)
+		{
+			peraggstate = &winstate->peragg[i];
+			if (peraggstate->segtree == NULL)
+				continue;
+
+			if (peraggstate->initValueIsNull)
+				peraggstate->transValue = peraggstate->initValue;
+			else
+			{
+				oldContext = MemoryContextSwitchTo(peraggstate->aggcontext);
+				peraggstate->transValue = datumCopy(peraggstate->initValue,
+												peraggstate->transtypeByVal,
+												peraggstate->transtypeLen);
+				MemoryContextSwitchTo(oldContext);
+			}
+			peraggstate->transValueIsNull = peraggstate->initValueIsNull;
+			peraggstate->transValueCount = 0;
+
+			advance_windowaggregate(winstate,
+									&winstate->perfunc[peraggstate->wfuncno],
+									peraggstate);
+
+			peraggstate->segtree[nrows + pos] = peraggstate->transValue;
+			peraggstate->segtreenulls[nrows + pos] = peraggstate->transValueIsNull;
+		}
+
+		/* Reset per-input-tuple context after each tuple */
+		ResetExprContext(winstate->tmpcontext);
+		ExecClearTuple(temp_slot);
+	}
+
+	/* And combine pairs of nodes upwards */
+	for (i = 0; i < winstate->numaggs; i++)
+	{
+		WindowStatePerFunc perfuncstate;
+		int64		node;
+
+		peraggstate = &winstate->peragg[i];
+		if (peraggstate->segtree == NULL)
+			continue;
+		perfuncstate = &winstate->perfunc[peraggstate->wfuncno];
+
+		for (node = nrows - 1; node >= 1; node--)
+		{
+			Datum		value = (Datum) 0;
+			bool		isnull = true;
+			bool		noTransValue = peraggstate->initValueIsNull;
+
+			if (!peraggstate->initValueIsNull)
+			{
+				oldContext = MemoryContextSwitchTo(peraggstate->aggcontext);
+				value = datumCopy(peraggstate->initValue,
+								  peraggstate->transtypeByVal,
+								  peraggstate->transtypeLen);
+				isnull = false;
+				MemoryContextSwitchTo(oldContext);
+			}
+			combine_windowaggregate(winstate, perfuncstate, peraggstate,
+									peraggstate->aggcontext,
+									&value, &isnull, &noTransValue,
+									peraggstate->segtree[2 * node],
+									peraggstate->segtreenulls[2 * node]);
+			combine_windowaggregate(winstate, perfuncstate, peraggstate,
+									peraggstate->aggcontext,
+									&value, &isnull, &noTransValue,
+									peraggstate->segtree[2 * node + 1],
+									peraggstate->segtreenulls[2 * node + 1]);
+			peraggstate->segtree[node] = value;
+			peraggstate->segtreenulls[node] = isnull;
+
+			ResetExprContext(winstate->tmpcontext);
+		}
+	}
+}
+
+/*
+ * eval_windowaggregates_segtree
+ * evaluate the aggregates that have a segment tree in this partition
+ *
+ * The frame [frameheadpos, frametailpos] is covered by at most two tree
+ * nodes per tree level.  We combine those nodes into a fresh transition
+ * value in left-to-right order, so the combine function need not be
+ * commutative, and finalize it into the current row's result.  Returns the
+ * number of aggregates handled.
+ */
+static int
+eval_windowaggregates_segtree(WindowAggState *winstate)
+{
+	ExprContext *econtext = winstate->ss.ps.ps_ExprContext;
+	MemoryContext tmpcontext = winstate->tmpcontext->ecxt_per_tuple_memory;
+	int64		leftnodes[64];
+	int64		rightnodes[64];
+	int			numaggs_segtree = 0;
+	int			i;
+
+	for (i = 0; i < winstate->numaggs; i++)
+	{
+		WindowStatePerAgg peraggstate = &winstate->peragg[i];
+		WindowStatePerFunc perfuncstate;
+		int			wfuncno = peraggstate->wfuncno;
+		int64		nrows = peraggstate->segtree_size;
+		int64		lo,
+					hi;
+		int			nleft,
+					nright,
+					j;
+		Datum		value = (Datum) 0;
+		bool		isnull = true;
+		bool		noTransValue = peraggstate->initValueIsNull;
+
+		if (peraggstate->segtree == NULL)
+			continue;
+		perfuncstate = &winstate->perfunc[wfuncno];
+
+		/* We need the frame's end too, but only compute it once */
+		if (numaggs_segtree++ == 0)
+			update_frametailpos(winstate->agg_winobj, winstate->temp_slot_1);
+
+		/* Collect the nodes covering the frame, as a half-open leaf range */
+		lo = Max(winstate->frameheadpos, 0) + nrows;
+		hi = Min(winstate->frametailpos, nrows - 1) + 1 + nrows;
+		nleft = nright = 0;
+		for (; lo < hi; lo >>= 1, hi >>= 1)
+		{
+			if (lo & 1)
+				leftnodes[nleft++] = lo++;
+			if (hi & 1)
+				rightnodes[nright++] = --hi;
+		}
+
+		if (!peraggstate->initValueIsNull)
+		{
+			MemoryContext oldContext = MemoryContextSwitchTo(tmpcontext);
+
+			value = datumCopy(peraggstate->initValue,
+							  peraggstate->transtypeByVal,
+							  peraggstate->transtypeLen);
+			isnull = false;
+			MemoryContextSwitchTo(oldContext);
+		}
+		for (j = 0; j < nleft; j++)
+			combine_windowaggregate(winstate, perfuncstate, peraggstate,
+									tmpcontext,
+									&value, &isnull, &noTransValue,
+									peraggstate->segtree[leftnodes[j]],
+									peraggstate->segtreenulls[leftnodes[j]]);
+		for (j = nright - 1; j >= 0; j--)
+			combine_windowaggregate(winstate, perfuncstate, peraggstate,
+									tmpcontext,
+									&value, &isnull, &noTransValue,
+									peraggstate->segtree[rightnodes[j]],
+									peraggstate->segtreenulls[rightnodes[j]]);
+
+		peraggstate->transValue = value;
+		peraggstate->transValueIsNull = isnull;
+		finalize_windowaggregate(winstate, perfuncstate, peraggstate,
+								 &econtext->ecxt_aggvalues[wfuncno],
+								 &econtext->ecxt_aggnulls[wfuncno]);
+
+		/* finalize_windowaggregate copied the result out of tmpcontext */
+		ResetExprContext(winstate->tmpcontext);
+	}
+
+	return numaggs_segtree;
+}
+
 /*
  * eval_windowaggregates
  * evaluate plain aggregates being used as window functions
@@ -630,6 +982,7 @@ eval_windowaggregates(WindowAggState *winstate)
 	int			wfuncno,
 				numaggs,
 				numaggs_restart,
+				numaggs_segtree,
 				i;
 	int64		aggregatedupto_nonrestarted;
 	MemoryContext oldContext;
@@ -686,6 +1039,13 @@ eval_windowaggregates(WindowAggState *winstate)
 	 * 'aggregatedupto' keeps track of the first row that has not yet been
 	 * accumulated into the aggregate transition values.  Whenever we start a
 	 * new peer group, we accumulate forward to the end of the peer group.
+	 *
+	 * Restarting costs time proportional to the frame length for every row,
+	 * which is quadratic for long sliding frames.  So aggregates without an
+	 * inverse transition function but with a combine function instead get a
+	 * segment tree of partial transition values, built once per partition,
+	 * from which any frame is answered by combining O(log n) nodes.  Those
+	 * aggregates are skipped by all the incremental logic below.
 	 */
 
 	/*
@@ -698,6 +1058,20 @@ eval_windowaggregates(WindowAggState *winstate)
 	if (winstate->frameheadpos < winstate->aggregatedbase)
 		elog(ERROR, "window frame head moved backward");
 
+	/*
+	 * Evaluate the aggregates that have a segment tree.  If that was all of
+	 * them, we need only keep the mark pointer pushed up to the frame head.
+	 */
+	if (winstate->currentpos == 0)
+		build_windowaggregate_segtrees(winstate);
+	numaggs_segtree = eval_windowaggregates_segtree(winstate);
+	if (numaggs_segtree == numaggs)
+	{
+		if (agg_winobj->markptr >= 0)
+			WinSetMarkPosition(agg_winobj, winstate->frameheadpos);
+		return;
+	}
+
 	/*
 	 * If the frame didn't change compared to the previous row, we can re-use
 	 * the result values that were previously saved at the bottom of this
@@ -718,6 +1092,8 @@ eval_windowaggregates(WindowAggState *winstate)
 		for (i = 0; i < numaggs; i++)
 		{
 			peraggstate = &winstate->peragg[i];
+			if (peraggstate->segtree != NULL)
+				continue;
 			wfuncno = peraggstate->wfuncno;
 			econtext->ecxt_aggvalues[wfuncno] = peraggstate->resultValue;
 			econtext->ecxt_aggnulls[wfuncno] = peraggstate->resultValueIsNull;
@@ -743,6 +1119,11 @@ eval_windowaggregates(WindowAggState *winstate)
 	for (i = 0; i < numaggs; i++)
 	{
 		peraggstate = &winstate->peragg[i];
+		if (peraggstate->segtree != NULL)
+		{
+			peraggstate->restart = false;
+			continue;
+		}
 		if (winstate->currentpos == 0 ||
 			(winstate->aggregatedbase != winstate->frameheadpos &&
 			 !OidIsValid(peraggstate->invtransfn_oid)) ||
@@ -762,7 +1143,7 @@ eval_windowaggregates(WindowAggState *winstate)
 	 * i.e. advance_windowaggregate_base() can return false, in which case
 	 * we'll restart that aggregate below.
 	 */
-	while (numaggs_restart < numaggs &&
+	while (numaggs_restart < numaggs - numaggs_segtree &&
 		   winstate->aggregatedbase < winstate->frameheadpos)
 	{
 		/*
@@ -785,7 +1166,7 @@ eval_windowaggregates(WindowAggState *winstate)
 			bool		ok;
 
 			peraggstate = &winstate->peragg[i];
-			if (peraggstate->restart)
+			if (peraggstate->restart || peraggstate->segtree != NULL)
 				continue;
 
 			wfuncno = peraggstate->wfuncno;
@@ -837,6 +1218,8 @@ eval_windowaggregates(WindowAggState *winstate)
 	for (i = 0; i < numaggs; i++)
 	{
 		peraggstate = &winstate->peragg[i];
+		if (peraggstate->segtree != NULL)
+			continue;
 
 		/* Aggregates using the shared ctx must restart if *any* agg does */
 		Assert(peraggstate->aggcontext != winstate->aggcontext ||
@@ -905,6 +1288,8 @@ eval_windowaggregates(WindowAggState *winstate)
 		for (i = 0; i < numaggs; i++)
 		{
 			peraggstate = &winstate->peragg[i];
+			if (peraggstate->segtree != NULL)
+				continue;
 
 			/* Non-restarted aggs skip until aggregatedupto_nonrestarted */
 			if (!peraggstate->restart &&
@@ -937,6 +1322,8 @@ eval_windowaggregates(WindowAggState *winstate)
 		bool	   *isnull;
 
 		peraggstate = &winstate->peragg[i];
+		if (peraggstate->segtree != NULL)
+			continue;
 		wfuncno = peraggstate->wfuncno;
 		result = &econtext->ecxt_aggvalues[wfuncno];
 		isnull = &econtext->ecxt_aggnulls[wfuncno];
@@ -982,8 +1369,9 @@ static void
 eval_windowfunction(WindowAggState *winstate, WindowStatePerFunc perfuncstate,
 					Datum *result, bool *isnull)
 {
-	FunctionCallInfoData fcinfo;
+	LOCAL_FCINFO(fcinfo, FUNC_MAX_ARGS);
 	MemoryContext oldContext;
+	int			argno;
 
 	oldContext = MemoryContextSwitchTo(winstate->ss.ps.ps_ExprContext->ecxt_per_tuple_memory);
 
@@ -993,24 +1381,25 @@ eval_windowfunction(WindowAggState *winstate, WindowStatePerFunc perfuncstate,
 	 * implementations to support varying numbers of arguments.  The real info
 	 * goes through the WindowObject, which is passed via fcinfo->context.
 	 */
-	InitFunctionCallInfoData(fcinfo, &(perfuncstate->flinfo),
+	InitFunctionCallInfoData(*fcinfo, &(perfuncstate->flinfo),
 							 perfuncstate->numArguments,
 							 perfuncstate->winCollation,
 							 (void *) perfuncstate->winobj, NULL);
 	/* Just in case, make all the regular argument slots be null */
-	memset(fcinfo.argnull, true, perfuncstate->numArguments);
+	for (argno = 0; argno < perfuncstate->numArguments; argno++)
+		fcinfo->args[argno].isnull = true;
 	/* Window functions don't have a current aggregate context, either */
 	winstate->curaggcontext = NULL;
 
-	*result = FunctionCallInvoke(&fcinfo);
-	*isnull = fcinfo.isnull;
+	*result = FunctionCallInvoke(fcinfo);
+	*isnull = fcinfo->isnull;
 
 	/*
 	 * Make sure pass-by-ref data is allocated in the appropriate context. (We
 	 * need this in case the function returns a pointer into some short-lived
 	 * tuple, as is entirely possible.)
 	 */
-	if (!perfuncstate->resulttypeByVal && !fcinfo.isnull &&
+	if (!perfuncstate->resulttypeByVal && !fcinfo->isnull &&
 		!MemoryContextContains(CurrentMemoryContext,
 							   DatumGetPointer(*result)))
 		*result = datumCopy(*result,
@@ -1225,6 +1614,8 @@ release_partition(WindowAggState *winstate)
 	{
 		if (winstate->peragg[i].aggcontext != winstate->aggcontext)
 			MemoryContextResetAndDeleteChildren(winstate->peragg[i].aggcontext);
+		winstate->peragg[i].segtree = NULL;
+		winstate->peragg[i].segtreenulls = NULL;
 	}
 
 	if (winstate->buffer)
@@ -1890,6 +2281,12 @@ ExecInitWindowAgg(WindowAgg *node, EState *estate, int eflags)
 	winstate->perfunc = perfunc;
 	winstate->peragg = peragg;
 
+	/*
+	 * copy frame options to state node for easy access; initialize_peragg
+	 * needs them already
+	 */
+	winstate->frameOptions = node->frameOptions;
+
 	wfuncno = -1;
 	aggno = -1;
 	foreach(l, winstate->funcs)
@@ -1990,9 +2387,6 @@ ExecInitWindowAgg(WindowAgg *node, EState *estate, int eflags)
 		winstate->agg_winobj = agg_winobj;
 	}
 
-	/* copy frame options to state node for easy access */
-	winstate->frameOptions = node->frameOptions;
-
 	/* initialize frame bound offset expressions */
 	winstate->startOffset = ExecInitExpr((Expr *) node->startOffset,
 										 (PlanState *) winstate);
@@ -2083,6 +2477,20 @@ ExecReScanWindowAgg(WindowAggState *node)
 		ExecReScan(outerPlan);
 }
 
+/*
+ * window_float_transtype
+ * is this a floating-point transition type, or an array of one?
+ */
+static bool
+window_float_transtype(Oid transtype)
+{
+	Oid			elemtype = get_element_type(transtype);
+
+	if (OidIsValid(elemtype))
+		transtype = elemtype;
+	return transtype == FLOAT4OID || transtype == FLOAT8OID;
+}
+
 /*
  * initialize_peragg
  *
@@ -2101,11 +2509,13 @@ initialize_peragg(WindowAggState *winstate, WindowFunc *wfunc,
 	AclResult	aclresult;
 	Oid			transfn_oid,
 				invtransfn_oid,
-				finalfn_oid;
+				finalfn_oid,
+				combinefn_oid;
 	bool		finalextra;
 	Expr	   *transfnexpr,
 			   *invtransfnexpr,
-			   *finalfnexpr;
+			   *finalfnexpr,
+			   *combinefnexpr;
 	Datum		textInitVal;
 	int			i;
 	ListCell   *lc;
@@ -2155,6 +2565,28 @@ initialize_peragg(WindowAggState *winstate, WindowFunc *wfunc,
 		initvalAttNo = Anum_pg_aggregate_agginitval;
 	}
 
+	/*
+	 * Lacking an inverse transition function, an aggregate over a moving
+	 * frame would have to restart for every row.  If it has a combine
+	 * function we can instead answer frames from a segment tree of partial
+	 * states, subject to the same volatility restriction as above.  We don't
+	 * try this for INTERNAL transition states, whose contents we can't copy.
+	 * Nor for float transition states: the tree groups the additions
+	 * differently from a plain left-to-right pass, and float addition isn't
+	 * associative, so sum() or avg() over float8 could come out differently
+	 * depending on which path a frame took.
+	 */
+	if (!OidIsValid(invtransfn_oid) &&
+		OidIsValid(aggform->aggcombinefn) &&
+		aggform->aggtranstype != INTERNALOID &&
+		!window_float_transtype(aggform->aggtranstype) &&
+		!(winstate->frameOptions & FRAMEOPTION_START_UNBOUNDED_PRECEDING) &&
+		!contain_volatile_functions((Node *) wfunc))
+		peraggstate->combinefn_oid = combinefn_oid = aggform->aggcombinefn;
+	else
+		peraggstate->combinefn_oid = combinefn_oid = InvalidOid;
+	peraggstate->segtree_ok = OidIsValid(combinefn_oid);
+
 	/*
 	 * ExecInitWindowAgg already checked permission to call aggregate function
 	 * ... but we still need to check the component functions
@@ -2199,6 +2631,16 @@ initialize_peragg(WindowAggState *winstate, WindowFunc *wfunc,
 							   get_func_name(finalfn_oid));
 			InvokeFunctionExecuteHook(finalfn_oid);
 		}
+
+		if (OidIsValid(combinefn_oid))
+		{
+			aclresult = pg_proc_aclcheck(combinefn_oid, aggOwner,
+										 ACL_EXECUTE);
+			if (aclresult != ACLCHECK_OK)
+				aclcheck_error(aclresult, ACL_KIND_PROC,
+							   get_func_name(combinefn_oid));
+			InvokeFunctionExecuteHook(combinefn_oid);
+		}
 	}
 
 	/* Detect how many arguments to pass to the finalfn */
@@ -2248,6 +2690,16 @@ initialize_peragg(WindowAggState *winstate, WindowFunc *wfunc,
 		fmgr_info_set_expr((Node *) finalfnexpr, &peraggstate->finalfn);
 	}
 
+	if (OidIsValid(combinefn_oid))
+	{
+		build_aggregate_combinefn_expr(aggtranstype,
+									   wfunc->inputcollid,
+									   combinefn_oid,
+									   &combinefnexpr);
+		fmgr_info(combinefn_oid, &peraggstate->combinefn);
+		fmgr_info_set_expr((Node *) combinefnexpr, &peraggstate->combinefn);
+	}
+
 	/* get info about relevant datatypes */
 	get_typlenbyval(wfunc->wintype,
 					&peraggstate->resulttypeLen,
@@ -2255,6 +2707,7 @@ initialize_peragg(WindowAggState *winstate, WindowFunc *wfunc,
 	get_typlenbyval(aggtranstype,
 					&peraggstate->transtypeLen,
 					&peraggstate->transtypeByVal);
+	peraggstate->transtypeWidth = get_typavgwidth(aggtranstype, -1);
 
 	/*
 	 * initval is potentially null, so don't try to access it as a struct
@@ -2313,8 +2766,11 @@ initialize_peragg(WindowAggState *winstate, WindowFunc *wfunc,
 	 * make the memory allocation rules for moving aggregates different than
 	 * they have historically been for plain aggregates, but that seems grotty
 	 * and likely to lead to memory leaks.
+	 *
+	 * Aggregates that may use a segment tree need their own context too, to
+	 * keep the tree for the whole partition.
 	 */
-	if (OidIsValid(invtransfn_oid))
+	if (OidIsValid(invtransfn_oid) || peraggstate->segtree_ok)
 		peraggstate->aggcontext =
 			AllocSetContextCreate(CurrentMemoryContext,
 								  "WindowAgg Per Aggregate",
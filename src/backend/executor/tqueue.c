@@ -15,13 +15,15 @@
  * A DestReceiver of type DestTupleQueue, which is a TQueueDestReceiver
  * under the hood, writes tuples from the executor to a shm_mq.  If
  * necessary, it also writes control messages describing transient
- * record types used within the tuple.
+ * record types used within the tuple.  To keep the per-message overhead
+ * of shm_mq and the latch traffic it causes down, tuples are not sent one
+ * per message, but accumulated locally and sent in batches.
  *
- * A TupleQueueReader reads tuples, and control messages if any are sent,
- * from a shm_mq and returns the tuples.  If transient record types are
- * in use, it registers those types locally based on the control messages
- * and rewrites the typmods sent by the remote side to the corresponding
- * local record typmods.
+ * A TupleQueueReader reads batches of tuples, and control messages if any
+ * are sent, from a shm_mq and returns the tuples one at a time.  If
+ * transient record types are in use, it registers those types locally based
+ * on the control messages and rewrites the typmods sent by the remote side
+ * to the corresponding local record typmods.
  *
  * Portions Copyright (c) 1996-2016, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
@@ -52,14 +54,33 @@
  * The data transferred through the shm_mq is divided into messages.
  * One-byte messages are mode-switch messages, telling the receiver to switch
  * between "control" and "data" modes.  (We always start up in "data" mode.)
- * Otherwise, when in "data" mode, each message is a tuple.  When in "control"
- * mode, each message defines one transient-typmod-to-tupledesc mapping to
- * let us interpret future tuples.  Both of those cases certainly require
- * more than one byte, so no confusion is possible.
+ * Otherwise, when in "data" mode, each message is a batch of one or more
+ * tuples.  When in "control" mode, each message defines one
+ * transient-typmod-to-tupledesc mapping to let us interpret future tuples.
+ * Both of those cases certainly require more than one byte, so no confusion
+ * is possible.
+ *
+ * Within a batch, each tuple is preceded by a TupleQueueItemHeader giving its
+ * length, and both the header and the tuple data are padded to a MAXALIGN
+ * boundary, so that the receiver can work with the tuples in place.
  */
 #define TUPLE_QUEUE_MODE_CONTROL	'c' /* mode-switch message contents */
 #define TUPLE_QUEUE_MODE_DATA		'd'
 
+typedef struct TupleQueueItemHeader
+{
+	uint32		t_len;			/* length of the tuple data that follows */
+} TupleQueueItemHeader;
+
+#define TUPLE_QUEUE_ITEM_HDRSZ	MAXALIGN(sizeof(TupleQueueItemHeader))
+
+/*
+ * The sender sends a batch once it holds at least this many bytes.  This is
+ * kept well below the size of the queue, so that a worker can go on filling
+ * its next batch while the leader is still reading the previous one.
+ */
+#define TUPLE_QUEUE_BATCH_SIZE		8192
+
 /*
  * Both the sender and receiver build trees of TupleRemapInfo nodes to help
  * them identify which (sub) fields of transmitted tuples are composite and
@@ -145,6 +166,7 @@ typedef struct TQueueDestReceiver
 	char		mode;			/* current message mode */
 	TupleDesc	tupledesc;		/* current top-level tuple descriptor */
 	TupleRemapInfo **field_remapinfo;	/* current top-level remap info */
+	StringInfoData batch;		/* tuples not yet sent */
 } TQueueDestReceiver;
 
 /*
@@ -173,9 +195,12 @@ struct TupleQueueReader
 	char		mode;			/* current message mode */
 	TupleDesc	tupledesc;		/* current top-level tuple descriptor */
 	TupleRemapInfo **field_remapinfo;	/* current top-level remap info */
+	char	   *batch;			/* next tuple in current data message */
+	Size		batch_remaining;	/* bytes left in current data message */
 };
 
 /* Local function prototypes */
+static shm_mq_result TQFlushBatch(TQueueDestReceiver *tqueue);
 static void TQExamine(TQueueDestReceiver *tqueue,
 		  TupleRemapInfo *remapinfo,
 		  Datum value);
@@ -192,8 +217,7 @@ static void TQSendRecordInfo(TQueueDestReceiver *tqueue, int32 typmod,
 				 TupleDesc tupledesc);
 static void TupleQueueHandleControlMessage(TupleQueueReader *reader,
 							   Size nbytes, char *data);
-static HeapTuple TupleQueueHandleDataMessage(TupleQueueReader *reader,
-							Size nbytes, HeapTupleHeader data);
+static HeapTuple TupleQueueHandleDataMessage(TupleQueueReader *reader);
 static HeapTuple TQRemapTuple(TupleQueueReader *reader,
 			 TupleDesc tupledesc,
 			 TupleRemapInfo **field_remapinfo,
@@ -226,7 +250,9 @@ tqueueReceiveSlot(TupleTableSlot *slot, DestReceiver *self)
 	TQueueDestReceiver *tqueue = (TQueueDestReceiver *) self;
 	TupleDesc	tupledesc = slot->tts_tupleDescriptor;
 	HeapTuple	tuple;
-	shm_mq_result result;
+	StringInfo	batch = &tqueue->batch;
+	TupleQueueItemHeader *hdr;
+	shm_mq_result result = SHM_MQ_SUCCESS;
 
 	/*
 	 * If first time through, compute remapping info for the top-level fields.
@@ -304,9 +330,23 @@ tqueueReceiveSlot(TupleTableSlot *slot, DestReceiver *self)
 		}
 	}
 
-	/* Send the tuple itself. */
-	tuple = ExecMaterializeSlot(slot);
-	result = shm_mq_send(tqueue->queue, tuple->t_len, tuple->t_data, false);
+	/*
+	 * Add the tuple to the current batch.  We only read the tuple, so there's
+	 * no need to materialize a local copy of it in the slot first.
+	 */
+	tuple = ExecFetchSlotTuple(slot);
+	enlargeStringInfo(batch,
+					  TUPLE_QUEUE_ITEM_HDRSZ + MAXALIGN(tuple->t_len));
+	hdr = (TupleQueueItemHeader *) (batch->data + batch->len);
+	MemSet(hdr, 0, TUPLE_QUEUE_ITEM_HDRSZ);
+	hdr->t_len = tuple->t_len;
+	batch->len += TUPLE_QUEUE_ITEM_HDRSZ;
+	memcpy(batch->data + batch->len, tuple->t_data, tuple->t_len);
+	batch->len += MAXALIGN(tuple->t_len);
+
+	/* Send the batch, if it's big enough. */
+	if (batch->len >= TUPLE_QUEUE_BATCH_SIZE)
+		result = TQFlushBatch(tqueue);
 
 	/* Check for failure. */
 	if (result == SHM_MQ_DETACHED)
@@ -319,6 +359,25 @@ tqueueReceiveSlot(TupleTableSlot *slot, DestReceiver *self)
 	return true;
 }
 
+/*
+ * Send the tuples accumulated so far, if any, as one message.
+ */
+static shm_mq_result
+TQFlushBatch(TQueueDestReceiver *tqueue)
+{
+	shm_mq_result result;
+
+	if (tqueue->batch.len == 0)
+		return SHM_MQ_SUCCESS;
+
+	Assert(tqueue->mode == TUPLE_QUEUE_MODE_DATA);
+	result = shm_mq_send(tqueue->queue, tqueue->batch.len, tqueue->batch.data,
+						 false);
+	resetStringInfo(&tqueue->batch);
+
+	return result;
+}
+
 /*
  * Examine the given datum and send any necessary control messages for
  * transient record types contained in it.
@@ -537,9 +596,14 @@ TQSendRecordInfo(TQueueDestReceiver *tqueue, int32 typmod, TupleDesc tupledesc)
 
 	elog(DEBUG3, "sending tqueue control message for record typmod %d", typmod);
 
-	/* If message queue is in data mode, switch to control mode. */
+	/*
+	 * If message queue is in data mode, switch to control mode.  Any tuples
+	 * we're holding on to must go out first, as they'd be taken for control
+	 * messages otherwise.
+	 */
 	if (tqueue->mode != TUPLE_QUEUE_MODE_CONTROL)
 	{
+		(void) TQFlushBatch(tqueue);
 		tqueue->mode = TUPLE_QUEUE_MODE_CONTROL;
 		shm_mq_send(tqueue->queue, sizeof(char), &tqueue->mode, false);
 	}
@@ -578,6 +642,9 @@ tqueueShutdownReceiver(DestReceiver *self)
 {
 	TQueueDestReceiver *tqueue = (TQueueDestReceiver *) self;
 
+	/* Send any remaining tuples; it's OK if the receiver has gone away. */
+	(void) TQFlushBatch(tqueue);
+
 	shm_mq_detach(shm_mq_get_queue(tqueue->queue));
 }
 
@@ -596,6 +663,7 @@ tqueueDestroyReceiver(DestReceiver *self)
 	/* Is it worth trying to free substructure of the remap tree? */
 	if (tqueue->field_remapinfo != NULL)
 		pfree(tqueue->field_remapinfo);
+	pfree(tqueue->batch.data);
 	pfree(self);
 }
 
@@ -622,6 +690,8 @@ CreateTupleQueueDestReceiver(shm_mq_handle *handle)
 	/* Top-level tupledesc is not known yet */
 	self->tupledesc = NULL;
 	self->field_remapinfo = NULL;
+	initStringInfo(&self->batch);
+	enlargeStringInfo(&self->batch, TUPLE_QUEUE_BATCH_SIZE);
 
 	return (DestReceiver *) self;
 }
@@ -640,6 +710,8 @@ CreateTupleQueueReader(shm_mq_handle *handle, TupleDesc tupledesc)
 	reader->mode = TUPLE_QUEUE_MODE_DATA;
 	reader->tupledesc = tupledesc;
 	reader->field_remapinfo = BuildFieldRemapInfo(tupledesc, reader->mycontext);
+	reader->batch = NULL;
+	reader->batch_remaining = 0;
 
 	return reader;
 }
@@ -674,6 +746,10 @@ DestroyTupleQueueReader(TupleQueueReader *reader)
  * Even when shm_mq_receive() returns SHM_MQ_WOULD_BLOCK, this can still
  * accumulate bytes from a partially-read message, so it's useful to call
  * this with nowait = true even if nothing is returned.
+ *
+ * Tuples are returned from the current batch until it is used up, without
+ * going back to the shm_mq.  The batch stays valid until the next
+ * shm_mq_receive() call, which we don't make until then.
  */
 HeapTuple
 TupleQueueReaderNext(TupleQueueReader *reader, bool nowait, bool *done)
@@ -683,6 +759,10 @@ TupleQueueReaderNext(TupleQueueReader *reader, bool nowait, bool *done)
 	if (done != NULL)
 		*done = false;
 
+	/* Return the next tuple of the current batch, if there is one. */
+	if (reader->batch_remaining > 0)
+		return TupleQueueHandleDataMessage(reader);
+
 	for (;;)
 	{
 		Size		nbytes;
@@ -714,8 +794,10 @@ TupleQueueReaderNext(TupleQueueReader *reader, bool nowait, bool *done)
 		}
 		else if (reader->mode == TUPLE_QUEUE_MODE_DATA)
 		{
-			/* Tuple data. */
-			return TupleQueueHandleDataMessage(reader, nbytes, data);
+			/* A batch of tuples; return the first one. */
+			reader->batch = data;
+			reader->batch_remaining = nbytes;
+			return TupleQueueHandleDataMessage(reader);
 		}
 		else if (reader->mode == TUPLE_QUEUE_MODE_CONTROL)
 		{
@@ -728,14 +810,18 @@ TupleQueueReaderNext(TupleQueueReader *reader, bool nowait, bool *done)
 }
 
 /*
- * Handle a data message - that is, a tuple - from the remote side.
+ * Handle the next tuple of a data message from the remote side.
  */
 static HeapTuple
-TupleQueueHandleDataMessage(TupleQueueReader *reader,
-							Size nbytes,
-							HeapTupleHeader data)
+TupleQueueHandleDataMessage(TupleQueueReader *reader)
 {
+	TupleQueueItemHeader *hdr = (TupleQueueItemHeader *) reader->batch;
 	HeapTupleData htup;
+	Size		itemsz;
+
+	itemsz = TUPLE_QUEUE_ITEM_HDRSZ + MAXALIGN(hdr->t_len);
+	if (itemsz > reader->batch_remaining)
+		elog(ERROR, "invalid tuple queue message");
 
 	/*
 	 * Set up a dummy HeapTupleData pointing to the data from the shm_mq
@@ -743,8 +829,12 @@ TupleQueueHandleDataMessage(TupleQueueReader *reader,
 	 */
 	ItemPointerSetInvalid(&htup.t_self);
 	htup.t_tableOid = InvalidOid;
-	htup.t_len = nbytes;
-	htup.t_data = data;
+	htup.t_len = hdr->t_len;
+	htup.t_data = (HeapTupleHeader) (reader->batch + TUPLE_QUEUE_ITEM_HDRSZ);
+
+	/* Advance to the next tuple of the batch. */
+	reader->batch += itemsz;
+	reader->batch_remaining -= itemsz;
 
 	/*
 	 * Either just copy the data into a regular palloc'd tuple, or remap it,
@@ -0,0 +1,220 @@
+/*-------------------------------------------------------------------------
+ *
+ * bloomfilter.c
+ *		Space-efficient set membership testing
+ *
+ * A Bloom filter is a probabilistic data structure that is used to test an
+ * element's membership of a set.  False positives are possible, but false
+ * negatives are not; a test of membership of the set returns either "possibly
+ * in set" or "definitely not in set".  This is typically very space efficient,
+ * which can be a decisive advantage.
+ *
+ * Elements are added to the filter as 32-bit hash values, which the caller
+ * must already have computed with a hash function of reasonable quality.  The
+ * k bit positions for an element are derived from its hash value by double
+ * hashing (Kirsch and Mitzenmacher, "Less Hashing, Same Performance: Building
+ * a Better Bloom Filter"): the hash value itself supplies the first position,
+ * and a second, independent hash of it (mixed with a seed) supplies the step
+ * between successive positions.
+ *
+ * The size of the bitset is always a power of two, chosen so that there are
+ * at least 8 bits per expected element (subject to the caller's memory
+ * budget), and the number of hash functions, up to 8, is then chosen to
+ * minimize the false positive rate.  A filter sized for n elements that is given many more
+ * than n quickly degrades; callers can use bloom_prop_bits_set() to notice
+ * that.
+ *
+ * Portions Copyright (c) 2016, PostgreSQL Global Development Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/lib/bloomfilter.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <math.h>
+
+#include "access/hash.h"
+#include "lib/bloomfilter.h"
+
+#define MIN_BITSET_BITS		((uint64) 8192)	/* 1kB */
+#define MAX_HASH_FUNCS		8
+
+struct bloom_filter
+{
+	/* K hash functions are used, derived from the element's hash value */
+	int			k_hash_funcs;
+	uint32		seed;
+	/* m is bitset size, in bits.  Must be a power of two <= 2^32. */
+	uint64		m;
+	unsigned char bitset[FLEXIBLE_ARRAY_MEMBER];
+};
+
+static int	my_bloom_power(uint64 n, bool round_up);
+static int	optimal_k(uint64 bitset_bits, int64 total_elems);
+
+/*
+ * Create Bloom filter in caller's memory context.  We aim for a false positive
+ * rate of at most 2% when bitset size is not constrained by memory
+ * availability.
+ *
+ * total_elems is an estimate of the final size of the set.  It should be
+ * approximately correct, but the implementation can cope well with it being
+ * off by a factor of two or so.
+ *
+ * bloom_work_mem is sized in KB, in line with the general work_mem convention.
+ * The filter never uses less than 1kB, however.
+ *
+ * The seed is mixed into the second of the two hash values each element's
+ * bit positions are derived from; callers that don't care can pass 0.
+ */
+bloom_filter *
+bloom_create(int64 total_elems, int bloom_work_mem, uint32 seed)
+{
+	bloom_filter *filter;
+	uint64		target_bits;
+	uint64		max_bits;
+	uint64		bitset_bits;
+
+	/* At least 8 bits per element, rounded up to a power of two */
+	target_bits = Max(MIN_BITSET_BITS, (uint64) Max(total_elems, 1) * 8);
+	target_bits = UINT64CONST(1) << my_bloom_power(target_bits - 1, true);
+
+	/* ... but no more than the budget allows, rounded down */
+	max_bits = Min((uint64) bloom_work_mem * 1024 * BITS_PER_BYTE,
+				   (uint64) PG_UINT32_MAX + 1);
+	max_bits = Max(MIN_BITSET_BITS, max_bits);
+	max_bits = UINT64CONST(1) << my_bloom_power(max_bits, false);
+
+	bitset_bits = Min(target_bits, max_bits);
+
+	filter = palloc0(offsetof(bloom_filter, bitset) +
+					 sizeof(unsigned char) * bitset_bits / BITS_PER_BYTE);
+	filter->k_hash_funcs = optimal_k(bitset_bits, total_elems);
+	filter->seed = seed;
+	filter->m = bitset_bits;
+
+	return filter;
+}
+
+/*
+ * Free Bloom filter
+ */
+void
+bloom_free(bloom_filter *filter)
+{
+	pfree(filter);
+}
+
+/*
+ * Add element to Bloom filter
+ */
+void
+bloom_add_hash(bloom_filter *filter, uint32 hash)
+{
+	uint32		mask = (uint32) (filter->m - 1);
+	uint32		x = hash;
+	uint32		step = DatumGetUInt32(hash_uint32(hash ^ filter->seed)) | 1;
+	int			i;
+
+	for (i = 0; i < filter->k_hash_funcs; i++)
+	{
+		uint32		pos = x & mask;
+
+		filter->bitset[pos >> 3] |= 1 << (pos & 7);
+		x += step;
+	}
+}
+
+/*
+ * Test if Bloom filter definitely lacks element.
+ *
+ * Returns true if the element is definitely not in the set of elements
+ * observed by bloom_add_hash().  Otherwise, returns false, indicating that
+ * element is probably present in set.
+ */
+bool
+bloom_lacks_hash(bloom_filter *filter, uint32 hash)
+{
+	uint32		mask = (uint32) (filter->m - 1);
+	uint32		x = hash;
+	uint32		step = DatumGetUInt32(hash_uint32(hash ^ filter->seed)) | 1;
+	int			i;
+
+	for (i = 0; i < filter->k_hash_funcs; i++)
+	{
+		uint32		pos = x & mask;
+
+		if (!(filter->bitset[pos >> 3] & (1 << (pos & 7))))
+			return true;
+		x += step;
+	}
+
+	return false;
+}
+
+/*
+ * What proportion of bits are currently set?
+ *
+ * Returns proportion, expressed as a multiplier of filter size.  That should
+ * generally be close to 0.5, even when we have more than enough memory to
+ * ensure a false positive rate within target 1% to 2% band, since more hash
+ * functions are used as more memory is available per element.
+ *
+ * This is the only instrumentation that is low overhead enough to appear in
+ * debug traces.  When debugging Bloom filter code, it's likely to be far more
+ * interesting to directly test the false positive rate.
+ */
+double
+bloom_prop_bits_set(bloom_filter *filter)
+{
+	uint64		bitset_bytes = filter->m / BITS_PER_BYTE;
+	uint64		bits_set = 0;
+	uint64		i;
+
+	for (i = 0; i < bitset_bytes; i++)
+	{
+		unsigned char byte = filter->bitset[i];
+
+		while (byte)
+		{
+			bits_set++;
+			byte &= (byte - 1);
+		}
+	}
+
+	return bits_set / (double) filter->m;
+}
+
+/*
+ * Find the power of two nearest to n: the largest one <= n, or if round_up
+ * the smallest one > n.  n must be greater than zero.
+ */
+static int
+my_bloom_power(uint64 n, bool round_up)
+{
+	int			bloom_power = -1;
+
+	Assert(n > 0);
+	while (n > 0)
+	{
+		bloom_power++;
+		n >>= 1;
+	}
+
+	return round_up ? bloom_power + 1 : bloom_power;
+}
+
+/*
+ * Determine optimal number of hash functions based on size of filter in bits,
+ * and projected total number of elements.  The optimal number is the number
+ * that minimizes the false positive rate.
+ */
+static int
+optimal_k(uint64 bitset_bits, int64 total_elems)
+{
+	int			k = rint(log(2.0) * bitset_bits / Max(total_elems, 1));
+
+	return Max(1, Min(k, MAX_HASH_FUNCS));
+}
@@ -16,8 +16,15 @@
  * BLCKSZ, we can represent all pages in 64Gb of disk space in about 1Mb
  * of memory.  People pushing around tables of that size should have a
  * couple of Mb to spare, so we don't worry about providing a second level
- * of lossiness.  In theory we could fall back to page ranges at some
- * point, but for now that seems useless complexity.
+ * of lossiness.
+ *
+ * Callers that know up front that a whole run of consecutive pages must be
+ * visited (summarizing index AMs such as BRIN and Hippo) can instead add it
+ * with tbm_add_page_range, which stores just the first and last page of the
+ * run.  Such ranges are kept in a sorted array of disjoint, non-adjacent
+ * intervals beside the hashtable, and are merged with the chunks and exact
+ * pages in block order during iteration.  A page inside a range is lossy no
+ * matter what the hashtable says about it.
  *
  * We also support the notion of candidate matches, or rechecking.  This
  * means we know that a search need visit only some tuples on a page,
@@ -28,6 +35,12 @@
  * into a bitmap, and it can also happen internally when we AND a lossy
  * and a non-lossy page.
  *
+ * For parallel bitmap scans there is also a "shared" flavor, which lives in
+ * a caller-supplied chunk of dynamic shared memory and is always lossy: it
+ * is a flat array of one bit per heap page, sized for the relation when the
+ * scan starts, that any number of backends can set bits in concurrently and
+ * then hand out to each other a word at a time while iterating.
+ *
  *
  * Copyright (c) 2003-2016, PostgreSQL Global Development Group
  *
@@ -43,6 +56,8 @@
 #include "access/htup_details.h"
 #include "nodes/bitmapset.h"
 #include "nodes/tidbitmap.h"
+#include "port/atomics.h"
+#include "storage/shmem.h"
 #include "utils/hsearch.h"
 
 /*
@@ -117,9 +132,36 @@ typedef enum
 {
 	TBM_EMPTY,					/* no hashtable, nentries == 0 */
 	TBM_ONE_PAGE,				/* entry1 contains the single entry */
-	TBM_HASH					/* pagetable is valid, entry1 is not */
+	TBM_HASH,					/* pagetable is valid, entry1 is not */
+	TBM_SHARED					/* shared is valid, nothing else is */
 } TBMStatus;
 
+/*
+ * Layout of a shared bitmap in dynamic shared memory.  Bit N of words[N / 32]
+ * is set if heap page N must be visited; pages at or beyond nblocks are
+ * silently ignored, since the heap scan would ignore them anyway.  nextword
+ * is the next word to be claimed by a participant during iteration.
+ */
+#define TBM_SHARED_BITS_PER_WORD	32
+#define TBM_SHARED_NWORDS(nblocks) \
+	(((nblocks) + TBM_SHARED_BITS_PER_WORD - 1) / TBM_SHARED_BITS_PER_WORD)
+
+typedef struct TBMSharedData
+{
+	BlockNumber nblocks;		/* number of heap pages covered */
+	pg_atomic_uint32 nextword;	/* next word to hand out while iterating */
+	pg_atomic_uint32 words[FLEXIBLE_ARRAY_MEMBER];
+} TBMSharedData;
+
+/*
+ * A run of consecutive lossy pages, first and last inclusive.
+ */
+typedef struct TBMPageRange
+{
+	BlockNumber first;
+	BlockNumber last;
+} TBMPageRange;
+
 /*
  * Here is the representation for a whole TIDBitMap:
  */
@@ -134,7 +176,11 @@ struct TIDBitmap
 	int			npages;			/* number of exact entries in pagetable */
 	int			nchunks;		/* number of lossy entries in pagetable */
 	bool		iterating;		/* tbm_begin_iterate called? */
+	TBMPageRange *ranges;		/* sorted lossy page ranges, or NULL */
+	int			nranges;		/* number of entries in ranges[] */
+	int			maxranges;		/* allocated length of ranges[] */
 	PagetableEntry entry1;		/* used when status == TBM_ONE_PAGE */
+	TBMSharedData *shared;		/* used when status == TBM_SHARED */
 	/* these are valid when iterating is true: */
 	PagetableEntry **spages;	/* sorted exact-page list, or NULL */
 	PagetableEntry **schunks;	/* sorted lossy-chunk list, or NULL */
@@ -152,6 +198,10 @@ struct TBMIterator
 	int			spageptr;		/* next spages index */
 	int			schunkptr;		/* next schunks index */
 	int			schunkbit;		/* next bit to check in current schunk */
+	int			rangeptr;		/* next ranges index */
+	BlockNumber rangeblk;		/* next page to return from current range */
+	uint32		sharedword;		/* unreturned bits of claimed shared word */
+	BlockNumber sharedbase;		/* page number of bit 0 of sharedword */
 	TBMIterateResult output;	/* MUST BE LAST (because variable-size) */
 };
 
@@ -164,9 +214,16 @@ static const PagetableEntry *tbm_find_pageentry(const TIDBitmap *tbm,
 				   BlockNumber pageno);
 static PagetableEntry *tbm_get_pageentry(TIDBitmap *tbm, BlockNumber pageno);
 static bool tbm_page_is_lossy(const TIDBitmap *tbm, BlockNumber pageno);
+static bool tbm_range_contains(const TBMPageRange *ranges, int nranges,
+				   BlockNumber pageno);
+static void tbm_insert_range(TIDBitmap *tbm, BlockNumber first,
+				 BlockNumber last);
+static void tbm_intersect_ranges(TIDBitmap *a, const TIDBitmap *b);
 static void tbm_mark_page_lossy(TIDBitmap *tbm, BlockNumber pageno);
 static void tbm_lossify(TIDBitmap *tbm);
 static int	tbm_comparator(const void *left, const void *right);
+static void tbm_shared_set_page(TBMSharedData *shared, BlockNumber pageno);
+static TBMIterateResult *tbm_shared_iterate(TBMIterator *iterator);
 
 
 /*
@@ -249,12 +306,15 @@ tbm_create_pagetable(TIDBitmap *tbm)
 void
 tbm_free(TIDBitmap *tbm)
 {
+	/* a shared bitmap's storage belongs to whoever set up the DSM */
 	if (tbm->pagetable)
 		hash_destroy(tbm->pagetable);
 	if (tbm->spages)
 		pfree(tbm->spages);
 	if (tbm->schunks)
 		pfree(tbm->schunks);
+	if (tbm->ranges)
+		pfree(tbm->ranges);
 	pfree(tbm);
 }
 
@@ -273,6 +333,16 @@ tbm_add_tuples(TIDBitmap *tbm, const ItemPointer tids, int ntids,
 	int			i;
 
 	Assert(!tbm->iterating);
+
+	/* A shared bitmap only remembers pages; recheck is implied */
+	if (tbm->status == TBM_SHARED)
+	{
+		for (i = 0; i < ntids; i++)
+			tbm_shared_set_page(tbm->shared,
+								ItemPointerGetBlockNumber(tids + i));
+		return;
+	}
+
 	for (i = 0; i < ntids; i++)
 	{
 		BlockNumber blk = ItemPointerGetBlockNumber(tids + i);
@@ -333,6 +403,14 @@ tbm_add_tuples(TIDBitmap *tbm, const ItemPointer tids, int ntids,
 void
 tbm_add_page(TIDBitmap *tbm, BlockNumber pageno)
 {
+	if (tbm->status == TBM_SHARED)
+	{
+		tbm_shared_set_page(tbm->shared, pageno);
+		return;
+	}
+	/* Nothing to do if a range already covers it */
+	if (tbm_range_contains(tbm->ranges, tbm->nranges, pageno))
+		return;
 	/* Enter the page in the bitmap, or mark it lossy if already present */
 	tbm_mark_page_lossy(tbm, pageno);
 	/* If we went over the memory limit, lossify some more pages */
@@ -340,6 +418,53 @@ tbm_add_page(TIDBitmap *tbm, BlockNumber pageno)
 		tbm_lossify(tbm);
 }
 
+/*
+ * tbm_add_page_range - add the whole pages first .. last to a TIDBitmap
+ *
+ * Equivalent to calling tbm_add_page for each page of the range, but the
+ * range is stored as a single interval rather than page by page, so its cost
+ * does not depend on its length.  Ranges never count against the memory
+ * limit; each one takes only a few bytes.
+ */
+void
+tbm_add_page_range(TIDBitmap *tbm, BlockNumber first, BlockNumber last)
+{
+	Assert(!tbm->iterating);
+
+	if (first > last)
+		return;
+
+	if (tbm->status == TBM_SHARED)
+	{
+		TBMSharedData *shared = tbm->shared;
+		BlockNumber pageno = first;
+
+		if (first >= shared->nblocks)
+			return;
+		last = Min(last, shared->nblocks - 1);
+
+		/* set partial words bit by bit, whole words in one go */
+		while (pageno <= last)
+		{
+			if (pageno % TBM_SHARED_BITS_PER_WORD == 0 &&
+				last - pageno >= TBM_SHARED_BITS_PER_WORD - 1)
+			{
+				pg_atomic_uint32 *word;
+
+				word = &shared->words[pageno / TBM_SHARED_BITS_PER_WORD];
+				if (pg_atomic_read_u32(word) != PG_UINT32_MAX)
+					pg_atomic_fetch_or_u32(word, PG_UINT32_MAX);
+				pageno += TBM_SHARED_BITS_PER_WORD;
+			}
+			else
+				tbm_shared_set_page(shared, pageno++);
+		}
+		return;
+	}
+
+	tbm_insert_range(tbm, first, last);
+}
+
 /*
  * tbm_union - set union
  *
@@ -349,7 +474,17 @@ void
 tbm_union(TIDBitmap *a, const TIDBitmap *b)
 {
 	Assert(!a->iterating);
-	/* Nothing to do if b is empty */
+	if (a->status == TBM_SHARED || b->status == TBM_SHARED)
+		elog(ERROR, "cannot combine shared TID bitmaps");
+	/* Merge b's page ranges first; they take no memory budget */
+	if (b->nranges > 0)
+	{
+		int			i;
+
+		for (i = 0; i < b->nranges; i++)
+			tbm_insert_range(a, b->ranges[i].first, b->ranges[i].last);
+	}
+	/* Nothing more to do if b has no chunks or pages */
 	if (b->nentries == 0)
 		return;
 	/* Scan through chunks and pages in b, merge into a */
@@ -431,11 +566,17 @@ void
 tbm_intersect(TIDBitmap *a, const TIDBitmap *b)
 {
 	Assert(!a->iterating);
+	if (a->status == TBM_SHARED || b->status == TBM_SHARED)
+		elog(ERROR, "cannot combine shared TID bitmaps");
 	/* Nothing to do if a is empty */
-	if (a->nentries == 0)
+	if (a->nentries == 0 && a->nranges == 0)
 		return;
 	/* Scan through chunks and pages in a, try to match to b */
-	if (a->status == TBM_ONE_PAGE)
+	if (a->nentries == 0)
+	{
+		/* a has only page ranges, nothing to scan here */
+	}
+	else if (a->status == TBM_ONE_PAGE)
 	{
 		if (tbm_intersect_page(a, &a->entry1, b))
 		{
@@ -471,6 +612,9 @@ tbm_intersect(TIDBitmap *a, const TIDBitmap *b)
 			}
 		}
 	}
+	/* Now cut down a's page ranges to what b has of them */
+	if (a->nranges > 0)
+		tbm_intersect_ranges(a, b);
 }
 
 /*
@@ -556,13 +700,124 @@ tbm_intersect_page(TIDBitmap *a, PagetableEntry *apage, const TIDBitmap *b)
 	}
 }
 
+/*
+ * Intersect a's page ranges with b, after a's chunks and pages are done
+ *
+ * Where b has page ranges too, the result is simply the overlap of the two
+ * range lists.  Elsewhere within a's ranges, b's own chunks and pages are
+ * what survive: lossy pages stay lossy, and exact pages keep their tuples
+ * but must be rechecked, as when ANDing an exact page with a lossy one.
+ */
+static void
+tbm_intersect_ranges(TIDBitmap *a, const TIDBitmap *b)
+{
+	TBMPageRange *aranges = a->ranges;
+	int			naranges = a->nranges;
+	int			i,
+				j;
+
+	/* Rebuild a's range list from scratch */
+	a->ranges = NULL;
+	a->nranges = a->maxranges = 0;
+
+	/* Both lists are sorted, so a merge pass finds all the overlaps */
+	i = j = 0;
+	while (i < naranges && j < b->nranges)
+	{
+		BlockNumber first = Max(aranges[i].first, b->ranges[j].first);
+		BlockNumber last = Min(aranges[i].last, b->ranges[j].last);
+
+		if (first <= last)
+			tbm_insert_range(a, first, last);
+		if (aranges[i].last < b->ranges[j].last)
+			i++;
+		else
+			j++;
+	}
+
+	/* Now bring over b's chunks and pages that lie within a's old ranges */
+	if (b->nentries > 0)
+	{
+		HASH_SEQ_STATUS status;
+		const PagetableEntry *bpage;
+		bool		onepage = (b->status == TBM_ONE_PAGE);
+
+		if (!onepage)
+		{
+			Assert(b->status == TBM_HASH);
+			hash_seq_init(&status, b->pagetable);
+		}
+		bpage = onepage ? &b->entry1 :
+			(PagetableEntry *) hash_seq_search(&status);
+		while (bpage != NULL)
+		{
+			if (bpage->ischunk)
+			{
+				int			wordnum;
+
+				for (wordnum = 0; wordnum < WORDS_PER_CHUNK; wordnum++)
+				{
+					bitmapword	w = bpage->words[wordnum];
+					BlockNumber pg;
+
+					pg = bpage->blockno + (wordnum * BITS_PER_BITMAPWORD);
+					while (w != 0)
+					{
+						if ((w & 1) &&
+							tbm_range_contains(aranges, naranges, pg) &&
+							!tbm_range_contains(b->ranges, b->nranges, pg))
+							tbm_mark_page_lossy(a, pg);
+						pg++;
+						w >>= 1;
+					}
+				}
+			}
+			else if (tbm_range_contains(aranges, naranges, bpage->blockno) &&
+					 !tbm_range_contains(b->ranges, b->nranges,
+										 bpage->blockno) &&
+					 !tbm_page_is_lossy(a, bpage->blockno))
+			{
+				PagetableEntry *apage;
+
+				apage = tbm_get_pageentry(a, bpage->blockno);
+				if (apage->ischunk)
+				{
+					/* The page is a lossy chunk header, set bit for itself */
+					apage->words[0] |= ((bitmapword) 1 << 0);
+				}
+				else
+				{
+					int			wordnum;
+
+					for (wordnum = 0; wordnum < WORDS_PER_PAGE; wordnum++)
+						apage->words[wordnum] |= bpage->words[wordnum];
+					apage->recheck = true;
+				}
+			}
+			bpage = onepage ? NULL :
+				(PagetableEntry *) hash_seq_search(&status);
+		}
+	}
+
+	if (aranges)
+		pfree(aranges);
+
+	if (a->nentries > a->maxentries)
+		tbm_lossify(a);
+}
+
 /*
  * tbm_is_empty - is a TIDBitmap completely empty?
+ *
+ * We don't keep count of the bits set in a shared bitmap, so it is never
+ * reported empty.
  */
 bool
 tbm_is_empty(const TIDBitmap *tbm)
 {
-	return (tbm->nentries == 0);
+	if (tbm->status == TBM_SHARED)
+		return false;
+	return (tbm->nentries == 0 && tbm->nranges == 0);
 }
 
 /*
@@ -597,6 +852,10 @@ tbm_begin_iterate(TIDBitmap *tbm)
 	iterator->spageptr = 0;
 	iterator->schunkptr = 0;
 	iterator->schunkbit = 0;
+	iterator->rangeptr = 0;
+	iterator->rangeblk = (tbm->nranges > 0) ? tbm->ranges[0].first : 0;
+	iterator->sharedword = 0;
+	iterator->sharedbase = 0;
 
 	/*
 	 * If we have a hashtable, create and fill the sorted page lists, unless
@@ -655,6 +914,15 @@ tbm_begin_iterate(TIDBitmap *tbm)
  * condition.  If result->recheck is true, only the indicated tuples need
  * be examined, but the condition must be rechecked anyway.  (For ease of
  * testing, recheck is always set true when ntuples < 0.)
+ *
+ * When a lossy page is known to be followed by more lossy pages with no gap,
+ * result->runend is set to the last of them, so that the caller can treat the
+ * run as the sequential read it really is; otherwise runend is blockno.  This
+ * is only known for page ranges and shared bitmaps.
+ *
+ * For a shared bitmap, all iterators attached to the same shared memory
+ * divide the pages between them; each sees its own pages in numerical order,
+ * but no page is returned to more than one of them.
  */
 TBMIterateResult *
 tbm_iterate(TBMIterator *iterator)
@@ -664,6 +932,9 @@ tbm_iterate(TBMIterator *iterator)
 
 	Assert(tbm->iterating);
 
+	if (tbm->status == TBM_SHARED)
+		return tbm_shared_iterate(iterator);
+
 	/*
 	 * If lossy chunk pages remain, make sure we've advanced schunkptr/
 	 * schunkbit to the next set bit.
@@ -692,6 +963,55 @@ tbm_iterate(TBMIterator *iterator)
 		iterator->schunkbit = 0;
 	}
 
+	/*
+	 * If page ranges remain, make sure rangeptr/rangeblk point at the next
+	 * page of one, and output it if it comes before any chunk or exact page.
+	 * A chunk bit or exact page for the very same block is subsumed by the
+	 * range, so step over it; every page inside a range is reached this way
+	 * before it could come up from the other lists.
+	 */
+	if (iterator->rangeptr < tbm->nranges &&
+		iterator->rangeblk > tbm->ranges[iterator->rangeptr].last)
+	{
+		iterator->rangeptr++;
+		if (iterator->rangeptr < tbm->nranges)
+			iterator->rangeblk = tbm->ranges[iterator->rangeptr].first;
+	}
+	if (iterator->rangeptr < tbm->nranges)
+	{
+		BlockNumber rangeblk = iterator->rangeblk;
+		BlockNumber chunk_blockno = InvalidBlockNumber;
+		BlockNumber page_blockno = InvalidBlockNumber;
+
+		if (iterator->schunkptr < tbm->nchunks)
+			chunk_blockno = tbm->schunks[iterator->schunkptr]->blockno +
+				iterator->schunkbit;
+		if (iterator->spageptr < tbm->npages)
+		{
+			/* In ONE_PAGE state, we don't allocate an spages[] array */
+			if (tbm->status == TBM_ONE_PAGE)
+				page_blockno = tbm->entry1.blockno;
+			else
+				page_blockno = tbm->spages[iterator->spageptr]->blockno;
+		}
+
+		if (rangeblk <= chunk_blockno && rangeblk <= page_blockno)
+		{
+			if (chunk_blockno == rangeblk)
+				iterator->schunkbit++;
+			if (page_blockno == rangeblk)
+				iterator->spageptr++;
+
+			/* Return a lossy page indicator from the range */
+			output->blockno = rangeblk;
+			output->ntuples = -1;
+			output->recheck = true;
+			output->runend = tbm->ranges[iterator->rangeptr].last;
+			iterator->rangeblk++;
+			return output;
+		}
+	}
+
 	/*
 	 * If both chunk and per-page data remain, must output the numerically
 	 * earlier page.
@@ -709,6 +1029,7 @@ tbm_iterate(TBMIterator *iterator)
 			output->blockno = chunk_blockno;
 			output->ntuples = -1;
 			output->recheck = true;
+			output->runend = chunk_blockno;
 			iterator->schunkbit++;
 			return output;
 		}
@@ -748,6 +1069,7 @@ tbm_iterate(TBMIterator *iterator)
 		output->blockno = page->blockno;
 		output->ntuples = ntuples;
 		output->recheck = page->recheck;
+		output->runend = page->blockno;
 		iterator->spageptr++;
 		return output;
 	}
@@ -862,6 +1184,10 @@ tbm_page_is_lossy(const TIDBitmap *tbm, BlockNumber pageno)
 	BlockNumber chunk_pageno;
 	int			bitno;
 
+	/* pages inside a page range are always lossy */
+	if (tbm_range_contains(tbm->ranges, tbm->nranges, pageno))
+		return true;
+
 	/* we can skip the lookup if there are no lossy chunks */
 	if (tbm->nchunks == 0)
 		return false;
@@ -883,6 +1209,111 @@ tbm_page_is_lossy(const TIDBitmap *tbm, BlockNumber pageno)
 	return false;
 }
 
+/*
+ * tbm_range_contains - does a sorted page range list include pageno?
+ */
+static bool
+tbm_range_contains(const TBMPageRange *ranges, int nranges,
+				   BlockNumber pageno)
+{
+	int			lo = 0;
+	int			hi = nranges;
+
+	/* binary search for the first range not ending before pageno */
+	while (lo < hi)
+	{
+		int			mid = (lo + hi) / 2;
+
+		if (ranges[mid].last < pageno)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return (lo < nranges && ranges[lo].first <= pageno);
+}
+
+/*
+ * tbm_insert_range - merge pages first .. last into tbm's page ranges
+ *
+ * The list is kept sorted, with overlapping or adjacent ranges coalesced.
+ * Callers usually add ranges in ascending order, so appending to or growing
+ * the last range is the fast path.
+ */
+static void
+tbm_insert_range(TIDBitmap *tbm, BlockNumber first, BlockNumber last)
+{
+	TBMPageRange *r;
+	int			lo;
+	int			hi;
+	int			next;
+
+	Assert(first <= last);
+
+	/* make sure there's room for one more */
+	if (tbm->nranges >= tbm->maxranges)
+	{
+		if (tbm->ranges == NULL)
+		{
+			tbm->maxranges = 16;
+			tbm->ranges = (TBMPageRange *)
+				MemoryContextAlloc(tbm->mcxt,
+								   tbm->maxranges * sizeof(TBMPageRange));
+		}
+		else
+		{
+			tbm->maxranges *= 2;
+			tbm->ranges = (TBMPageRange *)
+				repalloc(tbm->ranges, tbm->maxranges * sizeof(TBMPageRange));
+		}
+	}
+
+	/* find the first range that ends at or after first - 1 */
+	if (tbm->nranges > 0 &&
+		tbm->ranges[tbm->nranges - 1].last + 1 < first)
+		lo = tbm->nranges;		/* beyond everything, just append */
+	else
+	{
+		lo = 0;
+		hi = tbm->nranges;
+		while (lo < hi)
+		{
+			int			mid = (lo + hi) / 2;
+
+			if (tbm->ranges[mid].last + 1 < first)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+	}
+
+	r = &tbm->ranges[lo];
+	if (lo == tbm->nranges || r->first > last + 1)
+	{
+		/* no overlap with anything, insert a new range here */
+		memmove(r + 1, r, (tbm->nranges - lo) * sizeof(TBMPageRange));
+		r->first = first;
+		r->last = last;
+		tbm->nranges++;
+		return;
+	}
+
+	/* extend the range we touch, then absorb any others it now reaches */
+	r->first = Min(r->first, first);
+	r->last = Max(r->last, last);
+	for (next = lo + 1; next < tbm->nranges; next++)
+	{
+		if (tbm->ranges[next].first > r->last + 1)
+			break;
+		r->last = Max(r->last, tbm->ranges[next].last);
+	}
+	if (next > lo + 1)
+	{
+		memmove(r + 1, &tbm->ranges[next],
+				(tbm->nranges - next) * sizeof(TBMPageRange));
+		tbm->nranges -= next - (lo + 1);
+	}
+}
+
 /*
  * tbm_mark_page_lossy - mark the page number as lossily stored
  *
@@ -1036,3 +1467,135 @@ tbm_comparator(const void *left, const void *right)
 		return 1;
 	return 0;
 }
+
+/*
+ * tbm_shared_estimate - size of a shared bitmap covering nblocks heap pages
+ */
+Size
+tbm_shared_estimate(BlockNumber nblocks)
+{
+	return add_size(offsetof(TBMSharedData, words),
+					mul_size(TBM_SHARED_NWORDS(nblocks),
+							 sizeof(pg_atomic_uint32)));
+}
+
+/*
+ * tbm_shared_initialize - set up an empty shared bitmap
+ *
+ * 'area' must point to tbm_shared_estimate(nblocks) bytes of shared memory.
+ */
+void
+tbm_shared_initialize(void *area, BlockNumber nblocks)
+{
+	TBMSharedData *shared = (TBMSharedData *) area;
+	uint32		nwords = TBM_SHARED_NWORDS(nblocks);
+	uint32		i;
+
+	shared->nblocks = nblocks;
+	pg_atomic_init_u32(&shared->nextword, 0);
+	for (i = 0; i < nwords; i++)
+		pg_atomic_init_u32(&shared->words[i], 0);
+}
+
+/*
+ * tbm_shared_reset - empty a shared bitmap so that it can be built again
+ *
+ * The caller must make sure nobody else is using it meanwhile.
+ */
+void
+tbm_shared_reset(void *area)
+{
+	TBMSharedData *shared = (TBMSharedData *) area;
+	uint32		nwords = TBM_SHARED_NWORDS(shared->nblocks);
+	uint32		i;
+
+	pg_atomic_write_u32(&shared->nextword, 0);
+	for (i = 0; i < nwords; i++)
+		pg_atomic_write_u32(&shared->words[i], 0);
+}
+
+/*
+ * tbm_attach_shared - get a TIDBitmap for a shared bitmap
+ *
+ * The returned bitmap can be filled with tbm_add_tuples and tbm_add_page
+ * concurrently with other backends attached to the same area, and iterated
+ * with tbm_begin_iterate once everybody is done adding.  Every page comes
+ * back lossy.  tbm_free releases only the local handle.
+ */
+TIDBitmap *
+tbm_attach_shared(void *area)
+{
+	TIDBitmap  *tbm;
+
+	tbm = makeNode(TIDBitmap);
+	tbm->mcxt = CurrentMemoryContext;
+	tbm->status = TBM_SHARED;
+	tbm->shared = (TBMSharedData *) area;
+
+	return tbm;
+}
+
+/*
+ * tbm_shared_set_page - mark one page of a shared bitmap
+ */
+static void
+tbm_shared_set_page(TBMSharedData *shared, BlockNumber pageno)
+{
+	pg_atomic_uint32 *word;
+	uint32		bit;
+
+	if (pageno >= shared->nblocks)
+		return;
+
+	word = &shared->words[pageno / TBM_SHARED_BITS_PER_WORD];
+	bit = (uint32) 1 << (pageno % TBM_SHARED_BITS_PER_WORD);
+
+	/* avoid dirtying the cache line if someone already set it */
+	if ((pg_atomic_read_u32(word) & bit) == 0)
+		pg_atomic_fetch_or_u32(word, bit);
+}
+
+/*
+ * tbm_shared_iterate - tbm_iterate for a shared bitmap
+ *
+ * Words are claimed one at a time from the shared counter, so concurrent
+ * iterators never return the same page.
+ */
+static TBMIterateResult *
+tbm_shared_iterate(TBMIterator *iterator)
+{
+	TBMSharedData *shared = iterator->tbm->shared;
+	TBMIterateResult *output = &(iterator->output);
+	uint32		nwords = TBM_SHARED_NWORDS(shared->nblocks);
+	int			bitnum;
+	int			runlen;
+
+	while (iterator->sharedword == 0)
+	{
+		uint32		wordnum;
+
+		wordnum = pg_atomic_fetch_add_u32(&shared->nextword, 1);
+		if (wordnum >= nwords)
+			return NULL;
+		iterator->sharedword = pg_atomic_read_u32(&shared->words[wordnum]);
+		iterator->sharedbase = wordnum * TBM_SHARED_BITS_PER_WORD;
+	}
+
+	/* return the lowest remaining bit and clear it */
+	bitnum = 0;
+	while ((iterator->sharedword & ((uint32) 1 << bitnum)) == 0)
+		bitnum++;
+	iterator->sharedword &= ~((uint32) 1 << bitnum);
+
+	/* the set bits right above it are ours too, and continue the run */
+	runlen = 0;
+	while (bitnum + runlen + 1 < TBM_SHARED_BITS_PER_WORD &&
+		   (iterator->sharedword & ((uint32) 1 << (bitnum + runlen + 1))) != 0)
+		runlen++;
+
+	output->blockno = iterator->sharedbase + bitnum;
+	output->ntuples = -1;
+	output->recheck = true;
+	output->runend = output->blockno + runlen;
+	return output;
+}
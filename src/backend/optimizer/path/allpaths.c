@@ -76,6 +76,7 @@ static void set_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 static void set_plain_rel_size(PlannerInfo *root, RelOptInfo *rel,
 				   RangeTblEntry *rte);
 static void create_plain_partial_paths(PlannerInfo *root, RelOptInfo *rel);
+static int	parallel_workers_for_pages(double pages);
 static void set_rel_consider_parallel(PlannerInfo *root, RelOptInfo *rel,
 						  RangeTblEntry *rte);
 static void set_plain_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
@@ -98,6 +99,7 @@ static void generate_mergeappend_paths(PlannerInfo *root, RelOptInfo *rel,
 static Path *get_cheapest_parameterized_child_path(PlannerInfo *root,
 									  RelOptInfo *rel,
 									  Relids required_outer);
+static Path *get_cheapest_parallel_safe_total_path(RelOptInfo *rel);
 static List *accumulate_append_subpath(List *subpaths, Path *path);
 static void set_subquery_pathlist(PlannerInfo *root, RelOptInfo *rel,
 					  Index rti, RangeTblEntry *rte);
@@ -679,6 +681,74 @@ create_plain_partial_paths(PlannerInfo *root, RelOptInfo *rel)
 {
 	int			parallel_workers;
 
+	parallel_workers = compute_parallel_worker(rel, rel->pages, -1);
+
+	/* If any limit was set to zero, the user doesn't want a parallel scan. */
+	if (parallel_workers <= 0)
+		return;
+
+	/* Add an unordered partial path based on a parallel sequential scan. */
+	add_partial_path(rel, create_seqscan_path(root, rel, NULL, parallel_workers));
+}
+
+/*
+ * create_partial_bitmap_paths
+ *	  Build partial bitmap heap path for the relation
+ *
+ * The bitmap itself can only be built cooperatively when it comes from a
+ * single index whose AM supports parallel scans; BitmapAnd/BitmapOr trees
+ * would need their inputs combined before anyone could start on the heap.
+ * ScalarArrayOpExpr quals are excluded too, since the executor rescans the
+ * index once per array element, which a shared scan can't follow.
+ */
+void
+create_partial_bitmap_paths(PlannerInfo *root, RelOptInfo *rel,
+							Path *bitmapqual)
+{
+	IndexPath  *ipath;
+	ListCell   *lc;
+	int			parallel_workers;
+
+	if (!IsA(bitmapqual, IndexPath))
+		return;
+	ipath = (IndexPath *) bitmapqual;
+	if (!ipath->indexinfo->amcanparallel)
+		return;
+	foreach(lc, ipath->indexquals)
+	{
+		if (IsA(lfirst(lc), ScalarArrayOpExpr))
+			return;
+	}
+
+	parallel_workers = compute_parallel_worker(rel, rel->pages, -1);
+
+	if (parallel_workers <= 0)
+		return;
+
+	add_partial_path(rel, (Path *) create_bitmap_heap_path(root, rel,
+					bitmapqual, rel->lateral_relids, 1.0, parallel_workers));
+}
+
+/*
+ * compute_parallel_worker
+ *	  Compute the number of parallel workers that should be used to scan a
+ *	  relation.
+ *
+ * "heap_pages" is the number of pages from the table that we expect to scan,
+ * and "index_pages" is the number of pages from the index that we expect to
+ * scan; either may be passed as -1 if it doesn't apply.  The smaller of the
+ * two worker counts wins, since the less parallelizable part of the scan
+ * limits how much extra workers can help.
+ *
+ * Returns 0 if the relation is too small to be worth a parallel scan, or
+ * if the user has disabled parallelism for it.
+ */
+int
+compute_parallel_worker(RelOptInfo *rel, double heap_pages,
+						double index_pages)
+{
+	int			parallel_workers = 0;
+
 	/*
 	 * If the user has set the parallel_workers reloption, use that; otherwise
 	 * select a default number of workers.
@@ -687,8 +757,6 @@ create_plain_partial_paths(PlannerInfo *root, RelOptInfo *rel)
 		parallel_workers = rel->rel_parallel_workers;
 	else
 	{
-		int			parallel_threshold;
-
 		/*
 		 * If this relation is too small to be worth a parallel scan, just
 		 * return without doing anything ... unless it's an inheritance child.
@@ -696,25 +764,24 @@ create_plain_partial_paths(PlannerInfo *root, RelOptInfo *rel)
 		 * might not be worthwhile just for this relation, but when combined
 		 * with all of its inheritance siblings it may well pay off.
 		 */
-		if (rel->pages < (BlockNumber) min_parallel_relation_size &&
-			rel->reloptkind == RELOPT_BASEREL)
-			return;
+		if (rel->reloptkind == RELOPT_BASEREL &&
+			((heap_pages >= 0 && heap_pages < min_parallel_relation_size) ||
+			 (index_pages >= 0 && index_pages < min_parallel_relation_size)))
+			return 0;
 
-		/*
-		 * Select the number of workers based on the log of the size of the
-		 * relation.  This probably needs to be a good deal more
-		 * sophisticated, but we need something here for now.  Note that the
-		 * upper limit of the min_parallel_relation_size GUC is chosen to
-		 * prevent overflow here.
-		 */
-		parallel_workers = 1;
-		parallel_threshold = Max(min_parallel_relation_size, 1);
-		while (rel->pages >= (BlockNumber) (parallel_threshold * 3))
+		if (heap_pages >= 0)
+			parallel_workers = parallel_workers_for_pages(heap_pages);
+
+		if (index_pages >= 0)
 		{
-			parallel_workers++;
-			parallel_threshold *= 3;
-			if (parallel_threshold > INT_MAX / 3)
-				break;			/* avoid overflow */
+			int			index_parallel_workers;
+
+			index_parallel_workers = parallel_workers_for_pages(index_pages);
+			if (parallel_workers > 0)
+				parallel_workers = Min(parallel_workers,
+									   index_parallel_workers);
+			else
+				parallel_workers = index_parallel_workers;
 		}
 	}
 
@@ -723,12 +790,33 @@ create_plain_partial_paths(PlannerInfo *root, RelOptInfo *rel)
 	 */
 	parallel_workers = Min(parallel_workers, max_parallel_workers_per_gather);
 
-	/* If any limit was set to zero, the user doesn't want a parallel scan. */
-	if (parallel_workers <= 0)
-		return;
+	return parallel_workers;
+}
 
-	/* Add an unordered partial path based on a parallel sequential scan. */
-	add_partial_path(rel, create_seqscan_path(root, rel, NULL, parallel_workers));
+/*
+ * parallel_workers_for_pages
+ *	  Select the number of workers based on the log of the number of pages
+ *	  to be scanned.
+ *
+ * This probably needs to be a good deal more sophisticated, but we need
+ * something here for now.  Note that the upper limit of the
+ * min_parallel_relation_size GUC is chosen to prevent overflow here.
+ */
+static int
+parallel_workers_for_pages(double pages)
+{
+	int			parallel_workers = 1;
+	int			parallel_threshold = Max(min_parallel_relation_size, 1);
+
+	while (pages >= (double) parallel_threshold * 3)
+	{
+		parallel_workers++;
+		parallel_threshold *= 3;
+		if (parallel_threshold > INT_MAX / 3)
+			break;				/* avoid overflow */
+	}
+
+	return parallel_workers;
 }
 
 /*
@@ -1127,10 +1215,15 @@ set_append_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 	bool		subpaths_valid = true;
 	List	   *partial_subpaths = NIL;
 	bool		partial_subpaths_valid = true;
+	List	   *pa_partial_subpaths = NIL;
+	List	   *pa_nonpartial_subpaths = NIL;
+	bool		pa_subpaths_valid;
 	List	   *all_child_pathkeys = NIL;
 	List	   *all_child_outers = NIL;
 	ListCell   *l;
 
+	pa_subpaths_valid = enable_parallel_append && rel->consider_parallel;
+
 	/*
 	 * Generate access paths for each member relation, and remember the
 	 * cheapest path for each one.  Also, identify all pathkeys (orderings)
@@ -1197,6 +1290,36 @@ set_append_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 		else
 			partial_subpaths_valid = false;
 
+		/*
+		 * A parallel-aware Append can also mix partial children with
+		 * non-partial ones, running each of the latter in just one
+		 * participant.  Use the child's partial path if it has one that is
+		 * cheaper than its cheapest parallel-safe non-partial path, else
+		 * that non-partial path.
+		 */
+		if (pa_subpaths_valid)
+		{
+			Path	   *partial_path = NULL;
+			Path	   *nonpartial_path;
+
+			if (childrel->partial_pathlist != NIL)
+				partial_path = linitial(childrel->partial_pathlist);
+			nonpartial_path = get_cheapest_parallel_safe_total_path(childrel);
+
+			if (partial_path == NULL && nonpartial_path == NULL)
+				pa_subpaths_valid = false;
+			else if (nonpartial_path == NULL ||
+					 (partial_path != NULL &&
+					  partial_path->total_cost < nonpartial_path->total_cost))
+				pa_partial_subpaths =
+					accumulate_append_subpath(pa_partial_subpaths,
+											  partial_path);
+			else
+				pa_nonpartial_subpaths =
+					accumulate_append_subpath(pa_nonpartial_subpaths,
+											  nonpartial_path);
+		}
+
 		/*
 		 * Collect lists of all the available path orderings and
 		 * parameterizations for all the children.  We use these as a
@@ -1268,7 +1391,8 @@ set_append_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 	 * if we have zero or one live subpath due to constraint exclusion.)
 	 */
 	if (subpaths_valid)
-		add_path(rel, (Path *) create_append_path(rel, subpaths, NULL, 0));
+		add_path(rel, (Path *) create_append_path(rel, subpaths, NIL,
+												  NULL, 0, false));
 
 	/*
 	 * Consider an append of partial unordered, unparameterized partial paths.
@@ -1281,9 +1405,10 @@ set_append_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 
 		/*
 		 * Decide on the number of workers to request for this append path.
-		 * For now, we just use the maximum value from among the members.  It
-		 * might be useful to use a higher number if the Append node were
-		 * smart enough to spread out the workers, but it currently isn't.
+		 * Start from the maximum value from among the members.  If the Append
+		 * is parallel-aware, it spreads the workers out across its children,
+		 * so more workers than any one child wants can still be kept busy;
+		 * ask for about one more per doubling of the number of children.
 		 */
 		foreach(lc, partial_subpaths)
 		{
@@ -1291,14 +1416,55 @@ set_append_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 
 			parallel_workers = Max(parallel_workers, path->parallel_workers);
 		}
+
+		if (enable_parallel_append)
+		{
+			parallel_workers = Max(parallel_workers,
+								   fls(list_length(live_childrels)));
+			parallel_workers = Min(parallel_workers,
+								   max_parallel_workers_per_gather);
+		}
 		Assert(parallel_workers > 0);
 
 		/* Generate a partial append path. */
-		appendpath = create_append_path(rel, partial_subpaths, NULL,
-										parallel_workers);
+		appendpath = create_append_path(rel, NIL, partial_subpaths, NULL,
+										parallel_workers,
+										enable_parallel_append);
 		add_partial_path(rel, (Path *) appendpath);
 	}
 
+	/*
+	 * Consider a parallel-aware append mixing partial and non-partial paths.
+	 * If no non-partial path was chosen, this is the same as the path built
+	 * just above, so don't bother.
+	 */
+	if (pa_subpaths_valid && pa_nonpartial_subpaths != NIL)
+	{
+		AppendPath *appendpath;
+		ListCell   *lc;
+		int			parallel_workers = 0;
+
+		foreach(lc, pa_partial_subpaths)
+		{
+			Path	   *path = lfirst(lc);
+
+			parallel_workers = Max(parallel_workers, path->parallel_workers);
+		}
+		parallel_workers = Max(parallel_workers,
+							   fls(list_length(live_childrels)));
+		parallel_workers = Min(parallel_workers,
+							   max_parallel_workers_per_gather);
+
+		/* No partial path is useful if we couldn't get any workers */
+		if (parallel_workers > 0)
+		{
+			appendpath = create_append_path(rel, pa_nonpartial_subpaths,
+											pa_partial_subpaths, NULL,
+											parallel_workers, true);
+			add_partial_path(rel, (Path *) appendpath);
+		}
+	}
+
 	/*
 	 * Also build unparameterized MergeAppend paths based on the collected
 	 * list of child pathkeys.
@@ -1347,7 +1513,8 @@ set_append_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 
 		if (subpaths_valid)
 			add_path(rel, (Path *)
-					 create_append_path(rel, subpaths, required_outer, 0));
+					 create_append_path(rel, subpaths, NIL, required_outer, 0,
+										false));
 	}
 }
 
@@ -1522,6 +1689,30 @@ get_cheapest_parameterized_child_path(PlannerInfo *root, RelOptInfo *rel,
 	return cheapest;
 }
 
+/*
+ * get_cheapest_parallel_safe_total_path
+ *		Return the cheapest unparameterized, parallel-safe path for the rel,
+ *		or NULL if there is none.
+ *
+ * The pathlist is kept sorted by total cost, so the first qualifying entry
+ * is the one we want.
+ */
+static Path *
+get_cheapest_parallel_safe_total_path(RelOptInfo *rel)
+{
+	ListCell   *l;
+
+	foreach(l, rel->pathlist)
+	{
+		Path	   *path = (Path *) lfirst(l);
+
+		if (path->parallel_safe && path->param_info == NULL)
+			return path;
+	}
+
+	return NULL;
+}
+
 /*
  * accumulate_append_subpath
  *		Add a subpath to the list being built for an Append or MergeAppend
@@ -1539,7 +1730,11 @@ get_cheapest_parameterized_child_path(PlannerInfo *root, RelOptInfo *rel,
 static List *
 accumulate_append_subpath(List *subpaths, Path *path)
 {
-	if (IsA(path, AppendPath))
+	/*
+	 * A parallel-aware child Append can't be flattened, since its non-partial
+	 * children would then be run by every participant of ours.
+	 */
+	if (IsA(path, AppendPath) && !path->parallel_aware)
 	{
 		AppendPath *apath = (AppendPath *) path;
 
@@ -1577,7 +1772,8 @@ set_dummy_rel_pathlist(RelOptInfo *rel)
 	rel->pathlist = NIL;
 	rel->partial_pathlist = NIL;
 
-	add_path(rel, (Path *) create_append_path(rel, NIL, NULL, 0));
+	add_path(rel, (Path *) create_append_path(rel, NIL, NIL, NULL,
+											  0, false));
 
 	/*
 	 * We set the cheapest path immediately, to ensure that IS_DUMMY_REL()
@@ -2000,8 +2196,8 @@ set_worktable_pathlist(PlannerInfo *root, RelOptInfo *rel, RangeTblEntry *rte)
 
 /*
  * generate_gather_paths
- *		Generate parallel access paths for a relation by pushing a Gather on
- *		top of a partial path.
+ *		Generate parallel access paths for a relation by pushing a Gather or
+ *		Gather Merge on top of a partial path.
  *
  * This must not be called until after we're done creating all partial paths
  * for the specified relation.  (Otherwise, add_partial_path might delete a
@@ -2012,27 +2208,39 @@ generate_gather_paths(PlannerInfo *root, RelOptInfo *rel)
 {
 	Path	   *cheapest_partial_path;
 	Path	   *simple_gather_path;
+	ListCell   *lc;
 
 	/* If there are no partial paths, there's nothing to do here. */
 	if (rel->partial_pathlist == NIL)
 		return;
 
 	/*
-	 * The output of Gather is currently always unsorted, so there's only one
-	 * partial path of interest: the cheapest one.  That will be the one at
-	 * the front of partial_pathlist because of the way add_partial_path
-	 * works.
-	 *
-	 * Eventually, we should have a Gather Merge operation that can merge
-	 * multiple tuple streams together while preserving their ordering.  We
-	 * could usefully generate such a path from each partial path that has
-	 * non-NIL pathkeys.
+	 * The output of Gather is always unsorted, so there's only one partial
+	 * path of interest: the cheapest one.  That will be the one at the front
+	 * of partial_pathlist because of the way add_partial_path works.
 	 */
 	cheapest_partial_path = linitial(rel->partial_pathlist);
 	simple_gather_path = (Path *)
 		create_gather_path(root, rel, cheapest_partial_path, rel->reltarget,
 						   NULL, NULL);
 	add_path(rel, simple_gather_path);
+
+	/*
+	 * For each useful ordering, we can consider an order-preserving Gather
+	 * Merge.
+	 */
+	foreach(lc, rel->partial_pathlist)
+	{
+		Path	   *subpath = (Path *) lfirst(lc);
+		GatherMergePath *path;
+
+		if (subpath->pathkeys == NIL)
+			continue;
+
+		path = create_gather_merge_path(root, rel, subpath, rel->reltarget,
+										subpath->pathkeys, NULL, NULL);
+		add_path(rel, &path->path);
+	}
 }
 
 /*
@@ -2979,6 +3187,10 @@ print_path(PlannerInfo *root, Path *path, int indent)
 			ptype = "Gather";
 			subpath = ((GatherPath *) path)->subpath;
 			break;
+		case T_GatherMergePath:
+			ptype = "GatherMerge";
+			subpath = ((GatherMergePath *) path)->subpath;
+			break;
 		case T_ProjectionPath:
 			ptype = "Projection";
 			subpath = ((ProjectionPath *) path)->subpath;
@@ -2987,6 +3199,14 @@ print_path(PlannerInfo *root, Path *path, int indent)
 			ptype = "Sort";
 			subpath = ((SortPath *) path)->subpath;
 			break;
+		case T_ResultCachePath:
+			ptype = "ResultCache";
+			subpath = ((ResultCachePath *) path)->subpath;
+			break;
+		case T_IncrementalSortPath:
+			ptype = "IncrementalSort";
+			subpath = ((SortPath *) path)->subpath;
+			break;
 		case T_GroupPath:
 			ptype = "Group";
 			subpath = ((GroupPath *) path)->subpath;
@@ -80,7 +80,10 @@
 #include "access/htup_details.h"
 #include "access/tsmapi.h"
 #include "executor/executor.h"
+#include "executor/nodeAgg.h"
 #include "executor/nodeHash.h"
+#include "executor/nodeIncrementalSort.h"
+#include "executor/nodeResultCache.h"
 #include "miscadmin.h"
 #include "nodes/nodeFuncs.h"
 #include "optimizer/clauses.h"
@@ -91,6 +94,7 @@
 #include "optimizer/plancat.h"
 #include "optimizer/planmain.h"
 #include "optimizer/restrictinfo.h"
+#include "optimizer/var.h"
 #include "parser/parsetree.h"
 #include "utils/lsyscache.h"
 #include "utils/selfuncs.h"
@@ -121,11 +125,16 @@ bool		enable_indexonlyscan = true;
 bool		enable_bitmapscan = true;
 bool		enable_tidscan = true;
 bool		enable_sort = true;
+bool		enable_incrementalsort = true;
 bool		enable_hashagg = true;
 bool		enable_nestloop = true;
 bool		enable_material = true;
+bool		enable_resultcache = true;
 bool		enable_mergejoin = true;
 bool		enable_hashjoin = true;
+bool		enable_parallel_hash = true;
+bool		enable_gathermerge = true;
+bool		enable_parallel_append = true;
 
 typedef struct
 {
@@ -161,6 +170,9 @@ static Selectivity get_foreign_key_join_selectivity(PlannerInfo *root,
 static void set_rel_width(PlannerInfo *root, RelOptInfo *rel);
 static double relation_byte_size(double tuples, int width);
 static double page_size(double tuples, int width);
+static Cost cost_hashagg_spill(const AggClauseCosts *aggcosts,
+				   double numGroups, double input_tuples, int input_width);
+static double get_parallel_divisor(Path *path);
 
 
 /*
@@ -238,23 +250,7 @@ cost_seqscan(Path *path, PlannerInfo *root,
 	/* Adjust costing for parallelism, if used. */
 	if (path->parallel_workers > 0)
 	{
-		double		parallel_divisor = path->parallel_workers;
-		double		leader_contribution;
-
-		/*
-		 * Early experience with parallel query suggests that when there is
-		 * only one worker, the leader often makes a very substantial
-		 * contribution to executing the parallel portion of the plan, but as
-		 * more workers are added, it does less and less, because it's busy
-		 * reading tuples from the workers and doing whatever non-parallel
-		 * post-processing is needed.  By the time we reach 4 workers, the
-		 * leader no longer makes a meaningful contribution.  Thus, for now,
-		 * estimate that the leader spends 30% of its time servicing each
-		 * worker, and the remainder executing the parallel plan.
-		 */
-		leader_contribution = 1.0 - (0.3 * path->parallel_workers);
-		if (leader_contribution > 0)
-			parallel_divisor += leader_contribution;
+		double		parallel_divisor = get_parallel_divisor(path);
 
 		/*
 		 * In the case of a parallel plan, the row count needs to represent
@@ -390,6 +386,73 @@ cost_gather(GatherPath *path, PlannerInfo *root,
 	path->path.total_cost = (startup_cost + run_cost);
 }
 
+/*
+ * cost_gather_merge
+ *	  Determines and returns the cost of gather merge path.
+ *
+ * GatherMerge merges several pre-sorted input streams, using a heap that at
+ * any given instant holds the next tuple from each stream.  If there are N
+ * streams, we need about N*log2(N) tuple comparisons to construct the heap at
+ * startup, and then for each output tuple, about log2(N) comparisons to
+ * replace the top heap entry with the next tuple from the same stream.
+ */
+void
+cost_gather_merge(GatherMergePath *path, PlannerInfo *root,
+				  RelOptInfo *rel, ParamPathInfo *param_info,
+				  Cost input_startup_cost, Cost input_total_cost,
+				  double *rows)
+{
+	Cost		startup_cost = 0;
+	Cost		run_cost = 0;
+	Cost		comparison_cost;
+	double		N;
+	double		logN;
+
+	/* Mark the path with the correct row estimate */
+	if (rows)
+		path->path.rows = *rows;
+	else if (param_info)
+		path->path.rows = param_info->ppi_rows;
+	else
+		path->path.rows = rel->rows;
+
+	if (!enable_gathermerge)
+		startup_cost += disable_cost;
+
+	/*
+	 * Add one to the number of workers to account for the leader.  This might
+	 * be overgenerous since the leader will do less work than other workers
+	 * in typical cases, but we'll go with it for now.
+	 */
+	Assert(path->path.parallel_workers > 0);
+	N = (double) path->path.parallel_workers + 1;
+	logN = LOG2(N);
+
+	/* Assumed cost per tuple comparison */
+	comparison_cost = 2.0 * cpu_operator_cost;
+
+	/* Heap creation cost */
+	startup_cost += comparison_cost * N * logN;
+
+	/* Per-tuple heap maintenance cost */
+	run_cost += path->path.rows * comparison_cost * logN;
+
+	/* small cost for heap management, like cost_merge_append */
+	run_cost += cpu_operator_cost * path->path.rows;
+
+	/*
+	 * Parallel setup and communication cost.  Since Gather Merge, unlike
+	 * Gather, requires us to block until a tuple is available from every
+	 * worker, we bump the IPC cost up a little bit as compared with Gather.
+	 * For lack of a better idea, charge an extra 5%.
+	 */
+	startup_cost += parallel_setup_cost;
+	run_cost += parallel_tuple_cost * path->path.rows * 1.05;
+
+	path->path.startup_cost = startup_cost + input_startup_cost;
+	path->path.total_cost = (startup_cost + run_cost + input_total_cost);
+}
+
 /*
  * cost_index
  *	  Determines and returns the cost of scanning a relation using an index.
@@ -398,10 +461,14 @@ cost_gather(GatherPath *path, PlannerInfo *root,
  *		except for the fields to be set by this routine
  * 'loop_count' is the number of repetitions of the indexscan to factor into
  *		estimates of caching behavior
+ * 'partial_path' is true if the scan will be divided among the workers of a
+ *		parallel query
  *
  * In addition to rows, startup_cost and total_cost, cost_index() sets the
  * path's indextotalcost and indexselectivity fields.  These values will be
- * needed if the IndexPath is used in a BitmapIndexScan.
+ * needed if the IndexPath is used in a BitmapIndexScan.  For a partial path
+ * it also sets parallel_workers, and leaves it zero if the scan isn't worth
+ * parallelizing; the caller must then discard the path.
  *
  * NOTE: path->indexquals must contain only clauses usable as index
  * restrictions.  Any additional quals evaluated as qpquals may reduce the
@@ -409,7 +476,8 @@ cost_gather(GatherPath *path, PlannerInfo *root,
  * we have to fetch from the table, so they don't reduce the scan cost.
  */
 void
-cost_index(IndexPath *path, PlannerInfo *root, double loop_count)
+cost_index(IndexPath *path, PlannerInfo *root, double loop_count,
+		   bool partial_path)
 {
 	IndexOptInfo *index = path->indexinfo;
 	RelOptInfo *baserel = index->rel;
@@ -418,6 +486,7 @@ cost_index(IndexPath *path, PlannerInfo *root, double loop_count)
 	List	   *qpquals;
 	Cost		startup_cost = 0;
 	Cost		run_cost = 0;
+	Cost		cpu_run_cost = 0;
 	Cost		indexStartupCost;
 	Cost		indexTotalCost;
 	Selectivity indexSelectivity;
@@ -431,6 +500,7 @@ cost_index(IndexPath *path, PlannerInfo *root, double loop_count)
 	Cost		cpu_per_tuple;
 	double		tuples_fetched;
 	double		pages_fetched;
+	double		rand_heap_pages = -1;
 
 	/* Should only be applied to base relations */
 	Assert(IsA(baserel, RelOptInfo) &&
@@ -582,6 +652,8 @@ cost_index(IndexPath *path, PlannerInfo *root, double loop_count)
 		if (indexonly)
 			pages_fetched = ceil(pages_fetched * (1.0 - baserel->allvisfrac));
 
+		rand_heap_pages = pages_fetched;
+
 		/* max_IO_cost is for the perfectly uncorrelated case (csquared=0) */
 		max_IO_cost = pages_fetched * spc_random_page_cost;
 
@@ -609,6 +681,29 @@ cost_index(IndexPath *path, PlannerInfo *root, double loop_count)
 
 	run_cost += max_IO_cost + csquared * (min_IO_cost - max_IO_cost);
 
+	if (partial_path)
+	{
+		/*
+		 * Estimate the number of parallel workers required to scan the index.
+		 * Use the number of heap pages computed assuming the heap fetches
+		 * won't be sequential, since in a parallel scan each participant
+		 * visits the pages in random order.
+		 */
+		path->path.parallel_workers =
+			compute_parallel_worker(baserel, rand_heap_pages,
+									ceil(indexSelectivity * index->pages));
+
+		/*
+		 * Fall out if workers can't be assigned for parallel scan, because in
+		 * such a case this path will be rejected.  So there is no benefit in
+		 * doing extra computation.
+		 */
+		if (path->path.parallel_workers <= 0)
+			return;
+
+		path->path.parallel_aware = true;
+	}
+
 	/*
 	 * Estimate CPU costs per tuple.
 	 *
@@ -620,11 +715,24 @@ cost_index(IndexPath *path, PlannerInfo *root, double loop_count)
 	startup_cost += qpqual_cost.startup;
 	cpu_per_tuple = cpu_tuple_cost + qpqual_cost.per_tuple;
 
-	run_cost += cpu_per_tuple * tuples_fetched;
+	cpu_run_cost += cpu_per_tuple * tuples_fetched;
 
 	/* tlist eval costs are paid per output row, not per tuple scanned */
 	startup_cost += path->path.pathtarget->cost.startup;
-	run_cost += path->path.pathtarget->cost.per_tuple * path->path.rows;
+	cpu_run_cost += path->path.pathtarget->cost.per_tuple * path->path.rows;
+
+	/* Adjust costing for parallelism, if used. */
+	if (path->path.parallel_workers > 0)
+	{
+		double		parallel_divisor = get_parallel_divisor(&path->path);
+
+		path->path.rows = clamp_row_est(path->path.rows / parallel_divisor);
+
+		/* The CPU cost is divided among all the workers. */
+		cpu_run_cost /= parallel_divisor;
+	}
+
+	run_cost += cpu_run_cost;
 
 	path->path.startup_cost = startup_cost;
 	path->path.total_cost = startup_cost + run_cost;
@@ -830,6 +938,7 @@ cost_bitmap_heap_scan(Path *path, PlannerInfo *root, RelOptInfo *baserel,
 {
 	Cost		startup_cost = 0;
 	Cost		run_cost = 0;
+	Cost		cpu_run_cost;
 	Cost		indexTotalCost;
 	Selectivity indexSelectivity;
 	QualCost	qpqual_cost;
@@ -933,14 +1042,28 @@ cost_bitmap_heap_scan(Path *path, PlannerInfo *root, RelOptInfo *baserel,
 	startup_cost += qpqual_cost.startup;
 	cpu_per_tuple = cpu_tuple_cost + qpqual_cost.per_tuple;
 
-	run_cost += cpu_per_tuple * tuples_fetched;
+	cpu_run_cost = cpu_per_tuple * tuples_fetched;
 
 	/* tlist eval costs are paid per output row, not per tuple scanned */
 	startup_cost += path->pathtarget->cost.startup;
-	run_cost += path->pathtarget->cost.per_tuple * path->rows;
+	cpu_run_cost += path->pathtarget->cost.per_tuple * path->rows;
+
+	/* Adjust costing for parallelism, if used. */
+	if (path->parallel_workers > 0)
+	{
+		double		parallel_divisor = get_parallel_divisor(path);
+
+		/* The bitmap is built by all participants together ... */
+		startup_cost -= indexTotalCost * (1.0 - 1.0 / parallel_divisor);
+
+		/* ... and so is the CPU work of scanning the heap pages. */
+		cpu_run_cost /= parallel_divisor;
+
+		path->rows = clamp_row_est(path->rows / parallel_divisor);
+	}
 
 	path->startup_cost = startup_cost;
-	path->total_cost = startup_cost + run_cost;
+	path->total_cost = startup_cost + run_cost + cpu_run_cost;
 }
 
 /*
@@ -1569,6 +1692,195 @@ cost_sort(Path *path, PlannerInfo *root,
 	path->total_cost = startup_cost + run_cost;
 }
 
+/*
+ * cost_incremental_sort
+ *	  Determines and returns the cost of sorting a relation incrementally,
+ *	  when the input path is already sorted by some of the pathkeys.
+ *
+ * We estimate the number of runs of tuples with equal presorted keys, and
+ * charge for sorting each of them separately.  The executor doesn't bother
+ * to sort fewer than INCREMENTAL_SORT_MIN_BATCH_SIZE tuples at a time, so
+ * there can't usefully be more batches than that allows.  Since only the
+ * first batch has to be read and sorted before the first tuple is returned,
+ * the startup cost is much lower than for a full sort.
+ *
+ * 'presorted_keys' is the number of leading pathkeys the input is sorted
+ * by; the other arguments are as for cost_sort, except that we need both
+ * the input's startup and total costs.
+ */
+void
+cost_incremental_sort(Path *path, PlannerInfo *root,
+					  List *pathkeys, int presorted_keys,
+					  Cost input_startup_cost, Cost input_total_cost,
+					  double input_tuples, int width, Cost comparison_cost,
+					  int sort_mem, double limit_tuples)
+{
+	Cost		startup_cost,
+				run_cost,
+				input_run_cost = input_total_cost - input_startup_cost;
+	double		group_tuples,
+				input_groups;
+	Cost		group_startup_cost,
+				group_run_cost,
+				group_input_run_cost;
+	List	   *presortedExprs = NIL;
+	ListCell   *l;
+	int			i = 0;
+	bool		unknown_varno = false;
+	Path		sort_path;		/* dummy for result of cost_sort */
+
+	Assert(presorted_keys > 0 && presorted_keys < list_length(pathkeys));
+
+	/*
+	 * We want to be sure the cost of a sort is never estimated as zero, even
+	 * if passed-in tuple count is zero.  Besides, mustn't do log(0)...
+	 */
+	if (input_tuples < 2.0)
+		input_tuples = 2.0;
+
+	/*
+	 * Collect the presorted key expressions, so we can estimate the number
+	 * of distinct combinations of them.  Upper-level expressions with Vars
+	 * of varno 0 can't be looked up in the statistics, so don't try.
+	 */
+	foreach(l, pathkeys)
+	{
+		PathKey    *key = (PathKey *) lfirst(l);
+		EquivalenceMember *member = (EquivalenceMember *)
+		linitial(key->pk_eclass->ec_members);
+
+		if (bms_is_member(0, pull_varnos((Node *) member->em_expr)))
+		{
+			unknown_varno = true;
+			break;
+		}
+
+		presortedExprs = lappend(presortedExprs, member->em_expr);
+
+		if (++i >= presorted_keys)
+			break;
+	}
+
+	if (unknown_varno)
+		input_groups = Min(input_tuples, DEFAULT_NUM_DISTINCT);
+	else
+		input_groups = estimate_num_groups(root, presortedExprs, input_tuples,
+										   NULL);
+
+	input_groups = Min(input_groups,
+					   ceil(input_tuples / INCREMENTAL_SORT_MIN_BATCH_SIZE));
+	input_groups = Max(input_groups, 1.0);
+
+	group_tuples = input_tuples / input_groups;
+	group_input_run_cost = input_run_cost / input_groups;
+
+	/*
+	 * Estimate the cost of sorting one batch.  Allow for batches being
+	 * uneven in size by assuming each is half again as big as the average.
+	 */
+	cost_sort(&sort_path, root, pathkeys, group_input_run_cost,
+			  1.5 * group_tuples, width, comparison_cost, sort_mem,
+			  limit_tuples);
+
+	group_startup_cost = sort_path.startup_cost;
+	group_run_cost = sort_path.total_cost - sort_path.startup_cost;
+
+	/*
+	 * We have to read and sort the first batch before returning anything;
+	 * the rest are read and sorted as we go.
+	 */
+	startup_cost = input_startup_cost + group_startup_cost;
+	run_cost = group_run_cost +
+		(group_startup_cost + group_run_cost) * (input_groups - 1);
+
+	/*
+	 * Incremental sort also has to compare every tuple's presorted keys with
+	 * the current run's, and set up a fresh sort for each batch.
+	 */
+	run_cost += (cpu_tuple_cost + comparison_cost) * input_tuples;
+	run_cost += 2.0 * cpu_tuple_cost * input_groups;
+
+	path->rows = input_tuples;
+	path->startup_cost = startup_cost;
+	path->total_cost = startup_cost + run_cost;
+}
+
+/*
+ * cost_append
+ *	  Determines and returns the cost of an Append node.
+ *
+ * Rows and costs are the sums of the subpaths' rows and costs.  We charge
+ * nothing extra for the Append itself, which perhaps is too optimistic, but
+ * since it doesn't do any selection or projection, it is a pretty cheap node.
+ *
+ * For a parallel-aware Append, the children are spread across the
+ * participants rather than each participant running all of them, so the
+ * per-participant figures are the children's totals divided among our own
+ * parallel divisor.  A partial child's estimates are already per-participant
+ * for its own worker count, so scale them back up first.  A non-partial child
+ * is run to completion by a single participant, so the Append can't finish
+ * any sooner than its most expensive non-partial child.
+ */
+void
+cost_append(AppendPath *apath)
+{
+	Path	   *path = &apath->path;
+	ListCell   *l;
+	int			i;
+
+	path->rows = 0;
+	path->startup_cost = 0;
+	path->total_cost = 0;
+
+	if (apath->subpaths == NIL)
+		return;
+
+	path->startup_cost = ((Path *) linitial(apath->subpaths))->startup_cost;
+
+	if (!path->parallel_aware)
+	{
+		foreach(l, apath->subpaths)
+		{
+			Path	   *subpath = (Path *) lfirst(l);
+
+			path->rows += subpath->rows;
+			path->total_cost += subpath->total_cost;
+		}
+	}
+	else
+	{
+		double		parallel_divisor = get_parallel_divisor(path);
+		Cost		max_nonpartial_cost = 0;
+
+		i = 0;
+		foreach(l, apath->subpaths)
+		{
+			Path	   *subpath = (Path *) lfirst(l);
+
+			if (i < apath->first_partial_path)
+			{
+				path->rows += subpath->rows / parallel_divisor;
+				path->total_cost += subpath->total_cost / parallel_divisor;
+				max_nonpartial_cost = Max(max_nonpartial_cost,
+										  subpath->total_cost);
+			}
+			else
+			{
+				double		subpath_divisor = get_parallel_divisor(subpath);
+
+				path->rows += subpath->rows * subpath_divisor /
+					parallel_divisor;
+				path->total_cost += subpath->total_cost * subpath_divisor /
+					parallel_divisor;
+			}
+			i++;
+		}
+
+		path->rows = clamp_row_est(path->rows);
+		path->total_cost = Max(path->total_cost, max_nonpartial_cost);
+	}
+}
+
 /*
  * cost_merge_append
  *	  Determines and returns the cost of a MergeAppend node.
@@ -1704,7 +2016,7 @@ cost_agg(Path *path, PlannerInfo *root,
 		 AggStrategy aggstrategy, const AggClauseCosts *aggcosts,
 		 int numGroupCols, double numGroups,
 		 Cost input_startup_cost, Cost input_total_cost,
-		 double input_tuples)
+		 double input_tuples, int input_width)
 {
 	double		output_tuples;
 	Cost		startup_cost;
@@ -1773,6 +2085,8 @@ cost_agg(Path *path, PlannerInfo *root,
 		startup_cost += aggcosts->transCost.startup;
 		startup_cost += aggcosts->transCost.per_tuple * input_tuples;
 		startup_cost += (cpu_operator_cost * numGroupCols) * input_tuples;
+		startup_cost += cost_hashagg_spill(aggcosts, numGroups,
+										   input_tuples, input_width);
 		total_cost = startup_cost;
 		total_cost += aggcosts->finalCost * numGroups;
 		total_cost += cpu_tuple_cost * numGroups;
@@ -1784,6 +2098,47 @@ cost_agg(Path *path, PlannerInfo *root,
 	path->total_cost = total_cost;
 }
 
+/*
+ * cost_hashagg_spill
+ *		Estimate the extra cost of a hashed Agg whose hash table won't fit
+ *		in work_mem.
+ *
+ * Once the table is full, the input tuples of groups not already in it are
+ * written to temporary files and read back later, each file making up to
+ * HASHAGG_MAX_PARTITIONS more if it doesn't fit in turn.  We charge a write
+ * and a read of the fraction of the input that won't fit, for each level of
+ * spilling.  That is not much different from what sorting the input for a
+ * GroupAggregate would cost, as it should be.
+ */
+static Cost
+cost_hashagg_spill(const AggClauseCosts *aggcosts, double numGroups,
+				   double input_tuples, int input_width)
+{
+	double		hashentrysize;
+	double		hash_mem = work_mem * 1024.0;
+	double		spill_fraction;
+	double		spill_pages;
+	double		depth;
+
+	/* Estimate per-hash-entry space at tuple width... */
+	hashentrysize = MAXALIGN(input_width) + MAXALIGN(SizeofMinimalTupleHeader);
+	/* plus space for pass-by-ref transition values... */
+	hashentrysize += aggcosts->transitionSpace;
+	/* plus the per-hash-entry overhead */
+	hashentrysize += hash_agg_entry_size(aggcosts->numAggs);
+
+	if (numGroups * hashentrysize <= hash_mem)
+		return 0;
+
+	spill_fraction = 1.0 - hash_mem / (numGroups * hashentrysize);
+	depth = ceil(log(numGroups * hashentrysize / hash_mem) /
+				 log(HASHAGG_MAX_PARTITIONS));
+	spill_pages = page_size(input_tuples, input_width) * spill_fraction;
+
+	return depth * (2 * seq_page_cost * spill_pages +
+					cpu_tuple_cost * input_tuples * spill_fraction);
+}
+
 /*
  * cost_windowagg
  *		Determines and returns the cost of performing a WindowAgg plan node,
@@ -2304,15 +2659,37 @@ initial_cost_mergejoin(PlannerInfo *root, JoinCostWorkspace *workspace,
 
 	if (outersortkeys)			/* do we need to sort outer? */
 	{
-		cost_sort(&sort_path,
-				  root,
-				  outersortkeys,
-				  outer_path->total_cost,
-				  outer_path_rows,
-				  outer_path->pathtarget->width,
-				  0.0,
-				  work_mem,
-				  -1.0);
+		int			outer_presorted_keys;
+
+		/*
+		 * If the outer path is already sorted on some leading merge keys,
+		 * create_mergejoin_plan will use an incremental sort; cost it so.
+		 */
+		(void) pathkeys_count_contained_in(outersortkeys,
+										   outer_path->pathkeys,
+										   &outer_presorted_keys);
+		if (enable_incrementalsort && outer_presorted_keys > 0)
+			cost_incremental_sort(&sort_path,
+								  root,
+								  outersortkeys,
+								  outer_presorted_keys,
+								  outer_path->startup_cost,
+								  outer_path->total_cost,
+								  outer_path_rows,
+								  outer_path->pathtarget->width,
+								  0.0,
+								  work_mem,
+								  -1.0);
+		else
+			cost_sort(&sort_path,
+					  root,
+					  outersortkeys,
+					  outer_path->total_cost,
+					  outer_path_rows,
+					  outer_path->pathtarget->width,
+					  0.0,
+					  work_mem,
+					  -1.0);
 		startup_cost += sort_path.startup_cost;
 		startup_cost += (sort_path.total_cost - sort_path.startup_cost)
 			* outerstartsel;
@@ -2687,6 +3064,8 @@ cached_scansel(PlannerInfo *root, RestrictInfo *rinfo, PathKey *pathkey)
  * 'inner_path' is the inner input to the join
  * 'sjinfo' is extra info about the join for selectivity estimation
  * 'semifactors' contains valid data if jointype is SEMI or ANTI
+ * 'parallel_hash' indicates that inner_path is partial and that a shared
+ *		hash table will be built in parallel
  */
 void
 initial_cost_hashjoin(PlannerInfo *root, JoinCostWorkspace *workspace,
@@ -2694,12 +3073,14 @@ initial_cost_hashjoin(PlannerInfo *root, JoinCostWorkspace *workspace,
 					  List *hashclauses,
 					  Path *outer_path, Path *inner_path,
 					  SpecialJoinInfo *sjinfo,
-					  SemiAntiJoinFactors *semifactors)
+					  SemiAntiJoinFactors *semifactors,
+					  bool parallel_hash)
 {
 	Cost		startup_cost = 0;
 	Cost		run_cost = 0;
 	double		outer_path_rows = outer_path->rows;
 	double		inner_path_rows = inner_path->rows;
+	double		inner_path_rows_total = inner_path_rows;
 	int			num_hashclauses = list_length(hashclauses);
 	int			numbuckets;
 	int			numbatches;
@@ -2733,13 +3114,30 @@ initial_cost_hashjoin(PlannerInfo *root, JoinCostWorkspace *workspace,
 	 *
 	 * XXX at some point it might be interesting to try to account for skew
 	 * optimization in the cost estimate, but for now, we don't.
+	 *
+	 * A shared hash table holds the inner rows of all participants, and can
+	 * use the work_mem of all of them.  Each participant still hashes only
+	 * its own share of the rows, so the CPU costs above stay as they are.
 	 */
-	ExecChooseHashTableSize(inner_path_rows,
-							inner_path->pathtarget->width,
-							true,		/* useskew */
-							&numbuckets,
-							&numbatches,
-							&num_skew_mcvs);
+	if (parallel_hash)
+	{
+		Size		area_size;
+
+		inner_path_rows_total *= get_parallel_divisor(inner_path);
+		ExecChooseParallelHashTableSize(inner_path_rows_total,
+										inner_path->pathtarget->width,
+										inner_path->parallel_workers + 1,
+										&numbuckets,
+										&numbatches,
+										&area_size);
+	}
+	else
+		ExecChooseHashTableSize(inner_path_rows,
+								inner_path->pathtarget->width,
+								true,	/* useskew */
+								&numbuckets,
+								&numbatches,
+								&num_skew_mcvs);
 
 	/*
 	 * If inner relation is too big then we will need to "batch" the join,
@@ -2768,6 +3166,7 @@ initial_cost_hashjoin(PlannerInfo *root, JoinCostWorkspace *workspace,
 	workspace->run_cost = run_cost;
 	workspace->numbuckets = numbuckets;
 	workspace->numbatches = numbatches;
+	workspace->inner_rows_total = inner_path_rows_total;
 }
 
 /*
@@ -2791,7 +3190,7 @@ final_cost_hashjoin(PlannerInfo *root, HashPath *path,
 	Path	   *outer_path = path->jpath.outerjoinpath;
 	Path	   *inner_path = path->jpath.innerjoinpath;
 	double		outer_path_rows = outer_path->rows;
-	double		inner_path_rows = inner_path->rows;
+	double		inner_path_rows_total = workspace->inner_rows_total;
 	List	   *hashclauses = path->path_hashclauses;
 	Cost		startup_cost = workspace->startup_cost;
 	Cost		run_cost = workspace->run_cost;
@@ -2822,6 +3221,9 @@ final_cost_hashjoin(PlannerInfo *root, HashPath *path,
 	/* mark the path with estimated # of batches */
 	path->num_batches = numbatches;
 
+	/* store the total number of tuples (sum of partial row estimates) */
+	path->inner_rows_total = inner_path_rows_total;
+
 	/* and compute the number of "virtual" buckets in the whole join */
 	virtualbuckets = (double) numbuckets *(double) numbatches;
 
@@ -2924,24 +3326,25 @@ final_cost_hashjoin(PlannerInfo *root, HashPath *path,
 
 		startup_cost += hash_qual_cost.startup;
 		run_cost += hash_qual_cost.per_tuple * outer_matched_rows *
-			clamp_row_est(inner_path_rows * innerbucketsize * inner_scan_frac) * 0.5;
+			clamp_row_est(inner_path_rows_total * innerbucketsize *
+						  inner_scan_frac) * 0.5;
 
 		/*
 		 * For unmatched outer-rel rows, the picture is quite a lot different.
 		 * In the first place, there is no reason to assume that these rows
 		 * preferentially hit heavily-populated buckets; instead assume they
 		 * are uncorrelated with the inner distribution and so they see an
-		 * average bucket size of inner_path_rows / virtualbuckets.  In the
-		 * second place, it seems likely that they will have few if any exact
-		 * hash-code matches and so very few of the tuples in the bucket will
-		 * actually require eval of the hash quals.  We don't have any good
+		 * average bucket size of inner_path_rows_total / virtualbuckets.  In
+		 * the second place, it seems likely that they will have few if any
+		 * exact hash-code matches and so very few of the tuples in the bucket
+		 * will actually require eval of the hash quals.  We don't have any good
 		 * way to estimate how many will, but for the moment assume that the
 		 * effective cost per bucket entry is one-tenth what it is for
 		 * matchable tuples.
 		 */
 		run_cost += hash_qual_cost.per_tuple *
 			(outer_path_rows - outer_matched_rows) *
-			clamp_row_est(inner_path_rows / virtualbuckets) * 0.05;
+			clamp_row_est(inner_path_rows_total / virtualbuckets) * 0.05;
 
 		/* Get # of tuples that will pass the basic join */
 		if (path->jpath.jointype == JOIN_SEMI)
@@ -2963,7 +3366,7 @@ final_cost_hashjoin(PlannerInfo *root, HashPath *path,
 		 */
 		startup_cost += hash_qual_cost.startup;
 		run_cost += hash_qual_cost.per_tuple * outer_path_rows *
-			clamp_row_est(inner_path_rows * innerbucketsize) * 0.5;
+			clamp_row_est(inner_path_rows_total * innerbucketsize) * 0.5;
 
 		/*
 		 * Get approx # tuples passing the hashquals.  We use
@@ -3078,6 +3481,129 @@ cost_subplan(PlannerInfo *root, SubPlan *subplan, Plan *plan)
 }
 
 
+/*
+ * has_default_ndistinct
+ *	  Does estimating the number of distinct values of any of the given
+ *	  expressions fall back on a default for lack of statistics?
+ */
+static bool
+has_default_ndistinct(PlannerInfo *root, List *exprs)
+{
+	List	   *varlist;
+	ListCell   *lc;
+	bool		result = false;
+
+	varlist = pull_var_clause((Node *) exprs,
+							  PVC_RECURSE_AGGREGATES |
+							  PVC_RECURSE_WINDOWFUNCS |
+							  PVC_INCLUDE_PLACEHOLDERS);
+	foreach(lc, varlist)
+	{
+		VariableStatData vardata;
+		bool		isdefault;
+
+		examine_variable(root, (Node *) lfirst(lc), 0, &vardata);
+		(void) get_variable_numdistinct(&vardata, &isdefault);
+		ReleaseVariableStats(vardata);
+
+		if (isdefault)
+		{
+			result = true;
+			break;
+		}
+	}
+	list_free(varlist);
+
+	return result;
+}
+
+/*
+ * cost_resultcache_rescan
+ *	  Determines the estimated cost of rescanning a ResultCache node.
+ *
+ * The cost of a rescan depends on how likely its parameter values are to
+ * be found in the cache already.  We estimate the number of distinct
+ * values among the expected calls and how many entries fit in work_mem,
+ * and from those, the fraction of calls that will be cache hits.  Since
+ * nestloops charge the same rescan cost for every call, what we produce
+ * is the average over all of them.
+ *
+ * As a side effect, this sets rcpath->est_entries, which the executor
+ * uses to size its hash table.
+ */
+static void
+cost_resultcache_rescan(PlannerInfo *root, ResultCachePath *rcpath,
+						Cost *rescan_startup_cost, Cost *rescan_total_cost)
+{
+	Path	   *subpath = rcpath->subpath;
+	double		tuples = rcpath->path.rows;
+	double		calls = Max(rcpath->calls, 1.0);
+	int			width = rcpath->path.pathtarget->width;
+	double		est_entry_bytes;
+	double		est_cache_entries;
+	double		ndistinct;
+	double		evict_ratio;
+	double		hit_ratio;
+	Cost		startup_cost;
+	Cost		total_cost;
+
+	/* estimate the size of one entry */
+	est_entry_bytes = relation_byte_size(tuples, width) +
+		ExecEstimateCacheEntryOverheadBytes(tuples);
+
+	/* and how many of them fit in the cache */
+	est_cache_entries = floor((work_mem * 1024.0) / est_entry_bytes);
+
+	/*
+	 * The number of distinct keys we expect to see.  A cache that's useless
+	 * costs more than no cache, but one that works can win by a lot, so a
+	 * guess is too risky here: if there are no statistics to go on, assume
+	 * that every call has different parameters.
+	 */
+	if (has_default_ndistinct(root, rcpath->param_exprs))
+		ndistinct = calls;
+	else
+		ndistinct = estimate_num_groups(root, rcpath->param_exprs, calls,
+										NULL);
+	ndistinct = clamp_row_est(Min(ndistinct, calls));
+
+	rcpath->est_entries = (uint32) Min(Min(ndistinct, est_cache_entries),
+									   PG_UINT32_MAX);
+
+	/*
+	 * If more keys are live than fit in the cache, this is the fraction of
+	 * misses that will have to evict an entry to make room.
+	 */
+	evict_ratio = 1.0 - Min(est_cache_entries, ndistinct) / ndistinct;
+
+	/*
+	 * Every key misses on its first call; after that, it hits if its entry
+	 * is still cached.  We assume keys arrive in random order, so that an
+	 * entry survives in proportion to how much of the key set fits.
+	 */
+	hit_ratio = ((calls - ndistinct) / calls) *
+		(est_cache_entries / Max(ndistinct, est_cache_entries));
+	hit_ratio = Max(Min(hit_ratio, 1.0), 0.0);
+
+	/*
+	 * A miss costs a scan of the subpath; every call pays for the lookup.
+	 * Evictions cost a little for the entry and each of its tuples.
+	 */
+	startup_cost = subpath->startup_cost * (1.0 - hit_ratio);
+	total_cost = subpath->total_cost * (1.0 - hit_ratio);
+
+	startup_cost += cpu_operator_cost;
+	total_cost += cpu_operator_cost;
+	total_cost += evict_ratio * (1.0 - hit_ratio) *
+		(cpu_tuple_cost + cpu_operator_cost * tuples);
+
+	/* fetching a cached tuple is about as cheap as a Material rescan */
+	total_cost += hit_ratio * cpu_operator_cost * tuples;
+
+	*rescan_startup_cost = startup_cost;
+	*rescan_total_cost = total_cost;
+}
+
 /*
  * cost_rescan
  *		Given a finished Path, estimate the costs of rescanning it after
@@ -3182,6 +3708,10 @@ cost_rescan(PlannerInfo *root, Path *path,
 				*rescan_total_cost = run_cost;
 			}
 			break;
+		case T_ResultCache:
+			cost_resultcache_rescan(root, (ResultCachePath *) path,
+									rescan_startup_cost, rescan_total_cost);
+			break;
 		default:
 			*rescan_startup_cost = path->startup_cost;
 			*rescan_total_cost = path->total_cost;
@@ -4765,3 +5295,31 @@ page_size(double tuples, int width)
 {
 	return ceil(relation_byte_size(tuples, width) / BLCKSZ);
 }
+
+/*
+ * Estimate the fraction of the work that each worker will do given the
+ * number of workers budgeted for the path.
+ */
+static double
+get_parallel_divisor(Path *path)
+{
+	double		parallel_divisor = path->parallel_workers;
+	double		leader_contribution;
+
+	/*
+	 * Early experience with parallel query suggests that when there is only
+	 * one worker, the leader often makes a very substantial contribution to
+	 * executing the parallel portion of the plan, but as more workers are
+	 * added, it does less and less, because it's busy reading tuples from the
+	 * workers and doing whatever non-parallel post-processing is needed.  By
+	 * the time we reach 4 workers, the leader no longer makes a meaningful
+	 * contribution.  Thus, for now, estimate that the leader spends 30% of
+	 * its time servicing each worker, and the remainder executing the
+	 * parallel plan.
+	 */
+	leader_contribution = 1.0 - (0.3 * path->parallel_workers);
+	if (leader_contribution > 0)
+		parallel_divisor += leader_contribution;
+
+	return parallel_divisor;
+}
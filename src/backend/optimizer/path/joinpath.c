@@ -18,6 +18,8 @@
 
 #include "executor/executor.h"
 #include "foreign/fdwapi.h"
+#include "nodes/nodeFuncs.h"
+#include "optimizer/clauses.h"
 #include "optimizer/cost.h"
 #include "optimizer/pathnode.h"
 #include "optimizer/paths.h"
@@ -261,6 +263,108 @@ allow_star_schema_join(PlannerInfo *root,
 			bms_nonempty_difference(innerparams, outerrelids));
 }
 
+/*
+ * get_resultcache_path
+ *	  If possible, make a ResultCache path to cache the results of inner_path
+ *	  across the rescans a nestloop with outer_path would do.  Returns NULL
+ *	  if that's not possible or not sensible.
+ *
+ * The cache key is the outer side of each of the inner path's parameterized
+ * join clauses.  Those must be the only references to the outer rel in the
+ * inner path, else the cached results could be wrong for a key, so we insist
+ * that the inner rel is a base rel without lateral references.  Volatile
+ * functions in the inner rel rule out caching too, since a cache hit would
+ * skip calls to them.
+ */
+static Path *
+get_resultcache_path(PlannerInfo *root, RelOptInfo *innerrel,
+					 RelOptInfo *outerrel, Path *inner_path,
+					 Path *outer_path, JoinType jointype,
+					 JoinPathExtraData *extra)
+{
+	List	   *param_exprs = NIL;
+	bool		singlerow;
+	ListCell   *lc;
+
+	if (!enable_resultcache)
+		return NULL;
+
+	/* There's no point in caching for an outer side with a single row */
+	if (outer_path->rows < 2)
+		return NULL;
+
+	/* The inner path must be parameterized by the outer rel, and only it */
+	if (inner_path->param_info == NULL ||
+		inner_path->param_info->ppi_clauses == NIL ||
+		!bms_is_subset(PATH_REQ_OUTER(inner_path), outerrel->relids))
+		return NULL;
+
+	if (innerrel->reloptkind != RELOPT_BASEREL ||
+		!bms_is_empty(innerrel->lateral_relids))
+		return NULL;
+
+	if (contain_volatile_functions((Node *) innerrel->reltarget->exprs))
+		return NULL;
+	foreach(lc, innerrel->baserestrictinfo)
+	{
+		RestrictInfo *rinfo = (RestrictInfo *) lfirst(lc);
+
+		if (contain_volatile_functions((Node *) rinfo->clause))
+			return NULL;
+	}
+
+	/*
+	 * Collect the outer side of each parameterized clause.  Each must be a
+	 * binary operator clause with the outer rel's expression on one side and
+	 * the inner rel's on the other.
+	 */
+	foreach(lc, inner_path->param_info->ppi_clauses)
+	{
+		RestrictInfo *rinfo = (RestrictInfo *) lfirst(lc);
+		OpExpr	   *opexpr = (OpExpr *) rinfo->clause;
+		Node	   *expr;
+
+		if (!IsA(opexpr, OpExpr) || list_length(opexpr->args) != 2 ||
+			contain_volatile_functions((Node *) opexpr))
+			return NULL;
+
+		if (bms_is_subset(rinfo->left_relids, outerrel->relids) &&
+			!bms_overlap(rinfo->right_relids, outerrel->relids))
+			expr = (Node *) linitial(opexpr->args);
+		else if (bms_is_subset(rinfo->right_relids, outerrel->relids) &&
+				 !bms_overlap(rinfo->left_relids, outerrel->relids))
+			expr = (Node *) lsecond(opexpr->args);
+		else
+			return NULL;
+
+		param_exprs = list_append_unique(param_exprs, expr);
+	}
+
+	/*
+	 * A semi or anti join stops reading the inner side at the first match.
+	 * If no join clauses remain to be checked at the join itself, the first
+	 * inner row is a match, so each cache entry is complete after one row.
+	 */
+	singlerow = false;
+	if (jointype == JOIN_SEMI || jointype == JOIN_ANTI)
+	{
+		singlerow = true;
+		foreach(lc, extra->restrictlist)
+		{
+			if (!list_member_ptr(inner_path->param_info->ppi_clauses,
+								 lfirst(lc)))
+			{
+				singlerow = false;
+				break;
+			}
+		}
+	}
+
+	return (Path *) create_resultcache_path(root, innerrel, inner_path,
+											param_exprs, singlerow,
+											outer_path->rows);
+}
+
 /*
  * try_nestloop_path
  *	  Consider a nestloop join path; if it appears useful, push it into
@@ -508,7 +612,7 @@ try_hashjoin_path(PlannerInfo *root,
 	 */
 	initial_cost_hashjoin(root, &workspace, jointype, hashclauses,
 						  outer_path, inner_path,
-						  extra->sjinfo, &extra->semifactors);
+						  extra->sjinfo, &extra->semifactors, false);
 
 	if (add_path_precheck(joinrel,
 						  workspace.startup_cost, workspace.total_cost,
@@ -523,6 +627,7 @@ try_hashjoin_path(PlannerInfo *root,
 									  &extra->semifactors,
 									  outer_path,
 									  inner_path,
+									  false,	/* parallel_hash */
 									  extra->restrictlist,
 									  required_outer,
 									  hashclauses));
@@ -538,6 +643,11 @@ try_hashjoin_path(PlannerInfo *root,
  * try_partial_hashjoin_path
  *	  Consider a partial hashjoin join path; if it appears useful, push it into
  *	  the joinrel's partial_pathlist via add_partial_path().
+ *	  The outer side is partial.  If parallel_hash is true, then the inner path
+ *	  must be partial and will be run in parallel to create one or more shared
+ *	  hash tables; otherwise the inner path must be complete and a copy of it
+ *	  is run in every process to create separate identical private hash
+ *	  tables.
  */
 static void
 try_partial_hashjoin_path(PlannerInfo *root,
@@ -546,7 +656,8 @@ try_partial_hashjoin_path(PlannerInfo *root,
 						  Path *inner_path,
 						  List *hashclauses,
 						  JoinType jointype,
-						  JoinPathExtraData *extra)
+						  JoinPathExtraData *extra,
+						  bool parallel_hash)
 {
 	JoinCostWorkspace workspace;
 
@@ -571,7 +682,7 @@ try_partial_hashjoin_path(PlannerInfo *root,
 	 */
 	initial_cost_hashjoin(root, &workspace, jointype, hashclauses,
 						  outer_path, inner_path,
-						  extra->sjinfo, &extra->semifactors);
+						  extra->sjinfo, &extra->semifactors, parallel_hash);
 	if (!add_partial_path_precheck(joinrel, workspace.total_cost, NIL))
 		return;
 
@@ -585,6 +696,7 @@ try_partial_hashjoin_path(PlannerInfo *root,
 										  &extra->semifactors,
 										  outer_path,
 										  inner_path,
+										  parallel_hash,
 										  extra->restrictlist,
 										  NULL,
 										  hashclauses));
@@ -957,6 +1069,7 @@ match_unsorted_outer(PlannerInfo *root,
 			foreach(lc2, innerrel->cheapest_parameterized_paths)
 			{
 				Path	   *innerpath = (Path *) lfirst(lc2);
+				Path	   *rcpath;
 
 				try_nestloop_path(root,
 								  joinrel,
@@ -965,6 +1078,22 @@ match_unsorted_outer(PlannerInfo *root,
 								  merge_pathkeys,
 								  jointype,
 								  extra);
+
+				/*
+				 * Also consider caching the inner path's results, in case
+				 * the outer path repeats parameter values.
+				 */
+				rcpath = get_resultcache_path(root, innerrel, outerrel,
+											  innerpath, outerpath, jointype,
+											  extra);
+				if (rcpath != NULL)
+					try_nestloop_path(root,
+									  joinrel,
+									  outerpath,
+									  rcpath,
+									  merge_pathkeys,
+									  jointype,
+									  extra);
 			}
 
 			/* Also consider materialized form of the cheapest inner path */
@@ -1238,6 +1367,7 @@ consider_parallel_nestloop(PlannerInfo *root,
 		foreach(lc2, innerrel->cheapest_parameterized_paths)
 		{
 			Path	   *innerpath = (Path *) lfirst(lc2);
+			Path	   *rcpath;
 
 			/* Can't join to an inner path that is not parallel-safe */
 			if (!innerpath->parallel_safe)
@@ -1261,6 +1391,14 @@ consider_parallel_nestloop(PlannerInfo *root,
 
 			try_partial_nestloop_path(root, joinrel, outerpath, innerpath,
 									  pathkeys, jointype, extra);
+
+			/* Each worker can keep its own cache of the inner path, too */
+			rcpath = get_resultcache_path(root, innerrel, outerrel,
+										  innerpath, outerpath, jointype,
+										  extra);
+			if (rcpath != NULL)
+				try_partial_nestloop_path(root, joinrel, outerpath, rcpath,
+										  pathkeys, jointype, extra);
 		}
 	}
 }
@@ -1284,6 +1422,7 @@ hash_inner_and_outer(PlannerInfo *root,
 					 JoinType jointype,
 					 JoinPathExtraData *extra)
 {
+	JoinType	save_jointype = jointype;
 	bool		isouterjoin = IS_OUTER_JOIN(jointype);
 	List	   *hashclauses;
 	ListCell   *l;
@@ -1457,11 +1596,30 @@ hash_inner_and_outer(PlannerInfo *root,
 			bms_is_empty(joinrel->lateral_relids))
 		{
 			Path	   *cheapest_partial_outer;
+			Path	   *cheapest_partial_inner = NULL;
 			Path	   *cheapest_safe_inner = NULL;
 
 			cheapest_partial_outer =
 				(Path *) linitial(outerrel->partial_pathlist);
 
+			if (innerrel->partial_pathlist != NIL)
+				cheapest_partial_inner =
+					(Path *) linitial(innerrel->partial_pathlist);
+
+			/*
+			 * If we can use a partial inner plan too, we can build a shared
+			 * hash table in parallel.  We can't do that for a unique-ified
+			 * inner, because the inner path is then not partial.
+			 */
+			if (enable_parallel_hash &&
+				cheapest_partial_inner != NULL &&
+				save_jointype != JOIN_UNIQUE_INNER)
+				try_partial_hashjoin_path(root, joinrel,
+										  cheapest_partial_outer,
+										  cheapest_partial_inner,
+										  hashclauses, jointype, extra,
+										  true /* parallel_hash */ );
+
 			/*
 			 * Normally, given that the joinrel is parallel-safe, the cheapest
 			 * total inner path will also be parallel-safe, but if not, we'll
@@ -1491,7 +1649,8 @@ hash_inner_and_outer(PlannerInfo *root,
 				try_partial_hashjoin_path(root, joinrel,
 										  cheapest_partial_outer,
 										  cheapest_safe_inner,
-										  hashclauses, jointype, extra);
+										  hashclauses, jointype, extra,
+										  false /* parallel_hash */ );
 		}
 	}
 }
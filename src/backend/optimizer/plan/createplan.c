@@ -81,14 +81,20 @@ static Plan *create_join_plan(PlannerInfo *root, JoinPath *best_path);
 static Plan *create_append_plan(PlannerInfo *root, AppendPath *best_path);
 static Plan *create_merge_append_plan(PlannerInfo *root, MergeAppendPath *best_path);
 static Result *create_result_plan(PlannerInfo *root, ResultPath *best_path);
+static ResultCache *create_resultcache_plan(PlannerInfo *root,
+						ResultCachePath *best_path, int flags);
 static Material *create_material_plan(PlannerInfo *root, MaterialPath *best_path,
 					 int flags);
 static Plan *create_unique_plan(PlannerInfo *root, UniquePath *best_path,
 				   int flags);
 static Gather *create_gather_plan(PlannerInfo *root, GatherPath *best_path);
+static GatherMerge *create_gather_merge_plan(PlannerInfo *root,
+						 GatherMergePath *best_path);
 static Plan *create_projection_plan(PlannerInfo *root, ProjectionPath *best_path);
 static Plan *inject_projection_plan(Plan *subplan, List *tlist);
 static Sort *create_sort_plan(PlannerInfo *root, SortPath *best_path, int flags);
+static IncrementalSort *create_incrementalsort_plan(PlannerInfo *root,
+							IncrementalSortPath *best_path, int flags);
 static Group *create_group_plan(PlannerInfo *root, GroupPath *best_path);
 static Unique *create_upper_unique_plan(PlannerInfo *root, UpperUniquePath *best_path,
 						 int flags);
@@ -158,6 +164,9 @@ static void copy_generic_path_info(Plan *dest, Path *src);
 static void copy_plan_costsize(Plan *dest, Plan *src);
 static void label_sort_with_costsize(PlannerInfo *root, Sort *plan,
 						 double limit_tuples);
+static void label_incrementalsort_with_costsize(PlannerInfo *root,
+									IncrementalSort *plan,
+									List *pathkeys, double limit_tuples);
 static SeqScan *make_seqscan(List *qptlist, List *qpqual, Index scanrelid);
 static SampleScan *make_samplescan(List *qptlist, List *qpqual, Index scanrelid,
 				TableSampleClause *tsc);
@@ -193,7 +202,8 @@ static CteScan *make_ctescan(List *qptlist, List *qpqual,
 			 Index scanrelid, int ctePlanId, int cteParam);
 static WorkTableScan *make_worktablescan(List *qptlist, List *qpqual,
 				   Index scanrelid, int wtParam);
-static Append *make_append(List *appendplans, List *tlist);
+static Append *make_append(List *appendplans, int first_partial_plan,
+			List *tlist);
 static RecursiveUnion *make_recursive_union(List *tlist,
 					 Plan *lefttree,
 					 Plan *righttree,
@@ -229,6 +239,10 @@ static MergeJoin *make_mergejoin(List *tlist,
 static Sort *make_sort(Plan *lefttree, int numCols,
 		  AttrNumber *sortColIdx, Oid *sortOperators,
 		  Oid *collations, bool *nullsFirst);
+static IncrementalSort *make_incrementalsort(Plan *lefttree,
+					 int numCols, int presortedCols,
+					 AttrNumber *sortColIdx, Oid *sortOperators,
+					 Oid *collations, bool *nullsFirst);
 static Plan *prepare_sort_from_pathkeys(Plan *lefttree, List *pathkeys,
 						   Relids relids,
 						   const AttrNumber *reqColIdx,
@@ -242,10 +256,14 @@ static EquivalenceMember *find_ec_member_for_tle(EquivalenceClass *ec,
 					   TargetEntry *tle,
 					   Relids relids);
 static Sort *make_sort_from_pathkeys(Plan *lefttree, List *pathkeys);
+static IncrementalSort *make_incrementalsort_from_pathkeys(Plan *lefttree,
+								   List *pathkeys, int presortedCols);
 static Sort *make_sort_from_groupcols(List *groupcls,
 						 AttrNumber *grpColIdx,
 						 Plan *lefttree);
 static Material *make_material(Plan *lefttree);
+static ResultCache *make_resultcache(Plan *lefttree, List *param_exprs,
+				 bool singlerow, uint32 est_entries);
 static WindowAgg *make_windowagg(List *tlist, Index winref,
 			   int partNumCols, AttrNumber *partColIdx, Oid *partOperators,
 			   int ordNumCols, AttrNumber *ordColIdx, Oid *ordOperators,
@@ -397,6 +415,11 @@ create_plan_recurse(PlannerInfo *root, Path *best_path, int flags)
 												 (MaterialPath *) best_path,
 												 flags);
 			break;
+		case T_ResultCache:
+			plan = (Plan *) create_resultcache_plan(root,
+												(ResultCachePath *) best_path,
+													flags);
+			break;
 		case T_Unique:
 			if (IsA(best_path, UpperUniquePath))
 			{
@@ -416,11 +439,20 @@ create_plan_recurse(PlannerInfo *root, Path *best_path, int flags)
 			plan = (Plan *) create_gather_plan(root,
 											   (GatherPath *) best_path);
 			break;
+		case T_GatherMerge:
+			plan = (Plan *) create_gather_merge_plan(root,
+												(GatherMergePath *) best_path);
+			break;
 		case T_Sort:
 			plan = (Plan *) create_sort_plan(root,
 											 (SortPath *) best_path,
 											 flags);
 			break;
+		case T_IncrementalSort:
+			plan = (Plan *) create_incrementalsort_plan(root,
+											(IncrementalSortPath *) best_path,
+														flags);
+			break;
 		case T_Group:
 			plan = (Plan *) create_group_plan(root,
 											  (GroupPath *) best_path);
@@ -761,6 +793,15 @@ use_physical_tlist(PlannerInfo *root, Path *path, int flags)
 	if (rel->reloptkind != RELOPT_BASEREL)
 		return false;
 
+	/*
+	 * If a bitmap scan's tlist is empty, keep it as-is.  This may allow the
+	 * executor to skip heap page fetches, and in any case, the benefit of
+	 * using a physical tlist instead would be minimal.
+	 */
+	if (IsA(path, BitmapHeapPath) &&
+		path->pathtarget->exprs == NIL)
+		return false;
+
 	/*
 	 * Can't do it if any system columns or whole-row Vars are requested.
 	 * (This could possibly be fixed but would take some fragile assumptions
@@ -1001,7 +1042,7 @@ create_append_plan(PlannerInfo *root, AppendPath *best_path)
 	 * parent-rel Vars it'll be asked to emit.
 	 */
 
-	plan = make_append(subplans, tlist);
+	plan = make_append(subplans, best_path->first_partial_path, tlist);
 
 	copy_generic_path_info(&plan->plan, (Path *) best_path);
 
@@ -1169,6 +1210,40 @@ create_material_plan(PlannerInfo *root, MaterialPath *best_path, int flags)
 	return plan;
 }
 
+/*
+ * create_resultcache_plan
+ *	  Create a ResultCache plan for 'best_path' and (recursively) plans
+ *	  for its subpaths.
+ *
+ *	  Returns a Plan node.
+ */
+static ResultCache *
+create_resultcache_plan(PlannerInfo *root, ResultCachePath *best_path,
+						int flags)
+{
+	ResultCache *plan;
+	Plan	   *subplan;
+	List	   *param_exprs;
+
+	/* As for Material, keep the cached tuples narrow */
+	subplan = create_plan_recurse(root, best_path->subpath,
+								  flags | CP_SMALL_TLIST);
+
+	/*
+	 * The cache key refers to the outer rel of the nestloop we're below, so
+	 * its Vars must become the nestloop's parameters, as in the subplan.
+	 */
+	param_exprs = (List *) replace_nestloop_params(root, (Node *)
+												   best_path->param_exprs);
+
+	plan = make_resultcache(subplan, param_exprs, best_path->singlerow,
+							best_path->est_entries);
+
+	copy_generic_path_info(&plan->plan, (Path *) best_path);
+
+	return plan;
+}
+
 /*
  * create_unique_plan
  *	  Create a Unique plan for 'best_path' and (recursively) plans
@@ -1407,6 +1482,62 @@ create_gather_plan(PlannerInfo *root, GatherPath *best_path)
 	return gather_plan;
 }
 
+/*
+ * create_gather_merge_plan
+ *
+ *	  Create a Gather Merge plan for 'best_path' and (recursively)
+ *	  plans for its subpaths.
+ */
+static GatherMerge *
+create_gather_merge_plan(PlannerInfo *root, GatherMergePath *best_path)
+{
+	GatherMerge *gm_plan;
+	Plan	   *subplan;
+	List	   *pathkeys = best_path->path.pathkeys;
+	List	   *tlist;
+
+	/* As with Gather, it's best to project away columns in the workers. */
+	subplan = create_plan_recurse(root, best_path->subpath, CP_EXACT_TLIST);
+
+	tlist = build_path_tlist(root, &best_path->path);
+
+	gm_plan = makeNode(GatherMerge);
+	copy_generic_path_info(&gm_plan->plan, &best_path->path);
+	gm_plan->plan.targetlist = tlist;
+	gm_plan->plan.qual = NIL;
+	gm_plan->num_workers = best_path->path.parallel_workers;
+
+	/*
+	 * The merge compares the tuples coming out of the subplan, so the sort
+	 * columns are identified by their position in the subplan's tlist.
+	 * Compute them, adding resjunk sort columns to the subplan if needed.
+	 */
+	subplan = prepare_sort_from_pathkeys(subplan, pathkeys,
+										 best_path->subpath->parent->relids,
+										 NULL,
+										 false,
+										 &gm_plan->numCols,
+										 &gm_plan->sortColIdx,
+										 &gm_plan->sortOperators,
+										 &gm_plan->collations,
+										 &gm_plan->nullsFirst);
+
+	/* Now, insert a Sort node if subplan isn't sufficiently ordered */
+	if (!pathkeys_contained_in(pathkeys, best_path->subpath->pathkeys))
+		subplan = (Plan *) make_sort(subplan, gm_plan->numCols,
+									 gm_plan->sortColIdx,
+									 gm_plan->sortOperators,
+									 gm_plan->collations,
+									 gm_plan->nullsFirst);
+
+	gm_plan->plan.lefttree = subplan;
+
+	/* use parallel mode for parallel plans. */
+	root->glob->parallelModeNeeded = true;
+
+	return gm_plan;
+}
+
 /*
  * create_projection_plan
  *
@@ -1520,6 +1651,30 @@ create_sort_plan(PlannerInfo *root, SortPath *best_path, int flags)
 	return plan;
 }
 
+/*
+ * create_incrementalsort_plan
+ *
+ *	  Do the same as create_sort_plan, but create IncrementalSort plan.
+ */
+static IncrementalSort *
+create_incrementalsort_plan(PlannerInfo *root, IncrementalSortPath *best_path,
+							int flags)
+{
+	IncrementalSort *plan;
+	Plan	   *subplan;
+
+	/* See comments in create_sort_plan() above */
+	subplan = create_plan_recurse(root, best_path->spath.subpath,
+								  flags | CP_SMALL_TLIST);
+	plan = make_incrementalsort_from_pathkeys(subplan,
+											  best_path->spath.path.pathkeys,
+											  best_path->nPresortedCols);
+
+	copy_generic_path_info(&plan->sort.plan, (Path *) best_path);
+
+	return plan;
+}
+
 /*
  * create_group_plan
  *
@@ -1670,6 +1825,11 @@ remap_groupColIdx(PlannerInfo *root, List *groupClause)
  *	  but they are a convenient way to represent the required data for
  *	  the extra steps.
  *
+ *	  If any grouping sets are hashed, the top Agg implements the first
+ *	  hashed set instead, and the chain lists the other hashed sets (as Agg
+ *	  nodes without a Sort) before the sorted rollups, of which the one the
+ *	  input is presorted for comes first and also has no Sort.
+ *
  *	  Returns a Plan node.
  */
 static Plan *
@@ -1679,6 +1839,7 @@ create_groupingsets_plan(PlannerInfo *root, GroupingSetsPath *best_path)
 	Plan	   *subplan;
 	List	   *rollup_groupclauses = best_path->rollup_groupclauses;
 	List	   *rollup_lists = best_path->rollup_lists;
+	List	   *hashed_sets = best_path->hashed_sets;
 	AttrNumber *grouping_map;
 	int			maxref;
 	List	   *chain;
@@ -1687,7 +1848,7 @@ create_groupingsets_plan(PlannerInfo *root, GroupingSetsPath *best_path)
 
 	/* Shouldn't get here without grouping sets */
 	Assert(root->parse->groupingSets);
-	Assert(rollup_lists != NIL);
+	Assert(rollup_lists != NIL || hashed_sets != NIL);
 	Assert(list_length(rollup_lists) == list_length(rollup_groupclauses));
 
 	/*
@@ -1740,6 +1901,50 @@ create_groupingsets_plan(PlannerInfo *root, GroupingSetsPath *best_path)
 	 * costs will be shown by EXPLAIN.
 	 */
 	chain = NIL;
+
+	if (best_path->aggstrategy != AGG_SORTED)
+	{
+		/* The hashed sets other than the first, which is the top node */
+		for_each_cell(lc, lnext(list_head(hashed_sets)))
+		{
+			HashedGroupingSet *hs = (HashedGroupingSet *) lfirst(lc);
+
+			chain = lappend(chain,
+							make_agg(NIL,
+									 NIL,
+									 AGG_HASHED,
+									 AGGSPLIT_SIMPLE,
+									 list_length(hs->set),
+									 remap_groupColIdx(root, hs->groupClause),
+									 extract_grouping_ops(hs->groupClause),
+									 list_make1(hs->set),
+									 NIL,
+									 Max(hs->numGroups, 1.0),
+									 NULL));
+		}
+
+		/* The rollup the input is presorted for comes first, without Sort */
+		if (rollup_lists != NIL)
+		{
+			List	   *groupClause = (List *) llast(rollup_groupclauses);
+			List	   *gsets = (List *) llast(rollup_lists);
+			int			numGroupCols = list_length((List *) linitial(gsets));
+
+			chain = lappend(chain,
+							make_agg(NIL,
+									 NIL,
+									 (numGroupCols > 0) ? AGG_SORTED : AGG_PLAIN,
+									 AGGSPLIT_SIMPLE,
+									 numGroupCols,
+									 remap_groupColIdx(root, groupClause),
+									 extract_grouping_ops(groupClause),
+									 gsets,
+									 NIL,
+									 0,		/* numGroups not needed */
+									 NULL));
+		}
+	}
+
 	if (list_length(rollup_groupclauses) > 1)
 	{
 		forboth(lc, rollup_groupclauses, lc2, rollup_lists)
@@ -1786,6 +1991,26 @@ create_groupingsets_plan(PlannerInfo *root, GroupingSetsPath *best_path)
 	/*
 	 * Now make the final Agg node
 	 */
+	if (best_path->aggstrategy != AGG_SORTED)
+	{
+		HashedGroupingSet *hs = (HashedGroupingSet *) linitial(hashed_sets);
+
+		plan = make_agg(build_path_tlist(root, &best_path->path),
+						best_path->qual,
+						best_path->aggstrategy,
+						AGGSPLIT_SIMPLE,
+						list_length(hs->set),
+						remap_groupColIdx(root, hs->groupClause),
+						extract_grouping_ops(hs->groupClause),
+						list_make1(hs->set),
+						chain,
+						Max(hs->numGroups, 1.0),
+						subplan);
+
+		/* Copy cost data from Path to Plan */
+		copy_generic_path_info(&plan->plan, &best_path->path);
+	}
+	else
 	{
 		List	   *groupClause = (List *) llast(rollup_groupclauses);
 		List	   *gsets = (List *) llast(rollup_lists);
@@ -3496,6 +3721,13 @@ create_nestloop_plan(PlannerInfo *root,
 							  inner_plan,
 							  best_path->jointype);
 
+	/*
+	 * A LIMIT, an EXISTS or a cursor means the query may stop after the
+	 * first few rows; the executor uses this to start its inner-side probe
+	 * batches small.
+	 */
+	join_plan->fast_start = (root->tuple_fraction > 0);
+
 	copy_generic_path_info(&join_plan->join.plan, &best_path->path);
 
 	return join_plan;
@@ -3586,11 +3818,36 @@ create_mergejoin_plan(PlannerInfo *root,
 	 */
 	if (best_path->outersortkeys)
 	{
-		Sort	   *sort = make_sort_from_pathkeys(outer_plan,
-												   best_path->outersortkeys);
+		int			presorted_keys;
 
-		label_sort_with_costsize(root, sort, -1.0);
-		outer_plan = (Plan *) sort;
+		/*
+		 * If the outer path is already sorted on some leading merge keys, an
+		 * incremental sort is enough; initial_cost_mergejoin costed it so.
+		 * The outer side never needs mark/restore, so that's safe.
+		 */
+		(void) pathkeys_count_contained_in(best_path->outersortkeys,
+									best_path->jpath.outerjoinpath->pathkeys,
+										   &presorted_keys);
+		if (enable_incrementalsort && presorted_keys > 0)
+		{
+			IncrementalSort *sort;
+
+			sort = make_incrementalsort_from_pathkeys(outer_plan,
+													best_path->outersortkeys,
+													  presorted_keys);
+			label_incrementalsort_with_costsize(root, sort,
+												best_path->outersortkeys,
+												-1.0);
+			outer_plan = (Plan *) sort;
+		}
+		else
+		{
+			Sort	   *sort = make_sort_from_pathkeys(outer_plan,
+													best_path->outersortkeys);
+
+			label_sort_with_costsize(root, sort, -1.0);
+			outer_plan = (Plan *) sort;
+		}
 		outerpathkeys = best_path->outersortkeys;
 	}
 	else
@@ -3886,9 +4143,10 @@ create_hashjoin_plan(PlannerInfo *root,
 	 * skew optimization.  (Note: in principle we could do skew optimization
 	 * with multiple join clauses, but we'd have to be able to determine the
 	 * most common combinations of outer values, which we don't currently have
-	 * enough stats for.)
+	 * enough stats for.)  A parallel-aware hash table is shared by all
+	 * participants and has no skew buckets, so don't bother in that case.
 	 */
-	if (list_length(hashclauses) == 1)
+	if (list_length(hashclauses) == 1 && !best_path->jpath.path.parallel_aware)
 	{
 		OpExpr	   *clause = (OpExpr *) linitial(hashclauses);
 		Node	   *node;
@@ -3931,6 +4189,17 @@ create_hashjoin_plan(PlannerInfo *root,
 	copy_plan_costsize(&hash_plan->plan, inner_plan);
 	hash_plan->plan.startup_cost = hash_plan->plan.total_cost;
 
+	/*
+	 * If parallel-aware, the executor will also need an estimate of the total
+	 * number of rows expected from all participants, so that it can size the
+	 * shared hash table.
+	 */
+	if (best_path->jpath.path.parallel_aware)
+	{
+		hash_plan->plan.parallel_aware = true;
+		hash_plan->rows_total = best_path->inner_rows_total;
+	}
+
 	join_plan = make_hashjoin(tlist,
 							  joinclauses,
 							  otherclauses,
@@ -4631,6 +4900,35 @@ label_sort_with_costsize(PlannerInfo *root, Sort *plan, double limit_tuples)
 	plan->plan.parallel_aware = false;
 }
 
+/*
+ * label_incrementalsort_with_costsize
+ *	Set the cost estimates for an IncrementalSort plan node, as above.
+ *
+ * Unlike label_sort_with_costsize, we need the pathkeys, to estimate how
+ * many separate sorts there will be.
+ */
+static void
+label_incrementalsort_with_costsize(PlannerInfo *root, IncrementalSort *plan,
+									List *pathkeys, double limit_tuples)
+{
+	Plan	   *lefttree = plan->sort.plan.lefttree;
+	Path		sort_path;		/* dummy for result of cost_incremental_sort */
+
+	cost_incremental_sort(&sort_path, root, pathkeys, plan->presortedCols,
+						  lefttree->startup_cost,
+						  lefttree->total_cost,
+						  lefttree->plan_rows,
+						  lefttree->plan_width,
+						  0.0,
+						  work_mem,
+						  limit_tuples);
+	plan->sort.plan.startup_cost = sort_path.startup_cost;
+	plan->sort.plan.total_cost = sort_path.total_cost;
+	plan->sort.plan.plan_rows = lefttree->plan_rows;
+	plan->sort.plan.plan_width = lefttree->plan_width;
+	plan->sort.plan.parallel_aware = false;
+}
+
 
 /*****************************************************************************
  *
@@ -4934,7 +5232,7 @@ make_foreignscan(List *qptlist,
 }
 
 static Append *
-make_append(List *appendplans, List *tlist)
+make_append(List *appendplans, int first_partial_plan, List *tlist)
 {
 	Append	   *node = makeNode(Append);
 	Plan	   *plan = &node->plan;
@@ -4944,6 +5242,7 @@ make_append(List *appendplans, List *tlist)
 	plan->lefttree = NULL;
 	plan->righttree = NULL;
 	node->appendplans = appendplans;
+	node->first_partial_plan = first_partial_plan;
 
 	return node;
 }
@@ -5159,6 +5458,34 @@ make_sort(Plan *lefttree, int numCols,
 	return node;
 }
 
+/*
+ * make_incrementalsort --- basic routine to build an IncrementalSort plan
+ *
+ * Caller must have built the sortColIdx, sortOperators, collations, and
+ * nullsFirst arrays already.
+ */
+static IncrementalSort *
+make_incrementalsort(Plan *lefttree, int numCols, int presortedCols,
+					 AttrNumber *sortColIdx, Oid *sortOperators,
+					 Oid *collations, bool *nullsFirst)
+{
+	IncrementalSort *node = makeNode(IncrementalSort);
+	Plan	   *plan = &node->sort.plan;
+
+	plan->targetlist = lefttree->targetlist;
+	plan->qual = NIL;
+	plan->lefttree = lefttree;
+	plan->righttree = NULL;
+	node->presortedCols = presortedCols;
+	node->sort.numCols = numCols;
+	node->sort.sortColIdx = sortColIdx;
+	node->sort.sortOperators = sortOperators;
+	node->sort.collations = collations;
+	node->sort.nullsFirst = nullsFirst;
+
+	return node;
+}
+
 /*
  * prepare_sort_from_pathkeys
  *	  Prepare to sort according to given pathkeys
@@ -5502,6 +5829,42 @@ make_sort_from_pathkeys(Plan *lefttree, List *pathkeys)
 					 collations, nullsFirst);
 }
 
+/*
+ * make_incrementalsort_from_pathkeys
+ *	  Create sort plan to sort according to given pathkeys, given that the
+ *	  input is already sorted on the first presortedCols of them
+ *
+ *	  'lefttree' is the node which yields input tuples
+ *	  'pathkeys' is the list of pathkeys by which the result is to be sorted
+ *	  'presortedCols' is the number of presorted columns in input tuples
+ */
+static IncrementalSort *
+make_incrementalsort_from_pathkeys(Plan *lefttree, List *pathkeys,
+								   int presortedCols)
+{
+	int			numsortkeys;
+	AttrNumber *sortColIdx;
+	Oid		   *sortOperators;
+	Oid		   *collations;
+	bool	   *nullsFirst;
+
+	/* Compute sort column info, and adjust lefttree as needed */
+	lefttree = prepare_sort_from_pathkeys(lefttree, pathkeys,
+										  NULL,
+										  NULL,
+										  false,
+										  &numsortkeys,
+										  &sortColIdx,
+										  &sortOperators,
+										  &collations,
+										  &nullsFirst);
+
+	/* Now build the IncrementalSort node */
+	return make_incrementalsort(lefttree, numsortkeys, presortedCols,
+								sortColIdx, sortOperators,
+								collations, nullsFirst);
+}
+
 /*
  * make_sort_from_sortclauses
  *	  Create sort plan to sort according to given sortclauses
@@ -5613,6 +5976,25 @@ make_material(Plan *lefttree)
 	return node;
 }
 
+static ResultCache *
+make_resultcache(Plan *lefttree, List *param_exprs, bool singlerow,
+				 uint32 est_entries)
+{
+	ResultCache *node = makeNode(ResultCache);
+	Plan	   *plan = &node->plan;
+
+	plan->targetlist = lefttree->targetlist;
+	plan->qual = NIL;
+	plan->lefttree = lefttree;
+	plan->righttree = NULL;
+
+	node->param_exprs = param_exprs;
+	node->singlerow = singlerow;
+	node->est_entries = est_entries;
+
+	return node;
+}
+
 /*
  * materialize_finished_plan: stick a Material node atop a completed plan
  *
@@ -6167,7 +6549,9 @@ is_projection_capable_path(Path *path)
 	{
 		case T_Hash:
 		case T_Material:
+		case T_ResultCache:
 		case T_Sort:
+		case T_IncrementalSort:
 		case T_Unique:
 		case T_SetOp:
 		case T_LockRows:
@@ -6203,7 +6587,9 @@ is_projection_capable_plan(Plan *plan)
 	{
 		case T_Hash:
 		case T_Material:
+		case T_ResultCache:
 		case T_Sort:
+		case T_IncrementalSort:
 		case T_Unique:
 		case T_SetOp:
 		case T_LockRows:
@@ -111,12 +111,30 @@ static double get_number_of_groups(PlannerInfo *root,
 static Size estimate_hashagg_tablesize(Path *path,
 						   const AggClauseCosts *agg_costs,
 						   double dNumGroups);
+static double estimate_hashagg_distinct_size(PlannerInfo *root,
+							   double path_rows,
+							   const AggClauseCosts *agg_costs,
+							   List *rollup_lists);
 static RelOptInfo *create_grouping_paths(PlannerInfo *root,
 					  RelOptInfo *input_rel,
 					  PathTarget *target,
 					  const AggClauseCosts *agg_costs,
 					  List *rollup_lists,
 					  List *rollup_groupclauses);
+static void consider_groupingsets_paths(PlannerInfo *root,
+							RelOptInfo *grouped_rel,
+							Path *path,
+							bool is_sorted,
+							bool can_hash,
+							PathTarget *target,
+							List *rollup_lists,
+							List *rollup_groupclauses,
+							const AggClauseCosts *agg_costs,
+							double dNumGroups);
+static HashedGroupingSet *make_hashed_grouping_set(PlannerInfo *root,
+						 double path_rows,
+						 List *groupClause,
+						 List *gset);
 static RelOptInfo *create_window_paths(PlannerInfo *root,
 					RelOptInfo *input_rel,
 					PathTarget *input_target,
@@ -3274,6 +3292,75 @@ estimate_hashagg_tablesize(Path *path, const AggClauseCosts *agg_costs,
 	return hashentrysize * dNumGroups;
 }
 
+/*
+ * estimate_hashagg_distinct_size
+ *	  estimate the number of bytes that the DISTINCT aggregates that hash
+ *	  their input (agg_costs->hashDistinctAggs) will need to remember the
+ *	  inputs of every group, when the groups are hashed.
+ *
+ * With grouping sets, we assume each nonempty set has as many distinct
+ * inputs as the full GROUP BY list, which is an upper bound.  (The empty sets
+ * are never hashed.)
+ */
+static double
+estimate_hashagg_distinct_size(PlannerInfo *root, double path_rows,
+							   const AggClauseCosts *agg_costs,
+							   List *rollup_lists)
+{
+	Query	   *parse = root->parse;
+	List	   *groupExprs;
+	double		size = 0;
+	int			nsets = 0;
+	ListCell   *lc;
+
+	groupExprs = get_sortgrouplist_exprs(parse->groupClause,
+										 parse->targetList);
+
+	foreach(lc, agg_costs->hashDistinctAggs)
+	{
+		Aggref	   *aggref = (Aggref *) lfirst(lc);
+		List	   *distinctExprs;
+		Size		entrysize;
+		int32		width = sizeof(int64);	/* the group identifier */
+		ListCell   *lc2;
+
+		distinctExprs = get_sortgrouplist_exprs(aggref->aggdistinct,
+												aggref->args);
+		foreach(lc2, distinctExprs)
+		{
+			Node	   *expr = (Node *) lfirst(lc2);
+
+			width += get_typavgwidth(exprType(expr), exprTypmod(expr));
+		}
+
+		entrysize = MAXALIGN(width) + MAXALIGN(SizeofMinimalTupleHeader) +
+			hash_agg_entry_size(0);
+
+		size += entrysize *
+			estimate_num_groups(root,
+								list_concat(list_copy(groupExprs),
+											distinctExprs),
+								path_rows, NULL);
+	}
+
+	if (parse->groupingSets)
+	{
+		foreach(lc, rollup_lists)
+		{
+			ListCell   *lc2;
+
+			foreach(lc2, (List *) lfirst(lc))
+			{
+				if (lfirst(lc2) != NIL)
+					nsets++;
+			}
+		}
+		size *= nsets;
+	}
+
+	return size;
+}
+
 /*
  * create_grouping_paths
  *
@@ -3382,8 +3469,10 @@ create_grouping_paths(PlannerInfo *root,
 			path = (Path *)
 				create_append_path(grouped_rel,
 								   paths,
+								   NIL,
 								   NULL,
-								   0);
+								   0,
+								   false);
 			path->pathtarget = target;
 		}
 		else
@@ -3424,23 +3513,37 @@ create_grouping_paths(PlannerInfo *root,
 	 * Determine whether we should consider hash-based implementations of
 	 * grouping.
 	 *
-	 * Hashed aggregation only applies if we're grouping.  We currently can't
-	 * hash if there are grouping sets, though.
+	 * Hashed aggregation only applies if we're grouping.  With grouping
+	 * sets, whether each set can be hashed is checked separately, by
+	 * consider_groupingsets_paths.
 	 *
-	 * Executor doesn't support hashed aggregation with DISTINCT or ORDER BY
-	 * aggregates.  (Doing so would imply storing *all* the input values in
-	 * the hash table, and/or running many sorts in parallel, either of which
-	 * seems like a certain loser.)  We similarly don't support ordered-set
-	 * aggregates in hashed aggregation, but that case is also included in the
-	 * numOrderedAggs count.
+	 * Executor doesn't support hashed aggregation with ORDER BY aggregates,
+	 * nor with DISTINCT aggregates that must sort their input to eliminate
+	 * duplicates (see aggref_distinct_is_hashable).  (Doing so would imply
+	 * running many sorts in parallel, which seems like a certain loser.)  We
+	 * similarly don't support ordered-set aggregates in hashed aggregation,
+	 * but that case is also included in the numOrderedAggs count.
 	 *
 	 * Note: grouping_is_hashable() is much more expensive to check than the
 	 * other gating conditions, so we want to do it last.
 	 */
 	can_hash = (parse->groupClause != NIL &&
-				parse->groupingSets == NIL &&
 				agg_costs->numOrderedAggs == 0 &&
-				grouping_is_hashable(parse->groupClause));
+				(parse->groupingSets != NIL ||
+				 grouping_is_hashable(parse->groupClause)));
+
+	/*
+	 * With hashed grouping, DISTINCT aggregates that eliminate duplicates by
+	 * hashing keep the inputs of all the groups in memory at once, and that
+	 * memory isn't released by spilling groups to disk.  So, unless we have
+	 * no other way to do the grouping, only hash when all those inputs are
+	 * expected to fit in work_mem.
+	 */
+	if (can_hash && can_sort && agg_costs->hashDistinctAggs != NIL &&
+		estimate_hashagg_distinct_size(root, cheapest_path->rows,
+									   agg_costs, rollup_lists) >
+		work_mem * 1024.0)
+		can_hash = false;
 
 	/*
 	 * If grouped_rel->consider_parallel is true, then paths that we generate
@@ -3594,7 +3697,10 @@ create_grouping_paths(PlannerInfo *root,
 
 			/*
 			 * Tentatively produce a partial HashAgg Path, depending on if it
-			 * looks as if the hash table will fit in work_mem.
+			 * looks as if the hash table will fit in work_mem.  The partial
+			 * hash table could spill too, but if each worker would have to
+			 * do that, partial aggregation is unlikely to reduce the input
+			 * enough to be worth it.
 			 */
 			if (hashaggtablesize < work_mem * 1024L)
 			{
@@ -3642,18 +3748,16 @@ create_grouping_paths(PlannerInfo *root,
 				{
 					/*
 					 * We have grouping sets, possibly with aggregation.  Make
-					 * a GroupingSetsPath.
+					 * a GroupingSetsPath, and maybe others hashing some of
+					 * the sets.
 					 */
-					add_path(grouped_rel, (Path *)
-							 create_groupingsets_path(root,
-													  grouped_rel,
-													  path,
-													  target,
-												  (List *) parse->havingQual,
-													  rollup_lists,
-													  rollup_groupclauses,
-													  agg_costs,
-													  dNumGroups));
+					consider_groupingsets_paths(root, grouped_rel,
+												path, true, can_hash,
+												target,
+												rollup_lists,
+												rollup_groupclauses,
+												agg_costs,
+												dNumGroups);
 				}
 				else if (parse->hasAggs)
 				{
@@ -3747,75 +3851,120 @@ create_grouping_paths(PlannerInfo *root,
 										   (List *) parse->havingQual,
 										   dNumGroups));
 		}
-	}
-
-	if (can_hash)
-	{
-		hashaggtablesize = estimate_hashagg_tablesize(cheapest_path,
-													  agg_costs,
-													  dNumGroups);
 
 		/*
-		 * Provided that the estimated size of the hashtable does not exceed
-		 * work_mem, we'll generate a HashAgg Path, although if we were unable
-		 * to sort above, then we'd better generate a Path, so that we at
-		 * least have one.
+		 * A partial path that is already sorted on the grouping keys can
+		 * instead be combined with Gather Merge, which preserves that order
+		 * and so saves sorting the partially aggregated groups.  That's only
+		 * interesting if there is a GROUP BY clause.
 		 */
-		if (hashaggtablesize < work_mem * 1024L ||
-			grouped_rel->pathlist == NIL)
+		if (parse->groupClause != NIL && root->group_pathkeys != NIL)
 		{
-			/*
-			 * We just need an Agg over the cheapest-total input path, since
-			 * input order won't matter.
-			 */
-			add_path(grouped_rel, (Path *)
-					 create_agg_path(root, grouped_rel,
-									 cheapest_path,
-									 target,
-									 AGG_HASHED,
-									 AGGSPLIT_SIMPLE,
-									 parse->groupClause,
-									 (List *) parse->havingQual,
-									 agg_costs,
-									 dNumGroups));
+			foreach(lc, grouped_rel->partial_pathlist)
+			{
+				Path	   *subpath = (Path *) lfirst(lc);
+				Path	   *gmpath;
+				double		total_groups;
+
+				if (!pathkeys_contained_in(root->group_pathkeys,
+										   subpath->pathkeys))
+					continue;
+
+				total_groups = subpath->rows * subpath->parallel_workers;
+
+				gmpath = (Path *)
+					create_gather_merge_path(root,
+											 grouped_rel,
+											 subpath,
+											 partial_grouping_target,
+											 root->group_pathkeys,
+											 NULL,
+											 &total_groups);
+
+				if (parse->hasAggs)
+					add_path(grouped_rel, (Path *)
+							 create_agg_path(root,
+											 grouped_rel,
+											 gmpath,
+											 target,
+											 AGG_SORTED,
+											 AGGSPLIT_FINAL_DESERIAL,
+											 parse->groupClause,
+											 (List *) parse->havingQual,
+											 &agg_final_costs,
+											 dNumGroups));
+				else
+					add_path(grouped_rel, (Path *)
+							 create_group_path(root,
+											   grouped_rel,
+											   gmpath,
+											   target,
+											   parse->groupClause,
+											   (List *) parse->havingQual,
+											   dNumGroups));
+			}
 		}
+	}
 
+	if (can_hash && parse->groupingSets)
+	{
 		/*
-		 * Generate a HashAgg Path atop of the cheapest partial path. Once
-		 * again, we'll only do this if it looks as though the hash table
-		 * won't exceed work_mem.
+		 * Try hashing all the grouping sets over the cheapest-total input
+		 * path, since input order won't matter then.
+		 */
+		consider_groupingsets_paths(root, grouped_rel,
+									cheapest_path, false, true,
+									target,
+									rollup_lists,
+									rollup_groupclauses,
+									agg_costs,
+									dNumGroups);
+	}
+	else if (can_hash)
+	{
+		/*
+		 * We just need an Agg over the cheapest-total input path, since input
+		 * order won't matter.  A hash table that exceeds work_mem spills to
+		 * disk, which cost_agg takes into account, so we needn't insist that
+		 * it fit.
+		 */
+		add_path(grouped_rel, (Path *)
+				 create_agg_path(root, grouped_rel,
+								 cheapest_path,
+								 target,
+								 AGG_HASHED,
+								 AGGSPLIT_SIMPLE,
+								 parse->groupClause,
+								 (List *) parse->havingQual,
+								 agg_costs,
+								 dNumGroups));
+
+		/*
+		 * Generate a HashAgg Path atop of the cheapest partial path.
 		 */
 		if (grouped_rel->partial_pathlist)
 		{
 			Path	   *path = (Path *) linitial(grouped_rel->partial_pathlist);
+			double		total_groups = path->rows * path->parallel_workers;
 
-			hashaggtablesize = estimate_hashagg_tablesize(path,
-														  &agg_final_costs,
-														  dNumGroups);
-
-			if (hashaggtablesize < work_mem * 1024L)
-			{
-				double		total_groups = path->rows * path->parallel_workers;
-
-				path = (Path *) create_gather_path(root,
-												   grouped_rel,
-												   path,
-												   partial_grouping_target,
-												   NULL,
-												   &total_groups);
+			path = (Path *) create_gather_path(root,
+											   grouped_rel,
+											   path,
+											   partial_grouping_target,
+											   NULL,
+											   &total_groups);
 
-				add_path(grouped_rel, (Path *)
-						 create_agg_path(root,
-										 grouped_rel,
-										 path,
-										 target,
-										 AGG_HASHED,
-										 AGGSPLIT_FINAL_DESERIAL,
-										 parse->groupClause,
-										 (List *) parse->havingQual,
-										 &agg_final_costs,
-										 dNumGroups));
-			}
+			add_path(grouped_rel, (Path *)
+					 create_agg_path(root,
+									 grouped_rel,
+									 path,
+									 target,
+									 AGG_HASHED,
+									 AGGSPLIT_FINAL_DESERIAL,
+									 parse->groupClause,
+									 (List *) parse->havingQual,
+									 &agg_final_costs,
+									 dNumGroups));
 		}
 	}
 
@@ -3846,6 +3995,250 @@ create_grouping_paths(PlannerInfo *root,
 	return grouped_rel;
 }
 
+/*
+ * consider_groupingsets_paths
+ *
+ * Add paths computing the grouping sets over "path" to grouped_rel.
+ *
+ * If is_sorted, path is sorted for the last rollup in rollup_lists.  We
+ * always add a path computing every rollup by sorting, but each of the other
+ * rollups costs an extra sort of the whole input; so if can_hash, we also
+ * try computing as many of them as possible with hash tables instead, while
+ * the input is read for the presorted rollup (AGG_MIXED).  Choosing the
+ * rollups with the smallest tables first saves the most sorts.
+ *
+ * Otherwise, we try hashing every grouping set except the empty ones, which
+ * need neither sorting nor hashing.
+ *
+ * Only a lone hash table can spill to disk, so whenever there are several
+ * of them, or sorted phases too, we insist that they are estimated to fit
+ * in work_mem together, unless there is no other way to do the grouping.
+ */
+static void
+consider_groupingsets_paths(PlannerInfo *root,
+							RelOptInfo *grouped_rel,
+							Path *path,
+							bool is_sorted,
+							bool can_hash,
+							PathTarget *target,
+							List *rollup_lists,
+							List *rollup_groupclauses,
+							const AggClauseCosts *agg_costs,
+							double dNumGroups)
+{
+	Query	   *parse = root->parse;
+	double		hashmem_limit = work_mem * 1024.0;
+	double		hashsize = 0;
+	List	   *hashed_sets = NIL;
+	List	   *new_rollup_lists = NIL;
+	List	   *new_rollup_groupclauses = NIL;
+	List	  **rollup_hashes;
+	double	   *rollup_sizes;
+	bool	   *chosen;
+	int			nrollups;
+	int			i;
+	ListCell   *lc,
+			   *lc2,
+			   *lc3;
+
+	if (!is_sorted)
+	{
+		List	   *empty_sets = NIL;
+		AggStrategy aggstrategy = AGG_HASHED;
+
+		if (!can_hash)
+			return;
+
+		forboth(lc, rollup_groupclauses, lc2, rollup_lists)
+		{
+			foreach(lc3, (List *) lfirst(lc2))
+			{
+				List	   *gset = (List *) lfirst(lc3);
+				HashedGroupingSet *hs;
+
+				if (gset == NIL)
+				{
+					empty_sets = lappend(empty_sets, NIL);
+					continue;
+				}
+
+				hs = make_hashed_grouping_set(root, path->rows,
+											  (List *) lfirst(lc), gset);
+				if (hs == NULL)
+					return;
+
+				hashed_sets = lappend(hashed_sets, hs);
+				hashsize += estimate_hashagg_tablesize(path, agg_costs,
+													   hs->numGroups);
+			}
+		}
+
+		if (hashed_sets == NIL)
+			return;
+
+		if ((list_length(hashed_sets) > 1 || empty_sets != NIL) &&
+			hashsize > hashmem_limit &&
+			grouping_is_sortable(parse->groupClause))
+			return;
+
+		/* The empty sets are computed by a plain phase reading the input */
+		if (empty_sets != NIL)
+		{
+			aggstrategy = AGG_MIXED;
+			new_rollup_lists = list_make1(empty_sets);
+			new_rollup_groupclauses = list_make1(NIL);
+		}
+
+		add_path(grouped_rel, (Path *)
+				 create_groupingsets_path(root,
+										  grouped_rel,
+										  path,
+										  target,
+										  (List *) parse->havingQual,
+										  aggstrategy,
+										  new_rollup_lists,
+										  new_rollup_groupclauses,
+										  hashed_sets,
+										  agg_costs,
+										  dNumGroups));
+		return;
+	}
+
+	add_path(grouped_rel, (Path *)
+			 create_groupingsets_path(root,
+									  grouped_rel,
+									  path,
+									  target,
+									  (List *) parse->havingQual,
+									  AGG_SORTED,
+									  rollup_lists,
+									  rollup_groupclauses,
+									  NIL,
+									  agg_costs,
+									  dNumGroups));
+
+	if (!can_hash || list_length(rollup_lists) < 2)
+		return;
+
+	/*
+	 * Work out the hashed sets and the total table size of each rollup but
+	 * the presorted one.  Rollups containing the empty set, or any set that
+	 * can't be hashed, have to stay sorted.
+	 */
+	nrollups = list_length(rollup_lists) - 1;
+	rollup_hashes = (List **) palloc0(nrollups * sizeof(List *));
+	rollup_sizes = (double *) palloc0(nrollups * sizeof(double));
+	chosen = (bool *) palloc0(nrollups * sizeof(bool));
+
+	i = 0;
+	forboth(lc, rollup_groupclauses, lc2, rollup_lists)
+	{
+		if (i >= nrollups)
+			break;
+
+		foreach(lc3, (List *) lfirst(lc2))
+		{
+			List	   *gset = (List *) lfirst(lc3);
+			HashedGroupingSet *hs = NULL;
+
+			if (gset != NIL)
+				hs = make_hashed_grouping_set(root, path->rows,
+											  (List *) lfirst(lc), gset);
+			if (hs == NULL)
+			{
+				rollup_hashes[i] = NIL;
+				break;
+			}
+
+			rollup_hashes[i] = lappend(rollup_hashes[i], hs);
+			rollup_sizes[i] += estimate_hashagg_tablesize(path, agg_costs,
+														  hs->numGroups);
+		}
+		i++;
+	}
+
+	for (;;)
+	{
+		int			best = -1;
+
+		for (i = 0; i < nrollups; i++)
+		{
+			if (rollup_hashes[i] != NIL && !chosen[i] &&
+				(best < 0 || rollup_sizes[i] < rollup_sizes[best]))
+				best = i;
+		}
+
+		if (best < 0 || hashsize + rollup_sizes[best] > hashmem_limit)
+			break;
+
+		chosen[best] = true;
+		hashsize += rollup_sizes[best];
+	}
+
+	i = 0;
+	forboth(lc, rollup_groupclauses, lc2, rollup_lists)
+	{
+		if (i < nrollups && chosen[i])
+			hashed_sets = list_concat(hashed_sets, rollup_hashes[i]);
+		else
+		{
+			new_rollup_groupclauses = lappend(new_rollup_groupclauses,
+											  lfirst(lc));
+			new_rollup_lists = lappend(new_rollup_lists, lfirst(lc2));
+		}
+		i++;
+	}
+
+	if (hashed_sets == NIL)
+		return;
+
+	add_path(grouped_rel, (Path *)
+			 create_groupingsets_path(root,
+									  grouped_rel,
+									  path,
+									  target,
+									  (List *) parse->havingQual,
+									  AGG_MIXED,
+									  new_rollup_lists,
+									  new_rollup_groupclauses,
+									  hashed_sets,
+									  agg_costs,
+									  dNumGroups));
+}
+
+/*
+ * make_hashed_grouping_set
+ *
+ * Build the HashedGroupingSet for a non-empty grouping set of a rollup, or
+ * return NULL if its columns can't all be hashed.  The set's indexes into
+ * the rollup's groupClause are always a prefix of it, so the set's own
+ * groupClause is just the rollup's truncated to the set's length.
+ */
+static HashedGroupingSet *
+make_hashed_grouping_set(PlannerInfo *root, double path_rows,
+						 List *groupClause, List *gset)
+{
+	HashedGroupingSet *hs;
+	List	   *setClause;
+
+	Assert(gset != NIL);
+
+	setClause = list_truncate(list_copy(groupClause), list_length(gset));
+	if (!grouping_is_hashable(setClause))
+		return NULL;
+
+	hs = makeNode(HashedGroupingSet);
+	hs->groupClause = setClause;
+	hs->set = gset;
+	hs->numGroups = estimate_num_groups(root,
+										get_sortgrouplist_exprs(setClause,
+													root->parse->targetList),
+										path_rows,
+										NULL);
+
+	return hs;
+}
+
 /*
  * create_window_paths
  *
@@ -4172,8 +4565,8 @@ create_distinct_paths(PlannerInfo *root,
 	 * die trying.  If we do have other choices, there are several things that
 	 * should prevent selection of hashing: if the query uses DISTINCT ON
 	 * (because it won't really have the expected behavior if we hash), or if
-	 * enable_hashagg is off, or if it looks like the hashtable will exceed
-	 * work_mem.
+	 * enable_hashagg is off.  A hashtable that would exceed work_mem spills
+	 * to disk, and is costed accordingly.
 	 *
 	 * Note: grouping_is_hashable() is much more expensive to check than the
 	 * other gating conditions, so we want to do it last.
@@ -4183,18 +4576,7 @@ create_distinct_paths(PlannerInfo *root,
 	else if (parse->hasDistinctOn || !enable_hashagg)
 		allow_hash = false;		/* policy-based decision not to hash */
 	else
-	{
-		Size		hashentrysize;
-
-		/* Estimate per-hash-entry space at tuple width... */
-		hashentrysize = MAXALIGN(cheapest_input_path->pathtarget->width) +
-			MAXALIGN(SizeofMinimalTupleHeader);
-		/* plus the per-hash-entry overhead */
-		hashentrysize += hash_agg_entry_size(0);
-
-		/* Allow hashing only if hashtable is predicted to fit in work_mem */
-		allow_hash = (hashentrysize * numDistinctRows <= work_mem * 1024L);
-	}
+		allow_hash = true;
 
 	if (allow_hash && grouping_is_hashable(parse->distinctClause))
 	{
@@ -4285,19 +4667,22 @@ create_ordered_paths(PlannerInfo *root,
 
 	foreach(lc, input_rel->pathlist)
 	{
-		Path	   *path = (Path *) lfirst(lc);
+		Path	   *input_path = (Path *) lfirst(lc);
+		Path	   *path = input_path;
 		bool		is_sorted;
+		int			presorted_keys;
 
-		is_sorted = pathkeys_contained_in(root->sort_pathkeys,
-										  path->pathkeys);
-		if (path == cheapest_input_path || is_sorted)
+		is_sorted = pathkeys_count_contained_in(root->sort_pathkeys,
+												input_path->pathkeys,
+												&presorted_keys);
+		if (input_path == cheapest_input_path || is_sorted)
 		{
 			if (!is_sorted)
 			{
 				/* An explicit sort here can take advantage of LIMIT */
 				path = (Path *) create_sort_path(root,
 												 ordered_rel,
-												 path,
+												 input_path,
 												 root->sort_pathkeys,
 												 limit_tuples);
 			}
@@ -4309,6 +4694,84 @@ create_ordered_paths(PlannerInfo *root,
 
 			add_path(ordered_rel, path);
 		}
+
+		/*
+		 * If the path is sorted on a leading subset of the required keys, an
+		 * incremental sort may well be cheaper than a full one, especially
+		 * with a LIMIT.
+		 */
+		if (!is_sorted && presorted_keys > 0 && enable_incrementalsort)
+		{
+			path = (Path *) create_incremental_sort_path(root,
+														 ordered_rel,
+														 input_path,
+														 root->sort_pathkeys,
+														 presorted_keys,
+														 limit_tuples);
+
+			/* Add projection step if needed */
+			if (path->pathtarget != target)
+				path = apply_projection_to_path(root, ordered_rel,
+												path, target);
+
+			add_path(ordered_rel, path);
+		}
+	}
+
+	/*
+	 * generate_gather_paths() will already have generated a simple Gather
+	 * path for the best parallel path, if any, and the loop above will have
+	 * considered sorting it.  Similarly, it will also have generated
+	 * order-preserving Gather Merge paths, which the loop above can use
+	 * without sorting if they happen to match the sort_pathkeys.  However,
+	 * there's one more possibility: it may make sense to sort the cheapest
+	 * partial path according to the required output order and then use
+	 * Gather Merge.
+	 *
+	 * The partial paths of an upper rel (that is, the grouping rel) produce
+	 * partially aggregated rows, which can't be returned as they are, so we
+	 * only do this for the scan/join rel.
+	 */
+	if (ordered_rel->consider_parallel && root->sort_pathkeys != NIL &&
+		input_rel->reloptkind != RELOPT_UPPER_REL &&
+		input_rel->partial_pathlist != NIL)
+	{
+		Path	   *cheapest_partial_path;
+
+		cheapest_partial_path = linitial(input_rel->partial_pathlist);
+
+		/*
+		 * If cheapest partial path doesn't need a sort, this is redundant
+		 * with what's already been tried.
+		 */
+		if (!pathkeys_contained_in(root->sort_pathkeys,
+								   cheapest_partial_path->pathkeys))
+		{
+			Path	   *path;
+			double		total_groups;
+
+			path = (Path *) create_sort_path(root,
+											 ordered_rel,
+											 cheapest_partial_path,
+											 root->sort_pathkeys,
+											 -1.0);
+
+			total_groups = cheapest_partial_path->rows *
+				cheapest_partial_path->parallel_workers;
+			path = (Path *)
+				create_gather_merge_path(root, ordered_rel,
+										 path,
+										 path->pathtarget,
+										 root->sort_pathkeys, NULL,
+										 &total_groups);
+
+			/* Add projection step if needed */
+			if (path->pathtarget != target)
+				path = apply_projection_to_path(root, ordered_rel,
+												path, target);
+
+			add_path(ordered_rel, path);
+		}
 	}
 
 	/*
@@ -5274,7 +5737,7 @@ plan_cluster_use_sort(Oid tableOid, Oid indexOid)
 	indexScanPath = create_index_path(root, indexInfo,
 									  NIL, NIL, NIL, NIL, NIL,
 									  ForwardScanDirection, false,
-									  NULL, 1.0);
+									  NULL, 1.0, false);
 
 	return (seqScanAndSortPath.total_cost < indexScanPath->path.total_cost);
 }
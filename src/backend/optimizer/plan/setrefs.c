@@ -605,12 +605,31 @@ set_plan_refs(PlannerInfo *root, Plan *plan, int rtoffset)
 			break;
 
 		case T_Gather:
+		case T_GatherMerge:
 			set_upper_references(root, plan, rtoffset);
 			break;
 
+		case T_ResultCache:
+			{
+				ResultCache *rcplan = (ResultCache *) plan;
+
+				/*
+				 * Like Material, we don't evaluate the targetlist, but the
+				 * cache key expressions must be fixed up.  They contain no
+				 * Vars, only the nestloop's Params.
+				 */
+				set_dummy_tlist_references(plan, rtoffset);
+				Assert(rcplan->plan.qual == NIL);
+				rcplan->param_exprs = fix_scan_list(root,
+													rcplan->param_exprs,
+													rtoffset);
+			}
+			break;
+
 		case T_Hash:
 		case T_Material:
 		case T_Sort:
+		case T_IncrementalSort:
 		case T_Unique:
 		case T_SetOp:
 
@@ -36,6 +36,7 @@
 #include "optimizer/cost.h"
 #include "optimizer/planmain.h"
 #include "optimizer/prep.h"
+#include "optimizer/tlist.h"
 #include "optimizer/var.h"
 #include "parser/analyze.h"
 #include "parser/parse_agg.h"
@@ -540,13 +541,22 @@ get_agg_clause_costs_walker(Node *node, get_agg_clause_costs_context *context)
 
 		/*
 		 * Count it, and check for cases requiring ordered input.  Note that
-		 * ordered-set aggs always have nonempty aggorder.  Any ordered-input
-		 * case also defeats partial aggregation.
+		 * ordered-set aggs always have nonempty aggorder.  DISTINCT aggs
+		 * that can eliminate duplicates by hashing don't need ordered input
+		 * (we collect them so the planner can estimate the size of their
+		 * hash tables), but like every other DISTINCT or ORDER BY case they
+		 * defeat partial aggregation, since duplicates seen by different
+		 * workers could not be recognized when combining.
 		 */
 		costs->numAggs++;
 		if (aggref->aggorder != NIL || aggref->aggdistinct != NIL)
 		{
-			costs->numOrderedAggs++;
+			if (!aggref_distinct_is_hashable(aggref, aggcombinefn,
+											 aggtranstype))
+				costs->numOrderedAggs++;
+			else
+				costs->hashDistinctAggs = lappend(costs->hashDistinctAggs,
+												  aggref);
 			costs->hasNonPartial = true;
 		}
 
@@ -46,6 +46,8 @@ typedef enum
 #define STD_FUZZ_FACTOR 1.01
 
 static List *translate_sub_tlist(List *tlist, int relid);
+static List *sort_paths_by_total_cost_desc(List *paths);
+static int	path_total_cost_desc_cmp(const void *a, const void *b);
 
 
 /*****************************************************************************
@@ -744,10 +746,9 @@ add_path_precheck(RelOptInfo *parent_rel,
  *	  As with add_path, we pfree paths that are found to be dominated by
  *	  another partial path; this requires that there be no other references to
  *	  such paths yet.  Hence, GatherPaths must not be created for a rel until
- *	  we're done creating all partial paths for it.  We do not currently build
- *	  partial indexscan paths, so there is no need for an exception for
- *	  IndexPaths here; for safety, we instead Assert that a path to be freed
- *	  isn't an IndexPath.
+ *	  we're done creating all partial paths for it.  Unlike add_path, we don't
+ *	  take an exception for IndexPaths, as partial index paths won't be
+ *	  referenced by partial BitmapHeapPaths.
  */
 void
 add_partial_path(RelOptInfo *parent_rel, Path *new_path)
@@ -826,8 +827,6 @@ add_partial_path(RelOptInfo *parent_rel, Path *new_path)
 		{
 			parent_rel->partial_pathlist =
 				list_delete_cell(parent_rel->partial_pathlist, p1, p1_prev);
-			/* we should not see IndexPaths here, so always safe to delete */
-			Assert(!IsA(old_path, IndexPath));
 			pfree(old_path);
 			/* p1_prev does not advance */
 		}
@@ -860,8 +859,6 @@ add_partial_path(RelOptInfo *parent_rel, Path *new_path)
 	}
 	else
 	{
-		/* we should not see IndexPaths here, so always safe to delete */
-		Assert(!IsA(new_path, IndexPath));
 		/* Reject and recycle the new path */
 		pfree(new_path);
 	}
@@ -1005,6 +1002,7 @@ create_samplescan_path(PlannerInfo *root, RelOptInfo *rel, Relids required_outer
  * 'required_outer' is the set of outer relids for a parameterized path.
  * 'loop_count' is the number of repetitions of the indexscan to factor into
  *		estimates of caching behavior.
+ * 'partial_path' is true if constructing a parallel index scan path.
  *
  * Returns the new path node.
  */
@@ -1019,7 +1017,8 @@ create_index_path(PlannerInfo *root,
 				  ScanDirection indexscandir,
 				  bool indexonly,
 				  Relids required_outer,
-				  double loop_count)
+				  double loop_count,
+				  bool partial_path)
 {
 	IndexPath  *pathnode = makeNode(IndexPath);
 	RelOptInfo *rel = index->rel;
@@ -1049,7 +1048,7 @@ create_index_path(PlannerInfo *root,
 	pathnode->indexorderbycols = indexorderbycols;
 	pathnode->indexscandir = indexscandir;
 
-	cost_index(pathnode, root, loop_count);
+	cost_index(pathnode, root, loop_count, partial_path);
 
 	return pathnode;
 }
@@ -1062,6 +1061,8 @@ create_index_path(PlannerInfo *root,
  * 'required_outer' is the set of outer relids for a parameterized path.
  * 'loop_count' is the number of repetitions of the indexscan to factor into
  *		estimates of caching behavior.
+ * 'parallel_workers' is the number of workers for a parallel bitmap heap
+ *		scan, or zero for an ordinary one.
  *
  * loop_count should match the value used when creating the component
  * IndexPaths.
@@ -1071,7 +1072,8 @@ create_bitmap_heap_path(PlannerInfo *root,
 						RelOptInfo *rel,
 						Path *bitmapqual,
 						Relids required_outer,
-						double loop_count)
+						double loop_count,
+						int parallel_workers)
 {
 	BitmapHeapPath *pathnode = makeNode(BitmapHeapPath);
 
@@ -1080,9 +1082,9 @@ create_bitmap_heap_path(PlannerInfo *root,
 	pathnode->path.pathtarget = rel->reltarget;
 	pathnode->path.param_info = get_baserel_parampathinfo(root, rel,
 														  required_outer);
-	pathnode->path.parallel_aware = false;
+	pathnode->path.parallel_aware = parallel_workers > 0 ? true : false;
 	pathnode->path.parallel_safe = rel->consider_parallel;
-	pathnode->path.parallel_workers = 0;
+	pathnode->path.parallel_workers = parallel_workers;
 	pathnode->path.pathkeys = NIL;		/* always unordered */
 
 	pathnode->bitmapqual = bitmapqual;
@@ -1199,47 +1201,45 @@ create_tidscan_path(PlannerInfo *root, RelOptInfo *rel, List *tidquals,
  *	  Creates a path corresponding to an Append plan, returning the
  *	  pathnode.
  *
+ * 'subpaths' are ordinary (non-partial) child paths, each of which will be
+ * run to completion by a single process; 'partial_subpaths' are partial child
+ * paths, which are placed after them.  Only a parallel-aware Append cares
+ * about the distinction.  In a parallel-aware Append the non-partial children
+ * are sorted into descending order of total cost, so that the most expensive
+ * ones are started first and the workers finish at about the same time.
+ *
  * Note that we must handle subpaths = NIL, representing a dummy access path.
  */
 AppendPath *
-create_append_path(RelOptInfo *rel, List *subpaths, Relids required_outer,
-				   int parallel_workers)
+create_append_path(RelOptInfo *rel, List *subpaths, List *partial_subpaths,
+				   Relids required_outer, int parallel_workers,
+				   bool parallel_aware)
 {
 	AppendPath *pathnode = makeNode(AppendPath);
 	ListCell   *l;
 
+	Assert(!parallel_aware || parallel_workers > 0);
+
 	pathnode->path.pathtype = T_Append;
 	pathnode->path.parent = rel;
 	pathnode->path.pathtarget = rel->reltarget;
 	pathnode->path.param_info = get_appendrel_parampathinfo(rel,
 															required_outer);
-	pathnode->path.parallel_aware = false;
+	pathnode->path.parallel_aware = parallel_aware;
 	pathnode->path.parallel_safe = rel->consider_parallel;
 	pathnode->path.parallel_workers = parallel_workers;
 	pathnode->path.pathkeys = NIL;		/* result is always considered
 										 * unsorted */
-	pathnode->subpaths = subpaths;
 
-	/*
-	 * We don't bother with inventing a cost_append(), but just do it here.
-	 *
-	 * Compute rows and costs as sums of subplan rows and costs.  We charge
-	 * nothing extra for the Append itself, which perhaps is too optimistic,
-	 * but since it doesn't do any selection or projection, it is a pretty
-	 * cheap node.
-	 */
-	pathnode->path.rows = 0;
-	pathnode->path.startup_cost = 0;
-	pathnode->path.total_cost = 0;
-	foreach(l, subpaths)
+	if (parallel_aware)
+		subpaths = sort_paths_by_total_cost_desc(subpaths);
+	pathnode->first_partial_path = list_length(subpaths);
+	pathnode->subpaths = list_concat(subpaths, partial_subpaths);
+
+	foreach(l, pathnode->subpaths)
 	{
 		Path	   *subpath = (Path *) lfirst(l);
 
-		pathnode->path.rows += subpath->rows;
-
-		if (l == list_head(subpaths))	/* first node? */
-			pathnode->path.startup_cost = subpath->startup_cost;
-		pathnode->path.total_cost += subpath->total_cost;
 		pathnode->path.parallel_safe = pathnode->path.parallel_safe &&
 			subpath->parallel_safe;
 
@@ -1247,9 +1247,64 @@ create_append_path(RelOptInfo *rel, List *subpaths, Relids required_outer,
 		Assert(bms_equal(PATH_REQ_OUTER(subpath), required_outer));
 	}
 
+	cost_append(pathnode);
+
 	return pathnode;
 }
 
+/*
+ * sort_paths_by_total_cost_desc
+ *	  Return a new list containing the given paths, most expensive first.
+ */
+static List *
+sort_paths_by_total_cost_desc(List *paths)
+{
+	int			npaths = list_length(paths);
+	Path	  **patharray;
+	List	   *result = NIL;
+	ListCell   *l;
+	int			i;
+
+	if (npaths < 2)
+		return list_copy(paths);
+
+	patharray = (Path **) palloc(npaths * sizeof(Path *));
+	i = 0;
+	foreach(l, paths)
+		patharray[i++] = (Path *) lfirst(l);
+
+	qsort(patharray, npaths, sizeof(Path *), path_total_cost_desc_cmp);
+
+	for (i = 0; i < npaths; i++)
+		result = lappend(result, patharray[i]);
+	pfree(patharray);
+
+	return result;
+}
+
+/*
+ * qsort comparator for sort_paths_by_total_cost_desc
+ *
+ * Ties are broken on startup cost so that the result doesn't depend on the
+ * qsort implementation more than it has to.
+ */
+static int
+path_total_cost_desc_cmp(const void *a, const void *b)
+{
+	Path	   *path1 = *(Path *const *) a;
+	Path	   *path2 = *(Path *const *) b;
+
+	if (path1->total_cost > path2->total_cost)
+		return -1;
+	if (path1->total_cost < path2->total_cost)
+		return 1;
+	if (path1->startup_cost > path2->startup_cost)
+		return -1;
+	if (path1->startup_cost < path2->startup_cost)
+		return 1;
+	return 0;
+}
+
 /*
  * create_merge_append_path
  *	  Creates a path corresponding to a MergeAppend plan, returning the
@@ -1412,6 +1467,52 @@ create_material_path(RelOptInfo *rel, Path *subpath)
 	return pathnode;
 }
 
+/*
+ * create_resultcache_path
+ *	  Creates a path corresponding to a ResultCache plan, returning the
+ *	  pathnode.
+ *
+ * 'param_exprs' are the cache key expressions, and 'calls' is the number of
+ * times we expect the path to be scanned, i.e. the outer side's row count.
+ */
+ResultCachePath *
+create_resultcache_path(PlannerInfo *root, RelOptInfo *rel, Path *subpath,
+						List *param_exprs, bool singlerow, double calls)
+{
+	ResultCachePath *pathnode = makeNode(ResultCachePath);
+
+	Assert(subpath->parent == rel);
+
+	pathnode->path.pathtype = T_ResultCache;
+	pathnode->path.parent = rel;
+	pathnode->path.pathtarget = rel->reltarget;
+	pathnode->path.param_info = subpath->param_info;
+	pathnode->path.parallel_aware = false;
+	pathnode->path.parallel_safe = rel->consider_parallel &&
+		subpath->parallel_safe;
+	pathnode->path.parallel_workers = subpath->parallel_workers;
+	pathnode->path.pathkeys = subpath->pathkeys;
+
+	pathnode->subpath = subpath;
+	pathnode->param_exprs = param_exprs;
+	pathnode->singlerow = singlerow;
+	pathnode->calls = calls;
+
+	/* set by cost_rescan(), which is where the cache's savings show up */
+	pathnode->est_entries = 0;
+
+	/*
+	 * The first scan costs what the subpath does, plus a token amount for
+	 * setting up the cache, so that we don't pick a ResultCache where the
+	 * subpath alone would do as well.
+	 */
+	pathnode->path.rows = subpath->rows;
+	pathnode->path.startup_cost = subpath->startup_cost + cpu_tuple_cost;
+	pathnode->path.total_cost = subpath->total_cost + cpu_tuple_cost;
+
+	return pathnode;
+}
+
 /*
  * create_unique_path
  *	  Creates a path representing elimination of distinct rows from the
@@ -1590,7 +1691,8 @@ create_unique_path(PlannerInfo *root, RelOptInfo *rel, Path *subpath,
 					 numCols, pathnode->path.rows,
 					 subpath->startup_cost,
 					 subpath->total_cost,
-					 rel->rows);
+					 rel->rows,
+					 subpath->pathtarget->width);
 	}
 
 	if (sjinfo->semi_can_btree && sjinfo->semi_can_hash)
@@ -1699,6 +1801,66 @@ create_gather_path(PlannerInfo *root, RelOptInfo *rel, Path *subpath,
 	return pathnode;
 }
 
+/*
+ * create_gather_merge_path
+ *
+ *	  Creates a path corresponding to a gather merge scan, returning
+ *	  the pathnode.  The subpath must be sorted according to 'pathkeys',
+ *	  which become the sort order of the result.
+ */
+GatherMergePath *
+create_gather_merge_path(PlannerInfo *root, RelOptInfo *rel, Path *subpath,
+						 PathTarget *target, List *pathkeys,
+						 Relids required_outer, double *rows)
+{
+	GatherMergePath *pathnode = makeNode(GatherMergePath);
+	Cost		input_startup_cost = 0;
+	Cost		input_total_cost = 0;
+
+	Assert(subpath->parallel_safe);
+	Assert(pathkeys);
+
+	pathnode->path.pathtype = T_GatherMerge;
+	pathnode->path.parent = rel;
+	pathnode->path.param_info = get_baserel_parampathinfo(root, rel,
+														  required_outer);
+	pathnode->path.parallel_aware = false;
+
+	pathnode->subpath = subpath;
+	pathnode->path.parallel_workers = subpath->parallel_workers;
+	pathnode->path.pathkeys = pathkeys;
+	pathnode->path.pathtarget = target ? target : rel->reltarget;
+
+	if (pathkeys_contained_in(pathkeys, subpath->pathkeys))
+	{
+		/* Subpath is adequately ordered, we won't need to sort it */
+		input_startup_cost += subpath->startup_cost;
+		input_total_cost += subpath->total_cost;
+	}
+	else
+	{
+		/* We'll need to insert a Sort node, so include cost for that */
+		Path		sort_path;	/* dummy for result of cost_sort */
+
+		cost_sort(&sort_path,
+				  root,
+				  pathkeys,
+				  subpath->total_cost,
+				  subpath->rows,
+				  subpath->pathtarget->width,
+				  0.0,
+				  work_mem,
+				  -1);
+		input_startup_cost += sort_path.startup_cost;
+		input_total_cost += sort_path.total_cost;
+	}
+
+	cost_gather_merge(pathnode, root, rel, pathnode->path.param_info,
+					  input_startup_cost, input_total_cost, rows);
+
+	return pathnode;
+}
+
 /*
  * create_subqueryscan_path
  *	  Creates a path corresponding to a scan of a subquery,
@@ -2092,6 +2254,7 @@ create_mergejoin_path(PlannerInfo *root,
  * 'semifactors' contains valid data if jointype is SEMI or ANTI
  * 'outer_path' is the cheapest outer path
  * 'inner_path' is the cheapest inner path
+ * 'parallel_hash' to select Parallel Hash of inner path (shared hash table)
  * 'restrict_clauses' are the RestrictInfo nodes to apply at the join
  * 'required_outer' is the set of required outer rels
  * 'hashclauses' are the RestrictInfo nodes to use as hash clauses
@@ -2106,6 +2269,7 @@ create_hashjoin_path(PlannerInfo *root,
 					 SemiAntiJoinFactors *semifactors,
 					 Path *outer_path,
 					 Path *inner_path,
+					 bool parallel_hash,
 					 List *restrict_clauses,
 					 Relids required_outer,
 					 List *hashclauses)
@@ -2123,7 +2287,8 @@ create_hashjoin_path(PlannerInfo *root,
 								  sjinfo,
 								  required_outer,
 								  &restrict_clauses);
-	pathnode->jpath.path.parallel_aware = false;
+	pathnode->jpath.path.parallel_aware =
+		joinrel->consider_parallel && parallel_hash;
 	pathnode->jpath.path.parallel_safe = joinrel->consider_parallel &&
 		outer_path->parallel_safe && inner_path->parallel_safe;
 	/* This is a foolish way to estimate parallel_workers, but for now... */
@@ -2147,6 +2312,7 @@ create_hashjoin_path(PlannerInfo *root,
 	pathnode->jpath.joinrestrictinfo = restrict_clauses;
 	pathnode->path_hashclauses = hashclauses;
 	/* final_cost_hashjoin will fill in pathnode->num_batches */
+	/* ... and pathnode->inner_rows_total */
 
 	final_cost_hashjoin(root, pathnode, workspace, sjinfo, semifactors);
 
@@ -2362,6 +2528,54 @@ create_sort_path(PlannerInfo *root,
 	return pathnode;
 }
 
+/*
+ * create_incremental_sort_path
+ *	  Creates a pathnode that represents performing an incremental sort.
+ *
+ * 'rel' is the parent relation associated with the result
+ * 'subpath' is the path representing the source of data
+ * 'pathkeys' represents the desired sort order
+ * 'presorted_keys' is the number of leading pathkeys subpath is sorted by
+ * 'limit_tuples' is the estimated bound on the number of output tuples,
+ *		or -1 if no LIMIT or couldn't estimate
+ */
+IncrementalSortPath *
+create_incremental_sort_path(PlannerInfo *root,
+							 RelOptInfo *rel,
+							 Path *subpath,
+							 List *pathkeys,
+							 int presorted_keys,
+							 double limit_tuples)
+{
+	IncrementalSortPath *sort = makeNode(IncrementalSortPath);
+	SortPath   *pathnode = &sort->spath;
+
+	pathnode->path.pathtype = T_IncrementalSort;
+	pathnode->path.parent = rel;
+	/* Sort doesn't project, so use source path's pathtarget */
+	pathnode->path.pathtarget = subpath->pathtarget;
+	/* For now, assume we are above any joins, so no parameterization */
+	pathnode->path.param_info = NULL;
+	pathnode->path.parallel_aware = false;
+	pathnode->path.parallel_safe = rel->consider_parallel &&
+		subpath->parallel_safe;
+	pathnode->path.parallel_workers = subpath->parallel_workers;
+	pathnode->path.pathkeys = pathkeys;
+
+	pathnode->subpath = subpath;
+	sort->nPresortedCols = presorted_keys;
+
+	cost_incremental_sort(&pathnode->path, root, pathkeys, presorted_keys,
+						  subpath->startup_cost,
+						  subpath->total_cost,
+						  subpath->rows,
+						  subpath->pathtarget->width,
+						  0.0,	/* XXX comparison_cost shouldn't be 0? */
+						  work_mem, limit_tuples);
+
+	return sort;
+}
+
 /*
  * create_group_path
  *	  Creates a pathnode that represents performing grouping of presorted input
@@ -2522,7 +2736,7 @@ create_agg_path(PlannerInfo *root,
 			 aggstrategy, aggcosts,
 			 list_length(groupClause), numGroups,
 			 subpath->startup_cost, subpath->total_cost,
-			 subpath->rows);
+			 subpath->rows, subpath->pathtarget->width);
 
 	/* add tlist eval cost for each output row */
 	pathnode->path.startup_cost += target->cost.startup;
@@ -2536,16 +2750,19 @@ create_agg_path(PlannerInfo *root,
  * create_groupingsets_path
  *	  Creates a pathnode that represents performing GROUPING SETS aggregation
  *
- * GroupingSetsPath represents sorted grouping with one or more grouping sets.
- * The input path's result must be sorted to match the last entry in
- * rollup_groupclauses.
+ * GroupingSetsPath represents grouping with one or more grouping sets, each
+ * computed either as part of a sorted rollup or with a hash table of its own.
+ * With AGG_SORTED or AGG_MIXED, the input path's result must be sorted to
+ * match the last entry in rollup_groupclauses.
  *
  * 'rel' is the parent relation associated with the result
  * 'subpath' is the path representing the source of data
  * 'target' is the PathTarget to be computed
  * 'having_qual' is the HAVING quals if any
+ * 'aggstrategy' is AGG_SORTED, AGG_HASHED or AGG_MIXED
  * 'rollup_lists' is a list of grouping sets
  * 'rollup_groupclauses' is a list of grouping clauses for grouping sets
+ * 'hashed_sets' is a list of HashedGroupingSet
  * 'agg_costs' contains cost info about the aggregate functions to be computed
  * 'numGroups' is the estimated number of groups
  */
@@ -2555,13 +2772,16 @@ create_groupingsets_path(PlannerInfo *root,
 						 Path *subpath,
 						 PathTarget *target,
 						 List *having_qual,
+						 AggStrategy aggstrategy,
 						 List *rollup_lists,
 						 List *rollup_groupclauses,
+						 List *hashed_sets,
 						 const AggClauseCosts *agg_costs,
 						 double numGroups)
 {
 	GroupingSetsPath *pathnode = makeNode(GroupingSetsPath);
 	int			numGroupCols;
+	ListCell   *lc;
 
 	/* The topmost generated Plan node will be an Agg */
 	pathnode->path.pathtype = T_Agg;
@@ -2576,33 +2796,59 @@ create_groupingsets_path(PlannerInfo *root,
 
 	/*
 	 * Output will be in sorted order by group_pathkeys if, and only if, there
-	 * is a single rollup operation on a non-empty list of grouping
+	 * is a single sorted rollup operation on a non-empty list of grouping
 	 * expressions.
 	 */
-	if (list_length(rollup_groupclauses) == 1 &&
+	if (aggstrategy == AGG_SORTED &&
+		list_length(rollup_groupclauses) == 1 &&
 		((List *) linitial(rollup_groupclauses)) != NIL)
 		pathnode->path.pathkeys = root->group_pathkeys;
 	else
 		pathnode->path.pathkeys = NIL;
 
+	pathnode->aggstrategy = aggstrategy;
 	pathnode->rollup_groupclauses = rollup_groupclauses;
 	pathnode->rollup_lists = rollup_lists;
+	pathnode->hashed_sets = hashed_sets;
 	pathnode->qual = having_qual;
 
-	Assert(rollup_lists != NIL);
 	Assert(list_length(rollup_lists) == list_length(rollup_groupclauses));
+	Assert((rollup_lists != NIL) == (aggstrategy != AGG_HASHED));
+	Assert((hashed_sets != NIL) == (aggstrategy != AGG_SORTED));
 
-	/* Account for cost of the topmost Agg node */
-	numGroupCols = list_length((List *) linitial((List *) llast(rollup_lists)));
+	if (aggstrategy == AGG_HASHED)
+	{
+		HashedGroupingSet *hs = (HashedGroupingSet *) linitial(hashed_sets);
 
-	cost_agg(&pathnode->path, root,
-			 (numGroupCols > 0) ? AGG_SORTED : AGG_PLAIN,
-			 agg_costs,
-			 numGroupCols,
-			 numGroups,
-			 subpath->startup_cost,
-			 subpath->total_cost,
-			 subpath->rows);
+		/*
+		 * The first hash table is the topmost Agg node; all the tables are
+		 * filled before anything is returned.
+		 */
+		cost_agg(&pathnode->path, root,
+				 AGG_HASHED,
+				 agg_costs,
+				 list_length(hs->set),
+				 hs->numGroups,
+				 subpath->startup_cost,
+				 subpath->total_cost,
+				 subpath->rows,
+				 subpath->pathtarget->width);
+	}
+	else
+	{
+		/* Account for cost of the topmost (or presorted) Agg node */
+		numGroupCols = list_length((List *) linitial((List *) llast(rollup_lists)));
+
+		cost_agg(&pathnode->path, root,
+				 (numGroupCols > 0) ? AGG_SORTED : AGG_PLAIN,
+				 agg_costs,
+				 numGroupCols,
+				 numGroups,
+				 subpath->startup_cost,
+				 subpath->total_cost,
+				 subpath->rows,
+				 subpath->pathtarget->width);
+	}
 
 	/*
 	 * Add in the costs and output rows of the additional sorting/aggregation
@@ -2611,8 +2857,6 @@ create_groupingsets_path(PlannerInfo *root,
 	 */
 	if (list_length(rollup_lists) > 1)
 	{
-		ListCell   *lc;
-
 		foreach(lc, rollup_lists)
 		{
 			List	   *gsets = (List *) lfirst(lc);
@@ -2642,13 +2886,47 @@ create_groupingsets_path(PlannerInfo *root,
 					 numGroups, /* XXX surely not right for all steps? */
 					 sort_path.startup_cost,
 					 sort_path.total_cost,
-					 sort_path.rows);
+					 sort_path.rows,
+					 subpath->pathtarget->width);
 
 			pathnode->path.total_cost += agg_path.total_cost;
 			pathnode->path.rows += agg_path.rows;
 		}
 	}
 
+	/*
+	 * Likewise for the hash tables, other than a first one that was costed
+	 * as the topmost node above.  They are filled from the input as it is
+	 * read, so there's no input cost to charge again.  Without any sorted
+	 * rollups, they must all be filled before the first row is returned.
+	 */
+	foreach(lc, hashed_sets)
+	{
+		HashedGroupingSet *hs = (HashedGroupingSet *) lfirst(lc);
+		Path		agg_path;	/* dummy for result of cost_agg */
+
+		if (aggstrategy == AGG_HASHED && lc == list_head(hashed_sets))
+			continue;
+
+		cost_agg(&agg_path, root,
+				 AGG_HASHED,
+				 agg_costs,
+				 list_length(hs->set),
+				 hs->numGroups,
+				 0.0,
+				 0.0,
+				 subpath->rows,
+				 subpath->pathtarget->width);
+
+		if (aggstrategy == AGG_HASHED)
+			pathnode->path.startup_cost += agg_path.startup_cost;
+		pathnode->path.total_cost += agg_path.total_cost;
+	}
+
+	/* With any hashing, we have an estimate of the rows of each set */
+	if (aggstrategy != AGG_SORTED)
+		pathnode->path.rows = numGroups;
+
 	/* add tlist eval cost for each output row */
 	pathnode->path.startup_cost += target->cost.startup;
 	pathnode->path.total_cost += target->cost.startup +
@@ -3181,7 +3459,7 @@ reparameterize_path(PlannerInfo *root, Path *path,
 				memcpy(newpath, ipath, sizeof(IndexPath));
 				newpath->path.param_info =
 					get_baserel_parampathinfo(root, rel, required_outer);
-				cost_index(newpath, root, loop_count);
+				cost_index(newpath, root, loop_count, false);
 				return (Path *) newpath;
 			}
 		case T_BitmapHeapScan:
@@ -3192,7 +3470,7 @@ reparameterize_path(PlannerInfo *root, Path *path,
 														rel,
 														bpath->bitmapqual,
 														required_outer,
-														loop_count);
+														loop_count, 0);
 			}
 		case T_SubqueryScan:
 			{
@@ -14,9 +14,11 @@
  */
 #include "postgres.h"
 
+#include "catalog/pg_type.h"
 #include "nodes/makefuncs.h"
 #include "nodes/nodeFuncs.h"
 #include "optimizer/tlist.h"
+#include "utils/lsyscache.h"
 
 
 /*****************************************************************************
@@ -527,6 +529,40 @@ grouping_is_hashable(List *groupClause)
 	return true;
 }
 
+/*
+ * aggref_distinct_is_hashable - can a DISTINCT aggregate eliminate duplicate
+ *		inputs by hashing instead of sorting?
+ *
+ * A hash table passes the surviving inputs to the transition function in no
+ * particular order, so there must be no ORDER BY, and the aggregate must not
+ * care about input order.  We take having a combine function as a promise of
+ * the latter, since partial aggregation already feeds such aggregates their
+ * input in arbitrary order, except for floating-point transition types:
+ * their rounding errors depend on the order of the inputs, which partial
+ * aggregation tolerates but a DISTINCT aggregate has never been subject to.
+ * (nodeWindowAgg.c makes the same exception for the same reason.)  The
+ * planner and the executor must agree on this.
+ */
+bool
+aggref_distinct_is_hashable(Aggref *aggref, Oid aggcombinefn,
+							Oid aggtranstype)
+{
+	Oid			elemtype;
+
+	if (aggref->aggdistinct == NIL ||
+		aggref->aggorder != NIL ||
+		!OidIsValid(aggcombinefn))
+		return false;
+
+	elemtype = get_element_type(aggtranstype);
+	if (OidIsValid(elemtype))
+		aggtranstype = elemtype;
+	if (aggtranstype == FLOAT4OID || aggtranstype == FLOAT8OID)
+		return false;
+
+	return grouping_is_hashable(aggref->aggdistinct);
+}
+
 
 /*****************************************************************************
  *		PathTarget manipulation functions
@@ -16,9 +16,9 @@
 
 #include "miscadmin.h"
 #include "libpq/pqsignal.h"
+#include "port/atomics.h"
 #include "postmaster/bgworker_internals.h"
 #include "postmaster/postmaster.h"
-#include "storage/barrier.h"
 #include "storage/dsm.h"
 #include "storage/ipc.h"
 #include "storage/latch.h"
@@ -1050,3 +1050,33 @@ TerminateBackgroundWorker(BackgroundWorkerHandle *handle)
 	if (signal_postmaster)
 		SendPostmasterSignal(PMSIGNAL_BACKGROUND_WORKER_CHANGE);
 }
+
+/*
+ * Extract the identity of a background worker handle, so that it can be
+ * stored in shared memory and used by some other backend.
+ */
+void
+ExportBackgroundWorkerHandle(BackgroundWorkerHandle *handle, int *slot,
+							 uint64 *generation)
+{
+	*slot = handle->slot;
+	*generation = handle->generation;
+}
+
+/*
+ * Rebuild a background worker handle from an identity previously extracted
+ * by ExportBackgroundWorkerHandle.  The result is palloc'd in the current
+ * memory context.
+ */
+BackgroundWorkerHandle *
+ImportBackgroundWorkerHandle(int slot, uint64 generation)
+{
+	BackgroundWorkerHandle *handle;
+
+	Assert(slot >= 0 && slot < max_worker_processes);
+	handle = palloc(sizeof(BackgroundWorkerHandle));
+	handle->slot = slot;
+	handle->generation = generation;
+
+	return handle;
+}
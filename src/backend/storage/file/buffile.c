@@ -31,15 +31,21 @@
  * BufFile also supports temporary files that exceed the OS file size limit
  * (by opening multiple fd.c temporary files).  This is an essential feature
  * for sorts and hashjoins on large amounts of data.
+ *
+ * BufFile supports temporary files that can be shared with other backends,
+ * as infrastructure for parallel execution.  Such files need to be created
+ * as a member of a SharedFileSet that all participants are attached to.
  *-------------------------------------------------------------------------
  */
 
 #include "postgres.h"
 
 #include "executor/instrument.h"
+#include "miscadmin.h"
 #include "storage/fd.h"
 #include "storage/buffile.h"
 #include "storage/buf_internals.h"
+#include "storage/sharedfileset.h"
 #include "utils/resowner.h"
 
 /*
@@ -70,6 +76,14 @@ struct BufFile
 	bool		isTemp;			/* can only add files if this is TRUE */
 	bool		isInterXact;	/* keep open over transactions? */
 	bool		dirty;			/* does buffer need to be written? */
+	bool		readOnly;		/* has the file been opened for reading? */
+
+	/*
+	 * For shared BufFiles, the set the segment files belong to and the name
+	 * they are known by; NULL otherwise.
+	 */
+	SharedFileSet *fileset;
+	const char *name;
 
 	/*
 	 * resowner is the ResourceOwner to use for underlying temp files.  (We
@@ -90,6 +104,10 @@ struct BufFile
 };
 
 static BufFile *makeBufFile(File firstfile);
+static File MakeNewSharedSegment(SharedFileSet *fileset, const char *name,
+					 int segment);
+static void SharedSegmentName(char *name, const char *buffile_name,
+				  int segment);
 static void extendBufFile(BufFile *file);
 static void BufFileLoadBuffer(BufFile *file);
 static void BufFileDumpBuffer(BufFile *file);
@@ -113,6 +131,9 @@ makeBufFile(File firstfile)
 	file->isTemp = false;
 	file->isInterXact = false;
 	file->dirty = false;
+	file->readOnly = false;
+	file->fileset = NULL;
+	file->name = NULL;
 	file->resowner = CurrentResourceOwner;
 	file->curFile = 0;
 	file->curOffset = 0L;
@@ -136,7 +157,11 @@ extendBufFile(BufFile *file)
 	CurrentResourceOwner = file->resowner;
 
 	Assert(file->isTemp);
-	pfile = OpenTemporaryFile(file->isInterXact);
+	if (file->fileset == NULL)
+		pfile = OpenTemporaryFile(file->isInterXact);
+	else
+		pfile = MakeNewSharedSegment(file->fileset, file->name,
+									 file->numFiles);
 	Assert(pfile >= 0);
 
 	CurrentResourceOwner = oldowner;
@@ -178,6 +203,173 @@ BufFileCreateTemp(bool interXact)
 	return file;
 }
 
+/*
+ * Build the name for a given segment of a given shared BufFile.
+ */
+static void
+SharedSegmentName(char *name, const char *buffile_name, int segment)
+{
+	snprintf(name, MAXPGPATH, "%s.%d", buffile_name, segment);
+}
+
+/*
+ * Create a new segment file backing a shared BufFile.
+ */
+static File
+MakeNewSharedSegment(SharedFileSet *fileset, const char *buffile_name,
+					 int segment)
+{
+	char		name[MAXPGPATH];
+
+	/*
+	 * It is possible that there are files left over from before a crash
+	 * restart with the same name.  In order for BufFileOpenShared() not to
+	 * get confused about how many segments there are, we'll unlink the next
+	 * segment number if it already exists.
+	 */
+	SharedSegmentName(name, buffile_name, segment + 1);
+	SharedFileSetDelete(fileset, name, true);
+
+	/* Create the new segment. */
+	SharedSegmentName(name, buffile_name, segment);
+	return SharedFileSetCreate(fileset, name);
+}
+
+/*
+ * Create a BufFile that can be discovered and opened read-only by other
+ * backends that are attached to the same SharedFileSet using the same name.
+ *
+ * The naming scheme for shared BufFiles is left up to the calling code.  The
+ * name will appear as part of one or more filenames on disk, and might
+ * provide clues to administrators about which subsystem is generating
+ * temporary file data.  Since each SharedFileSet object is backed by one or
+ * more uniquely named temporary directory, names don't conflict with
+ * unrelated SharedFileSet objects.
+ */
+BufFile *
+BufFileCreateShared(SharedFileSet *fileset, const char *name)
+{
+	BufFile    *file;
+
+	file = makeBufFile(MakeNewSharedSegment(fileset, name, 0));
+	file->fileset = fileset;
+	file->name = pstrdup(name);
+	file->isTemp = true;
+
+	return file;
+}
+
+/*
+ * Open a file that was previously created in another backend (or this one)
+ * with BufFileCreateShared in the same SharedFileSet using the same name.
+ * The backend that created the file must have called BufFileClose() or
+ * BufFileExportShared() to make sure that it is ready to be opened by other
+ * backends and render it read-only.  Returns NULL if no file of that name
+ * exists.
+ */
+BufFile *
+BufFileOpenShared(SharedFileSet *fileset, const char *name)
+{
+	BufFile    *file;
+	char		segment_name[MAXPGPATH];
+	int			capacity = 16;
+	File	   *files;
+	int			nfiles = 0;
+
+	files = palloc(sizeof(File) * capacity);
+
+	/*
+	 * We don't know how many segments there are, so we'll probe the
+	 * filesystem to find out.
+	 */
+	for (;;)
+	{
+		/* See if we need to expand our file segment array. */
+		if (nfiles + 1 > capacity)
+		{
+			capacity *= 2;
+			files = repalloc(files, sizeof(File) * capacity);
+		}
+		/* Try to load a segment. */
+		SharedSegmentName(segment_name, name, nfiles);
+		files[nfiles] = SharedFileSetOpen(fileset, segment_name);
+		if (files[nfiles] <= 0)
+			break;
+		++nfiles;
+
+		CHECK_FOR_INTERRUPTS();
+	}
+
+	/* The file doesn't exist, or hasn't been written yet. */
+	if (nfiles == 0)
+	{
+		pfree(files);
+		return NULL;
+	}
+
+	file = makeBufFile(files[0]);
+	pfree(file->files);
+	pfree(file->offsets);
+	file->files = files;
+	file->offsets = (off_t *) palloc0(sizeof(off_t) * nfiles);
+	file->numFiles = nfiles;
+	file->isTemp = true;
+	file->readOnly = true;
+	file->fileset = fileset;
+	file->name = pstrdup(name);
+
+	return file;
+}
+
+/*
+ * Delete a BufFile that was created by BufFileCreateShared in the given
+ * SharedFileSet using the given name.
+ *
+ * It is not necessary to delete files explicitly with this function.  It is
+ * provided only as a way to delete files proactively, rather than waiting for
+ * the SharedFileSet to be cleaned up.
+ *
+ * Only one backend should attempt to delete a given name, and should know
+ * that it exists and has been exported or closed.
+ */
+void
+BufFileDeleteShared(SharedFileSet *fileset, const char *name)
+{
+	char		segment_name[MAXPGPATH];
+	int			segment = 0;
+
+	/*
+	 * We don't know how many segments the file has.  We'll keep deleting
+	 * until we run out.
+	 */
+	for (;;)
+	{
+		SharedSegmentName(segment_name, name, segment);
+		if (!SharedFileSetDelete(fileset, segment_name, true))
+			break;
+		++segment;
+
+		CHECK_FOR_INTERRUPTS();
+	}
+}
+
+/*
+ * BufFileExportShared --- flush and make read-only, in preparation for
+ * sharing.
+ */
+void
+BufFileExportShared(BufFile *file)
+{
+	/* Must be a file belonging to a SharedFileSet. */
+	Assert(file->fileset != NULL);
+
+	/* It's probably a bug if someone calls this twice. */
+	Assert(!file->readOnly);
+
+	BufFileFlush(file);
+	file->readOnly = true;
+}
+
 #ifdef NOT_USED
 /*
  * Create a BufFile and attach it to an already-opened virtual File.
@@ -211,6 +403,8 @@ BufFileClose(BufFile *file)
 	/* release the buffer space */
 	pfree(file->files);
 	pfree(file->offsets);
+	if (file->name)
+		pfree((char *) file->name);
 	pfree(file);
 }
 
@@ -407,6 +601,8 @@ BufFileWrite(BufFile *file, void *ptr, size_t size)
 	size_t		nwritten = 0;
 	size_t		nthistime;
 
+	Assert(!file->readOnly);
+
 	while (size > 0)
 	{
 		if (file->pos >= BLCKSZ)
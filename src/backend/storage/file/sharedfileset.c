@@ -0,0 +1,242 @@
+/*-------------------------------------------------------------------------
+ *
+ * sharedfileset.c
+ *	  Shared temporary file management.
+ *
+ * Portions Copyright (c) 1996-2016, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *	  src/backend/storage/file/sharedfileset.c
+ *
+ * NOTES:
+ *
+ * SharedFileSets provide a temporary namespace (think directory) so that
+ * files can be discovered by name, and a shared ownership semantics so that
+ * shared files survive until the last user detaches.
+ *
+ * All files of a set live in the temporary file directory of one tablespace,
+ * and their names start with a prefix made from the PID of the backend that
+ * created the set and a per-backend counter.  That prefix is chosen so that
+ * the names can't collide with those of OpenTemporaryFile, and so that
+ * RemovePgTempFiles cleans up anything left behind after a crash.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "postgres.h"
+
+#include <sys/stat.h>
+
+#include "catalog/pg_tablespace.h"
+#include "commands/tablespace.h"
+#include "miscadmin.h"
+#include "storage/sharedfileset.h"
+
+static uint32 sharedFileSetCounter = 0;
+
+static void SharedFileSetOnDetach(dsm_segment *segment, Datum datum);
+static void SharedFileSetPrefix(char *prefix, SharedFileSet *fileset);
+static void SharedFileSetPath(char *path, SharedFileSet *fileset,
+				  const char *name);
+
+/*
+ * Initialize a space for temporary files that can be opened by other
+ * backends.  Other backends must attach to it before accessing it.  The set
+ * is cleaned up automatically when the last backend detaches from 'seg',
+ * which must be the DSM segment containing 'fileset'.
+ *
+ * Files will be placed in the next temporary tablespace, as with
+ * OpenTemporaryFile.
+ */
+void
+SharedFileSetInit(SharedFileSet *fileset, dsm_segment *seg)
+{
+	SpinLockInit(&fileset->mutex);
+	fileset->refcnt = 1;
+	fileset->creator_pid = MyProcPid;
+	fileset->number = sharedFileSetCounter++;
+
+	PrepareTempTablespaces();
+	fileset->tablespace = GetNextTempTableSpace();
+	if (!OidIsValid(fileset->tablespace))
+		fileset->tablespace = MyDatabaseTableSpace ? MyDatabaseTableSpace :
+			DEFAULTTABLESPACE_OID;
+
+	/* Register our cleanup callback. */
+	on_dsm_detach(seg, SharedFileSetOnDetach, PointerGetDatum(fileset));
+}
+
+/*
+ * Attach to a set of files that was created with SharedFileSetInit.
+ */
+void
+SharedFileSetAttach(SharedFileSet *fileset, dsm_segment *seg)
+{
+	bool		success;
+
+	SpinLockAcquire(&fileset->mutex);
+	if (fileset->refcnt == 0)
+		success = false;
+	else
+	{
+		++fileset->refcnt;
+		success = true;
+	}
+	SpinLockRelease(&fileset->mutex);
+
+	if (!success)
+		ereport(ERROR,
+				(errcode(ERRCODE_OBJECT_NOT_IN_PREREQUISITE_STATE),
+				 errmsg("could not attach to a SharedFileSet that is already destroyed")));
+
+	/* Register our cleanup callback. */
+	on_dsm_detach(seg, SharedFileSetOnDetach, PointerGetDatum(fileset));
+}
+
+/*
+ * Create a new file in the given set.
+ */
+File
+SharedFileSetCreate(SharedFileSet *fileset, const char *name)
+{
+	char		path[MAXPGPATH];
+	File		file;
+
+	SharedFileSetPath(path, fileset, name);
+	file = PathNameCreateTemporaryFile(path, false);
+
+	/* If we failed, see if we need to create the directory on demand. */
+	if (file <= 0)
+	{
+		char		tempdirpath[MAXPGPATH];
+
+		/*
+		 * Don't check for error from mkdir; it could fail if someone else
+		 * just did the same thing.  If it doesn't work then we'll bomb out on
+		 * the second create attempt, instead.
+		 */
+		TempTablespacePath(tempdirpath, fileset->tablespace);
+		mkdir(tempdirpath, S_IRWXU);
+
+		file = PathNameCreateTemporaryFile(path, true);
+	}
+
+	return file;
+}
+
+/*
+ * Open a file that was created with SharedFileSetCreate(), possibly in
+ * another backend.  Returns a value <= 0 if there is no such file.
+ */
+File
+SharedFileSetOpen(SharedFileSet *fileset, const char *name)
+{
+	char		path[MAXPGPATH];
+
+	SharedFileSetPath(path, fileset, name);
+	return PathNameOpenTemporaryFile(path);
+}
+
+/*
+ * Delete a file that was created with SharedFileSetCreate().
+ * Return true if the file existed, false if didn't.
+ */
+bool
+SharedFileSetDelete(SharedFileSet *fileset, const char *name,
+					bool error_on_failure)
+{
+	char		path[MAXPGPATH];
+
+	SharedFileSetPath(path, fileset, name);
+	return PathNameDeleteTemporaryFile(path, error_on_failure);
+}
+
+/*
+ * Delete all files in the set.  The set itself remains usable.
+ */
+void
+SharedFileSetDeleteAll(SharedFileSet *fileset)
+{
+	char		dirpath[MAXPGPATH];
+	char		prefix[MAXPGPATH];
+	char		path[MAXPGPATH];
+	size_t		prefixlen;
+	DIR		   *dir;
+	struct dirent *de;
+
+	TempTablespacePath(dirpath, fileset->tablespace);
+	SharedFileSetPrefix(prefix, fileset);
+	prefixlen = strlen(prefix);
+
+	dir = AllocateDir(dirpath);
+	if (dir == NULL)
+		return;					/* no files were ever created */
+
+	while ((de = ReadDir(dir, dirpath)) != NULL)
+	{
+		if (strncmp(de->d_name, prefix, prefixlen) != 0)
+			continue;
+
+		if (snprintf(path, sizeof(path), "%s/%s",
+					 dirpath, de->d_name) >= sizeof(path))
+			elog(ERROR, "path of shared temporary file \"%s\" is too long",
+				 de->d_name);
+		PathNameDeleteTemporaryFile(path, false);
+	}
+
+	FreeDir(dir);
+}
+
+/*
+ * Callback function that will be invoked when this backend detaches from a
+ * DSM segment holding a SharedFileSet that it has created or attached to.  If
+ * we are the last to detach, then try to remove the files.
+ */
+static void
+SharedFileSetOnDetach(dsm_segment *segment, Datum datum)
+{
+	bool		unlink_all = false;
+	SharedFileSet *fileset = (SharedFileSet *) DatumGetPointer(datum);
+
+	SpinLockAcquire(&fileset->mutex);
+	Assert(fileset->refcnt > 0);
+	if (--fileset->refcnt == 0)
+		unlink_all = true;
+	SpinLockRelease(&fileset->mutex);
+
+	/*
+	 * If we are the last to detach, we delete the files.  No one else can be
+	 * creating new files in it at this point.
+	 */
+	if (unlink_all)
+		SharedFileSetDeleteAll(fileset);
+}
+
+/*
+ * Build the file name prefix shared by all files of the set.
+ */
+static void
+SharedFileSetPrefix(char *prefix, SharedFileSet *fileset)
+{
+	snprintf(prefix, MAXPGPATH, "%s%lu.%u.sharedfileset.",
+			 PG_TEMP_FILE_PREFIX, (unsigned long) fileset->creator_pid,
+			 fileset->number);
+}
+
+/*
+ * Build the path of a file in the set.
+ */
+static void
+SharedFileSetPath(char *path, SharedFileSet *fileset, const char *name)
+{
+	char		dirpath[MAXPGPATH];
+	char		prefix[MAXPGPATH];
+
+	TempTablespacePath(dirpath, fileset->tablespace);
+	SharedFileSetPrefix(prefix, fileset);
+	if (snprintf(path, MAXPGPATH, "%s/%s%s",
+				 dirpath, prefix, name) >= MAXPGPATH)
+		elog(ERROR, "path of shared temporary file \"%s\" is too long",
+			 name);
+}
@@ -1841,3 +1841,41 @@ BecomeLockGroupMember(PGPROC *leader, int pid)
 
 	return ok;
 }
+
+/*
+ * LeaveLockGroup - stop being a member of a lock group
+ *
+ * This is the counterpart of BecomeLockGroupMember, for processes (such as
+ * pooled parallel workers) that outlive the parallel operation for which
+ * they joined the group.  The caller must not hold any heavyweight locks.
+ * As in ProcKill, if the leader has already exited and we were the last
+ * member of its group, we are responsible for returning its PGPROC.
+ */
+void
+LeaveLockGroup(void)
+{
+	PGPROC	   *leader = MyProc->lockGroupLeader;
+	LWLock	   *leader_lwlock;
+
+	/* Must be a member, but not the leader. */
+	Assert(leader != NULL && leader != MyProc);
+
+	leader_lwlock = LockHashPartitionLockByProc(leader);
+	LWLockAcquire(leader_lwlock, LW_EXCLUSIVE);
+	Assert(!dlist_is_empty(&leader->lockGroupMembers));
+	dlist_delete(&MyProc->lockGroupLink);
+	if (dlist_is_empty(&leader->lockGroupMembers))
+	{
+		PGPROC	   *volatile * procgloballist = leader->procgloballist;
+
+		leader->lockGroupLeader = NULL;
+
+		/* Leader exited first; return its PGPROC. */
+		SpinLockAcquire(ProcStructLock);
+		leader->links.next = (SHM_QUEUE *) *procgloballist;
+		*procgloballist = leader;
+		SpinLockRelease(ProcStructLock);
+	}
+	MyProc->lockGroupLeader = NULL;
+	LWLockRelease(leader_lwlock);
+}
@@ -50,8 +50,8 @@
 #include <time.h>
 #include <unistd.h>
 
+#include "port/atomics.h"
 #include "storage/s_lock.h"
-#include "storage/barrier.h"
 
 
 #define MIN_SPINS_PER_DELAY 10
@@ -82,6 +82,7 @@ typedef bool (*IndexBulkDeleteCallback) (ItemPointer itemptr, void *state);
 /* struct definitions appear in relscan.h */
 typedef struct IndexScanDescData *IndexScanDesc;
 typedef struct SysScanDescData *SysScanDesc;
+typedef struct ParallelIndexScanDescData *ParallelIndexScanDesc;
 
 /*
  * Enumeration specifying the type of uniqueness check to perform in
@@ -141,6 +142,14 @@ extern IndexScanDesc index_beginscan_bitmap(Relation indexRelation,
 extern void index_rescan(IndexScanDesc scan,
 			 ScanKey keys, int nkeys,
 			 ScanKey orderbys, int norderbys);
+extern Size index_parallelscan_estimate(Relation indexRelation,
+							Snapshot snapshot);
+extern void index_parallelscan_initialize(Relation heapRelation,
+							  Relation indexRelation, Snapshot snapshot,
+							  ParallelIndexScanDesc target);
+extern void index_parallelrescan(IndexScanDesc scan);
+extern void index_parallelscan_attach(IndexScanDesc scan,
+						  ParallelIndexScanDesc pscan);
 extern void index_endscan(IndexScanDesc scan);
 extern void index_markpos(IndexScanDesc scan);
 extern void index_restrpos(IndexScanDesc scan);
@@ -148,6 +157,7 @@ extern ItemPointer index_getnext_tid(IndexScanDesc scan,
 				  ScanDirection direction);
 extern HeapTuple index_fetch_heap(IndexScanDesc scan);
 extern HeapTuple index_getnext(IndexScanDesc scan, ScanDirection direction);
+extern void index_prefetch_heap(IndexScanDesc scan, ItemPointer tid);
 extern int64 index_getbitmap(IndexScanDesc scan, TIDBitmap *bitmap);
 
 extern IndexBulkDeleteResult *index_bulk_delete(IndexVacuumInfo *info,
@@ -16,6 +16,7 @@
 
 #include "fmgr.h"
 #include "nodes/execnodes.h"
+#include "port/atomics.h"
 #ifndef HIPPO_H
 #define HIPPO_H
 
@@ -154,8 +155,23 @@ typedef struct HippoScanState
 	struct ewah_bitmap *compressedBitset;
 	Datum *histogramBounds;
 	int histogramBoundsNum;
+	/*
+	 * First index entry page, used to claim pages in a parallel scan.
+	 */
+	BlockNumber firstEntryPage;
 } HippoScanState;
 
+/*
+ * Shared state of a parallel HIPPO scan. Entries are independent of each other, so
+ * the participants simply claim entry pages one at a time. nextEntryPage counts from
+ * the first entry page, which is only known once the scan reads the index.
+ */
+typedef struct HippoParallelScanDescData
+{
+	pg_atomic_uint32 nextEntryPage;
+} HippoParallelScanDescData;
+typedef HippoParallelScanDescData *HippoParallelScanDesc;
+
 
 
 
@@ -178,6 +194,7 @@ typedef struct HippoScanState
 //extern Datum hippovacuumcleanup(PG_FUNCTION_ARGS);
 
 extern Datum hippohandler(PG_FUNCTION_ARGS);
+extern Datum hippo_estimate_count(PG_FUNCTION_ARGS);
 
 extern IndexBuildResult *hippobuild(Relation heap, Relation index,
 		  struct IndexInfo *indexInfo);
@@ -190,6 +207,9 @@ extern int64 hippogetbitmap(IndexScanDesc scan, TIDBitmap *tbm);
 extern void hipporescan(IndexScanDesc scan, ScanKey scankey, int nscankeys,
 		   ScanKey orderbys, int norderbys);
 extern void hippoendscan(IndexScanDesc scan);
+extern Size hippoestimateparallelscan(void);
+extern void hippoinitparallelscan(void *target);
+extern void hippoparallelrescan(IndexScanDesc scan);
 extern IndexBulkDeleteResult *hippobulkdelete(IndexVacuumInfo *info,
 			   IndexBulkDeleteResult *stats,
 			   IndexBulkDeleteCallback callback,
@@ -214,6 +234,7 @@ OffsetNumber hippo_doinsert(HippoBuildState *buildstate);
  * Index entry operations
  */
 void hippoGetNextIndexTuple(IndexScanDesc scan);
+BlockNumber hippo_parallel_next_page(IndexScanDesc scan,BlockNumber firstEntryPage);
 IndexTupleData * hippo_form_indextuple(HippoTupleLong *memTuple, Size *memlen);
 void hippo_form_memtuple(HippoTupleLong *hippoTupleLong,IndexTuple diskTuple,Size *memlen);
 bool hippo_can_do_samepage_update(Buffer buffer, Size origsz, Size newsz);
@@ -228,7 +249,7 @@ void binary_search_histogram_ondisk(searchResult *histogramMatchData, Relation i
 void binary_search_histogram(searchResult *histogramMatchData,int histogramBoundsNum,Datum *histogramBounds, Datum value);
 void put_histogram(Relation idxrel, BlockNumber startBlock, int histogramBoundsNum,Datum *histogramBounds);
 int get_histogram_totalNumber(Relation idxrel,BlockNumber startBlock);
-//int get_histogram(Relation idxrel,BlockNumber startblock,int histogramPosition)
+int get_histogram(Relation idxrel,BlockNumber startblock,int histogramPosition);
 
 /*
  *Index entries sorted list operations
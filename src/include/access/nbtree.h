@@ -633,6 +633,21 @@ typedef struct BTScanOpaqueData
 	 */
 	int			markItemIndex;	/* itemIndex, or -1 if not valid */
 
+	/*
+	 * Leaf page the latest scan started or ended on, which the next rescan
+	 * tries before descending the tree (see _bt_first), and how that has
+	 * been going.
+	 */
+	BlockNumber lastLeaf;		/* or InvalidBlockNumber */
+	int			lastLeafMisses; /* consecutive failed attempts */
+	int			lastLeafSkip;	/* rescans to go before trying again */
+
+	/*
+	 * When prefetching heap blocks, the currPos item furthest along in the
+	 * scan direction that we've already prefetched.
+	 */
+	int			prefetchItem;
+
 	/* keep these last in struct for efficiency */
 	BTScanPosData currPos;		/* current position data */
 	BTScanPosData markPos;		/* marked position, if any */
@@ -640,6 +655,10 @@ typedef struct BTScanOpaqueData
 
 typedef BTScanOpaqueData *BTScanOpaque;
 
+/* how many misses make _bt_first stop trying lastLeaf, and for how long */
+#define BT_LAST_LEAF_MAX_MISSES		4
+#define BT_LAST_LEAF_SKIP			64
+
 /*
  * We use some private sk_flags bits in preprocessed scan keys.  We're allowed
  * to use bits 16-31 (see skey.h).  The uppermost bits are copied from the
@@ -676,6 +695,16 @@ extern IndexBulkDeleteResult *btbulkdelete(IndexVacuumInfo *info,
 extern IndexBulkDeleteResult *btvacuumcleanup(IndexVacuumInfo *info,
 				IndexBulkDeleteResult *stats);
 extern bool btcanreturn(Relation index, int attno);
+extern Size btestimateparallelscan(void);
+extern void btinitparallelscan(void *target);
+extern void btparallelrescan(IndexScanDesc scan);
+
+/*
+ * prototypes for internal functions in nbtree.c
+ */
+extern bool _bt_parallel_seize(IndexScanDesc scan, BlockNumber *pageno);
+extern void _bt_parallel_release(IndexScanDesc scan, BlockNumber scan_page);
+extern void _bt_parallel_done(IndexScanDesc scan);
 
 /*
  * prototypes for functions in nbtinsert.c
@@ -27,6 +27,8 @@ typedef struct ParallelWorkerInfo
 	BackgroundWorkerHandle *bgwhandle;
 	shm_mq_handle *error_mqh;
 	int32		pid;
+	int			pool_slot;		/* worker pool slot, or -1 if not pooled */
+	uint64		pool_job;		/* job number assigned in that slot */
 } ParallelWorkerInfo;
 
 typedef struct ParallelContext
@@ -49,6 +51,7 @@ typedef struct ParallelContext
 extern volatile bool ParallelMessagePending;
 extern int	ParallelWorkerNumber;
 extern bool InitializingParallelWorker;
+extern int	parallel_worker_pool_size;
 
 #define		IsParallelWorker()		(ParallelWorkerNumber >= 0)
 
@@ -67,4 +70,8 @@ extern void AtEOXact_Parallel(bool isCommit);
 extern void AtEOSubXact_Parallel(bool isCommit, SubTransactionId mySubId);
 extern void ParallelWorkerReportLastRecEnd(XLogRecPtr last_xlog_end);
 
+extern Size ParallelWorkerPoolShmemSize(void);
+extern void ParallelWorkerPoolShmemInit(void);
+extern void TerminatePooledParallelWorkers(Oid databaseId);
+
 #endif   /* PARALLEL_H */
@@ -125,8 +125,30 @@ typedef struct IndexScanDescData
 
 	/* state data for traversing HOT chains in index_getnext */
 	bool		xs_continue_hot;	/* T if must keep walking HOT chain */
+
+	/*
+	 * Heap prefetching: the caller sets xs_prefetch_distance to ask an AM
+	 * that can see upcoming TIDs to prefetch their heap blocks that many
+	 * entries ahead, through index_prefetch_heap.
+	 */
+	int			xs_prefetch_distance;	/* 0 means don't prefetch */
+	BlockNumber xs_prefetch_block;	/* last block prefetched */
+	Buffer		xs_prefetch_vmbuffer;	/* VM page, for index-only scans */
+	long		xs_prefetch_count;	/* blocks prefetched so far */
+
+	/* parallel index scan information, in shared memory */
+	ParallelIndexScanDesc parallel_scan;
 }	IndexScanDescData;
 
+/* Generic structure for parallel index scans */
+typedef struct ParallelIndexScanDescData
+{
+	Oid			ps_relid;		/* OID of the heap relation */
+	Oid			ps_indexid;		/* OID of the index relation */
+	Size		ps_offset;		/* offset of the AM-specific state */
+	char		ps_snapshot_data[FLEXIBLE_ARRAY_MEMBER];
+}	ParallelIndexScanDescData;
+
 /* Struct for heap-or-index scans of system tables */
 typedef struct SysScanDescData
 {
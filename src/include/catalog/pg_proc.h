@@ -567,6 +567,8 @@ DATA(insert OID = 3952 (  brin_summarize_new_values PGNSP PGUID 12 1 0 0 0 f f f
 DESCR("brin: standalone scan new table pages");
 DATA(insert OID = 336 (  hippohandler	PGNSP PGUID 12 1 0 0 0 f f f f t f v s 1 0 325 "2281" _null_ _null_ _null_ _null_ _null_	hippohandler _null_ _null_ _null_ ));
 DESCR("brin index access method handler");
+DATA(insert OID = 337 (  hippo_estimate_count PGNSP PGUID 12 1 0 0 0 f f f f t f s s 3 0 2249 "2205 20 20" "{2205,20,20,20,20,701}" "{i,i,i,o,o,o}" "{index,low,high,lower_estimate,upper_bound,expected}" _null_ _null_ hippo_estimate_count _null_ _null_ _null_ ));
+DESCR("hippo: estimate count of rows in a key range from the index");
 
 DATA(insert OID = 338 (  amvalidate		PGNSP PGUID 12 1 0 0 0 f f f f t f v s 1 0 16 "26" _null_ _null_ _null_ _null_ _null_	amvalidate _null_ _null_ _null_ ));
 DESCR("validate an operator class");
@@ -0,0 +1,79 @@
+/*-------------------------------------------------------------------------
+ *
+ * execBatch.h
+ *	  Support for passing rows between plan nodes a batch at a time
+ *
+ * A TupleBatch holds up to BATCH_SIZE rows as per-column arrays of deformed
+ * values, plus a selection vector listing the rows that passed the quals.
+ * Only pass-by-value columns can be batched, so that the values stay valid
+ * after the scan has moved off the page they came from.
+ *
+ *
+ * Portions Copyright (c) 1996-2016, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * src/include/executor/execBatch.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef EXECBATCH_H
+#define EXECBATCH_H
+
+#include "executor/tuptable.h"
+#include "nodes/pg_list.h"
+
+#define BATCH_SIZE		1024
+
+typedef struct TupleBatch
+{
+	int			ncols;			/* number of columns in use */
+	int			maxcols;		/* allocated length of the arrays below */
+	AttrNumber *attnos;			/* input attribute of each column, or 0 */
+	AttrNumber	lastattno;		/* highest input attribute to deform */
+	Datum	  **values;			/* values[col][row]; NULL if col unused */
+	bool	  **isnull;			/* isnull[col][row]; NULL if col unused */
+	int			nrows;			/* number of rows loaded */
+	int			nsel;			/* number of rows selected */
+	int		   *sel;			/* indexes of the selected rows, ascending */
+} TupleBatch;
+
+/* Comparison kernels available for batch quals */
+typedef enum BatchCmpType
+{
+	BATCH_CMP_INT4,				/* also used for date */
+	BATCH_CMP_INT8,
+	BATCH_CMP_FLOAT8
+} BatchCmpType;
+
+typedef enum BatchCmpOp
+{
+	BATCH_CMP_EQ,
+	BATCH_CMP_NE,
+	BATCH_CMP_LT,
+	BATCH_CMP_LE,
+	BATCH_CMP_GT,
+	BATCH_CMP_GE
+} BatchCmpOp;
+
+/* A qual of the form "column op constant" */
+typedef struct BatchQual
+{
+	int			col;			/* batch column */
+	BatchCmpType type;
+	BatchCmpOp	op;
+	Datum		constval;		/* never NULL */
+} BatchQual;
+
+/* GUC parameter */
+extern bool enable_batch_execution;
+
+extern TupleBatch *ExecBatchCreate(int ncols, int maxcols);
+extern void ExecBatchSetColumn(TupleBatch *batch, int col, AttrNumber attno);
+extern int	ExecBatchFindColumn(TupleBatch *batch, AttrNumber attno);
+extern bool ExecBatchQualsSupported(List *qual);
+extern void ExecBatchCompileQuals(TupleBatch *batch, List *qual,
+					  BatchQual **quals, int *nquals);
+extern void ExecBatchLoadRow(TupleBatch *batch, TupleTableSlot *slot);
+extern void ExecBatchFilter(TupleBatch *batch, BatchQual *quals, int nquals);
+
+#endif   /* EXECBATCH_H */
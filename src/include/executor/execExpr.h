@@ -0,0 +1,153 @@
+/*-------------------------------------------------------------------------
+ *
+ * execExpr.h
+ *	  Flat, step-based representation of executable expressions
+ *
+ * An expression whose top node is a function or operator call, a boolean
+ * AND/OR/NOT, or a scalar NULL test can be compiled into a linear array of
+ * steps that is run by a simple dispatch loop instead of recursing through
+ * the ExprState tree.  See execExprInterp.c.
+ *
+ *
+ * Portions Copyright (c) 1996-2016, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * src/include/executor/execExpr.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef EXEC_EXPR_H
+#define EXEC_EXPR_H
+
+#include "fmgr.h"
+#include "nodes/execnodes.h"
+
+/*
+ * Discriminator for ExprFlatStep.
+ *
+ * The interpreter jumps through a table indexed by these, so keep the table
+ * in execExprInterp.c in the same order.
+ */
+typedef enum ExprFlatOpcode
+{
+	/* entire expression has been evaluated completely, return */
+	EEOP_DONE,
+
+	/* deform the tuple in the corresponding slot up to d.fetch.last */
+	EEOP_INNER_FETCHSOME,
+	EEOP_OUTER_FETCHSOME,
+	EEOP_SCAN_FETCHSOME,
+
+	/* fetch a user attribute of an already-deformed tuple */
+	EEOP_INNER_VAR,
+	EEOP_OUTER_VAR,
+	EEOP_SCAN_VAR,
+
+	/* return a constant */
+	EEOP_CONST,
+
+	/*
+	 * Call a function whose arguments have already been evaluated into its
+	 * FunctionCallInfo; with a strictness check, or with statistics tracking
+	 * (which also checks strictness where needed).
+	 */
+	EEOP_FUNCEXPR,
+	EEOP_FUNCEXPR_STRICT,
+	EEOP_FUNCEXPR_FUSAGE,
+
+	/* fused strict call of a two-argument function on a scan Var and Const */
+	EEOP_FUNCEXPR_SCANVAR_CONST,
+
+	/* evaluate the arguments of an AND or OR, short-circuiting if possible */
+	EEOP_BOOL_AND_STEP_FIRST,
+	EEOP_BOOL_AND_STEP,
+	EEOP_BOOL_AND_STEP_LAST,
+	EEOP_BOOL_OR_STEP_FIRST,
+	EEOP_BOOL_OR_STEP,
+	EEOP_BOOL_OR_STEP_LAST,
+	EEOP_BOOL_NOT_STEP,
+
+	/* scalar IS [NOT] NULL */
+	EEOP_NULLTEST_ISNULL,
+	EEOP_NULLTEST_ISNOTNULL,
+
+	/* evaluate a subexpression that has no flat form the ordinary way */
+	EEOP_EVAL_TREE,
+
+	/* non-existent operation, used e.g. to check array lengths */
+	EEOP_LAST
+} ExprFlatOpcode;
+
+typedef struct ExprFlatStep
+{
+	/* opcode, an ExprFlatOpcode */
+	int			opcode;
+
+	/* where to store the result of this step */
+	Datum	   *resvalue;
+	bool	   *resnull;
+
+	/* opcode-specific data */
+	union
+	{
+		/* for EEOP_*_FETCHSOME */
+		struct
+		{
+			int			last;	/* highest attribute number needed */
+		}			fetch;
+
+		/* for EEOP_*_VAR */
+		struct
+		{
+			int			attnum; /* attribute number, starting at 0 */
+		}			var;
+
+		/* for EEOP_CONST */
+		struct
+		{
+			Datum		value;
+			bool		isnull;
+		}			constval;
+
+		/* for EEOP_FUNCEXPR_* */
+		struct
+		{
+			FmgrInfo   *finfo;	/* function's lookup data */
+			FunctionCallInfo fcinfo;	/* arguments etc */
+			PGFunction	fn_addr;	/* actual call address */
+			int			nargs;	/* number of arguments */
+			int			attnum; /* for _SCANVAR_CONST, the Var's */
+		}			func;
+
+		/* for EEOP_BOOL_*_STEP */
+		struct
+		{
+			bool	   *anynull;	/* track if any input was NULL */
+			int			jumpdone;	/* jump here if result determined */
+		}			boolexpr;
+
+		/* for EEOP_EVAL_TREE */
+		struct
+		{
+			ExprState  *state;
+		}			tree;
+	}			d;
+} ExprFlatStep;
+
+/*
+ * A compiled expression.  The steps run in order, except for jumps, and the
+ * last one is EEOP_DONE, which returns resvalue/resnull.
+ */
+typedef struct ExprFlatProgram
+{
+	ExprFlatStep *steps;
+	int			nsteps;
+	Datum		resvalue;
+	bool		resnull;
+} ExprFlatProgram;
+
+extern bool ExecFlatExprSupported(Expr *node);
+extern Datum ExecEvalFlatExprInit(ExprState *state, ExprContext *econtext,
+					 bool *isNull, ExprDoneCond *isDone);
+
+#endif   /* EXEC_EXPR_H */
@@ -14,8 +14,13 @@
 #ifndef HASHJOIN_H
 #define HASHJOIN_H
 
+#include "lib/bloomfilter.h"
 #include "nodes/execnodes.h"
+#include "port/atomics.h"
+#include "storage/barrier.h"
 #include "storage/buffile.h"
+#include "storage/sharedfileset.h"
+#include "storage/spin.h"
 
 /* ----------------------------------------------------------------
  *				hash-join hash table structures
@@ -54,6 +59,10 @@
  * inner batch file.  Subsequently, while reading either inner or outer batch
  * files, we might find tuples that no longer belong to the current batch;
  * if so, we just dump them out to the correct batch file.
+ *
+ * A parallel-aware hash join builds a single hash table in shared memory
+ * instead, with every participant inserting the tuples of its share of the
+ * inner relation; see ParallelHashJoinState below.
  * ----------------------------------------------------------------
  */
 
@@ -63,7 +72,12 @@
 
 typedef struct HashJoinTupleData
 {
-	struct HashJoinTupleData *next;		/* link to next tuple in same bucket */
+	/* link to next tuple in same bucket */
+	union
+	{
+		struct HashJoinTupleData *unshared;
+		uint32		shared;		/* see HJ_SHARED_TUPLE */
+	}			next;
 	uint32		hashvalue;		/* tuple's hash code */
 	/* Tuple data, in MinimalTuple format, follows on a MAXALIGN boundary */
 }	HashJoinTupleData;
@@ -186,6 +200,129 @@ typedef struct HashJoinTableData
 
 	/* used for dense allocation of tuples (into linked chunks) */
 	HashMemoryChunk chunks;		/* one list for the whole batch */
+
+	/*
+	 * Parallel-aware hash joins only.  While the shared hash table is in use,
+	 * nbuckets and log2_nbuckets describe it and shared_buckets points to its
+	 * bucket array; after the join has switched to batches, each batch is
+	 * loaded into the ordinary private buckets above, with nbatch = 1.  The
+	 * batch file arrays then have shared_nbatch entries and hold this
+	 * participant's files, which are only open while being written.  Chunk
+	 * positions are offsets from the start of parallel_state.
+	 */
+	struct ParallelHashJoinState *parallel_state;
+	int			participant;	/* our participant number */
+	pg_atomic_uint32 *shared_buckets;	/* shared bucket heads, or NULL */
+	Size		chunk_pos;		/* next free byte in our chunk of the area */
+	Size		chunk_end;		/* end of that chunk */
+	int			shared_nbatch;	/* number of batches, or 0 if not parallel */
+	int			log2_shared_nbatch;
+	int			shared_curbatch;	/* batch being processed, or -1 */
+	int			read_participant;	/* whose outer batch file we're reading */
+	BufFile    *read_file;		/* that file, if open */
 }	HashJoinTableData;
 
+/*
+ * A runtime filter lets an inner, semi or right hash join whose outer input
+ * is a plain relation scan discard outer rows in that scan, before they are
+ * projected and passed up, when no inner tuple can match them.  While the
+ * Hash node builds the table it adds every inner hash value to a Bloom
+ * filter; the scan then computes each row's hash value exactly as
+ * ExecHashGetHashValue would, from the join's outer hash keys rewritten in
+ * terms of the scan tuple, and drops the row if the filter lacks it.
+ *
+ * bloom is NULL, and every row passes, until the table has been built, and
+ * also if the filter turned out to be useless: if it came out saturated, or
+ * if it failed to reject enough of the first RUNTIME_FILTER_TRIAL_ROWS rows
+ * checked.  ntested and nrejected count the rows checked against the current
+ * bloom.
+ */
+typedef struct HashRuntimeFilterData
+{
+	bloom_filter *bloom;		/* filter over inner hash values, or NULL */
+	List	   *hashkeys;		/* outer hash keys, over the scan tuple */
+	FmgrInfo   *hashfunctions;	/* outer-side hash function for each key */
+	bool	   *hashStrict;		/* is each hash join operator strict? */
+	double		ntested;		/* # rows checked against bloom */
+	double		nrejected;		/* # of those rejected */
+}	HashRuntimeFilterData;
+
+#define RUNTIME_FILTER_TRIAL_ROWS	1024
+#define RUNTIME_FILTER_MIN_REJECT	0.05	/* fraction of the trial rows */
+#define RUNTIME_FILTER_MAX_FILL		0.8 /* fraction of bits set */
+
+/*
+ * Shared state for a parallel-aware hash join.  It lives in the parallel
+ * query's DSM segment, and is followed by the shared hash table: an array of
+ * nbuckets bucket heads starting at buckets_offset, and then area_size bytes
+ * of tuple storage starting at area_offset (both offsets counted from the
+ * start of this struct).  Participants claim HASH_CHUNK_SIZE pieces of the
+ * area, fill them with tuples, and push each tuple onto its bucket's list
+ * with a compare-and-swap; no locks are needed while building.  Since the
+ * segment may be mapped at a different address in each process, the lists
+ * are linked by offset rather than by pointer (see HJ_SHARED_TUPLE).
+ *
+ * The area's size is fixed when the join starts.  If it turns out to be too
+ * small, the participant that notices picks a number of batches, and from
+ * then on inner tuples go to batch files in "fileset" instead.  In that case
+ * the tuples already in the area are dumped out to batch files too, the
+ * outer relation is partitioned the same way, and participants then take
+ * whole batches to process one at a time with a private hash table.  If the
+ * planner expected more than one batch, there is no area at all and we go
+ * straight to that scheme.
+ *
+ * The build_barrier coordinates the phases of the build.  Participants that
+ * attach late join in whatever phase is current.
+ */
+typedef struct ParallelHashJoinState
+{
+	int			nparticipants;	/* maximum number of participants */
+	int			nbuckets;		/* # buckets in the shared table, or 0 */
+	int			log2_nbuckets;	/* its log2 */
+	int			batch_nbuckets; /* initial # buckets for a private batch */
+	int			planned_nbatch; /* # batches expected by the planner */
+	Size		area_size;		/* size of the tuple storage area */
+	Size		buckets_offset; /* offset of the bucket array */
+	Size		area_offset;	/* offset of the tuple storage area */
+	dsm_handle	handle;			/* DSM segment we live in */
+
+	slock_t		mutex;			/* protects the following fields */
+	int			nbatch;			/* actual # batches */
+	double		total_tuples;	/* # inner tuples seen by all participants */
+
+	pg_atomic_uint32 space_used;	/* area space claimed, in MAXALIGN units */
+	pg_atomic_uint32 next_bucket;	/* next bucket to dump out */
+	pg_atomic_uint32 next_batch;	/* next batch to process */
+
+	Barrier		build_barrier;	/* synchronizes the phases below */
+	SharedFileSet fileset;		/* space for batch files */
+} ParallelHashJoinState;
+
+/* Phases of build_barrier */
+#define PHJ_BUILD_HASHING_INNER		0
+#define PHJ_BUILD_DUMPING			1
+#define PHJ_BUILD_HASHING_OUTER		2
+#define PHJ_BUILD_RUNNING			3
+
+/*
+ * Convert between shared tuple pointers and the offsets used to link them.
+ * Offsets are counted in MAXIMUM_ALIGNOF units so that they fit in 32 bits;
+ * zero means no tuple.
+ */
+#define HJ_SHARED_TUPLE(pstate, offset) \
+	((offset) == 0 ? (HashJoinTuple) NULL : \
+	 (HashJoinTuple) ((char *) (pstate) + (Size) (offset) * MAXIMUM_ALIGNOF))
+#define HJ_SHARED_OFFSET(pstate, tuple) \
+	((uint32) (((char *) (tuple) - (char *) (pstate)) / MAXIMUM_ALIGNOF))
+
+/* Follow a bucket's list, in either a shared or a private hash table */
+#define HJ_NEXT_TUPLE(hashtable, tuple) \
+	((hashtable)->shared_buckets != NULL ? \
+	 HJ_SHARED_TUPLE((hashtable)->parallel_state, (tuple)->next.shared) : \
+	 (tuple)->next.unshared)
+
+/* Largest area we can address with 32-bit offsets, with room to spare */
+#define HJ_SHARED_MAX_AREA_SIZE \
+	((Size) (PG_UINT32_MAX / 2) * MAXIMUM_ALIGNOF)
+
 #endif   /* HASHJOIN_H */
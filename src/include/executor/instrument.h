@@ -60,6 +60,7 @@ typedef struct Instrumentation
 	double		nloops;			/* # of run cycles for this node */
 	double		nfiltered1;		/* # tuples removed by scanqual or joinqual */
 	double		nfiltered2;		/* # tuples removed by "other" quals */
+	double		nfiltered3;		/* # tuples removed by a runtime filter */
 	BufferUsage bufusage;		/* Total buffer usage */
 } Instrumentation;
 
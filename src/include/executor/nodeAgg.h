@@ -23,6 +23,11 @@ extern void ExecReScanAgg(AggState *node);
 
 extern Size hash_agg_entry_size(int numAggs);
 
+/* Limits on the number of spill files made by one pass of a hashed Agg */
+#define HASHAGG_MIN_PARTITION_BITS	2
+#define HASHAGG_MIN_PARTITIONS		(1 << HASHAGG_MIN_PARTITION_BITS)
+#define HASHAGG_MAX_PARTITIONS		256
+
 extern Datum aggregate_dummy(PG_FUNCTION_ARGS);
 
 #endif   /* NODEAGG_H */
@@ -14,7 +14,9 @@
 #ifndef NODEHASH_H
 #define NODEHASH_H
 
+#include "access/parallel.h"
 #include "nodes/execnodes.h"
+#include "storage/buffile.h"
 
 extern HashState *ExecInitHash(Hash *node, EState *estate, int eflags);
 extern TupleTableSlot *ExecHash(HashState *node);
@@ -22,7 +24,7 @@ extern Node *MultiExecHash(HashState *node);
 extern void ExecEndHash(HashState *node);
 extern void ExecReScanHash(HashState *node);
 
-extern HashJoinTable ExecHashTableCreate(Hash *node, List *hashOperators,
+extern HashJoinTable ExecHashTableCreate(HashState *state, List *hashOperators,
 					bool keepNulls);
 extern void ExecHashTableDestroy(HashJoinTable hashtable);
 extern void ExecHashTableInsert(HashJoinTable hashtable,
@@ -44,10 +46,32 @@ extern bool ExecScanHashTableForUnmatched(HashJoinState *hjstate,
 							  ExprContext *econtext);
 extern void ExecHashTableReset(HashJoinTable hashtable);
 extern void ExecHashTableResetMatchFlags(HashJoinTable hashtable);
+extern void ExecHashIncreaseNumBuckets(HashJoinTable hashtable);
 extern void ExecChooseHashTableSize(double ntuples, int tupwidth, bool useskew,
 						int *numbuckets,
 						int *numbatches,
 						int *num_skew_mcvs);
+extern void ExecChooseParallelHashTableSize(double ntuples, int tupwidth,
+								int nparticipants,
+								int *numbuckets,
+								int *numbatches,
+								Size *area_size);
 extern int	ExecHashGetSkewBucket(HashJoinTable hashtable, uint32 hashvalue);
+extern void ExecHashResetRuntimeFilter(HashRuntimeFilter filter);
+extern bool ExecHashRuntimeFilterPass(HashRuntimeFilter filter,
+						  ExprContext *econtext);
+
+/* parallel-aware hash join support */
+extern int	ExecParallelHashGetBatch(HashJoinTable hashtable, uint32 hashvalue);
+extern BufFile **ExecParallelHashGetBatchFile(HashJoinTable hashtable,
+							 bool inner, int batchno);
+extern void ExecParallelHashCloseBatchFiles(HashJoinTable hashtable);
+extern BufFile *ExecParallelHashOpenBatchFile(HashJoinTable hashtable,
+							  bool inner, int batchno, int participant);
+extern void ExecParallelHashDeleteBatch(HashJoinTable hashtable, int batchno);
+extern void ExecHashEstimate(HashState *node, ParallelContext *pcxt);
+extern void ExecHashInitializeDSM(HashState *node, ParallelContext *pcxt);
+extern void ExecHashReInitializeDSM(HashState *node, ParallelContext *pcxt);
+extern void ExecHashInitializeWorker(HashState *node, shm_toc *toc);
 
 #endif   /* NODEHASH_H */
@@ -17,6 +17,9 @@
 #include "nodes/execnodes.h"
 #include "storage/buffile.h"
 
+/* GUC parameter */
+extern bool enable_runtime_filter;
+
 extern HashJoinState *ExecInitHashJoin(HashJoin *node, EState *estate, int eflags);
 extern TupleTableSlot *ExecHashJoin(HashJoinState *node);
 extern void ExecEndHashJoin(HashJoinState *node);
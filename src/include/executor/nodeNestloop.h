@@ -16,6 +16,9 @@
 
 #include "nodes/execnodes.h"
 
+/* GUC parameter */
+extern bool enable_nestloop_batching;
+
 extern NestLoopState *ExecInitNestLoop(NestLoop *node, EState *estate, int eflags);
 extern TupleTableSlot *ExecNestLoop(NestLoopState *node);
 extern void ExecEndNestLoop(NestLoopState *node);
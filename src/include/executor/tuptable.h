@@ -108,6 +108,9 @@
  *
  * tts_slow/tts_off are saved state for slot_deform_tuple, and should not
  * be touched by any other code.
+ *
+ * tts_deform, if not NULL, is the deform program built for the slot's
+ * descriptor when it was assigned (see TupleDeformProgram below).
  *----------
  */
 typedef struct TupleTableSlot
@@ -127,8 +130,42 @@ typedef struct TupleTableSlot
 	MinimalTuple tts_mintuple;	/* minimal tuple, or NULL if none */
 	HeapTupleData tts_minhdr;	/* workspace for minimal-tuple-only case */
 	long		tts_off;		/* saved state for slot_deform_tuple */
+	struct TupleDeformProgram *tts_deform;		/* deform program, or NULL */
 } TupleTableSlot;
 
+/*----------
+ * A deform program describes how to extract the leading fixed-width
+ * attributes of a tuple descriptor.  As long as none of them is null, their
+ * offsets within the tuple data are the same for every tuple, so they are
+ * computed once when the descriptor is assigned to a slot, together with the
+ * kind of fetch each attribute needs.  slot_deform_tuple then runs through
+ * the steps without re-examining attlen, attbyval and alignment per row, and
+ * falls back to its generic loop at the first null, varlena or cstring
+ * attribute.
+ *----------
+ */
+typedef enum TupleDeformKind
+{
+	TDK_CHAR,					/* 1-byte pass-by-value */
+	TDK_INT16,					/* 2-byte pass-by-value */
+	TDK_INT32,					/* 4-byte pass-by-value */
+	TDK_DATUM,					/* Datum-sized pass-by-value */
+	TDK_BYREF					/* fixed-width pass-by-reference */
+} TupleDeformKind;
+
+typedef struct TupleDeformStep
+{
+	TupleDeformKind kind;		/* how to fetch the attribute */
+	int32		off;			/* offset of the attribute in the tuple data */
+	int32		end;			/* offset just past the attribute */
+} TupleDeformStep;
+
+typedef struct TupleDeformProgram
+{
+	int			nsteps;			/* number of leading fixed-width attributes */
+	TupleDeformStep steps[FLEXIBLE_ARRAY_MEMBER];
+} TupleDeformProgram;
+
 #define TTS_HAS_PHYSICAL_TUPLE(slot)  \
 	((slot)->tts_tuple != NULL && (slot)->tts_tuple != &((slot)->tts_minhdr))
 
@@ -169,5 +206,6 @@ extern Datum slot_getattr(TupleTableSlot *slot, int attnum, bool *isnull);
 extern void slot_getallattrs(TupleTableSlot *slot);
 extern void slot_getsomeattrs(TupleTableSlot *slot, int attnum);
 extern bool slot_attisnull(TupleTableSlot *slot, int attnum);
+extern TupleDeformProgram *slot_build_deform_program(TupleDesc tupdesc);
 
 #endif   /* TUPTABLE_H */
@@ -35,7 +35,7 @@ typedef struct StringInfoData *fmStringInfo;
  * signature.)
  */
 
-typedef struct FunctionCallInfoData *FunctionCallInfo;
+typedef struct FunctionCallInfoBaseData *FunctionCallInfo;
 
 typedef Datum (*PGFunction) (FunctionCallInfo fcinfo);
 
@@ -47,7 +47,7 @@ typedef Datum (*PGFunction) (FunctionCallInfo fcinfo);
  *
  * Note that fn_expr really is parse-time-determined information about the
  * arguments, rather than about the function itself.  But it's convenient
- * to store it here rather than in FunctionCallInfoData, where it might more
+ * to store it here rather than in FunctionCallInfoBaseData, where it might more
  * logically belong.
  */
 typedef struct FmgrInfo
@@ -63,10 +63,24 @@ typedef struct FmgrInfo
 	fmNodePtr	fn_expr;		/* expression parse tree for call, or NULL */
 } FmgrInfo;
 
+/*
+ * An argument value together with its null flag.
+ */
+typedef struct NullableDatum
+{
+	Datum		value;			/* the argument, or 0 if null */
+	bool		isnull;			/* T if the argument is actually NULL */
+} NullableDatum;
+
 /*
  * This struct is the data actually passed to an fmgr-called function.
+ *
+ * The args[] array is sized to the number of arguments of the call, rather
+ * than to FUNC_MAX_ARGS, so a FunctionCallInfoBaseData can't be declared as
+ * a plain variable.  Use LOCAL_FCINFO() to declare one on the stack, or
+ * allocate SizeForFunctionCallInfo(nargs) bytes.
  */
-typedef struct FunctionCallInfoData
+typedef struct FunctionCallInfoBaseData
 {
 	FmgrInfo   *flinfo;			/* ptr to lookup info used for this call */
 	fmNodePtr	context;		/* pass info about context of call */
@@ -74,9 +88,28 @@ typedef struct FunctionCallInfoData
 	Oid			fncollation;	/* collation for function to use */
 	bool		isnull;			/* function must set true if result is NULL */
 	short		nargs;			/* # arguments actually passed */
-	Datum		arg[FUNC_MAX_ARGS];		/* Arguments passed to function */
-	bool		argnull[FUNC_MAX_ARGS]; /* T if arg[i] is actually NULL */
-} FunctionCallInfoData;
+	NullableDatum args[FLEXIBLE_ARRAY_MEMBER];	/* Arguments passed to function */
+} FunctionCallInfoBaseData;
+
+/*
+ * Space needed for a FunctionCallInfoBaseData with room for nargs arguments.
+ */
+#define SizeForFunctionCallInfo(nargs) \
+	(offsetof(FunctionCallInfoBaseData, args) + \
+	 sizeof(NullableDatum) * (nargs))
+
+/*
+ * Declare a FunctionCallInfo pointer named "name", pointing to suitably
+ * aligned local storage for a call with up to nargs arguments.  nargs must
+ * be a compile-time constant.
+ */
+#define LOCAL_FCINFO(name, nargs) \
+	union \
+	{ \
+		FunctionCallInfoBaseData fcinfo; \
+		char		fcinfo_data[SizeForFunctionCallInfo(nargs)]; \
+	}			name##data; \
+	FunctionCallInfo name = &name##data.fcinfo
 
 /*
  * This routine fills a FmgrInfo struct, given the OID
@@ -103,11 +136,11 @@ extern void fmgr_info_copy(FmgrInfo *dstinfo, FmgrInfo *srcinfo,
 			   MemoryContext destcxt);
 
 /*
- * This macro initializes all the fields of a FunctionCallInfoData except
- * for the arg[] and argnull[] arrays.  Performance testing has shown that
- * the fastest way to set up argnull[] for small numbers of arguments is to
+ * This macro initializes all the fields of a FunctionCallInfoBaseData except
+ * for the args[] array.  Performance testing has shown that the fastest way
+ * to set up the args[].isnull flags for small numbers of arguments is to
  * explicitly set each required element to false, so we don't try to zero
- * out the argnull[] array in the macro.
+ * out the args[] array in the macro.
  */
 #define InitFunctionCallInfoData(Fcinfo, Flinfo, Nargs, Collation, Context, Resultinfo) \
 	do { \
@@ -120,7 +153,7 @@ extern void fmgr_info_copy(FmgrInfo *dstinfo, FmgrInfo *srcinfo,
 	} while (0)
 
 /*
- * This macro invokes a function given a filled-in FunctionCallInfoData
+ * This macro invokes a function given a filled-in FunctionCallInfoBaseData
  * struct.  The macro result is the returned Datum --- but note that
  * caller must still check fcinfo->isnull!	Also, if function is strict,
  * it is caller's responsibility to verify that no null arguments are present
@@ -163,7 +196,7 @@ extern void fmgr_info_copy(FmgrInfo *dstinfo, FmgrInfo *srcinfo,
  * If function is not marked "proisstrict" in pg_proc, it must check for
  * null arguments using this macro.  Do not try to GETARG a null argument!
  */
-#define PG_ARGISNULL(n)  (fcinfo->argnull[n])
+#define PG_ARGISNULL(n)  (fcinfo->args[n].isnull)
 
 /*
  * Support for fetching detoasted copies of toastable datatypes (all of
@@ -221,7 +254,7 @@ extern struct varlena *pg_detoast_datum_packed(struct varlena * datum);
 
 /* Macros for fetching arguments of standard types */
 
-#define PG_GETARG_DATUM(n)	 (fcinfo->arg[n])
+#define PG_GETARG_DATUM(n)	 (fcinfo->args[n].value)
 #define PG_GETARG_INT32(n)	 DatumGetInt32(PG_GETARG_DATUM(n))
 #define PG_GETARG_UINT32(n)  DatumGetUInt32(PG_GETARG_DATUM(n))
 #define PG_GETARG_INT16(n)	 DatumGetInt16(PG_GETARG_DATUM(n))
@@ -17,6 +17,7 @@
 #include "access/genam.h"
 #include "access/heapam.h"
 #include "executor/instrument.h"
+#include "lib/ilist.h"
 #include "lib/pairingheap.h"
 #include "nodes/params.h"
 #include "nodes/plannodes.h"
@@ -498,21 +499,30 @@ typedef struct TupleHashTableData *TupleHashTable;
 
 typedef struct TupleHashEntryData
 {
-	/* firstTuple must be the first field in this struct! */
 	MinimalTuple firstTuple;	/* copy of first tuple in this group */
-	/* there may be additional data beyond the end of this struct */
-} TupleHashEntryData;			/* VARIABLE LENGTH STRUCT */
+	void	   *additional;		/* user data */
+	uint32		status;			/* hash status */
+	uint32		hash;			/* hash value (cached) */
+} TupleHashEntryData;
+
+/* define parameters necessary to generate the tuple hash table interface */
+#define SH_PREFIX tuplehash
+#define SH_ELEMENT_TYPE TupleHashEntryData
+#define SH_KEY_TYPE MinimalTuple
+#define SH_SCOPE extern
+#define SH_DECLARE
+#include "lib/simplehash.h"
 
 typedef struct TupleHashTableData
 {
-	HTAB	   *hashtab;		/* underlying dynahash table */
+	tuplehash_hash *hashtab;	/* underlying hash table */
 	int			numCols;		/* number of columns in lookup key */
 	AttrNumber *keyColIdx;		/* attr numbers of key columns */
 	FmgrInfo   *tab_hash_funcs; /* hash functions for table datatype(s) */
 	FmgrInfo   *tab_eq_funcs;	/* equality functions for table datatype(s) */
 	MemoryContext tablecxt;		/* memory context containing table */
 	MemoryContext tempcxt;		/* context for function evaluations */
-	Size		entrysize;		/* actual size to make each hash entry */
+	Size		additionalsize; /* size of caller's per-entry data */
 	TupleTableSlot *tableslot;	/* slot for referencing table entries */
 	/* The following fields are set transiently for each table search: */
 	TupleTableSlot *inputslot;	/* current input tuple's slot */
@@ -520,24 +530,22 @@ typedef struct TupleHashTableData
 	FmgrInfo   *cur_eq_funcs;	/* equality functions for input vs. table */
 }	TupleHashTableData;
 
-typedef HASH_SEQ_STATUS TupleHashIterator;
+typedef tuplehash_iterator TupleHashIterator;
 
 /*
  * Use InitTupleHashIterator/TermTupleHashIterator for a read/write scan.
  * Use ResetTupleHashIterator if the table can be frozen (in this case no
- * explicit scan termination is needed).
+ * explicit scan termination is needed).  No entries may be added during
+ * a scan, since that could move the entries around.
  */
 #define InitTupleHashIterator(htable, iter) \
-	hash_seq_init(iter, (htable)->hashtab)
+	tuplehash_start_iterate((htable)->hashtab, iter)
 #define TermTupleHashIterator(iter) \
-	hash_seq_term(iter)
+	((void) 0)
 #define ResetTupleHashIterator(htable, iter) \
-	do { \
-		hash_freeze((htable)->hashtab); \
-		hash_seq_init(iter, (htable)->hashtab); \
-	} while (0)
-#define ScanTupleHashTable(iter) \
-	((TupleHashEntry) hash_seq_search(iter))
+	InitTupleHashIterator(htable, iter)
+#define ScanTupleHashTable(htable, iter) \
+	tuplehash_iterate((htable)->hashtab, iter)
 
 
 /* ----------------------------------------------------------------
@@ -577,6 +585,7 @@ struct ExprState
 	NodeTag		type;
 	Expr	   *expr;			/* associated Expr node */
 	ExprStateEvalFunc evalfunc; /* routine to run to execute node */
+	struct ExprFlatProgram *flat;	/* compiled form, if any; see execExpr.h */
 };
 
 /* ----------------
@@ -704,7 +713,7 @@ typedef struct FuncExprState
 	 * that uses value-per-call mode and we are in the middle of a call
 	 * series; we want to pass the same argument values to the function again
 	 * (and again, until it returns ExprEndResult).  This indicates that
-	 * fcinfo_data already contains valid argument data.
+	 * fcinfo already contains valid argument data.
 	 */
 	bool		setArgsValid;
 
@@ -724,11 +733,12 @@ typedef struct FuncExprState
 	bool		shutdown_reg;	/* a shutdown callback is registered */
 
 	/*
-	 * Call parameter structure for the function.  This has been initialized
-	 * (by InitFunctionCallInfoData) if func.fn_oid is valid.  It also saves
-	 * argument values between calls, when setArgsValid is true.
+	 * Call parameter structure for the function, sized for its arguments.
+	 * This has been allocated and initialized (by InitFunctionCallInfoData)
+	 * if func.fn_oid is valid.  It also saves argument values between calls,
+	 * when setArgsValid is true.
 	 */
-	FunctionCallInfoData fcinfo_data;
+	FunctionCallInfo fcinfo;
 } FuncExprState;
 
 /* ----------------
@@ -1082,6 +1092,11 @@ typedef struct PlanState
 		if (((PlanState *)(node))->instrument) \
 			((PlanState *)(node))->instrument->nfiltered2 += (delta); \
 	} while(0)
+#define InstrCountFiltered3(node, delta) \
+	do { \
+		if (((PlanState *)(node))->instrument) \
+			((PlanState *)(node))->instrument->nfiltered3 += (delta); \
+	} while(0)
 
 /*
  * EPQState is state for executing an EvalPlanQual recheck on a candidate
@@ -1142,7 +1157,10 @@ typedef struct ModifyTableState
  *	 AppendState information
  *
  *		nplans			how many plans are in the array
- *		whichplan		which plan is being executed (0 .. n-1)
+ *		whichplan		which plan is being executed (0 .. n-1), or -1 if
+ *						a parallel-aware Append hasn't chosen one yet
+ *		pstate_len		size of the shared state for a parallel append
+ *		pstate			shared state for a parallel append, or NULL
  * ----------------
  */
 typedef struct AppendState
@@ -1151,6 +1169,8 @@ typedef struct AppendState
 	PlanState **appendplans;	/* array of PlanStates for my inputs */
 	int			as_nplans;
 	int			as_whichplan;
+	Size		pstate_len;
+	struct ParallelAppendState *as_pstate;
 } AppendState;
 
 /* ----------------
@@ -1241,6 +1261,7 @@ typedef struct BitmapOrState
  *		currentRelation    relation being scanned (NULL if none)
  *		currentScanDesc    current scan descriptor for scan (NULL if none)
  *		ScanTupleSlot	   pointer to slot in tuple table holding scan tuple
+ *		RuntimeFilter	   filter set by a hash join above us, or NULL
  * ----------------
  */
 typedef struct ScanState
@@ -1249,6 +1270,7 @@ typedef struct ScanState
 	Relation	ss_currentRelation;
 	HeapScanDesc ss_currentScanDesc;
 	TupleTableSlot *ss_ScanTupleSlot;
+	struct HashRuntimeFilterData *ss_RuntimeFilter;
 } ScanState;
 
 /* ----------------
@@ -1259,6 +1281,10 @@ typedef struct SeqScanState
 {
 	ScanState	ss;				/* its first field is NodeTag */
 	Size		pscan_len;		/* size of parallel heap scan descriptor */
+	struct TupleBatch *batch;	/* batch being returned, if in batch mode */
+	struct BatchQual *batchquals;		/* the quals, in batch form */
+	int			nbatchquals;
+	bool		batch_done;		/* scan ended while filling a batch */
 } SeqScanState;
 
 /* ----------------
@@ -1324,6 +1350,7 @@ typedef struct
  *		SortSupport		   for reordering ORDER BY exprs
  *		OrderByTypByVals   is the datatype of order by expression pass-by-value?
  *		OrderByTypLens	   typlens of the datatypes of order by expressions
+ *		PscanLen		   size of parallel index scan descriptor
  * ----------------
  */
 typedef struct IndexScanState
@@ -1350,6 +1377,7 @@ typedef struct IndexScanState
 	SortSupport iss_SortSupport;
 	bool	   *iss_OrderByTypByVals;
 	int16	   *iss_OrderByTypLens;
+	Size		iss_PscanLen;
 } IndexScanState;
 
 /* ----------------
@@ -1368,6 +1396,7 @@ typedef struct IndexScanState
  *		ScanDesc		   index scan descriptor
  *		VMBuffer		   buffer in use for visibility map testing, if any
  *		HeapFetches		   number of tuples we were forced to fetch from heap
+ *		PscanLen		   size of parallel index-only scan descriptor
  * ----------------
  */
 typedef struct IndexOnlyScanState
@@ -1386,6 +1415,7 @@ typedef struct IndexOnlyScanState
 	IndexScanDesc ioss_ScanDesc;
 	Buffer		ioss_VMBuffer;
 	long		ioss_HeapFetches;
+	Size		ioss_PscanLen;
 } IndexOnlyScanState;
 
 /* ----------------
@@ -1429,10 +1459,19 @@ typedef struct BitmapIndexScanState
  *		tbmres			   current-page data
  *		exact_pages		   total number of exact pages retrieved
  *		lossy_pages		   total number of lossy pages retrieved
+ *		skipped_pages	   exact pages answered without reading the heap
  *		prefetch_iterator  iterator for prefetching ahead of current page
  *		prefetch_pages	   # pages prefetch iterator is ahead of current
  *		prefetch_target    current target prefetch distance
  *		prefetch_maximum   maximum value for prefetch_target
+ *		run_end			   last page of the current lossy run, if any
+ *		readahead_block    next page of the run to read ahead
+ *		can_skip_fetch	   can we potentially skip tuple fetches in this scan?
+ *		skip_fetch		   are we skipping the fetch of the current page?
+ *		vmbuffer		   buffer for visibility-map lookups
+ *		pvmbuffer		   ditto, for prefetched pages
+ *		pscan_len		   size of the shared state for a parallel scan
+ *		pstate			   shared state for a parallel scan, or NULL
  * ----------------
  */
 typedef struct BitmapHeapScanState
@@ -1444,10 +1483,19 @@ typedef struct BitmapHeapScanState
 	TBMIterateResult *tbmres;
 	long		exact_pages;
 	long		lossy_pages;
+	long		skipped_pages;
 	TBMIterator *prefetch_iterator;
 	int			prefetch_pages;
 	int			prefetch_target;
 	int			prefetch_maximum;
+	BlockNumber run_end;
+	BlockNumber readahead_block;
+	bool		can_skip_fetch;
+	bool		skip_fetch;
+	Buffer		vmbuffer;
+	Buffer		pvmbuffer;
+	Size		pscan_len;
+	struct ParallelBitmapHeapState *pstate;
 } BitmapHeapScanState;
 
 /* ----------------
@@ -1642,6 +1690,8 @@ typedef struct JoinState
  *		NeedNewOuter	   true if need new outer tuple on next call
  *		MatchedOuter	   true if found a join match for current outer tuple
  *		NullInnerTupleSlot prepared null tuple for left outer joins
+ *		Batch			   state for probing the inner index in batches of
+ *						   outer rows, or NULL if going a row at a time
  * ----------------
  */
 typedef struct NestLoopState
@@ -1650,6 +1700,7 @@ typedef struct NestLoopState
 	bool		nl_NeedNewOuter;
 	bool		nl_MatchedOuter;
 	TupleTableSlot *nl_NullInnerTupleSlot;
+	struct NestLoopBatchData *nl_Batch;
 } NestLoopState;
 
 /* ----------------
@@ -1721,12 +1772,14 @@ typedef struct MergeJoinState
  *		hj_JoinState			current state of ExecHashJoin state machine
  *		hj_MatchedOuter			true if found a join match for current outer
  *		hj_OuterNotEmpty		true if outer relation known not empty
+ *		hj_RuntimeFilter		Bloom filter handed to the outer scan, or NULL
  * ----------------
  */
 
 /* these structs are defined in executor/hashjoin.h: */
 typedef struct HashJoinTupleData *HashJoinTuple;
 typedef struct HashJoinTableData *HashJoinTable;
+typedef struct HashRuntimeFilterData *HashRuntimeFilter;
 
 typedef struct HashJoinState
 {
@@ -1748,6 +1801,7 @@ typedef struct HashJoinState
 	int			hj_JoinState;
 	bool		hj_MatchedOuter;
 	bool		hj_OuterNotEmpty;
+	HashRuntimeFilter hj_RuntimeFilter;
 } HashJoinState;
 
 
@@ -1773,6 +1827,52 @@ typedef struct MaterialState
 	Tuplestorestate *tuplestorestate;
 } MaterialState;
 
+/* ----------------
+ *	 ResultCacheState information
+ *
+ *		result cache nodes cache the tuples produced by their subplan for
+ *		each distinct set of parameter values, in an LRU hash table bounded
+ *		by work_mem.  The hash table and entry types are private to
+ *		nodeResultCache.c.
+ * ----------------
+ */
+struct ResultCacheEntry;
+struct ResultCacheTuple;
+struct resultcache_hash;
+
+typedef struct ResultCacheInstrumentation
+{
+	uint64		cache_hits;		/* rescans answered from the cache */
+	uint64		cache_misses;	/* rescans that ran the subplan */
+	uint64		cache_evictions;	/* entries evicted to stay in work_mem */
+	uint64		cache_overflows;	/* entries too big to cache at all */
+	Size		mem_peak;		/* peak memory used by cache entries */
+} ResultCacheInstrumentation;
+
+typedef struct ResultCacheState
+{
+	ScanState	ss;				/* its first field is NodeTag */
+	int			rc_status;		/* state of the current scan */
+	int			nkeys;			/* number of cache key columns */
+	struct resultcache_hash *hashtable; /* hash table of cache entries */
+	TupleDesc	hashkeydesc;	/* tuple descriptor of cache keys */
+	TupleTableSlot *tableslot;	/* slot for deforming cached keys */
+	TupleTableSlot *probeslot;	/* parameter values of the current scan */
+	List	   *param_exprs;	/* ExprStates computing the cache key */
+	Bitmapset  *keyparamids;	/* PARAM_EXEC ids used in param_exprs */
+	int16	   *keytyplen;		/* typlen of each key column */
+	bool	   *keytypbyval;	/* typbyval of each key column */
+	Size		mem_used;		/* memory used by cache entries */
+	Size		mem_limit;		/* work_mem, in bytes */
+	MemoryContext tableContext; /* memory context holding the cache */
+	dlist_head	lru_list;		/* entries, least recently used first */
+	struct ResultCacheEntry *entry; /* entry of the current scan, if any */
+	struct ResultCacheTuple *last_tuple;	/* last tuple returned from or
+											 * added to entry */
+	bool		singlerow;		/* entry is complete after its first row */
+	ResultCacheInstrumentation stats;	/* for EXPLAIN ANALYZE */
+} ResultCacheState;
+
 /* ----------------
  *	 SortState information
  * ----------------
@@ -1789,6 +1889,34 @@ typedef struct SortState
 	void	   *tuplesortstate; /* private state of tuplesort.c */
 } SortState;
 
+/* ----------------
+ *	 IncrementalSortState information
+ *
+ *		presortedKeys	comparators for the presorted columns
+ *		group_pivot		the last tuple read from the outer plan, which
+ *						either defines the current group or starts the
+ *						next batch
+ *		nbatches		number of batches sorted so far
+ *		sortMethod, spaceType, maxSpace
+ *						largest batch sorted so far, for EXPLAIN ANALYZE
+ * ----------------
+ */
+typedef struct IncrementalSortState
+{
+	ScanState	ss;				/* its first field is NodeTag */
+	bool		bounded;		/* is the result set bounded? */
+	int64		bound;			/* if bounded, how many tuples are needed */
+	int64		bound_Done;		/* tuples returned so far, if bounded */
+	bool		outerNodeDone;	/* has the outer plan been exhausted? */
+	SortSupport presortedKeys;
+	TupleTableSlot *group_pivot;
+	void	   *tuplesortstate; /* private state of tuplesort.c */
+	int64		nbatches;
+	const char *sortMethod;
+	const char *spaceType;
+	long		maxSpace;
+} IncrementalSortState;
+
 /* ---------------------
  *	GroupState information
  * -------------------------
@@ -1817,6 +1945,7 @@ typedef struct AggStatePerAggData *AggStatePerAgg;
 typedef struct AggStatePerTransData *AggStatePerTrans;
 typedef struct AggStatePerGroupData *AggStatePerGroup;
 typedef struct AggStatePerPhaseData *AggStatePerPhase;
+typedef struct AggStatePerHashData *AggStatePerHash;
 
 typedef struct AggState
 {
@@ -1824,15 +1953,17 @@ typedef struct AggState
 	List	   *aggs;			/* all Aggref nodes in targetlist & quals */
 	int			numaggs;		/* length of list (could be zero!) */
 	int			numtrans;		/* number of pertrans items */
+	AggStrategy aggstrategy;	/* strategy mode */
 	AggSplit	aggsplit;		/* agg-splitting mode, see nodes.h */
 	AggStatePerPhase phase;		/* pointer to current phase data */
-	int			numphases;		/* number of phases */
+	int			numphases;		/* number of phases (including phase 0) */
 	int			current_phase;	/* current phase number */
-	FmgrInfo   *hashfunctions;	/* per-grouping-field hash fns */
 	AggStatePerAgg peragg;		/* per-Aggref information */
 	AggStatePerTrans pertrans;	/* per-Trans state information */
+	ExprContext *hashcontext;	/* econtext for long-lived data (hashtable) */
 	ExprContext **aggcontexts;	/* econtexts for long-lived data (per GS) */
 	ExprContext *tmpcontext;	/* econtext for input expressions */
+	ExprContext *curaggcontext; /* currently active aggcontext */
 	AggStatePerTrans curpertrans;		/* currently active trans state */
 	bool		input_done;		/* indicates end of input */
 	bool		agg_done;		/* indicates completion of Agg scan */
@@ -1850,12 +1981,26 @@ typedef struct AggState
 	/* these fields are used in AGG_PLAIN and AGG_SORTED modes: */
 	AggStatePerGroup pergroup;	/* per-Aggref-per-group working state */
 	HeapTuple	grp_firstTuple; /* copy of first tuple of current group */
-	/* these fields are used in AGG_HASHED mode: */
-	TupleHashTable hashtable;	/* hash table with one entry per group */
-	TupleTableSlot *hashslot;	/* slot for loading hash table */
-	List	   *hash_needed;	/* list of columns needed in hash table */
+	/* these fields are used in AGG_HASHED and AGG_MIXED modes: */
 	bool		table_filled;	/* hash table filled yet? */
-	TupleHashIterator hashiter; /* for iterating through hash table */
+	int			num_hashes;		/* number of hash tables (one per hashed set) */
+	AggStatePerHash perhash;	/* array of per-hashtable data */
+	AggStatePerGroup *hash_pergroup;	/* grouping set indexed array of
+										 * per-group pointers */
+	/* these fields are used when AGG_HASHED runs out of memory: */
+	Size		hash_mem_limit; /* memory allowed for the hash table */
+	bool		hash_spill_mode;	/* adding no new groups to hash table? */
+	struct HashAggSpill *hash_spill;	/* private in nodeAgg.c */
+	List	   *hash_batches;	/* spilled partitions yet to be processed */
+	int			hash_depth;		/* spill depth of the current pass */
+	double		hash_pass_groups;	/* estimated groups in current pass */
+	TupleTableSlot *hash_spill_slot;	/* slot for reading spilled tuples */
+	/* statistics for EXPLAIN ANALYZE: */
+	int			hash_batches_used;	/* number of passes over the input */
+	Size		hash_mem_peak;	/* peak hash table memory usage */
+	uint64		hash_disk_used; /* bytes written to spill files */
+	/* set if the input is read in batches: */
+	struct AggBatchState *batchstate;	/* private in nodeAgg.c */
 } AggState;
 
 /* ----------------
@@ -1961,6 +2106,36 @@ typedef struct GatherState
 	bool		need_to_scan_locally;
 } GatherState;
 
+/* ----------------
+ * GatherMergeState information
+ *
+ *		Gather merge nodes launch 1 or more parallel workers, run a
+ *		subplan which produces sorted output in each worker, and then
+ *		merge the results into a single sorted stream.
+ * ----------------
+ */
+struct GMReaderTupleBuffer;		/* private in nodeGatherMerge.c */
+
+typedef struct GatherMergeState
+{
+	PlanState	ps;				/* its first field is NodeTag */
+	bool		initialized;	/* workers launched? */
+	bool		gm_initialized; /* gather_merge_init() done? */
+	bool		need_to_scan_locally;	/* need to read from local plan? */
+	/* these fields are set up once: */
+	TupleDesc	tupDesc;		/* descriptor for subplan result tuples */
+	int			gm_nkeys;		/* number of sort columns */
+	SortSupport gm_sortkeys;	/* array of length gm_nkeys */
+	struct ParallelExecutorInfo *pei;
+	/* all remaining fields are reinitialized during a rescan */
+	int			nworkers_launched;	/* number of workers launched */
+	int			nreaders;		/* number of active readers */
+	TupleTableSlot **gm_slots;	/* array with nreaders+1 entries */
+	struct TupleQueueReader **reader;	/* array with nreaders entries */
+	struct GMReaderTupleBuffer *gm_tuple_buffers;	/* nreaders tuple buffers */
+	struct binaryheap *gm_heap; /* binary heap of slot indices */
+} GatherMergeState;
+
 /* ----------------
  *	 HashState information
  * ----------------
@@ -1971,6 +2146,10 @@ typedef struct HashState
 	HashJoinTable hashtable;	/* hash table for the hashjoin */
 	List	   *hashkeys;		/* list of ExprState nodes */
 	/* hashkeys is same as parent's hj_InnerHashKeys */
+	/* shared state if parallel-aware, set by parent HashJoin */
+	struct ParallelHashJoinState *parallel_state;
+	/* runtime filter to fill in while building, set by parent HashJoin */
+	HashRuntimeFilter runtimefilter;
 } HashState;
 
 /* ----------------
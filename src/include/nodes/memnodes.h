@@ -77,6 +77,7 @@ typedef struct MemoryContextData
 	bool		isReset;		/* T = no space alloced since last reset */
 	bool		allowInCritSection;		/* allow palloc in critical section */
 	MemoryContextMethods *methods;		/* virtual function table */
+	Size		mem_allocated;	/* total block memory obtained from malloc */
 	MemoryContext parent;		/* NULL if no parent (toplevel context) */
 	MemoryContext firstchild;	/* head of linked list of children */
 	MemoryContext prevchild;	/* previous child of same parent */
@@ -208,6 +208,12 @@ typedef struct Append
 {
 	Plan		plan;
 	List	   *appendplans;
+
+	/*
+	 * In a parallel-aware Append, the plans before first_partial_plan are
+	 * non-partial and must each be run by just one participant.
+	 */
+	int			first_partial_plan;
 } Append;
 
 /* ----------------
@@ -615,6 +621,7 @@ typedef struct NestLoop
 {
 	Join		join;
 	List	   *nestParams;		/* list of NestLoopParam nodes */
+	bool		fast_start;		/* probably only the first rows are fetched */
 } NestLoop;
 
 typedef struct NestLoopParam
@@ -665,6 +672,22 @@ typedef struct Material
 	Plan		plan;
 } Material;
 
+/* ----------------
+ *		result cache node
+ *
+ * Caches the output of a parameterized subplan, keyed by the values of
+ * param_exprs, so that rescans with previously seen parameter values can
+ * be answered without executing the subplan again.
+ * ----------------
+ */
+typedef struct ResultCache
+{
+	Plan		plan;
+	List	   *param_exprs;	/* expressions forming the cache key */
+	bool		singlerow;		/* entry is complete after its first row */
+	uint32		est_entries;	/* planner's estimate of entries that fit */
+} ResultCache;
+
 /* ----------------
  *		sort node
  * ----------------
@@ -679,6 +702,19 @@ typedef struct Sort
 	bool	   *nullsFirst;		/* NULLS FIRST/LAST directions */
 } Sort;
 
+/* ----------------
+ *		incremental sort node
+ *
+ * The input is already sorted on the first presortedCols sort keys, so only
+ * runs of tuples that agree on those need to be sorted.
+ * ----------------
+ */
+typedef struct IncrementalSort
+{
+	Sort		sort;
+	int			presortedCols;	/* number of presorted columns */
+} IncrementalSort;
+
 /* ---------------
  *	 group node -
  *		Used for queries with GROUP BY (but no aggregates) specified.
@@ -705,6 +741,13 @@ typedef struct Group
  * executor startup.  (It is possible that there are no aggregate functions;
  * this could happen if they get optimized away by constant-folding, or if
  * we are using the Agg node to implement hash-based grouping.)
+ *
+ * With grouping sets, the chain holds one Agg node per further rollup or
+ * hashed grouping set; those nodes are never executed themselves.  Hashed
+ * ones (AGG_HASHED) come first, each with a single grouping set; sorted ones
+ * follow, each with the Sort node giving its input order as lefttree, except
+ * that the first sorted rollup of an AGG_MIXED node reads the node's input
+ * as it comes and has no Sort.
  * ---------------
  */
 typedef struct Agg
@@ -717,7 +760,8 @@ typedef struct Agg
 	Oid		   *grpOperators;	/* equality operators to compare with */
 	long		numGroups;		/* estimated number of groups in input */
 	Bitmapset  *aggParams;		/* IDs of Params used in Aggref inputs */
-	/* Note: planner provides numGroups & aggParams only in AGG_HASHED case */
+	/* Note: planner provides numGroups only for hashed (or mixed) nodes */
+	/* and aggParams only in the AGG_HASHED case */
 	List	   *groupingSets;	/* grouping sets to use */
 	List	   *chain;			/* chained Agg/Sort nodes */
 } Agg;
@@ -765,6 +809,22 @@ typedef struct Gather
 	bool		invisible;		/* suppress EXPLAIN display (for testing)? */
 } Gather;
 
+/* ------------
+ *		gather merge node
+ * ------------
+ */
+typedef struct GatherMerge
+{
+	Plan		plan;
+	int			num_workers;
+	/* remaining fields are just like the sort-key info in struct Sort */
+	int			numCols;		/* number of sort-key columns */
+	AttrNumber *sortColIdx;		/* their indexes in the target list */
+	Oid		   *sortOperators;	/* OIDs of operators to sort them by */
+	Oid		   *collations;		/* OIDs of collations */
+	bool	   *nullsFirst;		/* NULLS FIRST/LAST directions */
+} GatherMerge;
+
 /* ----------------
  *		hash build node
  *
@@ -782,6 +842,7 @@ typedef struct Hash
 	bool		skewInherit;	/* is outer join rel an inheritance tree? */
 	Oid			skewColType;	/* datatype of the outer key column */
 	int32		skewColTypmod;	/* typmod of the outer key column */
+	double		rows_total;		/* estimate total rows if parallel_aware */
 	/* all other info is in the parent HashJoin node */
 } Hash;
 
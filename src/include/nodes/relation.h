@@ -56,12 +56,14 @@ typedef struct QualCost
 typedef struct AggClauseCosts
 {
 	int			numAggs;		/* total number of aggregate functions */
-	int			numOrderedAggs; /* number w/ DISTINCT/ORDER BY/WITHIN GROUP */
+	int			numOrderedAggs; /* number needing sorted input for DISTINCT/
+								 * ORDER BY/WITHIN GROUP */
 	bool		hasNonPartial;	/* does any agg not support partial mode? */
 	bool		hasNonSerial;	/* is any partial agg non-serializable? */
 	QualCost	transCost;		/* total per-input-row execution costs */
 	Cost		finalCost;		/* total per-aggregated-row costs */
 	Size		transitionSpace;	/* space for pass-by-ref transition data */
+	List	   *hashDistinctAggs;	/* DISTINCT Aggrefs that hash their input */
 } AggClauseCosts;
 
 /*
@@ -620,6 +622,7 @@ typedef struct IndexOptInfo
 	bool		amsearchnulls;	/* can AM search for NULL/NOT NULL entries? */
 	bool		amhasgettuple;	/* does AM have amgettuple interface? */
 	bool		amhasgetbitmap; /* does AM have amgetbitmap interface? */
+	bool		amcanparallel;	/* does AM support parallel scan? */
 	/* Rather than include amapi.h here, we declare amcostestimate like this */
 	void		(*amcostestimate) ();	/* AM's cost estimator */
 } IndexOptInfo;
@@ -1098,6 +1101,8 @@ typedef struct CustomPath
  *
  * Note: it is possible for "subpaths" to contain only one, or even no,
  * elements.  These cases are optimized during create_append_plan.
+ * In a parallel-aware Append, the non-partial subpaths come first and are
+ * each run by a single participant; the rest are partial and may be shared.
  * In particular, an AppendPath with no subpaths is a "dummy" path that
  * is created to represent the case that a relation is provably empty.
  */
@@ -1105,6 +1110,8 @@ typedef struct AppendPath
 {
 	Path		path;
 	List	   *subpaths;		/* list of component Paths */
+	/* Index of first partial path in subpaths (list_length if none) */
+	int			first_partial_path;
 } AppendPath;
 
 #define IS_DUMMY_PATH(p) \
@@ -1151,6 +1158,23 @@ typedef struct MaterialPath
 	Path	   *subpath;
 } MaterialPath;
 
+/*
+ * ResultCachePath represents a ResultCache plan node, i.e., a cache of the
+ * results of a parameterized subpath, keyed by the values of param_exprs.
+ * It's used on the inner side of a nestloop when the outer side is expected
+ * to supply the same parameter values repeatedly.  'calls' is the expected
+ * number of rescans; est_entries is filled in by cost_rescan().
+ */
+typedef struct ResultCachePath
+{
+	Path		path;
+	Path	   *subpath;		/* outerpath to cache tuples from */
+	List	   *param_exprs;	/* cache key expressions */
+	bool		singlerow;		/* true if each entry holds at most 1 row */
+	double		calls;			/* expected number of rescans */
+	uint32		est_entries;	/* expected number of entries that fit */
+} ResultCachePath;
+
 /*
  * UniquePath represents elimination of distinct rows from the output of
  * its subpath.
@@ -1191,6 +1215,17 @@ typedef struct GatherPath
 	bool		single_copy;	/* path must not be executed >1x */
 } GatherPath;
 
+/*
+ * GatherMergePath runs several copies of a plan in parallel and collects
+ * the results, preserving their common sort order.  For gather merge, the
+ * parallel leader always executes the plan too.
+ */
+typedef struct GatherMergePath
+{
+	Path		path;
+	Path	   *subpath;		/* path for each worker */
+} GatherMergePath;
+
 /*
  * All join-type paths share these fields.
  */
@@ -1270,6 +1305,7 @@ typedef struct HashPath
 	JoinPath	jpath;
 	List	   *path_hashclauses;		/* join clauses used for hashing */
 	int			num_batches;	/* number of batches expected */
+	double		inner_rows_total;		/* total inner rows expected */
 } HashPath;
 
 /*
@@ -1307,6 +1343,16 @@ typedef struct SortPath
 	Path	   *subpath;		/* path representing input source */
 } SortPath;
 
+/*
+ * IncrementalSortPath represents a sort step whose input is already sorted
+ * on a leading subset of the sort keys
+ */
+typedef struct IncrementalSortPath
+{
+	SortPath	spath;
+	int			nPresortedCols; /* number of presorted columns */
+} IncrementalSortPath;
+
 /*
  * GroupPath represents grouping (of presorted input)
  *
@@ -1354,18 +1400,37 @@ typedef struct AggPath
 	List	   *qual;			/* quals (HAVING quals), if any */
 } AggPath;
 
+/*
+ * HashedGroupingSet represents one grouping set computed by hashing.
+ *
+ * set holds indexes into groupClause, which are always 0..n-1.
+ */
+typedef struct HashedGroupingSet
+{
+	NodeTag		type;
+	List	   *groupClause;	/* a list of SortGroupClause's */
+	List	   *set;			/* the grouping set */
+	double		numGroups;		/* estimated number of groups in the set */
+} HashedGroupingSet;
+
 /*
  * GroupingSetsPath represents a GROUPING SETS aggregation
  *
- * Currently we only support this in sorted not hashed form, so the input
- * must always be appropriately presorted.
+ * The sorted rollups are computed in order from the input, the last of them
+ * from the input as it is; so with AGG_SORTED the input must be
+ * appropriately presorted.  With AGG_HASHED, all the sets are in
+ * hashed_sets and the rollup lists are empty; with AGG_MIXED, both are
+ * used, and the input is presorted only for the last rollup (if that has
+ * any grouping columns at all).
  */
 typedef struct GroupingSetsPath
 {
 	Path		path;
 	Path	   *subpath;		/* path representing input source */
+	AggStrategy aggstrategy;	/* AGG_SORTED, AGG_HASHED or AGG_MIXED */
 	List	   *rollup_groupclauses;	/* list of lists of SortGroupClause's */
 	List	   *rollup_lists;	/* parallel list of lists of grouping sets */
+	List	   *hashed_sets;	/* list of HashedGroupingSet */
 	List	   *qual;			/* quals (HAVING quals), if any */
 } GroupingSetsPath;
 
@@ -2051,6 +2116,7 @@ typedef struct JoinCostWorkspace
 	/* private for cost_hashjoin code */
 	int			numbuckets;
 	int			numbatches;
+	double		inner_rows_total;
 } JoinCostWorkspace;
 
 #endif   /* RELATION_H */
@@ -41,6 +41,7 @@ typedef struct
 	int			ntuples;		/* -1 indicates lossy result */
 	bool		recheck;		/* should the tuples be rechecked? */
 	/* Note: recheck is always true if ntuples < 0 */
+	BlockNumber runend;			/* last page of the lossy run holding blockno */
 	OffsetNumber offsets[FLEXIBLE_ARRAY_MEMBER];
 } TBMIterateResult;
 
@@ -53,6 +54,8 @@ extern void tbm_add_tuples(TIDBitmap *tbm,
 			   const ItemPointer tids, int ntids,
 			   bool recheck);
 extern void tbm_add_page(TIDBitmap *tbm, BlockNumber pageno);
+extern void tbm_add_page_range(TIDBitmap *tbm, BlockNumber first,
+				   BlockNumber last);
 
 extern void tbm_union(TIDBitmap *a, const TIDBitmap *b);
 extern void tbm_intersect(TIDBitmap *a, const TIDBitmap *b);
@@ -63,4 +66,9 @@ extern TBMIterator *tbm_begin_iterate(TIDBitmap *tbm);
 extern TBMIterateResult *tbm_iterate(TBMIterator *iterator);
 extern void tbm_end_iterate(TBMIterator *iterator);
 
+extern Size tbm_shared_estimate(BlockNumber nblocks);
+extern void tbm_shared_initialize(void *area, BlockNumber nblocks);
+extern void tbm_shared_reset(void *area);
+extern TIDBitmap *tbm_attach_shared(void *area);
+
 #endif   /* TIDBITMAP_H */
@@ -120,6 +120,12 @@ extern BgwHandleStatus
 /* Terminate a bgworker */
 extern void TerminateBackgroundWorker(BackgroundWorkerHandle *handle);
 
+/* Share a handle with another backend */
+extern void ExportBackgroundWorkerHandle(BackgroundWorkerHandle *handle,
+							 int *slot, uint64 *generation);
+extern BackgroundWorkerHandle *ImportBackgroundWorkerHandle(int slot,
+							 uint64 generation);
+
 /* This is valid in a running worker */
 extern PGDLLIMPORT BackgroundWorker *MyBgworkerEntry;
 
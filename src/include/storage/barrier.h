@@ -1,7 +1,7 @@
 /*-------------------------------------------------------------------------
  *
  * barrier.h
- *	  Memory barrier operations.
+ *	  Barriers for synchronizing cooperating processes.
  *
  * Portions Copyright (c) 1996-2016, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
@@ -14,10 +14,32 @@
 #define BARRIER_H
 
 /*
- * This used to be a separate file, full of compiler/architecture
- * dependent defines, but it's not included in the atomics.h
- * infrastructure and just kept for backward compatibility.
+ * For the header previously known as "barrier.h", please include
+ * "port/atomics.h", which deals with atomics, compiler barriers and memory
+ * barriers.
  */
-#include "port/atomics.h"
+
+#include "storage/condition_variable.h"
+#include "storage/spin.h"
+
+typedef struct Barrier
+{
+	slock_t		mutex;
+	int			phase;			/* phase counter */
+	int			participants;	/* the number of participants attached */
+	int			arrived;		/* the number of participants that have
+								 * arrived */
+	int			elected;		/* highest phase elected */
+	bool		static_party;	/* used only for assertions */
+	ConditionVariable condition_variable;
+} Barrier;
+
+extern void BarrierInit(Barrier *barrier, int num_workers);
+extern bool BarrierArriveAndWait(Barrier *barrier);
+extern bool BarrierArriveAndDetach(Barrier *barrier);
+extern int	BarrierAttach(Barrier *barrier);
+extern bool BarrierDetach(Barrier *barrier);
+extern int	BarrierPhase(Barrier *barrier);
+extern int	BarrierParticipants(Barrier *barrier);
 
 #endif   /* BARRIER_H */
@@ -30,6 +30,8 @@
 
 typedef struct BufFile BufFile;
 
+struct SharedFileSet;
+
 /*
  * prototypes for functions in buffile.c
  */
@@ -42,4 +44,12 @@ extern int	BufFileSeek(BufFile *file, int fileno, off_t offset, int whence);
 extern void BufFileTell(BufFile *file, int *fileno, off_t *offset);
 extern int	BufFileSeekBlock(BufFile *file, long blknum);
 
+extern BufFile *BufFileCreateShared(struct SharedFileSet *fileset,
+					const char *name);
+extern void BufFileExportShared(BufFile *file);
+extern BufFile *BufFileOpenShared(struct SharedFileSet *fileset,
+				  const char *name);
+extern void BufFileDeleteShared(struct SharedFileSet *fileset,
+					const char *name);
+
 #endif   /* BUFFILE_H */
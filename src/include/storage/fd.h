@@ -67,6 +67,11 @@ extern int	max_safe_fds;
 /* Operations on virtual Files --- equivalent to Unix kernel file ops */
 extern File PathNameOpenFile(FileName fileName, int fileFlags, int fileMode);
 extern File OpenTemporaryFile(bool interXact);
+extern File PathNameCreateTemporaryFile(const char *path,
+							bool error_on_failure);
+extern File PathNameOpenTemporaryFile(const char *path);
+extern bool PathNameDeleteTemporaryFile(const char *path,
+							bool error_on_failure);
 extern void FileClose(File file);
 extern int	FilePrefetch(File file, off_t offset, int amount);
 extern int	FileRead(File file, char *buffer, int amount);
@@ -107,6 +112,7 @@ extern void closeAllVfds(void);
 extern void SetTempTablespaces(Oid *tableSpaces, int numSpaces);
 extern bool TempTablespacesAreSet(void);
 extern Oid	GetNextTempTableSpace(void);
+extern void TempTablespacePath(char *path, Oid tablespace);
 extern void AtEOXact_Files(void);
 extern void AtEOSubXact_Files(bool isCommit, SubTransactionId mySubid,
 				  SubTransactionId parentSubid);
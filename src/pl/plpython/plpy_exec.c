@@ -433,7 +433,7 @@ PLy_function_build_args(FunctionCallInfo fcinfo, PLyProcedure *proc)
 		{
 			if (proc->args[i].is_rowtype > 0)
 			{
-				if (fcinfo->argnull[i])
+				if (fcinfo->args[i].isnull)
 					arg = NULL;
 				else
 				{
@@ -443,7 +443,7 @@ PLy_function_build_args(FunctionCallInfo fcinfo, PLyProcedure *proc)
 					TupleDesc	tupdesc;
 					HeapTupleData tmptup;
 
-					td = DatumGetHeapTupleHeader(fcinfo->arg[i]);
+					td = DatumGetHeapTupleHeader(fcinfo->args[i].value);
 					/* Extract rowtype info and find a tupdesc */
 					tupType = HeapTupleHeaderGetTypeId(td);
 					tupTypmod = HeapTupleHeaderGetTypMod(td);
@@ -463,12 +463,12 @@ PLy_function_build_args(FunctionCallInfo fcinfo, PLyProcedure *proc)
 			}
 			else
 			{
-				if (fcinfo->argnull[i])
+				if (fcinfo->args[i].isnull)
 					arg = NULL;
 				else
 				{
 					arg = (proc->args[i].in.d.func) (&(proc->args[i].in.d),
-													 fcinfo->arg[i]);
+													 fcinfo->args[i].value);
 				}
 			}
 
@@ -549,7 +549,7 @@ PLy_function_save_args(PLyProcedure *proc)
 			if (proc->argnames[i])
 			{
 				result->namedargs[i] = PyDict_GetItemString(proc->globals,
-														  proc->argnames[i]);
+															proc->argnames[i]);
 				Py_XINCREF(result->namedargs[i]);
 			}
 		}
@@ -84,7 +84,8 @@ SELECT sum2(q1,q2) FROM int8_tbl;
 -- this should work
 select ten, sum(distinct four) from onek a
 group by ten
-having exists (select 1 from onek b where sum(distinct a.four) = b.four);
+having exists (select 1 from onek b where sum(distinct a.four) = b.four)
+order by ten;
 
 -- this should fail because subquery has an agg of its own in WHERE
 select ten, sum(distinct four) from onek a
@@ -525,11 +526,13 @@ drop table bytea_test_table;
 select min(unique1) filter (where unique1 > 100) from tenk1;
 
 select ten, sum(distinct four) filter (where four::text ~ '123') from onek a
-group by ten;
+group by ten
+order by ten;
 
 select ten, sum(distinct four) filter (where four > 10) from onek a
 group by ten
-having exists (select 1 from onek b where sum(distinct a.four) = b.four);
+having exists (select 1 from onek b where sum(distinct a.four) = b.four)
+order by ten;
 
 select max(foo COLLATE "C") filter (where (bar collate "POSIX") > '0')
 from (values ('a', 'b')) AS v(foo,bar);
@@ -821,3 +824,160 @@ create aggregate my_half_sum(int4)
 select my_sum(one),my_half_sum(one) from (values(1),(2),(3),(4)) t(one);
 
 rollback;
+
+--
+-- Test batch-mode aggregation over a seqscan; results must match row mode
+--
+create temp table batch_agg (i int4, b int8, f float8, d date, t text);
+insert into batch_agg
+  select case when g % 10 = 0 then null else g % 100 end,
+         g * 100000000::int8,
+         case when g % 7 = 0 then null else g / 4.0 end,
+         date '2000-01-01' + g % 40,
+         'x' || g
+  from generate_series(1, 3000) g;
+insert into batch_agg values (5, 5, 'NaN', null, null), (6, -1, '-0', null, 'y');
+
+create temp table batch_agg_results (batch bool, q int, r text);
+create function batch_agg_run(batch bool) returns void as
+$$
+begin
+  perform set_config('enable_batch_execution', batch::text, true);
+  insert into batch_agg_results
+    select batch, 1, (select row(count(*), count(i), sum(i), min(i), max(i),
+                                 min(b), max(b), sum(f), min(f), max(f),
+                                 min(d), max(d))::text from batch_agg);
+  insert into batch_agg_results
+    select batch, 2, (select row(count(*), sum(i), min(f), max(f))::text
+                      from batch_agg
+                      where i > 50 and b <= 200000000000 and f <> 'NaN');
+  insert into batch_agg_results
+    select batch, 3, (select row(count(*), sum(f))::text
+                      from batch_agg where 'NaN' <= f or d < '2000-01-03');
+  insert into batch_agg_results
+    select batch, 4, (select row(count(*), sum(i))::text
+                      from batch_agg where i < 0);
+  insert into batch_agg_results
+    select batch, 5, row(d, count(*), sum(i), max(b), min(f))::text
+    from batch_agg where i < 20 group by d;
+  insert into batch_agg_results
+    select batch, 6, row(x, ss.*)::text
+    from (values (1), (2)) v(x),
+         lateral (select count(*), sum(i) from batch_agg where i > x * 45) ss;
+end
+$$ language plpgsql;
+
+select batch_agg_run(true);
+select batch_agg_run(false);
+
+-- both modes give the same answers
+select q, count(*) from
+  ((select q, r from batch_agg_results where batch
+    except all
+    select q, r from batch_agg_results where not batch)
+   union all
+   (select q, r from batch_agg_results where not batch
+    except all
+    select q, r from batch_agg_results where batch)) d
+group by q;
+select q, r from batch_agg_results where batch and q < 5 order by q;
+
+-- overflow in float8 sums is still detected
+select sum(f) from (values (1e308::float8), (1e308::float8)) v(f);
+create temp table batch_agg_ovf as
+  select 1e308::float8 as f from generate_series(1, 2);
+select sum(f) from batch_agg_ovf;
+
+drop function batch_agg_run(bool);
+
+-- Hash aggregation spills to disk once it exceeds work_mem
+create temp table hashagg_spill as
+  select g % 5000 as k, 'k' || (g % 3000) as t, g as v
+  from generate_series(1, 40000) g;
+analyze hashagg_spill;
+set work_mem = '64kB';
+set enable_sort = off;
+explain (costs off)
+  select k, count(*), sum(v) from hashagg_spill group by k;
+create temp table spill_hash_k as
+  select k, count(*) as c, sum(v) as s from hashagg_spill group by k;
+create temp table spill_hash_t as
+  select t, count(*) as c, max(v) as m, avg(v) as a
+  from hashagg_spill group by t;
+set enable_batch_execution = off;
+create temp table spill_hash_k_row as
+  select k, count(*) as c, sum(v) as s from hashagg_spill group by k;
+reset enable_batch_execution;
+select x, (select count(*) from
+             (select k from hashagg_spill where v % 2 = x group by k) ss)
+  from (values (0), (1)) v(x);
+reset enable_sort;
+set enable_hashagg = off;
+create temp table spill_sort_k as
+  select k, count(*) as c, sum(v) as s from hashagg_spill group by k;
+create temp table spill_sort_t as
+  select t, count(*) as c, max(v) as m, avg(v) as a
+  from hashagg_spill group by t;
+reset enable_hashagg;
+reset work_mem;
+select count(*) from spill_hash_k;
+select count(*) from spill_hash_t;
+(select * from spill_hash_k except select * from spill_sort_k)
+union all
+(select * from spill_sort_k except select * from spill_hash_k)
+union all
+(select * from spill_hash_k_row except select * from spill_sort_k);
+(select * from spill_hash_t except select * from spill_sort_t)
+union all
+(select * from spill_sort_t except select * from spill_hash_t);
+
+-- DISTINCT aggregates that can eliminate duplicates by hashing
+explain (costs off)
+  select k % 10 as g, count(distinct t), sum(distinct v % 7)
+  from hashagg_spill group by g;
+explain (costs off)
+  select k % 10 as g, array_agg(distinct v % 3)
+  from hashagg_spill group by g;
+explain (costs off)
+  select k % 10 as g, count(distinct t), sum(distinct v % 7), count(*)
+  from hashagg_spill group by rollup(g);
+create temp table distinct_hash as
+  select k % 10 as g, count(distinct t) as ct, sum(distinct v % 7) as sv,
+         count(*) as c
+  from hashagg_spill group by rollup(g);
+set work_mem = '64kB';
+create temp table distinct_hash_spill as
+  select k, count(distinct v % 5) as c from hashagg_spill group by k;
+reset work_mem;
+set enable_hashagg = off;
+create temp table distinct_sort as
+  select k % 10 as g, count(distinct t) as ct, sum(distinct v % 7) as sv,
+         count(*) as c
+  from hashagg_spill group by rollup(g);
+create temp table distinct_sort_spill as
+  select k, count(distinct v % 5) as c from hashagg_spill group by k;
+reset enable_hashagg;
+select * from distinct_hash where g is null;
+(select * from distinct_hash except select * from distinct_sort)
+union all
+(select * from distinct_sort except select * from distinct_hash);
+(select * from distinct_hash_spill except select * from distinct_sort_spill)
+union all
+(select * from distinct_sort_spill except select * from distinct_hash_spill);
+-- a group whose DISTINCT inputs outgrow work_mem sorts the rest of them
+set work_mem = '64kB';
+explain (costs off)
+  select k % 10 as g, count(distinct v) from hashagg_spill group by g;
+select count(distinct v), sum(distinct v), count(distinct t),
+       regr_count(distinct v % 1000, k)
+  from hashagg_spill;
+select k % 10 as g, count(distinct v), sum(distinct v % 2000),
+       count(distinct t)
+  from hashagg_spill group by g order by g;
+reset work_mem;
+-- float transition values depend on input order, so they keep sorting
+explain (costs off)
+  select k % 10 as g, sum(distinct v::float8), avg(distinct v::float4)
+  from hashagg_spill group by g;
+select count(distinct x), sum(distinct x), count(distinct (x, y))
+  from (values (1, 1), (null, 2), (1, 1), (2, null), (2, null)) v(x, y);
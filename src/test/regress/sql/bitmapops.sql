@@ -36,6 +36,54 @@ SELECT count(*) FROM bmscantest WHERE a = 1 AND b = 1;
 -- Test bitmap-or.
 SELECT count(*) FROM bmscantest WHERE a = 1 OR b = 1;
 
+-- Test count-only scans, which skip all-visible heap pages when exact.
+-- A concurrent transaction's snapshot may keep VACUUM from marking the pages
+-- all-visible.  Since all rows were inserted by one transaction, that's all
+-- pages or none, so compare with relallvisible rather than the table size.
+CREATE FUNCTION bmscan_heap_blocks(query text,
+  OUT exact int, OUT lossy int, OUT skipped int)
+LANGUAGE plpgsql AS
+$$
+DECLARE
+    ln text;
+BEGIN
+    exact := 0;
+    lossy := 0;
+    skipped := 0;
+    FOR ln IN
+        EXECUTE format('EXPLAIN (ANALYZE, COSTS OFF, TIMING OFF) %s', query)
+    LOOP
+        CONTINUE WHEN ln NOT LIKE '%Heap Blocks:%';
+        exact := coalesce(substring(ln FROM 'exact=(\d+)')::int, 0);
+        lossy := coalesce(substring(ln FROM 'lossy=(\d+)')::int, 0);
+        skipped := coalesce(substring(ln FROM 'skipped=(\d+)')::int, 0);
+    END LOOP;
+END;
+$$;
+
+reset work_mem;
+VACUUM bmscantest;
+SELECT count(*) FROM bmscantest WHERE a = 1;
+SELECT exact = relpages AS all_exact, lossy,
+       skipped = relallvisible AS visible_skipped
+  FROM bmscan_heap_blocks('SELECT count(*) FROM bmscantest WHERE a = 1'),
+       pg_class WHERE relname = 'bmscantest';
+-- Lossy pages must still be read, and so must pages with a qual to check.
+set work_mem = 64;
+SELECT lossy > 0 AS some_lossy,
+       skipped = CASE WHEN relallvisible > 0 THEN exact ELSE 0 END
+         AS exact_skipped
+  FROM bmscan_heap_blocks('SELECT count(*) FROM bmscantest WHERE a = 1'),
+       pg_class WHERE relname = 'bmscantest';
+SELECT skipped
+  FROM bmscan_heap_blocks('SELECT count(*) FROM bmscantest WHERE a = 1 AND t IS NOT NULL');
+reset work_mem;
+SELECT skipped
+  FROM bmscan_heap_blocks('SELECT count(*) FROM bmscantest WHERE a = 1 AND t IS NOT NULL');
+DELETE FROM bmscantest WHERE a = 1 AND b < 5;
+SELECT count(*) FROM bmscantest WHERE a = 1;
+SELECT count(*) FROM bmscantest WHERE a = 1 AND b = 1;
 
 -- clean up
+DROP FUNCTION bmscan_heap_blocks(text);
 DROP TABLE bmscantest;
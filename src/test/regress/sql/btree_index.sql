@@ -92,3 +92,46 @@ vacuum btree_tall_tbl;
 -- need to insert some rows to cause the fast root page to split.
 insert into btree_tall_tbl (id, t)
   select g, repeat('x', 100) from generate_series(1, 500) g;
+
+--
+-- Heap prefetching in index scans
+--
+create function btree_prefetch_count(query text) returns bigint
+language plpgsql as
+$$
+declare
+    plan json;
+begin
+    execute format('explain (analyze, costs off, timing off, format json) %s',
+                   query) into plan;
+    return plan->0->'Plan'->'Plans'->0->>'Heap Prefetches';
+end;
+$$;
+
+set enable_seqscan = off;
+set enable_indexscan = on;
+set enable_bitmapscan = off;
+
+-- tenk1's thousand column is uncorrelated with the heap order, so an index
+-- scan prefetches, unless the platform can't or we've been told not to
+select (btree_prefetch_count('select count(stringu1) from tenk1 where thousand < 100') > 0)
+  = (current_setting('effective_io_concurrency')::int > 0) as ok;
+set effective_io_concurrency = 0;
+select btree_prefetch_count('select count(stringu1) from tenk1 where thousand < 100');
+reset effective_io_concurrency;
+
+-- prefetching mustn't disturb the rows returned, in either direction
+begin;
+declare c scroll cursor for
+  select thousand, unique1 from tenk1 where thousand between 10 and 12
+  order by thousand, unique1;
+fetch 4 from c;
+fetch backward 2 from c;
+fetch last from c;
+fetch backward 3 from c;
+commit;
+
+reset enable_seqscan;
+reset enable_indexscan;
+reset enable_bitmapscan;
+drop function btree_prefetch_count(text);
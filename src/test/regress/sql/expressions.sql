@@ -0,0 +1,131 @@
+--
+-- EXPRESSIONS
+--
+-- Function and operator calls, AND/OR/NOT and scalar NULL tests are
+-- compiled into flat step programs; anything else inside them is left to
+-- the tree walker.  Use table columns rather than constants throughout, so
+-- that the planner can't fold the expressions away.
+--
+
+create temp table expr_t (id int, a int, b int, t text, f bool);
+insert into expr_t values
+  (1, 1, 2, 'x', true),
+  (2, null, 3, null, false),
+  (3, 0, null, 'z', null),
+  (4, 5, 0, 'w', true);
+
+-- Strict "scan column op constant" quals, including NULL columns
+select id from expr_t where a > 0 order by id;
+select id from expr_t where a = 0 order by id;
+select id from expr_t where t = 'x' order by id;
+select id from expr_t where 0 < a order by id;
+-- a NULL constant never matches
+select id from expr_t where a = null::int order by id;
+
+-- Calls in the target list, strict and not, with NULL inputs
+select id, a + b as sum, a + 1 as a1, 1 + a as a2, -a as neg,
+       t || 'y' as cat, concat(t, a, b) as concat
+from expr_t order by id;
+
+-- Nested calls, and casts that are mere relabelings
+select id, abs(a - b) * 2 as x, length(t::varchar || t) as len
+from expr_t order by id;
+
+-- Scalar NULL tests
+select id, a is null as a_null, b is not null as b_nn,
+       (a + b) is null as sum_null, not (t is null) as t_nn
+from expr_t order by id;
+select id from expr_t where a is null or b is null order by id;
+
+-- AND, OR and NOT with all combinations of true, false and NULL
+select x, y, x and y as "and", x or y as "or", not x as "not"
+from (values (true), (false), (null)) v1(x),
+     (values (true), (false), (null)) v2(y)
+order by x, y;
+select x, y, z, x and y and z as "and", x or y or z as "or",
+       (x and y) or z as and_or, (x or y) and not z as or_and
+from (values (true), (false), (null)) v1(x),
+     (values (true), (false), (null)) v2(y),
+     (values (true), (false), (null)) v3(z)
+order by x, y, z;
+
+-- AND and OR stop at the first argument that decides the result, so the
+-- division is never reached when b = 0
+select id, b <> 0 and a / b >= 0 as and_guard,
+       b = 0 or a / b >= 0 as or_guard,
+       not (b = 0 or a / b < 0) as not_guard
+from expr_t order by id;
+select id from expr_t where f or (b <> 0 and a / b = 0) order by id;
+
+-- Enough arguments to need more than the initial number of steps
+select id, a = 1 or a = 2 or a = 3 or a = 4 or a = 5 or a = 6 or a = 7 or
+       a = 8 or a = 9 or a = 10 or a = 11 or a = 12 as many
+from expr_t order by id;
+
+-- CASE and COALESCE inside a call are left to the tree walker, and must
+-- still only evaluate the arms they need
+select id, (case when b = 0 then null else a / b end) + 1 as case_div,
+       coalesce(a, 100 / b) + 1 as coalesce_div,
+       coalesce(a, b, -1) * 10 as coalesce_any
+from expr_t order by id;
+select id from expr_t
+where coalesce(b, 0) = 0 and (case when a > 0 then t end) is not null
+order by id;
+
+-- Strict functions must not be called with NULL arguments; others must
+create function expr_strict(int, int) returns int language plpgsql strict as
+$$ begin raise notice 'expr_strict(%, %)', $1, $2; return $1 + $2; end $$;
+create function expr_lax(int, int) returns int language plpgsql as
+$$ begin raise notice 'expr_lax(%, %)', $1, $2; return coalesce($1, 0) + coalesce($2, 0); end $$;
+
+select id, expr_strict(a, b), expr_lax(a, b) from expr_t order by id;
+select id from expr_t where expr_strict(a, 1) > 1 order by id;
+
+-- Likewise when function statistics are being tracked
+set track_functions = 'all';
+select id, expr_strict(a, b), expr_lax(a, b) from expr_t order by id;
+select id from expr_t where expr_strict(a, 1) > 1 order by id;
+reset track_functions;
+
+-- Join quals and join target lists read their columns from the outer and
+-- inner tuples
+set enable_hashjoin = off;
+set enable_mergejoin = off;
+explain (costs off)
+select x.id, y.id, x.a + y.b as sum
+from expr_t x join expr_t y on x.a + 1 = y.b or (x.a is null and y.b is null)
+order by 1, 2;
+select x.id, y.id, x.a + y.b as sum
+from expr_t x join expr_t y on x.a + 1 = y.b or (x.a is null and y.b is null)
+order by 1, 2;
+reset enable_hashjoin;
+reset enable_mergejoin;
+set enable_nestloop = off;
+set enable_mergejoin = off;
+explain (costs off)
+select x.id, y.id, x.t || y.t as cat
+from expr_t x join expr_t y on x.a = y.b and x.id < y.id
+order by 1, 2;
+select x.id, y.id, x.t || y.t as cat
+from expr_t x join expr_t y on x.a = y.b and x.id < y.id
+order by 1, 2;
+reset enable_nestloop;
+reset enable_mergejoin;
+
+-- System columns, whole-row references and row-valued NULL tests are left
+-- to the tree walker
+select id, tableoid::regclass = 'expr_t'::regclass as own_table,
+       x is null as row_null, x is not null as row_nn,
+       length(x::text) > 0 as row_text, (x).a + 1 as field
+from expr_t x order by id;
+
+-- A set-returning function in the target list
+select id, generate_series(1, a) + 1 as g from expr_t where a > 0 order by id, g;
+
+-- A column after a dropped one
+alter table expr_t drop column b;
+select id, a + 1 as a1, t || '!' as t1, f and a > 0 as fa
+from expr_t order by id;
+
+drop function expr_strict(int, int);
+drop function expr_lax(int, int);
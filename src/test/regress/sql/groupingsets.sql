@@ -181,7 +181,8 @@ select a, b, sum(c), count(*) from gstest2 group by grouping sets (rollup(a,b),a
 -- HAVING queries
 select ten, sum(distinct four) from onek a
 group by grouping sets((ten,four),(ten))
-having exists (select 1 from onek b where sum(distinct a.four) = b.four);
+having exists (select 1 from onek b where sum(distinct a.four) = b.four)
+order by 1, 2;
 
 -- Tests around pushdown of HAVING clauses, partially testing against previous bugs
 select a,count(*) from gstest2 group by rollup(a) order by a;
@@ -214,7 +215,8 @@ order by 2,1;
 
 -- FILTER queries
 select ten, sum(distinct four) filter (where four::text ~ '123') from onek a
-group by rollup(ten);
+group by rollup(ten)
+order by ten;
 
 -- More rescan tests
 select * from (values (1),(2)) v(a) left join lateral (select v.a, four, ten, count(*) from onek group by cube(four,ten)) s on true order by v.a,four,ten;
@@ -224,4 +226,39 @@ select array(select row(v.a,s1.*) from (select two,four, count(*) from onek grou
 select sum(ten) from onek group by two, rollup(four::text) order by 1;
 select sum(ten) from onek group by rollup(four::text), two order by 1;
 
+-- Hashed grouping sets
+explain (costs off)
+  select a, b, grouping(a,b), sum(v), count(*), max(v)
+    from gstest1 group by grouping sets ((a),(b)) order by 3,1,2;
+select a, b, grouping(a,b), sum(v), count(*), max(v)
+  from gstest1 group by grouping sets ((a),(b)) order by 3,1,2;
+explain (costs off)
+  select a, b, grouping(a,b), sum(v), count(*), max(v)
+    from gstest1 group by cube(a,b) order by 3,1,2;
+select a, b, grouping(a,b), sum(v), count(*), max(v)
+  from gstest1 group by cube(a,b) order by 3,1,2;
+select a, b, sum(v), count(*) from gstest_empty group by grouping sets ((a,b),());
+select a, b, sum(c), count(*) from gstest2
+  group by grouping sets ((a),(b),()) having count(*) > 2 order by 1,2;
+
+-- Hashed sets alongside sorted ones
+set enable_hashagg = false;
+create temp table gstest_sorted as
+  select unique1 % 7 as a, unique1 % 11 as b, two, count(*), sum(unique2)
+    from tenk1 group by grouping sets ((a,b),(a),(b),(two),());
+reset enable_hashagg;
+set enable_sort = false;
+set work_mem = '64kB';
+explain (costs off)
+  select unique1 % 7 as a, unique1 % 11 as b, two, count(*), sum(unique2)
+    from tenk1 group by grouping sets ((a,b),(a),(b),(two),());
+create temp table gstest_mixed as
+  select unique1 % 7 as a, unique1 % 11 as b, two, count(*), sum(unique2)
+    from tenk1 group by grouping sets ((a,b),(a),(b),(two),());
+reset work_mem;
+reset enable_sort;
+(select * from gstest_sorted except all select * from gstest_mixed)
+union all
+(select * from gstest_mixed except all select * from gstest_sorted);
+
 -- end
@@ -14,3 +14,93 @@ VACUUM;
 --select count(*) from hippo_tbl where id2>100000 and id2 <101000;
 drop index hippo_idx;
 drop table hippo_tbl;
+
+-- parallel bitmap scan: workers split the index entries and heap pages
+create table hippo_par_tbl(id int4, id2 int4);
+insert into hippo_par_tbl select i, i from generate_series(1, 200000) i;
+analyze hippo_par_tbl;
+create index hippo_par_idx on hippo_par_tbl using hippo(id2);
+analyze hippo_par_tbl;
+set max_parallel_workers_per_gather = 4;
+set parallel_setup_cost = 0;
+set parallel_tuple_cost = 0;
+set min_parallel_relation_size = 0;
+explain (costs off)
+  select count(*) from hippo_par_tbl where id2 > 1000 and id2 < 50000;
+select count(*) from hippo_par_tbl where id2 > 1000 and id2 < 50000;
+-- rescan of the parallel scan under a nestloop
+set enable_hashjoin = off;
+set enable_mergejoin = off;
+set enable_material = off;
+select count(*) from generate_series(0, 2) g, hippo_par_tbl
+  where id2 > 1000 and id2 < 50000 and id % 3 = g;
+reset enable_hashjoin;
+reset enable_mergejoin;
+reset enable_material;
+reset max_parallel_workers_per_gather;
+reset parallel_setup_cost;
+reset parallel_tuple_cost;
+reset min_parallel_relation_size;
+
+-- page ranges from hippo ORed with exact pages from a btree
+create index hippo_par_id on hippo_par_tbl (id);
+set enable_seqscan = off;
+set enable_indexscan = off;
+explain (costs off)
+  select count(*) from hippo_par_tbl
+  where (id2 > 1000 and id2 < 50000) or id > 199000 or id < 10;
+select count(*) from hippo_par_tbl
+  where (id2 > 1000 and id2 < 50000) or id > 199000 or id < 10;
+reset enable_seqscan;
+reset enable_indexscan;
+drop index hippo_par_id;
+
+-- approximate counts straight from the index
+vacuum analyze hippo_par_tbl;
+select lower_estimate <= expected and expected <= upper_bound as bounded,
+       abs(expected - 48999) / 48999 < 0.2 as close
+  from hippo_estimate_count('hippo_par_idx', 1001, 49999);
+select * from hippo_estimate_count('hippo_par_idx', 10, 1);
+create index hippo_par_btree on hippo_par_tbl (id2);
+select * from hippo_estimate_count('hippo_par_btree', 1, 10);
+drop table hippo_par_tbl;
+
+-- keys below the first histogram bound have an overflow bucket of their own,
+-- both when building the index and when scanning or estimating from it
+create table hippo_low_tbl(id int4, id2 int4);
+insert into hippo_low_tbl select i, i from generate_series(1, 20000) i;
+analyze hippo_low_tbl;
+truncate hippo_low_tbl;
+insert into hippo_low_tbl select i, -i from generate_series(1, 10000) i;
+create index hippo_low_idx on hippo_low_tbl using hippo(id2);
+vacuum analyze hippo_low_tbl;
+set enable_seqscan = off;
+set enable_indexscan = off;
+explain (costs off)
+  select count(*) from hippo_low_tbl where id2 > -10 and id2 < 0;
+select count(*) from hippo_low_tbl where id2 > -10 and id2 < 0;
+select count(*) from hippo_low_tbl where id2 < 0;
+select count(*) from hippo_low_tbl where id2 = -5000;
+reset enable_seqscan;
+reset enable_indexscan;
+select lower_estimate <= 10000 and 10000 <= upper_bound as bounded
+  from hippo_estimate_count('hippo_low_idx', -10000, -1);
+select lower_estimate, upper_bound
+  from hippo_estimate_count('hippo_low_idx', 20000, 20000);
+drop table hippo_low_tbl;
+
+-- upper_bound holds even for a key range whose pages hold many more rows
+-- than the table's average; lower_estimate is only an estimate, and is too
+-- high for the sparse pages of the wide rows
+create table hippo_skew_tbl(id2 int4, pad text);
+insert into hippo_skew_tbl select 10000 + i, null from generate_series(1, 10000) i;
+insert into hippo_skew_tbl select i, repeat('x', 500) from generate_series(1, 10000) i;
+analyze hippo_skew_tbl;
+create index hippo_skew_idx on hippo_skew_tbl using hippo(id2);
+select c.n, e.lower_estimate <= c.n as lower_ok, c.n <= e.upper_bound as upper_ok
+  from hippo_estimate_count('hippo_skew_idx', 10001, 20000) e,
+       (select count(*) as n from hippo_skew_tbl where id2 between 10001 and 20000) c;
+select c.n, c.n <= e.upper_bound as upper_ok
+  from hippo_estimate_count('hippo_skew_idx', 1, 10000) e,
+       (select count(*) as n from hippo_skew_tbl where id2 between 1 and 10000) c;
+drop table hippo_skew_tbl;
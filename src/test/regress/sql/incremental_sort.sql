@@ -0,0 +1,58 @@
+--
+-- INCREMENTAL SORT
+--
+
+-- When we have to sort the entire table, incremental sort will
+-- be slower than plain sort, so it should not be used.
+explain (costs off)
+select * from (select * from tenk1 order by four) t order by four, ten;
+
+-- When there is a LIMIT clause, incremental sort is beneficial because
+-- it only has to sort some of the groups, and not the entire table.
+explain (costs off)
+select * from (select * from tenk1 order by four) t order by four, ten
+limit 1;
+
+-- An index on a prefix of the requested ordering is useful too.
+explain (costs off)
+select unique1, hundred, ten from tenk1 order by hundred, ten, unique1
+limit 10;
+select unique1, hundred, ten from tenk1 order by hundred, ten, unique1
+limit 10;
+
+-- Batches are cut at group boundaries, so the result must match a full sort.
+create temp table inc_sort_data as
+  select (i / 10) as a, (i * 7919) % 1000 as b from generate_series(1, 1000) i;
+create index on inc_sort_data (a);
+analyze inc_sort_data;
+set enable_seqscan = off;
+explain (costs off)
+select a, b from inc_sort_data order by a, b limit 25;
+select a, b from inc_sort_data order by a, b limit 25;
+select md5(string_agg(a || ':' || b, ',')) from
+  (select a, b from inc_sort_data order by a, b offset 0) s;
+set enable_incrementalsort = off;
+select md5(string_agg(a || ':' || b, ',')) from
+  (select a, b from inc_sort_data order by a, b offset 0) s;
+reset enable_incrementalsort;
+
+-- Rescans restart the incremental sort from the beginning.
+explain (costs off)
+select * from (values (1), (50)) v(x),
+  lateral (select a, b from inc_sort_data where a >= x order by a, b limit 3) s;
+select * from (values (1), (50)) v(x),
+  lateral (select a, b from inc_sort_data where a >= x order by a, b limit 3) s;
+reset enable_seqscan;
+
+-- A mergejoin whose outer input is sorted on the first merge key.
+set enable_hashjoin = off;
+set enable_nestloop = off;
+explain (costs off)
+select count(*) from (select * from tenk1 order by hundred offset 0) a
+  join tenk1 b on a.hundred = b.hundred and a.ten = b.ten;
+select count(*) from (select * from tenk1 order by hundred offset 0) a
+  join tenk1 b on a.hundred = b.hundred and a.ten = b.ten;
+reset enable_hashjoin;
+reset enable_nestloop;
+
+drop table inc_sort_data;
@@ -486,6 +486,7 @@ reset enable_nestloop;
 
 set work_mem to '64kB';
 set enable_mergejoin to off;
+set enable_resultcache to off;
 
 explain (costs off)
 select count(*) from tenk1 a, tenk1 b
@@ -495,6 +496,7 @@ select count(*) from tenk1 a, tenk1 b
 
 reset work_mem;
 reset enable_mergejoin;
+reset enable_resultcache;
 
 --
 -- regression test for 8.2 bug with improper re-ordering of left joins
@@ -1730,3 +1732,182 @@ update xx1 set x2 = f1 from xx1, lateral (select * from int4_tbl where f1 = x1)
 delete from xx1 using (select * from int4_tbl where f1 = x1) ss;
 delete from xx1 using (select * from int4_tbl where f1 = xx1.x1) ss;
 delete from xx1 using lateral (select * from int4_tbl where f1 = x1) ss;
+
+--
+-- parallel hash join
+--
+begin;
+
+set local parallel_setup_cost = 0;
+set local parallel_tuple_cost = 0;
+set local min_parallel_relation_size = 0;
+set local max_parallel_workers_per_gather = 2;
+set local enable_nestloop = off;
+set local enable_mergejoin = off;
+
+-- temp tables can't be scanned in parallel, so use a plain table
+create table phj_big as
+  select g as id, g % 100 as grp from generate_series(1, 20000) g;
+alter table phj_big set (parallel_workers = 2);
+analyze phj_big;
+
+-- a shared hash table that fits in one batch
+explain (costs off)
+  select count(*) from phj_big a join phj_big b using (id);
+select count(*) from phj_big a join phj_big b using (id);
+
+-- a shared hash table that has to be spilled to batch files
+set local work_mem = '64kB';
+explain (costs off)
+  select count(*) from phj_big a join phj_big b using (id);
+select count(*) from phj_big a join phj_big b using (id);
+select count(*) from phj_big a left join phj_big b on a.id = b.id + 10000;
+select count(*) from phj_big a
+  where exists (select 1 from phj_big b where b.id = a.id * 2);
+select count(*) from phj_big a
+  where not exists (select 1 from phj_big b where b.id = a.id * 2);
+
+-- the same results with a private hash table in each worker
+set local enable_parallel_hash = off;
+select count(*) from phj_big a join phj_big b using (id);
+select count(*) from phj_big a left join phj_big b on a.id = b.id + 10000;
+
+rollback;
+
+--
+-- hash join runtime filters
+--
+
+-- Run EXPLAIN ANALYZE, masking what depends on the platform: memory usage,
+-- heap fetches, prefetching (which also depends on effective_io_concurrency)
+-- and timings.  The resultcache test uses this too, so it is not dropped.
+create function explain_analyze_masked(query text) returns setof text
+language plpgsql as
+$$
+declare
+    ln text;
+begin
+    for ln in
+        execute format('explain (analyze, costs off, timing off) %s', query)
+    loop
+        ln := regexp_replace(ln, 'Memory Usage: \d+', 'Memory Usage: N');
+        ln := regexp_replace(ln, 'Heap Fetches: \d+', 'Heap Fetches: N');
+        continue when ln like '%Heap Prefetches:%';
+        continue when ln like 'Planning time:%' or ln like 'Execution time:%';
+        return next ln;
+    end loop;
+end;
+$$;
+
+create temp table rf_fact as
+  select g as id, g % 1000 as dk,
+         case when g % 97 = 0 then null else g % 1000 end as dkn
+  from generate_series(1, 20000) g;
+create temp table rf_dim as
+  select g as dk, 'x' || g as name from generate_series(1, 1000) g;
+analyze rf_fact;
+analyze rf_dim;
+
+set enable_nestloop = off;
+set enable_mergejoin = off;
+
+-- the outer scan drops rows that can't find a partner
+select explain_analyze_masked('
+select count(*) from rf_fact f join rf_dim d on f.dk = d.dk
+where d.name like ''x1_''');
+select count(*), sum(f.id) from rf_fact f join rf_dim d on f.dk = d.dk
+  where d.name like 'x1_';
+select count(*), sum(f.id) from rf_fact f join rf_dim d on f.dkn = d.dk
+  where d.name like 'x1_';
+select count(*), count(f.id) from rf_fact f right join rf_dim d
+  on f.dk = d.dk where d.name like 'x1_';
+select count(*) from rf_fact f
+  where exists (select 1 from rf_dim d where d.dk = f.dk + 1 and d.name like 'x2%');
+
+-- outer rows without a partner must survive a left join
+select explain_analyze_masked('
+select count(*) from rf_fact f
+  left join (select * from rf_dim where name like ''x1_'') d on f.dk = d.dk');
+select count(*), count(d.dk) from rf_fact f
+  left join (select * from rf_dim where name like 'x1_') d on f.dk = d.dk;
+
+-- a filter that rejects too little is dropped after the first rows
+select explain_analyze_masked('
+select count(*) from rf_fact f join rf_dim d on f.dk = d.dk
+where d.name like ''x%''');
+
+-- the filter is rebuilt along with the hash table on rescan
+select g, (select count(*) from rf_fact f join rf_dim d
+           on f.dk = d.dk and d.dk < o.g)
+  from generate_series(1, 4) o(g);
+
+-- the same results with multiple batches, or without filters
+set work_mem = '64kB';
+select count(*), sum(f.id) from rf_fact f join rf_fact g on f.dk = g.id
+  where g.id % 7 = 0;
+reset work_mem;
+set enable_runtime_filter = off;
+select count(*), sum(f.id) from rf_fact f join rf_fact g on f.dk = g.id
+  where g.id % 7 = 0;
+reset enable_runtime_filter;
+
+reset enable_nestloop;
+reset enable_mergejoin;
+
+--
+-- nested loops that probe the inner index in batches must still return
+-- rows in outer order
+--
+set enable_hashjoin = off;
+set enable_mergejoin = off;
+set enable_resultcache = off;
+
+explain (costs off)
+select t1.unique1, t2.ten
+  from (select * from tenk1 where unique1 < 40 order by unique1 desc) t1
+  left join tenk1 t2 on t2.unique1 = t1.unique2 * 3 and t2.ten < 5;
+select string_agg(t1.unique1 || ':' || coalesce(t2.ten::text, '-'), ',')
+  from (select * from tenk1 where unique1 < 40 order by unique1 desc) t1
+  left join tenk1 t2 on t2.unique1 = t1.unique2 * 3 and t2.ten < 5;
+select string_agg(t1.unique1 || ':' || t2.hundred, ',')
+  from (select * from tenk1 where unique1 < 40 order by unique1 desc) t1
+  join tenk1 t2 on t2.unique1 = t1.unique2;
+select string_agg(t1.unique1::text, ',')
+  from (select * from tenk1 where unique1 < 40 order by unique1 desc) t1
+  where not exists (select 1 from tenk1 t2 where t2.unique1 = t1.unique2 * 3);
+
+set enable_nestloop_batching = off;
+select string_agg(t1.unique1 || ':' || coalesce(t2.ten::text, '-'), ',')
+  from (select * from tenk1 where unique1 < 40 order by unique1 desc) t1
+  left join tenk1 t2 on t2.unique1 = t1.unique2 * 3 and t2.ten < 5;
+
+reset enable_nestloop_batching;
+
+-- with a high-fanout inner side, a LIMIT must still stop the join early,
+-- and the rows kept for a batch must stay within work_mem
+create temp table nl_fanout as
+  select g % 4 as k, g as v from generate_series(1, 20000) g;
+create index on nl_fanout (k);
+analyze nl_fanout;
+set enable_seqscan = off;
+set enable_bitmapscan = off;
+
+select explain_analyze_masked('
+  select o.k, f.v from (values (3), (1), (2), (0)) o(k)
+    join nl_fanout f on f.k = o.k limit 1');
+select o.k, f.v from (values (3), (1), (2), (0)) o(k)
+  join nl_fanout f on f.k = o.k limit 3;
+
+set work_mem = '64kB';
+select count(*) as rows,
+       string_agg(k::text, ',') filter (where k is distinct from prev) as runs
+  from (select o.k, lag(o.k) over () as prev
+          from (values (3), (1), (2), (0), (3)) o(k)
+          join nl_fanout f on f.k = o.k) s;
+reset work_mem;
+
+reset enable_seqscan;
+reset enable_bitmapscan;
+reset enable_hashjoin;
+reset enable_mergejoin;
+reset enable_resultcache;
@@ -0,0 +1,76 @@
+--
+-- PARALLEL WORKER POOL
+--
+-- The pool is sized by a server-wide setting, and idle pooled workers can be
+-- handed jobs by any backend in the same database, so this test runs alone.
+--
+
+alter system set parallel_worker_pool_size = 2;
+select pg_reload_conf();
+select pg_sleep(0.5);
+show parallel_worker_pool_size;
+
+-- Report the state a parallel worker runs a job with.
+create function pool_job(out pid int, out usr name, out tmp oid, out wm text)
+  language plpgsql parallel safe as $$
+begin
+  pid := pg_backend_pid();
+  usr := current_user;
+  tmp := pg_my_temp_schema();
+  wm := current_setting('work_mem');
+end$$;
+
+create role regress_pool_user login;
+select current_user as pool_su \gset
+
+set force_parallel_mode = on;
+set max_parallel_workers_per_gather = 2;
+
+-- A first job, with a GUC changed
+set work_mem = '1234kB';
+select pid, usr, tmp, wm from pool_job() \gset j1_
+select :j1_pid <> pg_backend_pid() as in_worker, :'j1_usr' = current_user as usr,
+       :j1_tmp = 0 as no_temp, :'j1_wm' as wm;
+reset work_mem;
+
+-- The same worker takes the next job, but with that job's GUCs, user and
+-- temp namespace
+create temp table pool_tmp (a int);
+set role regress_pool_user;
+select pid, usr, tmp, wm from pool_job() \gset j2_
+select :j2_pid = :j1_pid as reused, :'j2_usr' as usr,
+       :j2_tmp = pg_my_temp_schema() as leader_temp, :j2_tmp <> 0 as has_temp,
+       :'j2_wm' = current_setting('work_mem') as wm;
+reset role;
+select pid, usr from pool_job() \gset j3_
+select :j3_pid = :j1_pid as reused, :'j3_usr' = current_user as usr;
+
+-- A job from another session doesn't see the previous leader's temp schema
+\c -
+set force_parallel_mode = on;
+set max_parallel_workers_per_gather = 2;
+select pid, usr, tmp, wm from pool_job() \gset j4_
+select :j4_pid = :j1_pid as reused, :'j4_usr' = current_user as usr,
+       :j4_tmp = 0 as no_temp, :'j4_wm' = current_setting('work_mem') as wm;
+
+-- Workers are only reused by sessions of the user they were started for
+\c - regress_pool_user
+set force_parallel_mode = on;
+set max_parallel_workers_per_gather = 2;
+select pid, usr from pool_job() \gset j5_
+select :j5_pid <> :j1_pid as new_worker, :'j5_usr' as usr;
+
+\c - :pool_su
+set force_parallel_mode = on;
+set max_parallel_workers_per_gather = 2;
+select pid, usr from pool_job() \gset j6_
+select :j6_pid = :j1_pid as reused, :j6_pid <> :j5_pid as not_other_users,
+       :'j6_usr' = current_user as usr;
+reset force_parallel_mode;
+reset max_parallel_workers_per_gather;
+
+alter system reset parallel_worker_pool_size;
+select pg_reload_conf();
+
+drop function pool_job();
+drop role regress_pool_user;
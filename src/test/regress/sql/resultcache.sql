@@ -0,0 +1,60 @@
+--
+-- RESULT CACHE
+--
+
+-- explain_analyze_masked() comes from the join test.
+
+set enable_hashjoin = off;
+set enable_mergejoin = off;
+
+-- Few distinct outer values: the inner side runs once per value.
+select explain_analyze_masked('
+select count(*), sum(t2.unique2) from tenk1 t1
+  join tenk1 t2 on t2.unique1 = t1.twenty
+where t1.unique1 < 1000');
+select count(*), sum(t2.unique2) from tenk1 t1
+  join tenk1 t2 on t2.unique1 = t1.twenty
+where t1.unique1 < 1000;
+
+-- Semi and anti joins need only one row per cache entry.
+select explain_analyze_masked('
+select count(*) from tenk1 t1
+where exists (select 1 from tenk1 t2 where t2.unique1 = t1.twenty)');
+select explain_analyze_masked('
+select count(*) from tenk1 t1
+where not exists (select 1 from tenk1 t2
+                  where t2.hundred = t1.twenty and t2.ten < 3)');
+select count(*) from tenk1 t1
+where not exists (select 1 from tenk1 t2
+                  where t2.hundred = t1.twenty and t2.ten < 3);
+
+-- With a small work_mem, entries are evicted, and an entry too large to
+-- cache at all is passed through; the results must not change.
+create temp table rc_inner as
+  select case when i <= 2000 then 0 else i - 2000 end as h,
+         repeat('y', 50) as pad
+  from generate_series(1, 2050) i;
+create index on rc_inner (h);
+analyze rc_inner;
+create temp table rc_outer as
+  select (i * 7) % 51 as k from generate_series(1, 3000) i;
+analyze rc_outer;
+set enable_material = off;
+set work_mem = '64kB';
+select explain_analyze_masked('
+select count(*), sum(length(i.pad)), sum(i.h) from rc_outer o
+  join rc_inner i on i.h = o.k');
+select count(*), sum(length(i.pad)), sum(i.h) from rc_outer o
+  join rc_inner i on i.h = o.k;
+set enable_resultcache = off;
+select count(*), sum(length(i.pad)), sum(i.h) from rc_outer o
+  join rc_inner i on i.h = o.k;
+reset enable_resultcache;
+reset work_mem;
+reset enable_material;
+
+reset enable_hashjoin;
+reset enable_mergejoin;
+
+drop table rc_inner;
+drop table rc_outer;
@@ -19,6 +19,22 @@ explain (costs off)
   select count(*) from a_star;
 select count(*) from a_star;
 
+-- a parallel append can mix partial and non-partial children
+alter table c_star set (parallel_workers = 0);
+alter table d_star set (parallel_workers = 0);
+explain (costs off)
+  select count(*) from a_star;
+select count(*) from a_star;
+
+-- without parallel append, every child needs a partial path
+set enable_parallel_append to off;
+explain (costs off)
+  select count(*) from a_star;
+select count(*) from a_star;
+reset enable_parallel_append;
+alter table c_star reset (parallel_workers);
+alter table d_star reset (parallel_workers);
+
 -- test that parallel_restricted function doesn't run in worker
 alter table tenk1 set (parallel_workers = 4);
 explain (verbose, costs off)
@@ -39,6 +55,56 @@ explain (costs off)
 	select  sum(parallel_restricted(unique1)) from tenk1
 	group by(parallel_restricted(unique1));
 
+-- test parallel index scans.
+set enable_seqscan to off;
+set enable_bitmapscan to off;
+
+explain (costs off)
+	select  count((unique1)) from tenk1 where hundred > 1;
+select  count((unique1)) from tenk1 where hundred > 1;
+
+-- test parallel index-only scans.
+explain (costs off)
+	select  count(*) from tenk1 where thousand > 95;
+select  count(*) from tenk1 where thousand > 95;
+
+-- array keys can't be shared between participants
+explain (costs off)
+	select  count(*) from tenk1 where thousand in (1, 2, 3);
+select  count(*) from tenk1 where thousand in (1, 2, 3);
+
+-- gather merge preserves the order of a backward parallel index scan
+explain (costs off)
+	select  unique1 from tenk1 where unique1 > 100 and tenthous % 500 = 7
+	order by unique1 desc;
+select  unique1 from tenk1 where unique1 > 100 and tenthous % 500 = 7
+	order by unique1 desc;
+
+reset enable_seqscan;
+reset enable_bitmapscan;
+
+-- test gather merge
+set enable_hashagg to off;
+
+explain (costs off)
+	select  count(*) from tenk1 group by twenty;
+select  count(*) from tenk1 group by twenty;
+
+-- gather merge over a sort done in the workers
+explain (costs off)
+	select  unique1, ten from tenk1 where tenthous % 500 = 7
+	order by ten desc, unique1;
+select  unique1, ten from tenk1 where tenthous % 500 = 7
+	order by ten desc, unique1;
+
+-- when gather merge is disabled, sort the output of a gather instead
+set enable_gathermerge to off;
+explain (costs off)
+	select  unique1, ten from tenk1 where tenthous % 500 = 7
+	order by ten desc, unique1;
+reset enable_gathermerge;
+reset enable_hashagg;
+
 set force_parallel_mode=1;
 
 explain (costs off)
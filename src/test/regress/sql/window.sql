@@ -641,3 +641,36 @@ SELECT to_char(SUM(n::float8) OVER (ORDER BY i ROWS BETWEEN CURRENT ROW AND 1 FO
 SELECT i, b, bool_and(b) OVER w, bool_or(b) OVER w
   FROM (VALUES (1,true), (2,true), (3,false), (4,false), (5,true)) v(i,b)
   WINDOW w AS (ORDER BY i ROWS BETWEEN CURRENT ROW AND 1 FOLLOWING);
+
+-- aggregates with a combine function but no inverse transition function are
+-- answered from a segment tree when the frame head moves; compare against
+-- the restart path, which a volatile FILTER forces
+SELECT i, v, min(v) OVER w, max(v) OVER w, bool_and(v > 2) OVER w,
+       max(v) FILTER (WHERE v < 5) OVER w
+  FROM (VALUES (1,3),(2,NULL),(3,5),(4,1),(5,NULL),(6,4),(7,2)) t(i,v)
+  WINDOW w AS (ORDER BY i ROWS BETWEEN 1 PRECEDING AND 2 FOLLOWING);
+
+SELECT i, min(v) OVER (ORDER BY i ROWS BETWEEN 1 FOLLOWING AND 2 FOLLOWING),
+       string_agg(v::text, ',') OVER (ORDER BY i ROWS BETWEEN 1 FOLLOWING AND 2 FOLLOWING)
+  FROM (VALUES (1,3),(2,NULL),(3,5),(4,1)) t(i,v);
+
+SELECT count(*)
+  FROM (SELECT min(x) OVER w AS m1, max(x::text) OVER w AS m2,
+               min(x) FILTER (WHERE random() >= 0) OVER w AS r1,
+               max(x::text) FILTER (WHERE random() >= 0) OVER w AS r2
+          FROM (SELECT g % 7 AS p, g AS i, (g * 7919) % 1000 AS x
+                  FROM generate_series(1, 1000) g) s
+        WINDOW w AS (PARTITION BY p ORDER BY i
+                     ROWS BETWEEN 20 PRECEDING AND 3 FOLLOWING)) ss
+ WHERE m1 IS DISTINCT FROM r1 OR m2 IS DISTINCT FROM r2;
+
+-- float addition isn't associative, so sum(float8) must not take the
+-- segment tree, which would group the additions differently
+SELECT count(*)
+  FROM (SELECT sum(x) OVER w AS s1,
+               sum(x) FILTER (WHERE random() >= 0) OVER w AS s2
+          FROM (SELECT g AS i,
+                       CASE g % 3 WHEN 0 THEN 1e16 WHEN 1 THEN 1 ELSE -1e16 END::float8 AS x
+                  FROM generate_series(1, 200) g) s
+        WINDOW w AS (ORDER BY i ROWS BETWEEN 5 PRECEDING AND 5 FOLLOWING)) ss
+ WHERE s1 IS DISTINCT FROM s2;
@@ -0,0 +1,328 @@
+/*-------------------------------------------------------------------------
+ *
+ * hashjoin.h
+ *	  internal structures for hash joins
+ *
+ *
+ * Portions Copyright (c) 1996-2016, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * src/include/executor/hashjoin.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef HASHJOIN_H
+#define HASHJOIN_H
+
+#include "lib/bloomfilter.h"
+#include "nodes/execnodes.h"
+#include "port/atomics.h"
+#include "storage/barrier.h"
+#include "storage/buffile.h"
+#include "storage/sharedfileset.h"
+#include "storage/spin.h"
+
+/* ----------------------------------------------------------------
+ *				hash-join hash table structures
+ *
+ * Each active hashjoin has a HashJoinTable control block, which is
+ * palloc'd in the executor's per-query context.  All other storage needed
+ * for the hashjoin is kept in private memory contexts, two for each hashjoin.
+ * This makes it easy and fast to release the storage when we don't need it
+ * anymore.  (Exception: data associated with the temp files lives in the
+ * per-query context too, since we always call buffile.c in that context.)
+ *
+ * The hashtable contexts are made children of the per-query context, ensuring
+ * that they will be discarded at end of statement even if the join is
+ * aborted early by an error.  (Likewise, any temporary files we make will
+ * be cleaned up by the virtual file manager in event of an error.)
+ *
+ * Storage that should live through the entire join is allocated from the
+ * "hashCxt", while storage that is only wanted for the current batch is
+ * allocated in the "batchCxt".  By resetting the batchCxt at the end of
+ * each batch, we free all the per-batch storage reliably and without tedium.
+ *
+ * During first scan of inner relation, we get its tuples from executor.
+ * If nbatch > 1 then tuples that don't belong in first batch get saved
+ * into inner-batch temp files. The same statements apply for the
+ * first scan of the outer relation, except we write tuples to outer-batch
+ * temp files.  After finishing the first scan, we do the following for
+ * each remaining batch:
+ *	1. Read tuples from inner batch file, load into hash buckets.
+ *	2. Read tuples from outer batch file, match to hash buckets and output.
+ *
+ * It is possible to increase nbatch on the fly if the in-memory hash table
+ * gets too big.  The hash-value-to-batch computation is arranged so that this
+ * can only cause a tuple to go into a later batch than previously thought,
+ * never into an earlier batch.  When we increase nbatch, we rescan the hash
+ * table and dump out any tuples that are now of a later batch to the correct
+ * inner batch file.  Subsequently, while reading either inner or outer batch
+ * files, we might find tuples that no longer belong to the current batch;
+ * if so, we just dump them out to the correct batch file.
+ *
+ * A parallel-aware hash join builds a single hash table in shared memory
+ * instead, with every participant inserting the tuples of its share of the
+ * inner relation; see ParallelHashJoinState below.
+ * ----------------------------------------------------------------
+ */
+
+/* these are in nodes/execnodes.h: */
+/* typedef struct HashJoinTupleData *HashJoinTuple; */
+/* typedef struct HashJoinTableData *HashJoinTable; */
+
+typedef struct HashJoinTupleData
+{
+	/* link to next tuple in same bucket */
+	union
+	{
+		struct HashJoinTupleData *unshared;
+		uint32		shared;		/* see HJ_SHARED_TUPLE */
+	}			next;
+	uint32		hashvalue;		/* tuple's hash code */
+	/* Tuple data, in MinimalTuple format, follows on a MAXALIGN boundary */
+}	HashJoinTupleData;
+
+#define HJTUPLE_OVERHEAD  MAXALIGN(sizeof(HashJoinTupleData))
+#define HJTUPLE_MINTUPLE(hjtup)  \
+	((MinimalTuple) ((char *) (hjtup) + HJTUPLE_OVERHEAD))
+
+/*
+ * If the outer relation's distribution is sufficiently nonuniform, we attempt
+ * to optimize the join by treating the hash values corresponding to the outer
+ * relation's MCVs specially.  Inner relation tuples matching these hash
+ * values go into the "skew" hashtable instead of the main hashtable, and
+ * outer relation tuples with these hash values are matched against that
+ * table instead of the main one.  Thus, tuples with these hash values are
+ * effectively handled as part of the first batch and will never go to disk.
+ * The skew hashtable is limited to SKEW_WORK_MEM_PERCENT of the total memory
+ * allowed for the join; while building the hashtables, we decrease the number
+ * of MCVs being specially treated if needed to stay under this limit.
+ *
+ * Note: you might wonder why we look at the outer relation stats for this,
+ * rather than the inner.  One reason is that the outer relation is typically
+ * bigger, so we get more I/O savings by optimizing for its most common values.
+ * Also, for similarly-sized relations, the planner prefers to put the more
+ * uniformly distributed relation on the inside, so we're more likely to find
+ * interesting skew in the outer relation.
+ */
+typedef struct HashSkewBucket
+{
+	uint32		hashvalue;		/* common hash value */
+	HashJoinTuple tuples;		/* linked list of inner-relation tuples */
+} HashSkewBucket;
+
+#define SKEW_BUCKET_OVERHEAD  MAXALIGN(sizeof(HashSkewBucket))
+#define INVALID_SKEW_BUCKET_NO	(-1)
+#define SKEW_WORK_MEM_PERCENT  2
+#define SKEW_MIN_OUTER_FRACTION  0.01
+
+/*
+ * To reduce palloc overhead, the HashJoinTuples for the current batch are
+ * packed in 32kB buffers instead of pallocing each tuple individually.
+ */
+typedef struct HashMemoryChunkData
+{
+	int			ntuples;		/* number of tuples stored in this chunk */
+	size_t		maxlen;			/* size of the buffer holding the tuples */
+	size_t		used;			/* number of buffer bytes already used */
+
+	struct HashMemoryChunkData *next;	/* pointer to the next chunk (linked
+										 * list) */
+
+	char		data[FLEXIBLE_ARRAY_MEMBER];	/* buffer allocated at the end */
+}	HashMemoryChunkData;
+
+typedef struct HashMemoryChunkData *HashMemoryChunk;
+
+#define HASH_CHUNK_SIZE			(32 * 1024L)
+#define HASH_CHUNK_THRESHOLD	(HASH_CHUNK_SIZE / 4)
+
+typedef struct HashJoinTableData
+{
+	int			nbuckets;		/* # buckets in the in-memory hash table */
+	int			log2_nbuckets;	/* its log2 (nbuckets must be a power of 2) */
+
+	int			nbuckets_original;		/* # buckets when starting the first
+										 * hash */
+	int			nbuckets_optimal;		/* optimal # buckets (per batch) */
+	int			log2_nbuckets_optimal;	/* log2(nbuckets_optimal) */
+
+	/* buckets[i] is head of list of tuples in i'th in-memory bucket */
+	struct HashJoinTupleData **buckets;
+	/* buckets array is per-batch storage, as are all the tuples */
+
+	bool		keepNulls;		/* true to store unmatchable NULL tuples */
+
+	bool		skewEnabled;	/* are we using skew optimization? */
+	HashSkewBucket **skewBucket;	/* hashtable of skew buckets */
+	int			skewBucketLen;	/* size of skewBucket array (a power of 2!) */
+	int			nSkewBuckets;	/* number of active skew buckets */
+	int		   *skewBucketNums; /* array indexes of active skew buckets */
+
+	int			nbatch;			/* number of batches */
+	int			curbatch;		/* current batch #; 0 during 1st pass */
+
+	int			nbatch_original;	/* nbatch when we started inner scan */
+	int			nbatch_outstart;	/* nbatch when we started outer scan */
+
+	bool		growEnabled;	/* flag to shut off nbatch increases */
+
+	double		totalTuples;	/* # tuples obtained from inner plan */
+	double		skewTuples;		/* # tuples inserted into skew tuples */
+
+	/*
+	 * These arrays are allocated for the life of the hash join, but only if
+	 * nbatch > 1.  A file is opened only when we first write a tuple into it
+	 * (otherwise its pointer remains NULL).  Note that the zero'th array
+	 * elements never get used, since we will process rather than dump out any
+	 * tuples of batch zero.
+	 */
+	BufFile   **innerBatchFile; /* buffered virtual temp file per batch */
+	BufFile   **outerBatchFile; /* buffered virtual temp file per batch */
+
+	/*
+	 * Info about the datatype-specific hash functions for the datatypes being
+	 * hashed. These are arrays of the same length as the number of hash join
+	 * clauses (hash keys).
+	 */
+	FmgrInfo   *outer_hashfunctions;	/* lookup data for hash functions */
+	FmgrInfo   *inner_hashfunctions;	/* lookup data for hash functions */
+	bool	   *hashStrict;		/* is each hash join operator strict? */
+
+	Size		spaceUsed;		/* memory space currently used by tuples */
+	Size		spaceAllowed;	/* upper limit for space used */
+	Size		spacePeak;		/* peak space used */
+	Size		spaceUsedSkew;	/* skew hash table's current space usage */
+	Size		spaceAllowedSkew;		/* upper limit for skew hashtable */
+
+	MemoryContext hashCxt;		/* context for whole-hash-join storage */
+	MemoryContext batchCxt;		/* context for this-batch-only storage */
+
+	/* used for dense allocation of tuples (into linked chunks) */
+	HashMemoryChunk chunks;		/* one list for the whole batch */
+
+	/*
+	 * Parallel-aware hash joins only.  While the shared hash table is in use,
+	 * nbuckets and log2_nbuckets describe it and shared_buckets points to its
+	 * bucket array; after the join has switched to batches, each batch is
+	 * loaded into the ordinary private buckets above, with nbatch = 1.  The
+	 * batch file arrays then have shared_nbatch entries and hold this
+	 * participant's files, which are only open while being written.  Chunk
+	 * positions are offsets from the start of parallel_state.
+	 */
+	struct ParallelHashJoinState *parallel_state;
+	int			participant;	/* our participant number */
+	pg_atomic_uint32 *shared_buckets;	/* shared bucket heads, or NULL */
+	Size		chunk_pos;		/* next free byte in our chunk of the area */
+	Size		chunk_end;		/* end of that chunk */
+	int			shared_nbatch;	/* number of batches, or 0 if not parallel */
+	int			log2_shared_nbatch;
+	int			shared_curbatch;	/* batch being processed, or -1 */
+	int			read_participant;	/* whose outer batch file we're reading */
+	BufFile    *read_file;		/* that file, if open */
+}	HashJoinTableData;
+
+/*
+ * A runtime filter lets an inner, semi or right hash join whose outer input
+ * is a plain relation scan discard outer rows in that scan, before they are
+ * projected and passed up, when no inner tuple can match them.  While the
+ * Hash node builds the table it adds every inner hash value to a Bloom
+ * filter; the scan then computes each row's hash value exactly as
+ * ExecHashGetHashValue would, from the join's outer hash keys rewritten in
+ * terms of the scan tuple, and drops the row if the filter lacks it.
+ *
+ * bloom is NULL, and every row passes, until the table has been built, and
+ * also if the filter turned out to be useless: if it came out saturated, or
+ * if it failed to reject enough of the first RUNTIME_FILTER_TRIAL_ROWS rows
+ * checked.  ntested and nrejected count the rows checked against the current
+ * bloom.
+ */
+typedef struct HashRuntimeFilterData
+{
+	bloom_filter *bloom;		/* filter over inner hash values, or NULL */
+	List	   *hashkeys;		/* outer hash keys, over the scan tuple */
+	FmgrInfo   *hashfunctions;	/* outer-side hash function for each key */
+	bool	   *hashStrict;		/* is each hash join operator strict? */
+	double		ntested;		/* # rows checked against bloom */
+	double		nrejected;		/* # of those rejected */
+}	HashRuntimeFilterData;
+
+#define RUNTIME_FILTER_TRIAL_ROWS	1024
+#define RUNTIME_FILTER_MIN_REJECT	0.05	/* fraction of the trial rows */
+#define RUNTIME_FILTER_MAX_FILL		0.8 /* fraction of bits set */
+
+/*
+ * Shared state for a parallel-aware hash join.  It lives in the parallel
+ * query's DSM segment, and is followed by the shared hash table: an array of
+ * nbuckets bucket heads starting at buckets_offset, and then area_size bytes
+ * of tuple storage starting at area_offset (both offsets counted from the
+ * start of this struct).  Participants claim HASH_CHUNK_SIZE pieces of the
+ * area, fill them with tuples, and push each tuple onto its bucket's list
+ * with a compare-and-swap; no locks are needed while building.  Since the
+ * segment may be mapped at a different address in each process, the lists
+ * are linked by offset rather than by pointer (see HJ_SHARED_TUPLE).
+ *
+ * The area's size is fixed when the join starts.  If it turns out to be too
+ * small, the participant that notices picks a number of batches, and from
+ * then on inner tuples go to batch files in "fileset" instead.  In that case
+ * the tuples already in the area are dumped out to batch files too, the
+ * outer relation is partitioned the same way, and participants then take
+ * whole batches to process one at a time with a private hash table.  If the
+ * planner expected more than one batch, there is no area at all and we go
+ * straight to that scheme.
+ *
+ * The build_barrier coordinates the phases of the build.  Participants that
+ * attach late join in whatever phase is current.
+ */
+typedef struct ParallelHashJoinState
+{
+	int			nparticipants;	/* maximum number of participants */
+	int			nbuckets;		/* # buckets in the shared table, or 0 */
+	int			log2_nbuckets;	/* its log2 */
+	int			batch_nbuckets; /* initial # buckets for a private batch */
+	int			planned_nbatch; /* # batches expected by the planner */
+	Size		area_size;		/* size of the tuple storage area */
+	Size		buckets_offset; /* offset of the bucket array */
+	Size		area_offset;	/* offset of the tuple storage area */
+	dsm_handle	handle;			/* DSM segment we live in */
+
+	slock_t		mutex;			/* protects the following fields */
+	int			nbatch;			/* actual # batches */
+	double		total_tuples;	/* # inner tuples seen by all participants */
+
+	pg_atomic_uint32 space_used;	/* area space claimed, in MAXALIGN units */
+	pg_atomic_uint32 next_bucket;	/* next bucket to dump out */
+	pg_atomic_uint32 next_batch;	/* next batch to process */
+
+	Barrier		build_barrier;	/* synchronizes the phases below */
+	SharedFileSet fileset;		/* space for batch files */
+} ParallelHashJoinState;
+
+/* Phases of build_barrier */
+#define PHJ_BUILD_HASHING_INNER		0
+#define PHJ_BUILD_DUMPING			1
+#define PHJ_BUILD_HASHING_OUTER		2
+#define PHJ_BUILD_RUNNING			3
+
+/*
+ * Convert between shared tuple pointers and the offsets used to link them.
+ * Offsets are counted in MAXIMUM_ALIGNOF units so that they fit in 32 bits;
+ * zero means no tuple.
+ */
+#define HJ_SHARED_TUPLE(pstate, offset) \
+	((offset) == 0 ? (HashJoinTuple) NULL : \
+	 (HashJoinTuple) ((char *) (pstate) + (Size) (offset) * MAXIMUM_ALIGNOF))
+#define HJ_SHARED_OFFSET(pstate, tuple) \
+	((uint32) (((char *) (tuple) - (char *) (pstate)) / MAXIMUM_ALIGNOF))
+
+/* Follow a bucket's list, in either a shared or a private hash table */
+#define HJ_NEXT_TUPLE(hashtable, tuple) \
+	((hashtable)->shared_buckets != NULL ? \
+	 HJ_SHARED_TUPLE((hashtable)->parallel_state, (tuple)->next.shared) : \
+	 (tuple)->next.unshared)
+
+/* Largest area we can address with 32-bit offsets, with room to spare */
+#define HJ_SHARED_MAX_AREA_SIZE \
+	((Size) (PG_UINT32_MAX / 2) * MAXIMUM_ALIGNOF)
+
+#endif   /* HASHJOIN_H */
@@ -0,0 +1,77 @@
+/*-------------------------------------------------------------------------
+ *
+ * nodeHash.h
+ *	  prototypes for nodeHash.c
+ *
+ *
+ * Portions Copyright (c) 1996-2016, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * src/include/executor/nodeHash.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef NODEHASH_H
+#define NODEHASH_H
+
+#include "access/parallel.h"
+#include "nodes/execnodes.h"
+#include "storage/buffile.h"
+
+extern HashState *ExecInitHash(Hash *node, EState *estate, int eflags);
+extern TupleTableSlot *ExecHash(HashState *node);
+extern Node *MultiExecHash(HashState *node);
+extern void ExecEndHash(HashState *node);
+extern void ExecReScanHash(HashState *node);
+
+extern HashJoinTable ExecHashTableCreate(HashState *state, List *hashOperators,
+					bool keepNulls);
+extern void ExecHashTableDestroy(HashJoinTable hashtable);
+extern void ExecHashTableInsert(HashJoinTable hashtable,
+					TupleTableSlot *slot,
+					uint32 hashvalue);
+extern bool ExecHashGetHashValue(HashJoinTable hashtable,
+					 ExprContext *econtext,
+					 List *hashkeys,
+					 bool outer_tuple,
+					 bool keep_nulls,
+					 uint32 *hashvalue);
+extern void ExecHashGetBucketAndBatch(HashJoinTable hashtable,
+						  uint32 hashvalue,
+						  int *bucketno,
+						  int *batchno);
+extern bool ExecScanHashBucket(HashJoinState *hjstate, ExprContext *econtext);
+extern void ExecPrepHashTableForUnmatched(HashJoinState *hjstate);
+extern bool ExecScanHashTableForUnmatched(HashJoinState *hjstate,
+							  ExprContext *econtext);
+extern void ExecHashTableReset(HashJoinTable hashtable);
+extern void ExecHashTableResetMatchFlags(HashJoinTable hashtable);
+extern void ExecHashIncreaseNumBuckets(HashJoinTable hashtable);
+extern void ExecChooseHashTableSize(double ntuples, int tupwidth, bool useskew,
+						int *numbuckets,
+						int *numbatches,
+						int *num_skew_mcvs);
+extern void ExecChooseParallelHashTableSize(double ntuples, int tupwidth,
+								int nparticipants,
+								int *numbuckets,
+								int *numbatches,
+								Size *area_size);
+extern int	ExecHashGetSkewBucket(HashJoinTable hashtable, uint32 hashvalue);
+extern void ExecHashResetRuntimeFilter(HashRuntimeFilter filter);
+extern bool ExecHashRuntimeFilterPass(HashRuntimeFilter filter,
+						  ExprContext *econtext);
+
+/* parallel-aware hash join support */
+extern int	ExecParallelHashGetBatch(HashJoinTable hashtable, uint32 hashvalue);
+extern BufFile **ExecParallelHashGetBatchFile(HashJoinTable hashtable,
+							 bool inner, int batchno);
+extern void ExecParallelHashCloseBatchFiles(HashJoinTable hashtable);
+extern BufFile *ExecParallelHashOpenBatchFile(HashJoinTable hashtable,
+							  bool inner, int batchno, int participant);
+extern void ExecParallelHashDeleteBatch(HashJoinTable hashtable, int batchno);
+extern void ExecHashEstimate(HashState *node, ParallelContext *pcxt);
+extern void ExecHashInitializeDSM(HashState *node, ParallelContext *pcxt);
+extern void ExecHashReInitializeDSM(HashState *node, ParallelContext *pcxt);
+extern void ExecHashInitializeWorker(HashState *node, shm_toc *toc);
+
+#endif   /* NODEHASH_H */
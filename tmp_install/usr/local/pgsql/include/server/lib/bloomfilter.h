@@ -0,0 +1,25 @@
+/*-------------------------------------------------------------------------
+ *
+ * bloomfilter.h
+ *	  Space-efficient set membership testing
+ *
+ * Portions Copyright (c) 2016, PostgreSQL Global Development Group
+ *
+ * IDENTIFICATION
+ *	  src/include/lib/bloomfilter.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef BLOOMFILTER_H
+#define BLOOMFILTER_H
+
+typedef struct bloom_filter bloom_filter;
+
+extern bloom_filter *bloom_create(int64 total_elems, int bloom_work_mem,
+			 uint32 seed);
+extern void bloom_free(bloom_filter *filter);
+extern void bloom_add_hash(bloom_filter *filter, uint32 hash);
+extern bool bloom_lacks_hash(bloom_filter *filter, uint32 hash);
+extern double bloom_prop_bits_set(bloom_filter *filter);
+
+#endif   /* BLOOMFILTER_H */
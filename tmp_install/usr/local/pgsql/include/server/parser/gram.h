@@ -0,0 +1,572 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_BASE_YY_GRAM_H_INCLUDED
+# define YY_BASE_YY_GRAM_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int base_yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    IDENT = 258,                   /* IDENT  */
+    FCONST = 259,                  /* FCONST  */
+    SCONST = 260,                  /* SCONST  */
+    BCONST = 261,                  /* BCONST  */
+    XCONST = 262,                  /* XCONST  */
+    Op = 263,                      /* Op  */
+    ICONST = 264,                  /* ICONST  */
+    PARAM = 265,                   /* PARAM  */
+    TYPECAST = 266,                /* TYPECAST  */
+    DOT_DOT = 267,                 /* DOT_DOT  */
+    COLON_EQUALS = 268,            /* COLON_EQUALS  */
+    EQUALS_GREATER = 269,          /* EQUALS_GREATER  */
+    LESS_EQUALS = 270,             /* LESS_EQUALS  */
+    GREATER_EQUALS = 271,          /* GREATER_EQUALS  */
+    NOT_EQUALS = 272,              /* NOT_EQUALS  */
+    ABORT_P = 273,                 /* ABORT_P  */
+    ABSOLUTE_P = 274,              /* ABSOLUTE_P  */
+    ACCESS = 275,                  /* ACCESS  */
+    ACTION = 276,                  /* ACTION  */
+    ADD_P = 277,                   /* ADD_P  */
+    ADMIN = 278,                   /* ADMIN  */
+    AFTER = 279,                   /* AFTER  */
+    AGGREGATE = 280,               /* AGGREGATE  */
+    ALL = 281,                     /* ALL  */
+    ALSO = 282,                    /* ALSO  */
+    ALTER = 283,                   /* ALTER  */
+    ALWAYS = 284,                  /* ALWAYS  */
+    ANALYSE = 285,                 /* ANALYSE  */
+    ANALYZE = 286,                 /* ANALYZE  */
+    AND = 287,                     /* AND  */
+    ANY = 288,                     /* ANY  */
+    ARRAY = 289,                   /* ARRAY  */
+    AS = 290,                      /* AS  */
+    ASC = 291,                     /* ASC  */
+    ASSERTION = 292,               /* ASSERTION  */
+    ASSIGNMENT = 293,              /* ASSIGNMENT  */
+    ASYMMETRIC = 294,              /* ASYMMETRIC  */
+    AT = 295,                      /* AT  */
+    ATTRIBUTE = 296,               /* ATTRIBUTE  */
+    AUTHORIZATION = 297,           /* AUTHORIZATION  */
+    BACKWARD = 298,                /* BACKWARD  */
+    BEFORE = 299,                  /* BEFORE  */
+    BEGIN_P = 300,                 /* BEGIN_P  */
+    BETWEEN = 301,                 /* BETWEEN  */
+    BIGINT = 302,                  /* BIGINT  */
+    BINARY = 303,                  /* BINARY  */
+    BIT = 304,                     /* BIT  */
+    BOOLEAN_P = 305,               /* BOOLEAN_P  */
+    BOTH = 306,                    /* BOTH  */
+    BY = 307,                      /* BY  */
+    CACHE = 308,                   /* CACHE  */
+    CALLED = 309,                  /* CALLED  */
+    CASCADE = 310,                 /* CASCADE  */
+    CASCADED = 311,                /* CASCADED  */
+    CASE = 312,                    /* CASE  */
+    CAST = 313,                    /* CAST  */
+    CATALOG_P = 314,               /* CATALOG_P  */
+    CHAIN = 315,                   /* CHAIN  */
+    CHAR_P = 316,                  /* CHAR_P  */
+    CHARACTER = 317,               /* CHARACTER  */
+    CHARACTERISTICS = 318,         /* CHARACTERISTICS  */
+    CHECK = 319,                   /* CHECK  */
+    CHECKPOINT = 320,              /* CHECKPOINT  */
+    CLASS = 321,                   /* CLASS  */
+    CLOSE = 322,                   /* CLOSE  */
+    CLUSTER = 323,                 /* CLUSTER  */
+    COALESCE = 324,                /* COALESCE  */
+    COLLATE = 325,                 /* COLLATE  */
+    COLLATION = 326,               /* COLLATION  */
+    COLUMN = 327,                  /* COLUMN  */
+    COMMENT = 328,                 /* COMMENT  */
+    COMMENTS = 329,                /* COMMENTS  */
+    COMMIT = 330,                  /* COMMIT  */
+    COMMITTED = 331,               /* COMMITTED  */
+    CONCURRENTLY = 332,            /* CONCURRENTLY  */
+    CONFIGURATION = 333,           /* CONFIGURATION  */
+    CONFLICT = 334,                /* CONFLICT  */
+    CONNECTION = 335,              /* CONNECTION  */
+    CONSTRAINT = 336,              /* CONSTRAINT  */
+    CONSTRAINTS = 337,             /* CONSTRAINTS  */
+    CONTENT_P = 338,               /* CONTENT_P  */
+    CONTINUE_P = 339,              /* CONTINUE_P  */
+    CONVERSION_P = 340,            /* CONVERSION_P  */
+    COPY = 341,                    /* COPY  */
+    COST = 342,                    /* COST  */
+    CREATE = 343,                  /* CREATE  */
+    CROSS = 344,                   /* CROSS  */
+    CSV = 345,                     /* CSV  */
+    CUBE = 346,                    /* CUBE  */
+    CURRENT_P = 347,               /* CURRENT_P  */
+    CURRENT_CATALOG = 348,         /* CURRENT_CATALOG  */
+    CURRENT_DATE = 349,            /* CURRENT_DATE  */
+    CURRENT_ROLE = 350,            /* CURRENT_ROLE  */
+    CURRENT_SCHEMA = 351,          /* CURRENT_SCHEMA  */
+    CURRENT_TIME = 352,            /* CURRENT_TIME  */
+    CURRENT_TIMESTAMP = 353,       /* CURRENT_TIMESTAMP  */
+    CURRENT_USER = 354,            /* CURRENT_USER  */
+    CURSOR = 355,                  /* CURSOR  */
+    CYCLE = 356,                   /* CYCLE  */
+    DATA_P = 357,                  /* DATA_P  */
+    DATABASE = 358,                /* DATABASE  */
+    DAY_P = 359,                   /* DAY_P  */
+    DEALLOCATE = 360,              /* DEALLOCATE  */
+    DEC = 361,                     /* DEC  */
+    DECIMAL_P = 362,               /* DECIMAL_P  */
+    DECLARE = 363,                 /* DECLARE  */
+    DEFAULT = 364,                 /* DEFAULT  */
+    DEFAULTS = 365,                /* DEFAULTS  */
+    DEFERRABLE = 366,              /* DEFERRABLE  */
+    DEFERRED = 367,                /* DEFERRED  */
+    DEFINER = 368,                 /* DEFINER  */
+    DELETE_P = 369,                /* DELETE_P  */
+    DELIMITER = 370,               /* DELIMITER  */
+    DELIMITERS = 371,              /* DELIMITERS  */
+    DEPENDS = 372,                 /* DEPENDS  */
+    DESC = 373,                    /* DESC  */
+    DICTIONARY = 374,              /* DICTIONARY  */
+    DISABLE_P = 375,               /* DISABLE_P  */
+    DISCARD = 376,                 /* DISCARD  */
+    DISTINCT = 377,                /* DISTINCT  */
+    DO = 378,                      /* DO  */
+    DOCUMENT_P = 379,              /* DOCUMENT_P  */
+    DOMAIN_P = 380,                /* DOMAIN_P  */
+    DOUBLE_P = 381,                /* DOUBLE_P  */
+    DROP = 382,                    /* DROP  */
+    EACH = 383,                    /* EACH  */
+    ELSE = 384,                    /* ELSE  */
+    ENABLE_P = 385,                /* ENABLE_P  */
+    ENCODING = 386,                /* ENCODING  */
+    ENCRYPTED = 387,               /* ENCRYPTED  */
+    END_P = 388,                   /* END_P  */
+    ENUM_P = 389,                  /* ENUM_P  */
+    ESCAPE = 390,                  /* ESCAPE  */
+    EVENT = 391,                   /* EVENT  */
+    EXCEPT = 392,                  /* EXCEPT  */
+    EXCLUDE = 393,                 /* EXCLUDE  */
+    EXCLUDING = 394,               /* EXCLUDING  */
+    EXCLUSIVE = 395,               /* EXCLUSIVE  */
+    EXECUTE = 396,                 /* EXECUTE  */
+    EXISTS = 397,                  /* EXISTS  */
+    EXPLAIN = 398,                 /* EXPLAIN  */
+    EXTENSION = 399,               /* EXTENSION  */
+    EXTERNAL = 400,                /* EXTERNAL  */
+    EXTRACT = 401,                 /* EXTRACT  */
+    FALSE_P = 402,                 /* FALSE_P  */
+    FAMILY = 403,                  /* FAMILY  */
+    FETCH = 404,                   /* FETCH  */
+    FILTER = 405,                  /* FILTER  */
+    FIRST_P = 406,                 /* FIRST_P  */
+    FLOAT_P = 407,                 /* FLOAT_P  */
+    FOLLOWING = 408,               /* FOLLOWING  */
+    FOR = 409,                     /* FOR  */
+    FORCE = 410,                   /* FORCE  */
+    FOREIGN = 411,                 /* FOREIGN  */
+    FORWARD = 412,                 /* FORWARD  */
+    FREEZE = 413,                  /* FREEZE  */
+    FROM = 414,                    /* FROM  */
+    FULL = 415,                    /* FULL  */
+    FUNCTION = 416,                /* FUNCTION  */
+    FUNCTIONS = 417,               /* FUNCTIONS  */
+    GLOBAL = 418,                  /* GLOBAL  */
+    GRANT = 419,                   /* GRANT  */
+    GRANTED = 420,                 /* GRANTED  */
+    GREATEST = 421,                /* GREATEST  */
+    GROUP_P = 422,                 /* GROUP_P  */
+    GROUPING = 423,                /* GROUPING  */
+    HANDLER = 424,                 /* HANDLER  */
+    HAVING = 425,                  /* HAVING  */
+    HEADER_P = 426,                /* HEADER_P  */
+    HOLD = 427,                    /* HOLD  */
+    HOUR_P = 428,                  /* HOUR_P  */
+    IDENTITY_P = 429,              /* IDENTITY_P  */
+    IF_P = 430,                    /* IF_P  */
+    ILIKE = 431,                   /* ILIKE  */
+    IMMEDIATE = 432,               /* IMMEDIATE  */
+    IMMUTABLE = 433,               /* IMMUTABLE  */
+    IMPLICIT_P = 434,              /* IMPLICIT_P  */
+    IMPORT_P = 435,                /* IMPORT_P  */
+    IN_P = 436,                    /* IN_P  */
+    INCLUDING = 437,               /* INCLUDING  */
+    INCREMENT = 438,               /* INCREMENT  */
+    INDEX = 439,                   /* INDEX  */
+    INDEXES = 440,                 /* INDEXES  */
+    INHERIT = 441,                 /* INHERIT  */
+    INHERITS = 442,                /* INHERITS  */
+    INITIALLY = 443,               /* INITIALLY  */
+    INLINE_P = 444,                /* INLINE_P  */
+    INNER_P = 445,                 /* INNER_P  */
+    INOUT = 446,                   /* INOUT  */
+    INPUT_P = 447,                 /* INPUT_P  */
+    INSENSITIVE = 448,             /* INSENSITIVE  */
+    INSERT = 449,                  /* INSERT  */
+    INSTEAD = 450,                 /* INSTEAD  */
+    INT_P = 451,                   /* INT_P  */
+    INTEGER = 452,                 /* INTEGER  */
+    INTERSECT = 453,               /* INTERSECT  */
+    INTERVAL = 454,                /* INTERVAL  */
+    INTO = 455,                    /* INTO  */
+    INVOKER = 456,                 /* INVOKER  */
+    IS = 457,                      /* IS  */
+    ISNULL = 458,                  /* ISNULL  */
+    ISOLATION = 459,               /* ISOLATION  */
+    JOIN = 460,                    /* JOIN  */
+    KEY = 461,                     /* KEY  */
+    LABEL = 462,                   /* LABEL  */
+    LANGUAGE = 463,                /* LANGUAGE  */
+    LARGE_P = 464,                 /* LARGE_P  */
+    LAST_P = 465,                  /* LAST_P  */
+    LATERAL_P = 466,               /* LATERAL_P  */
+    LEADING = 467,                 /* LEADING  */
+    LEAKPROOF = 468,               /* LEAKPROOF  */
+    LEAST = 469,                   /* LEAST  */
+    LEFT = 470,                    /* LEFT  */
+    LEVEL = 471,                   /* LEVEL  */
+    LIKE = 472,                    /* LIKE  */
+    LIMIT = 473,                   /* LIMIT  */
+    LISTEN = 474,                  /* LISTEN  */
+    LOAD = 475,                    /* LOAD  */
+    LOCAL = 476,                   /* LOCAL  */
+    LOCALTIME = 477,               /* LOCALTIME  */
+    LOCALTIMESTAMP = 478,          /* LOCALTIMESTAMP  */
+    LOCATION = 479,                /* LOCATION  */
+    LOCK_P = 480,                  /* LOCK_P  */
+    LOCKED = 481,                  /* LOCKED  */
+    LOGGED = 482,                  /* LOGGED  */
+    MAPPING = 483,                 /* MAPPING  */
+    MATCH = 484,                   /* MATCH  */
+    MATERIALIZED = 485,            /* MATERIALIZED  */
+    MAXVALUE = 486,                /* MAXVALUE  */
+    METHOD = 487,                  /* METHOD  */
+    MINUTE_P = 488,                /* MINUTE_P  */
+    MINVALUE = 489,                /* MINVALUE  */
+    MODE = 490,                    /* MODE  */
+    MONTH_P = 491,                 /* MONTH_P  */
+    MOVE = 492,                    /* MOVE  */
+    NAME_P = 493,                  /* NAME_P  */
+    NAMES = 494,                   /* NAMES  */
+    NATIONAL = 495,                /* NATIONAL  */
+    NATURAL = 496,                 /* NATURAL  */
+    NCHAR = 497,                   /* NCHAR  */
+    NEXT = 498,                    /* NEXT  */
+    NO = 499,                      /* NO  */
+    NONE = 500,                    /* NONE  */
+    NOT = 501,                     /* NOT  */
+    NOTHING = 502,                 /* NOTHING  */
+    NOTIFY = 503,                  /* NOTIFY  */
+    NOTNULL = 504,                 /* NOTNULL  */
+    NOWAIT = 505,                  /* NOWAIT  */
+    NULL_P = 506,                  /* NULL_P  */
+    NULLIF = 507,                  /* NULLIF  */
+    NULLS_P = 508,                 /* NULLS_P  */
+    NUMERIC = 509,                 /* NUMERIC  */
+    OBJECT_P = 510,                /* OBJECT_P  */
+    OF = 511,                      /* OF  */
+    OFF = 512,                     /* OFF  */
+    OFFSET = 513,                  /* OFFSET  */
+    OIDS = 514,                    /* OIDS  */
+    ON = 515,                      /* ON  */
+    ONLY = 516,                    /* ONLY  */
+    OPERATOR = 517,                /* OPERATOR  */
+    OPTION = 518,                  /* OPTION  */
+    OPTIONS = 519,                 /* OPTIONS  */
+    OR = 520,                      /* OR  */
+    ORDER = 521,                   /* ORDER  */
+    ORDINALITY = 522,              /* ORDINALITY  */
+    OUT_P = 523,                   /* OUT_P  */
+    OUTER_P = 524,                 /* OUTER_P  */
+    OVER = 525,                    /* OVER  */
+    OVERLAPS = 526,                /* OVERLAPS  */
+    OVERLAY = 527,                 /* OVERLAY  */
+    OWNED = 528,                   /* OWNED  */
+    OWNER = 529,                   /* OWNER  */
+    PARALLEL = 530,                /* PARALLEL  */
+    PARSER = 531,                  /* PARSER  */
+    PARTIAL = 532,                 /* PARTIAL  */
+    PARTITION = 533,               /* PARTITION  */
+    PASSING = 534,                 /* PASSING  */
+    PASSWORD = 535,                /* PASSWORD  */
+    PLACING = 536,                 /* PLACING  */
+    PLANS = 537,                   /* PLANS  */
+    POLICY = 538,                  /* POLICY  */
+    POSITION = 539,                /* POSITION  */
+    PRECEDING = 540,               /* PRECEDING  */
+    PRECISION = 541,               /* PRECISION  */
+    PRESERVE = 542,                /* PRESERVE  */
+    PREPARE = 543,                 /* PREPARE  */
+    PREPARED = 544,                /* PREPARED  */
+    PRIMARY = 545,                 /* PRIMARY  */
+    PRIOR = 546,                   /* PRIOR  */
+    PRIVILEGES = 547,              /* PRIVILEGES  */
+    PROCEDURAL = 548,              /* PROCEDURAL  */
+    PROCEDURE = 549,               /* PROCEDURE  */
+    PROGRAM = 550,                 /* PROGRAM  */
+    QUOTE = 551,                   /* QUOTE  */
+    RANGE = 552,                   /* RANGE  */
+    READ = 553,                    /* READ  */
+    REAL = 554,                    /* REAL  */
+    REASSIGN = 555,                /* REASSIGN  */
+    RECHECK = 556,                 /* RECHECK  */
+    RECURSIVE = 557,               /* RECURSIVE  */
+    REF = 558,                     /* REF  */
+    REFERENCES = 559,              /* REFERENCES  */
+    REFRESH = 560,                 /* REFRESH  */
+    REINDEX = 561,                 /* REINDEX  */
+    RELATIVE_P = 562,              /* RELATIVE_P  */
+    RELEASE = 563,                 /* RELEASE  */
+    RENAME = 564,                  /* RENAME  */
+    REPEATABLE = 565,              /* REPEATABLE  */
+    REPLACE = 566,                 /* REPLACE  */
+    REPLICA = 567,                 /* REPLICA  */
+    RESET = 568,                   /* RESET  */
+    RESTART = 569,                 /* RESTART  */
+    RESTRICT = 570,                /* RESTRICT  */
+    RETURNING = 571,               /* RETURNING  */
+    RETURNS = 572,                 /* RETURNS  */
+    REVOKE = 573,                  /* REVOKE  */
+    RIGHT = 574,                   /* RIGHT  */
+    ROLE = 575,                    /* ROLE  */
+    ROLLBACK = 576,                /* ROLLBACK  */
+    ROLLUP = 577,                  /* ROLLUP  */
+    ROW = 578,                     /* ROW  */
+    ROWS = 579,                    /* ROWS  */
+    RULE = 580,                    /* RULE  */
+    SAVEPOINT = 581,               /* SAVEPOINT  */
+    SCHEMA = 582,                  /* SCHEMA  */
+    SCROLL = 583,                  /* SCROLL  */
+    SEARCH = 584,                  /* SEARCH  */
+    SECOND_P = 585,                /* SECOND_P  */
+    SECURITY = 586,                /* SECURITY  */
+    SELECT = 587,                  /* SELECT  */
+    SEQUENCE = 588,                /* SEQUENCE  */
+    SEQUENCES = 589,               /* SEQUENCES  */
+    SERIALIZABLE = 590,            /* SERIALIZABLE  */
+    SERVER = 591,                  /* SERVER  */
+    SESSION = 592,                 /* SESSION  */
+    SESSION_USER = 593,            /* SESSION_USER  */
+    SET = 594,                     /* SET  */
+    SETS = 595,                    /* SETS  */
+    SETOF = 596,                   /* SETOF  */
+    SHARE = 597,                   /* SHARE  */
+    SHOW = 598,                    /* SHOW  */
+    SIMILAR = 599,                 /* SIMILAR  */
+    SIMPLE = 600,                  /* SIMPLE  */
+    SKIP = 601,                    /* SKIP  */
+    SMALLINT = 602,                /* SMALLINT  */
+    SNAPSHOT = 603,                /* SNAPSHOT  */
+    SOME = 604,                    /* SOME  */
+    SQL_P = 605,                   /* SQL_P  */
+    STABLE = 606,                  /* STABLE  */
+    STANDALONE_P = 607,            /* STANDALONE_P  */
+    START = 608,                   /* START  */
+    STATEMENT = 609,               /* STATEMENT  */
+    STATISTICS = 610,              /* STATISTICS  */
+    STDIN = 611,                   /* STDIN  */
+    STDOUT = 612,                  /* STDOUT  */
+    STORAGE = 613,                 /* STORAGE  */
+    STRICT_P = 614,                /* STRICT_P  */
+    STRIP_P = 615,                 /* STRIP_P  */
+    SUBSTRING = 616,               /* SUBSTRING  */
+    SYMMETRIC = 617,               /* SYMMETRIC  */
+    SYSID = 618,                   /* SYSID  */
+    SYSTEM_P = 619,                /* SYSTEM_P  */
+    TABLE = 620,                   /* TABLE  */
+    TABLES = 621,                  /* TABLES  */
+    TABLESAMPLE = 622,             /* TABLESAMPLE  */
+    TABLESPACE = 623,              /* TABLESPACE  */
+    TEMP = 624,                    /* TEMP  */
+    TEMPLATE = 625,                /* TEMPLATE  */
+    TEMPORARY = 626,               /* TEMPORARY  */
+    TEXT_P = 627,                  /* TEXT_P  */
+    THEN = 628,                    /* THEN  */
+    TIME = 629,                    /* TIME  */
+    TIMESTAMP = 630,               /* TIMESTAMP  */
+    TO = 631,                      /* TO  */
+    TRAILING = 632,                /* TRAILING  */
+    TRANSACTION = 633,             /* TRANSACTION  */
+    TRANSFORM = 634,               /* TRANSFORM  */
+    TREAT = 635,                   /* TREAT  */
+    TRIGGER = 636,                 /* TRIGGER  */
+    TRIM = 637,                    /* TRIM  */
+    TRUE_P = 638,                  /* TRUE_P  */
+    TRUNCATE = 639,                /* TRUNCATE  */
+    TRUSTED = 640,                 /* TRUSTED  */
+    TYPE_P = 641,                  /* TYPE_P  */
+    TYPES_P = 642,                 /* TYPES_P  */
+    UNBOUNDED = 643,               /* UNBOUNDED  */
+    UNCOMMITTED = 644,             /* UNCOMMITTED  */
+    UNENCRYPTED = 645,             /* UNENCRYPTED  */
+    UNION = 646,                   /* UNION  */
+    UNIQUE = 647,                  /* UNIQUE  */
+    UNKNOWN = 648,                 /* UNKNOWN  */
+    UNLISTEN = 649,                /* UNLISTEN  */
+    UNLOGGED = 650,                /* UNLOGGED  */
+    UNTIL = 651,                   /* UNTIL  */
+    UPDATE = 652,                  /* UPDATE  */
+    USER = 653,                    /* USER  */
+    USING = 654,                   /* USING  */
+    VACUUM = 655,                  /* VACUUM  */
+    VALID = 656,                   /* VALID  */
+    VALIDATE = 657,                /* VALIDATE  */
+    VALIDATOR = 658,               /* VALIDATOR  */
+    VALUE_P = 659,                 /* VALUE_P  */
+    VALUES = 660,                  /* VALUES  */
+    VARCHAR = 661,                 /* VARCHAR  */
+    VARIADIC = 662,                /* VARIADIC  */
+    VARYING = 663,                 /* VARYING  */
+    VERBOSE = 664,                 /* VERBOSE  */
+    VERSION_P = 665,               /* VERSION_P  */
+    VIEW = 666,                    /* VIEW  */
+    VIEWS = 667,                   /* VIEWS  */
+    VOLATILE = 668,                /* VOLATILE  */
+    WHEN = 669,                    /* WHEN  */
+    WHERE = 670,                   /* WHERE  */
+    WHITESPACE_P = 671,            /* WHITESPACE_P  */
+    WINDOW = 672,                  /* WINDOW  */
+    WITH = 673,                    /* WITH  */
+    WITHIN = 674,                  /* WITHIN  */
+    WITHOUT = 675,                 /* WITHOUT  */
+    WORK = 676,                    /* WORK  */
+    WRAPPER = 677,                 /* WRAPPER  */
+    WRITE = 678,                   /* WRITE  */
+    XML_P = 679,                   /* XML_P  */
+    XMLATTRIBUTES = 680,           /* XMLATTRIBUTES  */
+    XMLCONCAT = 681,               /* XMLCONCAT  */
+    XMLELEMENT = 682,              /* XMLELEMENT  */
+    XMLEXISTS = 683,               /* XMLEXISTS  */
+    XMLFOREST = 684,               /* XMLFOREST  */
+    XMLPARSE = 685,                /* XMLPARSE  */
+    XMLPI = 686,                   /* XMLPI  */
+    XMLROOT = 687,                 /* XMLROOT  */
+    XMLSERIALIZE = 688,            /* XMLSERIALIZE  */
+    YEAR_P = 689,                  /* YEAR_P  */
+    YES_P = 690,                   /* YES_P  */
+    ZONE = 691,                    /* ZONE  */
+    NOT_LA = 692,                  /* NOT_LA  */
+    NULLS_LA = 693,                /* NULLS_LA  */
+    WITH_LA = 694,                 /* WITH_LA  */
+    POSTFIXOP = 695,               /* POSTFIXOP  */
+    UMINUS = 696                   /* UMINUS  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 192 "gram.y"
+
+	core_YYSTYPE		core_yystype;
+	/* these fields must match core_YYSTYPE: */
+	int					ival;
+	char				*str;
+	const char			*keyword;
+
+	char				chr;
+	bool				boolean;
+	JoinType			jtype;
+	DropBehavior		dbehavior;
+	OnCommitAction		oncommit;
+	List				*list;
+	Node				*node;
+	Value				*value;
+	ObjectType			objtype;
+	TypeName			*typnam;
+	FunctionParameter   *fun_param;
+	FunctionParameterMode fun_param_mode;
+	FuncWithArgs		*funwithargs;
+	DefElem				*defelt;
+	SortBy				*sortby;
+	WindowDef			*windef;
+	JoinExpr			*jexpr;
+	IndexElem			*ielem;
+	Alias				*alias;
+	RangeVar			*range;
+	IntoClause			*into;
+	WithClause			*with;
+	InferClause			*infer;
+	OnConflictClause	*onconflict;
+	A_Indices			*aind;
+	ResTarget			*target;
+	struct PrivTarget	*privtarget;
+	AccessPriv			*accesspriv;
+	struct ImportQual	*importqual;
+	InsertStmt			*istmt;
+	VariableSetStmt		*vsetstmt;
+
+#line 545 "gram.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+/* Location type.  */
+#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
+{
+  int first_line;
+  int first_column;
+  int last_line;
+  int last_column;
+};
+# define YYLTYPE_IS_DECLARED 1
+# define YYLTYPE_IS_TRIVIAL 1
+#endif
+
+
+
+
+int base_yyparse (core_yyscan_t yyscanner);
+
+
+#endif /* !YY_BASE_YY_GRAM_H_INCLUDED  */